@@ -0,0 +1,41 @@
+/**
+ * Worker thread script that compiles and runs the programs of the batch command of cmd.js.
+ * Runs one job at a time, posting back the result of each job it is sent.
+ * If the batch is run with a cache directory (given in workerData), compilations are cached there, and so shared with
+ * the other workers and later runs of the batch.
+ */
+import fsPromises from "node:fs/promises";
+import { parentPort, workerData } from "node:worker_threads";
+import {
+  CompilationCache,
+  DirectoryCompilationCacheStore,
+  runBatchJob,
+} from "./dist/index.js";
+
+const compilationCache = workerData?.cacheDir
+  ? new CompilationCache({
+      store: new DirectoryCompilationCacheStore(
+        fsPromises,
+        workerData.cacheDir,
+      ),
+      compilerFingerprint: workerData.compilerFingerprint,
+    })
+  : undefined;
+
+parentPort.on("message", async ({ job }) => {
+  try {
+    parentPort.postMessage({
+      result: await runBatchJob(job, compilationCache),
+    });
+  } catch (e) {
+    parentPort.postMessage({
+      result: {
+        file: job.file,
+        status: "failure",
+        compileTimeMs: 0,
+        errorMessage: e instanceof Error ? e.message : String(e),
+        testCases: [],
+      },
+    });
+  }
+});
@@ -0,0 +1,252 @@
+/**
+ * Measures how the parsers backtrack, which decides the rules memoised by the selective build (see
+ * src/parser/peggyjs/restrictMemoization.js).
+ *
+ * For each rule of each grammar, reports the number of times it was tried, and its hit rate: the percentage of tries at
+ * a position it was already tried at, which memoisation answers from the cache. Rules with hits that the selective
+ * build does not memoise are flagged, as that build evaluates them again. Also reports the number of results memoised
+ * (the rule and position pairs tried) with every rule memoised and in the selective build, on the corpus and on a
+ * generated program of the given number of lines.
+ *
+ * Usage: yarn parser-rule-hits [--corpus <directory>]... [--lines <n>] [-o <results file>]
+ * which builds the compiler with parsers generated with tracing ("peggy --trace"), whose events are given to
+ * generate_C_AST. Run "yarn build" afterwards to build the untraced parsers again.
+ * The corpus defaults to bench/programs and test/samples. Programs that fail to parse are skipped.
+ */
+import { generate_C_AST } from "../dist/index.js";
+import { MEMOISED_RULES } from "../src/parser/peggyjs/restrictMemoization.js";
+import yargs from "yargs";
+import { hideBin } from "yargs/helpers";
+import * as fs from "fs";
+import * as path from "node:path";
+import { dirname } from "path";
+import { fileURLToPath } from "url";
+
+const __dirname = dirname(fileURLToPath(import.meta.url));
+const GRAMMARS = ["preprocessor", "lexer", "parser"];
+
+const argv = yargs(hideBin(process.argv))
+  .usage("Usage: $0 [args]")
+  .options({
+    corpus: {
+      type: "array",
+      default: [
+        path.resolve(__dirname, "programs"),
+        path.resolve(__dirname, "../test/samples"),
+      ],
+      describe: "Directories of C programs to measure",
+    },
+    lines: {
+      type: "number",
+      default: 5000,
+      describe: "Approximate number of lines of the generated large program",
+    },
+    o: {
+      type: "string",
+      alias: "out",
+      default: path.resolve(__dirname, "results/parser-rule-hits.json"),
+      describe: "The file to write the results to",
+    },
+  }).argv;
+
+/**
+ * Creates a tracer that counts, for each rule, the number of tries, and the number of tries at a position the rule was
+ * already tried at. The positions tried are the results that memoisation of the rule keeps.
+ */
+function createRuleHitTracer(ruleHits) {
+  return {
+    trace(event) {
+      if (event.type !== "rule.enter") {
+        return;
+      }
+      const hits = (ruleHits[event.rule] ??= {
+        tries: 0,
+        hits: 0,
+        positions: new Set(),
+      });
+      ++hits.tries;
+      if (hits.positions.has(event.location.start.offset)) {
+        ++hits.hits;
+      } else {
+        hits.positions.add(event.location.start.offset);
+      }
+    },
+  };
+}
+
+/**
+ * Parses the given program, returning the hits of the rules of each grammar, or undefined if it fails to parse.
+ */
+function measureRuleHits(sourceCode) {
+  const ruleHits = { preprocessor: {}, lexer: {}, parser: {} };
+  try {
+    generate_C_AST(sourceCode, {
+      preprocessor: createRuleHitTracer(ruleHits.preprocessor),
+      lexer: createRuleHitTracer(ruleHits.lexer),
+      parser: createRuleHitTracer(ruleHits.parser),
+    });
+  } catch (e) {
+    return undefined;
+  }
+  return ruleHits;
+}
+
+/**
+ * Returns the number of results memoised with every rule memoised, and with only the rules of the selective build.
+ */
+function countMemoisedResults(ruleHits) {
+  let full = 0;
+  let selective = 0;
+  for (const grammar of GRAMMARS) {
+    for (const [rule, { positions }] of Object.entries(ruleHits[grammar])) {
+      full += positions.size;
+      if (MEMOISED_RULES[grammar].includes(rule)) {
+        selective += positions.size;
+      }
+    }
+  }
+  return { full, selective };
+}
+
+/**
+ * Generates a program of about the given number of lines, of functions with declarations, expressions and control flow.
+ */
+function generateLargeProgram(numberOfLines) {
+  const functions = [];
+  for (let i = 0; i < numberOfLines / 10; ++i) {
+    functions.push(`struct s${i} { int a; int *b[4]; };
+int f${i}(int x, int y) {
+  struct s${i} v;
+  int arr[8];
+  for (int j = 0; j < 8; j++) { arr[j] = (x * j + y) % 7 - (j << 1); }
+  v.a = arr[x % 8] + ${i > 0 ? `f${i - 1}(x - 1, y)` : "y"};
+  if (x > 3 && y < 10 || !(x == y)) { v.a += x ? y : -y; } else { v.a -= sizeof(int) * 2; }
+  while (v.a > 100) v.a /= 2;
+  return v.a;
+}`);
+  }
+  return `#include <source_stdlib>\n${functions.join("\n")}\nint main() { print_int(f0(3, 4)); }\n`;
+}
+
+function findCProgramFiles(directory) {
+  const files = [];
+  for (const entry of fs.readdirSync(directory, { withFileTypes: true })) {
+    const entryPath = path.resolve(directory, entry.name);
+    if (entry.isDirectory()) {
+      files.push(...findCProgramFiles(entryPath));
+    } else if (entry.name.endsWith(".c")) {
+      files.push(entryPath);
+    }
+  }
+  return files.sort();
+}
+
+// rule hits over the whole corpus
+const ruleHits = { preprocessor: {}, lexer: {}, parser: {} };
+const corpusMemoisedResults = { full: 0, selective: 0 };
+let corpusSize = 0;
+for (const directory of argv.corpus) {
+  for (const file of findCProgramFiles(path.resolve(directory))) {
+    const programRuleHits = measureRuleHits(fs.readFileSync(file, "utf-8"));
+    if (typeof programRuleHits === "undefined") {
+      console.error(`Skipping ${file}, which does not parse`);
+      continue;
+    }
+    for (const grammar of GRAMMARS) {
+      for (const [rule, { tries, hits }] of Object.entries(
+        programRuleHits[grammar],
+      )) {
+        const totalHits = (ruleHits[grammar][rule] ??= { tries: 0, hits: 0 });
+        totalHits.tries += tries;
+        totalHits.hits += hits;
+      }
+    }
+    const { full, selective } = countMemoisedResults(programRuleHits);
+    corpusMemoisedResults.full += full;
+    corpusMemoisedResults.selective += selective;
+    ++corpusSize;
+  }
+}
+if (Object.keys(ruleHits.parser).length === 0) {
+  throw new Error(
+    'The parsers reported no events, they must be generated with tracing (run "yarn parser-rule-hits")',
+  );
+}
+
+const largeProgramRuleHits = measureRuleHits(generateLargeProgram(argv.lines));
+if (typeof largeProgramRuleHits === "undefined") {
+  throw new Error("The generated large program does not parse");
+}
+
+const results = {
+  date: new Date().toISOString(),
+  nodeVersion: process.version,
+  corpusSize,
+  ruleHits: {},
+  memoisedResults: {
+    corpus: corpusMemoisedResults,
+    largeProgram: {
+      lines: argv.lines,
+      ...countMemoisedResults(largeProgramRuleHits),
+    },
+  },
+  // rules tried again on the large program, which the selective build evaluates again
+  largeProgramHitsNotMemoised: [],
+};
+for (const grammar of GRAMMARS) {
+  const entries = Object.entries(ruleHits[grammar])
+    .map(([rule, { tries, hits }]) => ({
+      rule,
+      tries,
+      hits,
+      hitRate: tries > 0 ? (hits / tries) * 100 : 0,
+      memoised: MEMOISED_RULES[grammar].includes(rule),
+    }))
+    .sort((a, b) => b.hits - a.hits);
+  results.ruleHits[grammar] = entries;
+  console.log(`\n${grammar} rules, by number of hits:`);
+  console.table(
+    entries.map(({ rule, tries, hits, hitRate, memoised }) => ({
+      rule,
+      tries,
+      hits,
+      "hit rate %": hitRate.toFixed(1),
+      "memoised (selective build)": memoised,
+    })),
+  );
+  const notMemoised = entries.filter(
+    ({ hits, memoised }) => hits > 0 && !memoised,
+  );
+  if (notMemoised.length > 0) {
+    console.log(
+      `Rules with hits that the selective build does not memoise: ${notMemoised
+        .map(({ rule }) => rule)
+        .join(", ")}`,
+    );
+  }
+  for (const [rule, { hits }] of Object.entries(
+    largeProgramRuleHits[grammar],
+  )) {
+    if (hits > 0 && !MEMOISED_RULES[grammar].includes(rule)) {
+      results.largeProgramHitsNotMemoised.push(`${grammar}.${rule}`);
+    }
+  }
+}
+
+console.log("\nMemoised results (rule and position pairs):");
+console.table({
+  [`corpus (${corpusSize} programs)`]: corpusMemoisedResults,
+  [`generated program (${argv.lines} lines)`]:
+    results.memoisedResults.largeProgram,
+});
+if (results.largeProgramHitsNotMemoised.length > 0) {
+  console.log(
+    `Rules with hits on the generated program that the selective build does not memoise: ${results.largeProgramHitsNotMemoised.join(
+      ", ",
+    )}`,
+  );
+}
+
+fs.mkdirSync(path.dirname(path.resolve(argv.o)), { recursive: true });
+fs.writeFileSync(path.resolve(argv.o), JSON.stringify(results, null, 2));
+console.log(`Results saved to ${path.resolve(argv.o)}`);
@@ -0,0 +1,89 @@
+#include <source_stdlib>
+
+/**
+ * Binary search tree with malloc'd nodes: insertions, lookups and freeing of the whole tree.
+ * Measures pointer chasing and malloc/free.
+ */
+
+struct Node {
+  int key;
+  struct Node *left;
+  struct Node *right;
+};
+
+struct Node *insert(struct Node *root, int key) {
+  struct Node *node = malloc(sizeof(struct Node));
+  node->key = key;
+  node->left = 0;
+  node->right = 0;
+  if (root == 0) {
+    return node;
+  }
+  struct Node *curr = root;
+  while (1) {
+    if (key < curr->key) {
+      if (curr->left == 0) {
+        curr->left = node;
+        return root;
+      }
+      curr = curr->left;
+    } else {
+      if (curr->right == 0) {
+        curr->right = node;
+        return root;
+      }
+      curr = curr->right;
+    }
+  }
+}
+
+int contains(struct Node *root, int key) {
+  struct Node *curr = root;
+  while (curr != 0) {
+    if (key == curr->key) {
+      return 1;
+    }
+    if (key < curr->key) {
+      curr = curr->left;
+    } else {
+      curr = curr->right;
+    }
+  }
+  return 0;
+}
+
+int height(struct Node *node) {
+  if (node == 0) {
+    return 0;
+  }
+  int left_height = height(node->left);
+  int right_height = height(node->right);
+  return 1 + (left_height > right_height ? left_height : right_height);
+}
+
+void free_tree(struct Node *node) {
+  if (node == 0) {
+    return;
+  }
+  free_tree(node->left);
+  free_tree(node->right);
+  free(node);
+}
+
+int main() {
+  struct Node *root = 0;
+  int seed = 7;
+  for (int i = 0; i < 2000; ++i) {
+    seed = (seed * 1103515245 + 12345) & 2147483647;
+    root = insert(root, seed % 1000000);
+  }
+  int found = 0;
+  for (int i = 0; i < 200000; ++i) {
+    if (contains(root, (i * 37) % 1000000)) {
+      ++found;
+    }
+  }
+  print_int(found);
+  print_int(height(root));
+  free_tree(root);
+}
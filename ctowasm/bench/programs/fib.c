@@ -0,0 +1,16 @@
+#include <source_stdlib>
+
+/**
+ * Recursive fibonacci. Measures function call overhead (stack frame setup and teardown).
+ */
+
+int fib(int n) {
+  if (n < 2) {
+    return n;
+  }
+  return fib(n - 1) + fib(n - 2);
+}
+
+int main() {
+  print_int(fib(27));
+}
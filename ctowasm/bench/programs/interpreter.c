@@ -0,0 +1,81 @@
+#include <source_stdlib>
+
+/**
+ * Switch-based bytecode interpreter for a small stack machine, running a loop that sums the first n squares.
+ * Measures switch dispatch (br_table) and array accesses.
+ */
+
+// opcodes, as case labels cannot be enumerators:
+// 0 - PUSH, 1 - LOAD, 2 - STORE, 3 - ADD, 4 - SUB, 5 - MUL, 6 - JUMP_IF_ZERO, 7 - JUMP, 8 - PRINT, 9 - HALT
+
+int run(int code[], int variables[]) {
+  int stack[64];
+  int sp = 0;
+  int pc = 0;
+  int steps = 0;
+  while (1) {
+    ++steps;
+    switch (code[pc]) {
+      case 0: // PUSH
+        stack[sp++] = code[pc + 1];
+        pc += 2;
+        break;
+      case 1: // LOAD
+        stack[sp++] = variables[code[pc + 1]];
+        pc += 2;
+        break;
+      case 2: // STORE
+        variables[code[pc + 1]] = stack[--sp];
+        pc += 2;
+        break;
+      case 3: // ADD
+        --sp;
+        stack[sp - 1] = stack[sp - 1] + stack[sp];
+        ++pc;
+        break;
+      case 4: // SUB
+        --sp;
+        stack[sp - 1] = stack[sp - 1] - stack[sp];
+        ++pc;
+        break;
+      case 5: // MUL
+        --sp;
+        stack[sp - 1] = stack[sp - 1] * stack[sp];
+        ++pc;
+        break;
+      case 6: // JUMP_IF_ZERO
+        if (stack[--sp] == 0) {
+          pc = code[pc + 1];
+        } else {
+          pc += 2;
+        }
+        break;
+      case 7: // JUMP
+        pc = code[pc + 1];
+        break;
+      case 8: // PRINT
+        print_int(stack[--sp]);
+        ++pc;
+        break;
+      case 9: // HALT
+        return steps;
+    }
+  }
+}
+
+int main() {
+  // variables: 0 - i, 1 - sum
+  // i = 300000; sum = 0; while (i) { sum = sum + i * i; i = i - 1; } print(sum)
+  int code[] = {
+    0, 300000, 2, 0,              // PUSH 300000, STORE 0
+    0, 0, 2, 1,                   // PUSH 0, STORE 1
+    1, 0, 6, 31,                  // LOAD 0, JUMP_IF_ZERO 31
+    1, 1, 1, 0, 1, 0, 5, 3, 2, 1, // LOAD 1, LOAD 0, LOAD 0, MUL, ADD, STORE 1
+    1, 0, 0, 1, 4, 2, 0,          // LOAD 0, PUSH 1, SUB, STORE 0
+    7, 8,                         // JUMP 8
+    1, 1, 8,                      // LOAD 1, PRINT
+    9                             // HALT
+  };
+  int variables[2];
+  print_int(run(code, variables));
+}
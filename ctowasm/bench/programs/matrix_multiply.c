@@ -0,0 +1,47 @@
+#include <source_stdlib>
+
+/**
+ * Repeated multiplication of square matrices of doubles stored in row-major order. Measures nested loops and array
+ * indexing.
+ */
+
+double *create_matrix(int n, int seed) {
+  double *m = malloc(n * n * sizeof(double));
+  for (int i = 0; i < n * n; ++i) {
+    seed = (seed * 1103515245 + 12345) & 2147483647;
+    m[i] = (seed % 1000) / 100.0;
+  }
+  return m;
+}
+
+void multiply(double *a, double *b, double *c, int n) {
+  for (int i = 0; i < n; ++i) {
+    for (int j = 0; j < n; ++j) {
+      c[i * n + j] = 0;
+    }
+    for (int k = 0; k < n; ++k) {
+      double a_ik = a[i * n + k];
+      for (int j = 0; j < n; ++j) {
+        c[i * n + j] += a_ik * b[k * n + j];
+      }
+    }
+  }
+}
+
+int main() {
+  int n = 40;
+  double *a = create_matrix(n, 1);
+  double *b = create_matrix(n, 2);
+  double *c = malloc(n * n * sizeof(double));
+  double trace = 0;
+  for (int round = 0; round < 25; ++round) {
+    multiply(a, b, c, n);
+    for (int i = 0; i < n; ++i) {
+      trace += c[i * n + i];
+    }
+  }
+  print_double(trace);
+  free(a);
+  free(b);
+  free(c);
+}
@@ -0,0 +1,60 @@
+#include <source_stdlib>
+
+/**
+ * Merge sort of pseudo-random longs, with temp arrays allocated by malloc (like subset5/merge_sort_3.c).
+ * Measures recursion, malloc/free and long arithmetic.
+ */
+
+void merge(long arr[], int start_a, int mid, int end_b) {
+  long *temp = malloc((end_b - start_a) * sizeof(long));
+  int curr_a = start_a;
+  int curr_b = mid;
+  int curr_temp = 0;
+  while (curr_a < mid && curr_b < end_b) {
+    if (arr[curr_a] <= arr[curr_b]) {
+      temp[curr_temp++] = arr[curr_a++];
+    } else {
+      temp[curr_temp++] = arr[curr_b++];
+    }
+  }
+  while (curr_a < mid) {
+    temp[curr_temp++] = arr[curr_a++];
+  }
+  while (curr_b < end_b) {
+    temp[curr_temp++] = arr[curr_b++];
+  }
+  for (int i = start_a; i < end_b; ++i) {
+    arr[i] = temp[i - start_a];
+  }
+  free(temp);
+}
+
+void mergesort(long arr[], int start, int end) {
+  if (end - start <= 1) {
+    return;
+  }
+  int mid = (end + start) / 2;
+  mergesort(arr, start, mid);
+  mergesort(arr, mid, end);
+  merge(arr, start, mid, end);
+}
+
+int main() {
+  int length = 1500;
+  long *arr = malloc(length * sizeof(long));
+  long seed = 42;
+  for (int i = 0; i < length; ++i) {
+    seed = (seed * 6364136223846793005 + 1442695040888963407);
+    arr[i] = seed >> 33;
+  }
+  mergesort(arr, 0, length);
+  int sorted = 1;
+  for (int i = 1; i < length; ++i) {
+    if (arr[i - 1] > arr[i]) {
+      sorted = 0;
+    }
+  }
+  print_int(sorted);
+  print_long(arr[length / 2]);
+  free(arr);
+}
@@ -0,0 +1,112 @@
+#include <source_stdlib>
+
+/**
+ * N-body simulation of the jovian planets. Measures double arithmetic and struct field access.
+ * Square roots are computed in C, as the math library cannot be instantiated outside of a browser.
+ */
+
+struct Body {
+  double x;
+  double y;
+  double z;
+  double vx;
+  double vy;
+  double vz;
+  double mass;
+};
+
+double PI = 3.141592653589793;
+double DAYS_PER_YEAR = 365.24;
+
+// Newton's method, from above the root until the estimate stops decreasing
+double square_root(double x) {
+  double root = x + 1;
+  while (1) {
+    double next = 0.5 * (root + x / root);
+    if (next >= root) {
+      return root;
+    }
+    root = next;
+  }
+}
+
+void set_body(struct Body *b, double x, double y, double z, double vx,
+              double vy, double vz, double mass) {
+  double solar_mass = 4 * PI * PI;
+  b->x = x;
+  b->y = y;
+  b->z = z;
+  b->vx = vx * DAYS_PER_YEAR;
+  b->vy = vy * DAYS_PER_YEAR;
+  b->vz = vz * DAYS_PER_YEAR;
+  b->mass = mass * solar_mass;
+}
+
+void advance(struct Body bodies[], int n, double dt) {
+  for (int i = 0; i < n; ++i) {
+    struct Body *a = &bodies[i];
+    for (int j = i + 1; j < n; ++j) {
+      struct Body *b = &bodies[j];
+      double dx = a->x - b->x;
+      double dy = a->y - b->y;
+      double dz = a->z - b->z;
+      double distance_squared = dx * dx + dy * dy + dz * dz;
+      double distance = square_root(distance_squared);
+      double magnitude = dt / (distance_squared * distance);
+      a->vx -= dx * b->mass * magnitude;
+      a->vy -= dy * b->mass * magnitude;
+      a->vz -= dz * b->mass * magnitude;
+      b->vx += dx * a->mass * magnitude;
+      b->vy += dy * a->mass * magnitude;
+      b->vz += dz * a->mass * magnitude;
+    }
+  }
+  for (int i = 0; i < n; ++i) {
+    bodies[i].x += dt * bodies[i].vx;
+    bodies[i].y += dt * bodies[i].vy;
+    bodies[i].z += dt * bodies[i].vz;
+  }
+}
+
+double energy(struct Body bodies[], int n) {
+  double e = 0;
+  for (int i = 0; i < n; ++i) {
+    struct Body *a = &bodies[i];
+    e += 0.5 * a->mass * (a->vx * a->vx + a->vy * a->vy + a->vz * a->vz);
+    for (int j = i + 1; j < n; ++j) {
+      struct Body *b = &bodies[j];
+      double dx = a->x - b->x;
+      double dy = a->y - b->y;
+      double dz = a->z - b->z;
+      e -= (a->mass * b->mass) / square_root(dx * dx + dy * dy + dz * dz);
+    }
+  }
+  return e;
+}
+
+int main() {
+  struct Body bodies[5];
+  set_body(&bodies[0], 0, 0, 0, 0, 0, 0, 1);
+  set_body(&bodies[1], 4.84143144246472090, -1.16032004402742839,
+           -0.103622044471123109, 0.00166007664274403694,
+           0.00769901118419740425, -0.0000690460016972063023,
+           0.000954791938424326609);
+  set_body(&bodies[2], 8.34336671824457987, 4.12479856412430479,
+           -0.403523417114321381, -0.00276742510726862411,
+           0.00499852801234917238, 0.0000230417297573763929,
+           0.000285885980666130812);
+  set_body(&bodies[3], 12.8943695621391310, -15.1111514016986312,
+           -0.223307578892655734, 0.00296460137564761618,
+           0.00237847173959480950, -0.0000296589568540237556,
+           0.0000436624404335156298);
+  set_body(&bodies[4], 15.3796971148509165, -25.9193146099879641,
+           0.179258772950371181, 0.00268067772490389322,
+           0.00162824170038242295, -0.0000951592254519715870,
+           0.0000515138902046611451);
+
+  print_double(energy(bodies, 5));
+  for (int i = 0; i < 20000; ++i) {
+    advance(bodies, 5, 0.01);
+  }
+  print_double(energy(bodies, 5));
+}
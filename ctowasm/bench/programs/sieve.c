@@ -0,0 +1,35 @@
+#include <source_stdlib>
+
+/**
+ * Sieve of Eratosthenes over a heap allocated array, repeated a number of times. Measures tight loops and byte memory
+ * accesses.
+ */
+
+int count_primes(char *is_composite, int limit) {
+  for (int i = 0; i <= limit; ++i) {
+    is_composite[i] = 0;
+  }
+  int count = 0;
+  for (int i = 2; i <= limit; ++i) {
+    if (!is_composite[i]) {
+      ++count;
+      if (i <= limit / i) {
+        for (int j = i * i; j <= limit; j += i) {
+          is_composite[j] = 1;
+        }
+      }
+    }
+  }
+  return count;
+}
+
+int main() {
+  int limit = 40000;
+  char *is_composite = malloc(limit + 1);
+  int count = 0;
+  for (int round = 0; round < 50; ++round) {
+    count = count_primes(is_composite, limit);
+  }
+  free(is_composite);
+  print_int(count);
+}
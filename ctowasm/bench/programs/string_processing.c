@@ -0,0 +1,60 @@
+#include <source_stdlib>
+
+/**
+ * Generation of a text, then repeated word counting, in-place reversal of each word and hashing.
+ * Measures char arrays and byte-wise loops.
+ */
+
+int string_length(char *s) {
+  int length = 0;
+  while (s[length] != 0) {
+    ++length;
+  }
+  return length;
+}
+
+void reverse(char *s, int start, int end) {
+  while (start < end - 1) {
+    char temp = s[start];
+    s[start] = s[end - 1];
+    s[end - 1] = temp;
+    ++start;
+    --end;
+  }
+}
+
+int main() {
+  char words[] = "the quick brown fox jumps over lazy dog ";
+  int words_length = string_length(words);
+  int text_length = 20000;
+  char *text = malloc(text_length + 1);
+  for (int i = 0; i < text_length; ++i) {
+    text[i] = words[(i * 7) % words_length];
+  }
+  text[text_length] = 0;
+
+  int word_count = 0;
+  unsigned int hash = 2166136261;
+  for (int round = 0; round < 20; ++round) {
+    word_count = 0;
+    int word_start = -1;
+    for (int i = 0; i <= text_length; ++i) {
+      char c = text[i];
+      if (c == ' ' || c == 0) {
+        if (word_start != -1) {
+          ++word_count;
+          reverse(text, word_start, i);
+          word_start = -1;
+        }
+      } else if (word_start == -1) {
+        word_start = i;
+      }
+    }
+    for (int i = 0; i < text_length; ++i) {
+      hash = (hash ^ text[i]) * 16777619;
+    }
+  }
+  print_int(word_count);
+  print_int_unsigned(hash);
+  free(text);
+}
@@ -0,0 +1,245 @@
+/**
+ * Benchmark harness. Compiles and runs each program in bench/programs a number of times, recording compile time
+ * (in total and per compilation phase), run time, wasm binary size and peak memory, and optionally compares the results
+ * against a stored baseline.
+ *
+ * Usage: node bench/run.js [--iterations <n>] [--filter <substring>] [-o <results file>]
+ *                          [--baseline <baseline file>] [--threshold <percentage>] [--save-baseline]
+ *                          [--fuel-metering]
+ * Exits with a non-zero status if any program regressed by more than the threshold compared to the baseline.
+ */
+import { compile, runWasm } from "../dist/index.js";
+import yargs from "yargs";
+import { hideBin } from "yargs/helpers";
+import * as fs from "fs";
+import * as path from "node:path";
+import { dirname } from "path";
+import { fileURLToPath } from "url";
+
+const __dirname = dirname(fileURLToPath(import.meta.url));
+const PROGRAMS_DIRECTORY = path.resolve(__dirname, "programs");
+const DEFAULT_BASELINE_FILE = path.resolve(__dirname, "baseline.json");
+
+const argv = yargs(hideBin(process.argv))
+  .usage("Usage: $0 [args]")
+  .options({
+    iterations: {
+      type: "number",
+      default: 5,
+      describe: "Number of times each program is compiled and run",
+    },
+    filter: {
+      type: "string",
+      describe: "Only run the programs whose file name contains this string",
+    },
+    o: {
+      type: "string",
+      alias: "out",
+      default: path.resolve(__dirname, "results/latest.json"),
+      describe: "The file to write the results to",
+    },
+    baseline: {
+      type: "string",
+      default: DEFAULT_BASELINE_FILE,
+      describe: "Results to compare against, skipped if the file does not exist",
+    },
+    threshold: {
+      type: "number",
+      default: 10,
+      describe:
+        "Percentage by which a metric may exceed the baseline before it counts as a regression",
+    },
+    "save-baseline": {
+      type: "boolean",
+      default: false,
+      describe: "Also write the results to the baseline file",
+    },
+    "fuel-metering": {
+      type: "boolean",
+      default: false,
+      describe:
+        "Compile the programs with fuel metering, to measure its overhead against a baseline without it",
+    },
+  }).argv;
+
+// metrics compared against the baseline. Times are compared by their median over all iterations.
+const COMPARED_METRICS = [
+  "compileTimeMs",
+  "runTimeMs",
+  "wasmSize",
+  "peakMemoryBytes",
+];
+
+function median(values) {
+  const sorted = [...values].sort((a, b) => a - b);
+  const mid = Math.floor(sorted.length / 2);
+  return sorted.length % 2 === 0
+    ? (sorted[mid - 1] + sorted[mid]) / 2
+    : sorted[mid];
+}
+
+function summarise(values) {
+  return {
+    median: median(values),
+    min: Math.min(...values),
+    max: Math.max(...values),
+  };
+}
+
+async function benchmarkProgram(fileName) {
+  const source = fs.readFileSync(
+    path.resolve(PROGRAMS_DIRECTORY, fileName),
+    "utf-8",
+  );
+  const compileTimes = [];
+  const phaseTimes = {};
+  const runTimes = [];
+  let wasmSize = 0;
+  let peakMemoryBytes = 0;
+  let output = null;
+
+  for (let i = 0; i < argv.iterations; ++i) {
+    const result = await compile(source, undefined, {
+      metrics: true,
+      fuelMetering: argv.fuelMetering,
+    });
+    if (result.status === "failure") {
+      throw new Error(
+        `${fileName} failed to compile:\n${result.errorMessage}`,
+      );
+    }
+    // the sum of the phases excludes the time taken to collect the metrics
+    let compileTime = 0;
+    for (const [phase, timeMs] of Object.entries(
+      result.metrics.phaseTimings,
+    )) {
+      (phaseTimes[phase] ??= []).push(timeMs);
+      compileTime += timeMs;
+    }
+    compileTimes.push(compileTime);
+    wasmSize = result.wasm.byteLength;
+
+    const printed = [];
+    const runStartTime = performance.now();
+    const moduleRepository = await runWasm(
+      result.wasm,
+      result.dataSegmentSize,
+      result.functionTableSize,
+      result.importedModules,
+      { printFunction: (str) => printed.push(str), stdoutBufferMode: "full" },
+    );
+    runTimes.push(performance.now() - runStartTime);
+    // linear memory only ever grows, so its final size is its peak size
+    peakMemoryBytes = Math.max(
+      peakMemoryBytes,
+      moduleRepository.memory.buffer.byteLength,
+    );
+    const runOutput = printed.join("\n");
+    if (output !== null && output !== runOutput) {
+      throw new Error(`${fileName} printed different output across runs`);
+    }
+    output = runOutput;
+  }
+
+  return {
+    compileTimeMs: summarise(compileTimes),
+    // median time of each compilation phase
+    compilePhaseTimesMs: Object.fromEntries(
+      Object.entries(phaseTimes).map(([phase, times]) => [
+        phase.replace(/Ms$/, ""),
+        median(times),
+      ]),
+    ),
+    runTimeMs: summarise(runTimes),
+    wasmSize,
+    peakMemoryBytes,
+    output,
+  };
+}
+
+function getMetricValue(result, metric) {
+  const value = result[metric];
+  return typeof value === "object" ? value.median : value;
+}
+
+/**
+ * Returns the descriptions of all the regressions of the results compared to the baseline.
+ */
+function compareWithBaseline(results, baseline) {
+  const regressions = [];
+  for (const [program, result] of Object.entries(results.programs)) {
+    const baselineResult = baseline.programs[program];
+    if (typeof baselineResult === "undefined") {
+      continue;
+    }
+    if (result.output !== baselineResult.output) {
+      regressions.push(`${program}: output differs from the baseline`);
+    }
+    for (const metric of COMPARED_METRICS) {
+      const value = getMetricValue(result, metric);
+      const baselineValue = getMetricValue(baselineResult, metric);
+      if (value > baselineValue * (1 + argv.threshold / 100)) {
+        regressions.push(
+          `${program}: ${metric} ${value.toFixed(2)} exceeds baseline ${baselineValue.toFixed(
+            2,
+          )} by ${(((value - baselineValue) / baselineValue) * 100).toFixed(1)}%`,
+        );
+      }
+    }
+  }
+  return regressions;
+}
+
+const programFiles = fs
+  .readdirSync(PROGRAMS_DIRECTORY)
+  .filter(
+    (fileName) =>
+      fileName.endsWith(".c") &&
+      (typeof argv.filter === "undefined" || fileName.includes(argv.filter)),
+  )
+  .sort();
+
+const results = {
+  date: new Date().toISOString(),
+  iterations: argv.iterations,
+  fuelMetering: argv.fuelMetering,
+  nodeVersion: process.version,
+  programs: {},
+};
+
+for (const fileName of programFiles) {
+  const result = await benchmarkProgram(fileName);
+  results.programs[fileName] = result;
+  console.log(
+    `${fileName.padEnd(24)} compile ${result.compileTimeMs.median
+      .toFixed(2)
+      .padStart(9)} ms   run ${result.runTimeMs.median
+      .toFixed(2)
+      .padStart(9)} ms   wasm ${String(result.wasmSize).padStart(7)} B   memory ${String(
+      result.peakMemoryBytes,
+    ).padStart(9)} B`,
+  );
+}
+
+fs.mkdirSync(path.dirname(path.resolve(argv.o)), { recursive: true });
+fs.writeFileSync(path.resolve(argv.o), JSON.stringify(results, null, 2));
+console.log(`Results saved to ${path.resolve(argv.o)}`);
+
+if (argv.saveBaseline) {
+  fs.writeFileSync(DEFAULT_BASELINE_FILE, JSON.stringify(results, null, 2));
+  console.log(`Baseline saved to ${DEFAULT_BASELINE_FILE}`);
+} else if (fs.existsSync(argv.baseline)) {
+  const regressions = compareWithBaseline(
+    results,
+    JSON.parse(fs.readFileSync(argv.baseline, "utf-8")),
+  );
+  if (regressions.length > 0) {
+    console.log(
+      `Regressions compared to the baseline (threshold ${argv.threshold}%):\n${regressions.join(
+        "\n",
+      )}`,
+    );
+    process.exit(1);
+  }
+  console.log(`No regressions compared to the baseline`);
+}
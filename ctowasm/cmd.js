@@ -2,15 +2,28 @@
  * Command line script for running the parser on a provided c input file.
  */
 import {
+  CompilationCache,
+  DirectoryCompilationCacheStore,
+  FilterPipeline,
+  FuelExhaustedError,
+  Profiler,
+  TraceRecorder,
   compile,
-  compileAndRun,
+  fromNodeWorker,
+  runWasm,
+  WorkerRun,
   compileToWat,
   generate_C_AST,
   generate_WAT_AST,
   generate_processed_C_AST,
+  runHeadlessPipeline,
 } from "./dist/index.js";
 import yargs from "yargs";
+import { Worker } from "node:worker_threads";
+import { createHash } from "node:crypto";
 import * as fs from "fs";
+import * as fsPromises from "fs/promises";
+import * as os from "node:os";
 import * as path from "node:path";
 import { hideBin } from "yargs/helpers";
 
@@ -21,7 +34,82 @@ const argv = yargs(hideBin(process.argv))
       type: "string",
       alias: "out",
       describe:
-        'The file to output generated output to. Defaults to "output/a.wasm" for compile, "output/a.wat" for compile-to-wat, "output/c-ast.json" for generate-c-ast, "output/c-processed-ast.json" for generate-processed-c-ast and "output/wat-ast.json" for generate-wat-ast',
+        'The file to output generated output to. Defaults to "output/a.wasm" for compile, "output/a.wat" for compile-to-wat, "output/c-ast.json" for generate-c-ast, "output/c-processed-ast.json" for generate-processed-c-ast, "output/wat-ast.json" for generate-wat-ast and "output/filter-telemetry.json" for filter-headless',
+    },
+    "cache-dir": {
+      type: "string",
+      describe:
+        "Directory to cache compilation results in, so that identical programs are not recompiled (compile, compile-run and batch)",
+    },
+    frames: {
+      type: "number",
+      default: 120,
+      describe: "Number of synthetic frames to feed to the filter (filter-headless)",
+    },
+    fps: {
+      type: "number",
+      default: 30,
+      describe: "Rate at which synthetic frames are fed to the filter (filter-headless)",
+    },
+    height: {
+      type: "number",
+      default: 300,
+      describe: "Height of the synthetic frames (filter-headless)",
+    },
+    width: {
+      type: "number",
+      default: 400,
+      describe: "Width of the synthetic frames (filter-headless)",
+    },
+    fuel: {
+      type: "number",
+      describe:
+        "Compile with fuel metering and stop each run of the program after the given number of steps. The fuel used is reported (compile-run and batch)",
+    },
+    "heap-stats": {
+      type: "boolean",
+      describe:
+        "Print the heap statistics of the run (live, peak and allocated bytes, sizes of allocations and fragmentation), and the blocks it did not free with the position of their malloc (compile-run)",
+    },
+    metrics: {
+      type: "boolean",
+      describe:
+        "Print the time taken by each compilation phase, and the sizes of their outputs (compile, compile-to-wat and compile-run)",
+    },
+    profile: {
+      type: "boolean",
+      describe:
+        "Compile with profiling instrumentation and print the flat and call graph profiles of the run (compile-run)",
+    },
+    stdin: {
+      type: "string",
+      describe:
+        "File whose contents the program reads as its input, through getchar, read_int, read_long and scanf (compile-run)",
+    },
+    threads: {
+      type: "boolean",
+      describe:
+        "Compile the program to run its POSIX threads (see the pthread module) in parallel, each in a worker thread (compile, compile-to-wat and compile-run)",
+    },
+    trace: {
+      type: "boolean",
+      describe:
+        "Compile with tracing instrumentation and record the state of the program at every statement, then print a summary of the recorded trace (compile-run)",
+    },
+    "time-limit": {
+      type: "number",
+      describe:
+        "Run the program in a worker thread and stop it after the given number of milliseconds (compile-run)",
+    },
+    workers: {
+      type: "number",
+      describe:
+        "Number of worker threads to compile and run programs on. Defaults to the number of cores (batch)",
+    },
+    timeout: {
+      type: "number",
+      describe:
+        "Time in milliseconds after which a program (compilation and all its test cases) is stopped (batch)",
     },
   })
   .command("compile", "Compile the given input file to wasm")
@@ -39,6 +127,14 @@ const argv = yargs(hideBin(process.argv))
     "generate-wat-ast",
     "Generate the WAT AST as a JSON file for visualisation",
   )
+  .command(
+    "filter-headless",
+    "Run the pix_n_flix filter installed by the given input file in a worker thread on synthetic frames, and report frame telemetry",
+  )
+  .command(
+    "batch",
+    "Compile and run all the C files in the given directory, or listed in the given JSON manifest, in parallel on worker threads, and output the results as JSON lines",
+  )
   .demandCommand(2).argv;
 
 if (typeof argv._[1] === "undefined") {
@@ -50,7 +146,350 @@ if (!fs.existsSync(argv._[1])) {
   throw new Error(`File "${argv._[1]}" does not exist`);
 }
 
+/**
+ * Identifies the build of the compiler, so that results cached by another build are never reused.
+ */
+function getCompilerFingerprint() {
+  return createHash("sha256")
+    .update(fs.readFileSync(new URL("./dist/index.js", import.meta.url)))
+    .digest("hex");
+}
+
+/**
+ * Reads the programs of a batch. The batch input is either:
+ * - a directory, where each "<name>.c" file is a program, run with "<name>.in" as stdin and checked against
+ *   "<name>.out" if those files exist, or
+ * - a JSON manifest of the form
+ *   { "programs": ["a.c", { "file": "b.c", "testCases": [...] }], "testCases": [...] }
+ *   where each test case is { "stdin"?, "stdinFile"?, "expectedOutput"?, "expectedOutputFile"? },
+ *   and the top level test cases are used for programs without their own. Paths are relative to the manifest.
+ */
+function readBatchJobs(inputPath) {
+  const readIfExists = (filePath) =>
+    fs.existsSync(filePath) ? fs.readFileSync(filePath, "utf-8") : undefined;
+
+  if (fs.statSync(inputPath).isDirectory()) {
+    return fs
+      .readdirSync(inputPath)
+      .filter((fileName) => fileName.endsWith(".c"))
+      .sort()
+      .map((fileName) => {
+        const filePath = path.join(inputPath, fileName);
+        const stdin = readIfExists(filePath.replace(/\.c$/, ".in"));
+        const expectedOutput = readIfExists(filePath.replace(/\.c$/, ".out"));
+        return {
+          file: filePath,
+          source: fs.readFileSync(filePath, "utf-8"),
+          testCases:
+            typeof stdin !== "undefined" || typeof expectedOutput !== "undefined"
+              ? [{ stdin, expectedOutput }]
+              : [],
+        };
+      });
+  }
+
+  const manifestDirectory = path.dirname(inputPath);
+  const manifest = JSON.parse(fs.readFileSync(inputPath, "utf-8"));
+  // files shared by many test cases are only read once
+  const fileContents = new Map();
+  const readManifestFile = (filePath) => {
+    const resolvedPath = path.resolve(manifestDirectory, filePath);
+    if (!fileContents.has(resolvedPath)) {
+      fileContents.set(resolvedPath, fs.readFileSync(resolvedPath, "utf-8"));
+    }
+    return fileContents.get(resolvedPath);
+  };
+  const readTestCases = (testCases = []) =>
+    testCases.map((testCase) => ({
+      stdin: testCase.stdinFile
+        ? readManifestFile(testCase.stdinFile)
+        : testCase.stdin,
+      expectedOutput: testCase.expectedOutputFile
+        ? readManifestFile(testCase.expectedOutputFile)
+        : testCase.expectedOutput,
+    }));
+  const sharedTestCases = readTestCases(manifest.testCases);
+  return (manifest.programs ?? []).map((program) => {
+    const file = typeof program === "string" ? program : program.file;
+    return {
+      file,
+      source: fs.readFileSync(path.resolve(manifestDirectory, file), "utf-8"),
+      testCases:
+        typeof program === "string" || !program.testCases
+          ? sharedTestCases
+          : readTestCases(program.testCases),
+    };
+  });
+}
+
+/**
+ * Runs all the jobs of a batch on a pool of worker threads, writing the result of each job as a JSON line
+ * as soon as it finishes. A worker running a job past the timeout is terminated and replaced.
+ */
+async function runBatch(jobs, output) {
+  const numberOfWorkers = Math.max(
+    1,
+    Math.min(
+      argv.workers ??
+        (os.availableParallelism?.() ?? os.cpus().length),
+      jobs.length,
+    ),
+  );
+  const summary = {
+    programs: jobs.length,
+    compilationFailures: 0,
+    compilationsCached: 0,
+    timeouts: 0,
+    passed: 0,
+    failed: 0,
+    ran: 0,
+    error: 0,
+  };
+  let nextJobIndex = 0;
+  // the workers share one cache directory, so that each program is compiled once across workers and runs
+  const workerData = argv.cacheDir
+    ? {
+        cacheDir: path.resolve(argv.cacheDir),
+        compilerFingerprint: getCompilerFingerprint(),
+      }
+    : undefined;
+
+  const writeResult = (result) => {
+    if (result.compilationCached) {
+      ++summary.compilationsCached;
+    }
+    if (result.status === "failure") {
+      ++summary.compilationFailures;
+    } else if (result.status === "timeout") {
+      ++summary.timeouts;
+    }
+    for (const testCase of result.testCases) {
+      ++summary[testCase.status];
+    }
+    output.write(JSON.stringify(result) + "\n");
+  };
+
+  // each worker loop takes the next job until there are none left
+  const runWorker = async () => {
+    let worker = null;
+    while (nextJobIndex < jobs.length) {
+      const job = jobs[nextJobIndex++];
+      if (worker === null) {
+        worker = new Worker(new URL("./batchWorker.js", import.meta.url), {
+          workerData,
+        });
+      }
+      const currentWorker = worker;
+      let timer;
+      let isWorkerUsable = true;
+      const result = await new Promise((resolve) => {
+        currentWorker.once("message", ({ result }) => resolve(result));
+        currentWorker.once("error", (e) => {
+          isWorkerUsable = false;
+          resolve({
+            file: job.file,
+            status: "failure",
+            compileTimeMs: 0,
+            errorMessage: e.message,
+            testCases: [],
+          });
+        });
+        // e.g. the program called process.exit, or the worker ran out of memory
+        currentWorker.once("exit", (exitCode) => {
+          isWorkerUsable = false;
+          resolve({
+            file: job.file,
+            status: "failure",
+            compileTimeMs: 0,
+            errorMessage: `Worker exited with code ${exitCode} before finishing the job`,
+            testCases: [],
+          });
+        });
+        if (argv.timeout) {
+          timer = setTimeout(
+            () =>
+              resolve({
+                file: job.file,
+                status: "timeout",
+                compileTimeMs: 0,
+                errorMessage: `Timed out after ${argv.timeout} ms`,
+                testCases: [],
+              }),
+            argv.timeout,
+          );
+        }
+        currentWorker.postMessage({ job: { ...job, fuelLimit: argv.fuel } });
+      });
+      clearTimeout(timer);
+      currentWorker.removeAllListeners("message");
+      currentWorker.removeAllListeners("error");
+      currentWorker.removeAllListeners("exit");
+      if (result.status === "timeout" || !isWorkerUsable) {
+        // the worker may be stuck in an infinite loop, or has crashed, so a fresh worker is used for the next job
+        await currentWorker.terminate();
+        worker = null;
+      }
+      writeResult(result);
+    }
+    if (worker !== null) {
+      await worker.terminate();
+    }
+  };
+
+  const startTime = performance.now();
+  await Promise.all(Array.from({ length: numberOfWorkers }, runWorker));
+  return {
+    ...summary,
+    workers: numberOfWorkers,
+    timeMs: performance.now() - startTime,
+  };
+}
+
+if (argv._[0] === "batch") {
+  const jobs = readBatchJobs(argv._[1]);
+  const outputStream = argv.o
+    ? fs.createWriteStream(path.resolve(argv.o))
+    : process.stdout;
+  const summary = await runBatch(jobs, outputStream);
+  if (outputStream !== process.stdout) {
+    await new Promise((resolve) => outputStream.end(resolve));
+  }
+  console.error(
+    `Ran ${summary.programs} programs on ${summary.workers} workers in ${(
+      summary.timeMs / 1000
+    ).toFixed(2)} s: ${summary.compilationFailures} failed to compile, ${
+      summary.timeouts
+    } timed out. Test cases: ${summary.passed} passed, ${summary.failed} failed, ${
+      summary.error
+    } errors, ${summary.ran} unchecked${
+      argv.cacheDir
+        ? `. Compilation cache: ${summary.compilationsCached} programs cached`
+        : ""
+    }`,
+  );
+  process.exit(0);
+}
+
 const input = fs.readFileSync(argv._[1], "utf-8");
+// read as bytes, so that the program sees the input exactly as it is in the file
+const stdin = argv.stdin
+  ? new Uint8Array(fs.readFileSync(argv.stdin))
+  : undefined;
+
+const compilationCache = argv.cacheDir
+  ? new CompilationCache({
+      store: new DirectoryCompilationCacheStore(
+        fsPromises,
+        path.resolve(argv.cacheDir),
+      ),
+      compilerFingerprint: getCompilerFingerprint(),
+    })
+  : undefined;
+
+const compilationOptions = {
+  ...(typeof argv.fuel !== "undefined" ? { fuelMetering: true } : {}),
+  ...(argv.profile ? { profile: true } : {}),
+  ...(argv.metrics ? { metrics: true } : {}),
+  ...(argv.threads ? { threads: true } : {}),
+  ...(argv.trace ? { trace: true } : {}),
+  ...(argv.heapStats ? { allocationSites: true } : {}),
+};
+
+function printCompilationMetrics(metrics) {
+  if (!metrics) {
+    return;
+  }
+  console.log("Compilation phases (ms):");
+  console.table(
+    Object.fromEntries(
+      Object.entries(metrics.phaseTimings).map(([phase, timeMs]) => [
+        phase.replace(/Ms$/, ""),
+        { time: timeMs.toFixed(3) },
+      ]),
+    ),
+  );
+  console.log(
+    `Total ${metrics.totalMs.toFixed(3)} ms. C AST nodes: ${
+      metrics.cAstNodeCount
+    }, processed C AST nodes: ${metrics.processedCAstNodeCount}, WAT AST nodes: ${
+      metrics.wasmAstNodeCount
+    }, functions: ${metrics.numberOfFunctions}, WAT length: ${
+      metrics.watLength
+    }${
+      typeof metrics.wasmByteLength !== "undefined"
+        ? `, wasm size: ${metrics.wasmByteLength} bytes`
+        : ""
+    }`,
+  );
+}
+
+const PROFILE_ROWS = 20;
+
+function printProfile(profiler) {
+  console.log("\nFlat profile (times in ms):");
+  console.table(
+    profiler
+      .getFlatProfile()
+      .slice(0, PROFILE_ROWS)
+      .map(({ name, calls, inclusiveTime, exclusiveTime, exclusivePercentage }) => ({
+        function: name,
+        calls,
+        "inclusive time": inclusiveTime.toFixed(3),
+        "exclusive time": exclusiveTime.toFixed(3),
+        "exclusive %": exclusivePercentage.toFixed(1),
+      })),
+  );
+  console.log("Call graph profile (times in ms):");
+  console.table(
+    profiler
+      .getCallGraphProfile()
+      .slice(0, PROFILE_ROWS)
+      .map(({ caller, callee, calls, inclusiveTime }) => ({
+        caller: caller ?? "<program start>",
+        callee,
+        calls,
+        "inclusive time": inclusiveTime.toFixed(3),
+      })),
+  );
+}
+
+const HEAP_LEAK_ROWS = 20;
+
+function printHeapStats(moduleRepository, allocationSitePositions = []) {
+  const { sizeHistogram, ...heapStats } = moduleRepository.getHeapStats();
+  console.log("\nHeap statistics:");
+  console.table({
+    ...heapStats,
+    fragmentation: heapStats.fragmentation.toFixed(3),
+  });
+  console.log("Allocations by size (bytes):");
+  console.table(
+    sizeHistogram.map(({ maxSize, count }) => ({
+      "up to": maxSize,
+      allocations: count,
+    })),
+  );
+  const leaks = moduleRepository.getHeapLeaks();
+  if (leaks.length === 0) {
+    console.log("All allocated blocks were freed");
+    return;
+  }
+  console.log(
+    `${heapStats.liveBytes} bytes in ${leaks.length} blocks were not freed:`,
+  );
+  console.table(
+    leaks.slice(0, HEAP_LEAK_ROWS).map(({ address, size, allocationSite }) => {
+      const position = allocationSitePositions[allocationSite];
+      return {
+        address,
+        size,
+        "allocated at": position
+          ? `line ${position.start.line}, column ${position.start.column}`
+          : "unknown",
+      };
+    }),
+  );
+}
 
 let outputFile;
 let output;
@@ -61,7 +500,7 @@ let isSuccess = true;
 switch (argv._[0]) {
   case "compile":
     outputFile = argv.o ? path.resolve(argv.o) : path.resolve("output/a.wasm");
-    result = await compile(input);
+    result = await compile(input, compilationCache, compilationOptions);
     if (result.status === "failure") {
       isSuccess = false;
       console.log(
@@ -76,16 +515,18 @@ switch (argv._[0]) {
         )}`,
       );
     }
+    printCompilationMetrics(result.metrics);
     output = result.wasm;
     break;
   case "compile-to-wat":
     outputFile = argv.o ? path.resolve(argv.o) : path.resolve("output/a.wat");
-    result = compileToWat(input);
+    result = compileToWat(input, compilationOptions);
     if (result.status === "failure") {
       isSuccess = false;
       console.log(result.errorMessage);
       break;
     }
+    printCompilationMetrics(result.metrics);
     if (result.warnings.length > 0) {
       console.log(
         `Compilation finished with the following warnings:\n${result.warnings.join(
@@ -96,9 +537,7 @@ switch (argv._[0]) {
     output = result.watOutput;
     break;
   case "compile-run":
-    // save WAT before running
-    outputFile = argv.o ? path.resolve(argv.o) : path.resolve("output/a.wat");
-    result = compileToWat(input);
+    result = await compile(input, compilationCache, compilationOptions);
     if (result.status === "failure") {
       isSuccess = false;
       console.log(
@@ -113,8 +552,85 @@ switch (argv._[0]) {
         )}`,
       );
     }
-    output = result.watOutput;
-    await compileAndRun(input);
+    printCompilationMetrics(result.metrics);
+    // the WAT is only generated when it is to be saved, as the run needs only the wasm
+    if (argv.o) {
+      outputFile = path.resolve(argv.o);
+      output = compileToWat(input, compilationOptions).watOutput;
+    }
+    // threaded programs always run in worker threads
+    if (typeof argv.timeLimit !== "undefined" || argv.threads) {
+      if (argv.profile || argv.trace || argv.heapStats) {
+        isSuccess = false;
+        console.log(
+          "--profile, --trace and --heap-stats cannot be used with --time-limit or --threads",
+        );
+        break;
+      }
+      const startProgramWorker = () =>
+        fromNodeWorker(
+          new Worker(new URL("./programWorker.js", import.meta.url)),
+        );
+      const runResult = await WorkerRun.start(startProgramWorker(), result, {
+        printFunction: (str) => console.log(str),
+        fuelLimit: argv.fuel,
+        stdin,
+        timeLimitMs: argv.timeLimit,
+        spawnThreadWorker: startProgramWorker,
+      }).result;
+      if (runResult.status === "success") {
+        if (typeof runResult.fuelUsed !== "undefined") {
+          console.log(`Fuel used: ${runResult.fuelUsed}`);
+        }
+      } else {
+        console.log(runResult.errorMessage ?? "Program was cancelled");
+      }
+      break;
+    }
+    {
+      const profiler = argv.profile
+        ? new Profiler(result.profiledFunctionNames)
+        : undefined;
+      const tracer = argv.trace
+        ? new TraceRecorder(result.traceSymbols)
+        : undefined;
+      try {
+        const moduleRepository = await runWasm(
+          result.wasm,
+          result.dataSegmentSize,
+          result.functionTableSize,
+          result.importedModules,
+          {
+            printFunction: (str) => console.log(str),
+            fuelLimit: argv.fuel,
+            profiler,
+            tracer,
+            stdin,
+          },
+        );
+        if (typeof argv.fuel !== "undefined") {
+          console.log(`Fuel used: ${moduleRepository.getFuelUsed()}`);
+        }
+        if (argv.heapStats) {
+          printHeapStats(moduleRepository, result.allocationSitePositions);
+        }
+      } catch (e) {
+        if (!(e instanceof FuelExhaustedError)) {
+          throw e;
+        }
+        console.log(e.message);
+      }
+      if (profiler) {
+        printProfile(profiler);
+      }
+      if (tracer) {
+        console.log(
+          `\nTrace: ${tracer.numberOfSteps} steps, ${tracer.getNumberOfKeyframes()} keyframes, ${tracer.getByteLength()} bytes${
+            tracer.truncated ? " (truncated at the memory budget)" : ""
+          }`,
+        );
+      }
+    }
     break;
   case "generate-c-ast":
     outputFile = argv.o
@@ -134,9 +650,51 @@ switch (argv._[0]) {
       : path.resolve("output/wat-ast.json");
     output = generate_WAT_AST(input);
     break;
+  case "filter-headless": {
+    outputFile = argv.o
+      ? path.resolve(argv.o)
+      : path.resolve("output/filter-telemetry.json");
+    result = await compile(input);
+    if (result.status === "failure") {
+      isSuccess = false;
+      console.log(
+        `Compilation failed with the following errors:\n${result.errorMessage}`,
+      );
+      break;
+    }
+    const pipeline = await FilterPipeline.start(
+      fromNodeWorker(
+        new Worker(new URL("./pixNFlixWorker.js", import.meta.url)),
+      ),
+      result,
+      { height: argv.height, width: argv.width, fps: argv.fps },
+    );
+    const telemetry = await runHeadlessPipeline(pipeline, {
+      height: argv.height,
+      width: argv.width,
+      numberOfFrames: argv.frames,
+      fps: argv.fps,
+    });
+    pipeline.stop();
+    console.log(
+      `Filtered ${telemetry.framesFiltered} of ${telemetry.framesSubmitted} frames (${telemetry.framesDropped} dropped), average filter time ${telemetry.averageFilterTimeMs.toFixed(
+        2,
+      )} ms, max ${telemetry.maxFilterTimeMs.toFixed(2)} ms, frame budget ${telemetry.frameBudgetMs.toFixed(2)} ms`,
+    );
+    output = JSON.stringify(telemetry, null, 2);
+    break;
+  }
+}
+
+if (compilationCache) {
+  const { memoryHits, storeHits, misses } = compilationCache.getMetrics();
+  console.log(
+    `Compilation cache: ${memoryHits + storeHits} hits, ${misses} misses`,
+  );
 }
 
-if (isSuccess) {
+// compile-run saves its output only when given an output file path
+if (isSuccess && typeof outputFile !== "undefined") {
   // create the output directory if output file path provided
   fs.mkdirSync(path.dirname(outputFile), { recursive: true });
 
@@ -0,0 +1,7 @@
+/**
+ * Worker thread script that runs pix_n_flix filters for the filter-headless command of cmd.js.
+ */
+import { parentPort } from "node:worker_threads";
+import { nodeWorkerPort, startFilterWorker } from "./dist/index.js";
+
+startFilterWorker(nodeWorkerPort(parentPort));
@@ -0,0 +1,9 @@
+/**
+ * Worker thread script that runs compiled programs for the --time-limit and --threads options of the compile-run
+ * command of cmd.js. Each thread of a program compiled with the threads option runs in another worker running this
+ * script, which cmd.js starts.
+ */
+import { parentPort } from "node:worker_threads";
+import { nodeProgramWorkerPort, startProgramWorker } from "./dist/index.js";
+
+startProgramWorker(nodeProgramWorkerPort(parentPort));
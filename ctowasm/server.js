@@ -0,0 +1,99 @@
+/**
+ * Persistent compile server. Keeps the compiler loaded and handles compile and compile-and-run requests one after another,
+ * using a JSON-lines protocol (see src/compileServer.ts) over stdin/stdout, or over a local socket.
+ * Latency percentiles of the handled requests are printed to stderr when the server exits.
+ */
+import {
+  CompilationCache,
+  CompileServer,
+  DirectoryCompilationCacheStore,
+} from "./dist/index.js";
+import yargs from "yargs";
+import * as fs from "fs";
+import { createHash } from "node:crypto";
+import * as fsPromises from "fs/promises";
+import * as net from "node:net";
+import * as path from "node:path";
+import * as readline from "node:readline";
+import { hideBin } from "yargs/helpers";
+
+const argv = yargs(hideBin(process.argv))
+  .usage("Usage: $0 [args]")
+  .options({
+    socket: {
+      type: "string",
+      describe:
+        "Path of a local socket to listen on, instead of reading requests from stdin",
+    },
+    "cache-dir": {
+      type: "string",
+      describe: "Directory to persist cached compilation results in",
+    },
+  }).argv;
+
+const server = new CompileServer(
+  new CompilationCache({
+    store: argv.cacheDir
+      ? new DirectoryCompilationCacheStore(
+          fsPromises,
+          path.resolve(argv.cacheDir),
+        )
+      : undefined,
+    // results cached by another build of the compiler are never reused
+    compilerFingerprint: createHash("sha256")
+      .update(fs.readFileSync(new URL("./dist/index.js", import.meta.url)))
+      .digest("hex"),
+  }),
+);
+
+/**
+ * Handles the requests of one input stream, writing each response to output in order of the requests.
+ */
+function serve(input, output) {
+  const lines = readline.createInterface({ input, crlfDelay: Infinity });
+  lines.on("line", (line) => {
+    if (line.trim() === "") {
+      return;
+    }
+    server.handleLine(line).then((response) => output.write(response + "\n"));
+  });
+  return lines;
+}
+
+function printLatencyStats() {
+  for (const [type, stats] of Object.entries(server.getLatencyStats())) {
+    console.error(
+      `${type}: ${stats.count} requests, p50 ${stats.p50.toFixed(
+        2,
+      )} ms, p90 ${stats.p90.toFixed(2)} ms, p99 ${stats.p99.toFixed(
+        2,
+      )} ms, max ${stats.max.toFixed(2)} ms`,
+    );
+  }
+}
+
+if (argv.socket) {
+  const socketPath = path.resolve(argv.socket);
+  if (fs.existsSync(socketPath)) {
+    fs.unlinkSync(socketPath); // left behind by a previous server
+  }
+  const socketServer = net.createServer((connection) =>
+    serve(connection, connection),
+  );
+  socketServer.listen(socketPath, () =>
+    console.error(`Compile server listening on ${socketPath}`),
+  );
+  process.on("SIGINT", async () => {
+    socketServer.close();
+    await server.close(); // the requests in progress are still answered
+    printLatencyStats();
+    process.exit(0);
+  });
+} else {
+  // stdout carries the responses, so anything else logged goes to stderr
+  console.log = console.error;
+  serve(process.stdin, process.stdout).on("close", async () => {
+    await server.close(); // wait for the requests in progress
+    printLatencyStats();
+  });
+}
@@ -0,0 +1,168 @@
+/**
+ * Compiling and running of programs in batches, e.g. for grading many submissions against the same test cases.
+ * Each job is one program, which is compiled once and then run once per test case.
+ *
+ * Jobs are independent, so a batch can be spread across workers (see the batch command of cmd.js), each of which
+ * calls runBatchJob for the jobs given to it. Within a worker, the default module repository used for compilation and
+ * the compiled Emscripten library modules are shared by all the jobs it runs. Given a compilation cache whose store is
+ * shared by all the workers (e.g. a DirectoryCompilationCacheStore on one directory), a program is only compiled once
+ * across the workers and across runs of the batch.
+ */
+
+import { compile } from "~src/index";
+import { CompilationResult } from "~src/compiler";
+import CompilationCache from "~src/compilationCache";
+import { runWasm } from "~src/runWasm";
+import { FuelExhaustedError } from "~src/modules";
+import { HeapStats } from "~src/modules/source_stdlib/heapStats";
+
+export interface BatchTestCase {
+  stdin?: string;
+  expectedOutput?: string; // if not given, the output of the program is reported without being checked
+}
+
+export interface BatchJob {
+  file: string; // identifies the program in the results
+  source: string;
+  testCases: BatchTestCase[]; // the program is run once without input if there are none
+  fuelLimit?: number; // if given, the program is compiled with fuel metering and each run is limited to this many steps
+}
+
+/**
+ * "passed"/"failed" - the program ran to completion, and its output did/did not match the expected output.
+ * "ran" - the program ran to completion, and there was no expected output to check against.
+ * "error" - the program failed at runtime.
+ */
+export type BatchTestCaseStatus = "passed" | "failed" | "ran" | "error";
+
+export interface BatchTestCaseResult {
+  status: BatchTestCaseStatus;
+  runTimeMs: number;
+  output: string;
+  errorMessage?: string;
+  fuelUsed?: number; // only for programs compiled with fuel metering
+  heapStats?: HeapStats; // only for runs to completion, the bytes leaked by the program are its liveBytes
+}
+
+export interface BatchJobResult {
+  file: string;
+  // whether the program compiled. "timeout" is only set by the batch runner, if the job was stopped for taking too long
+  status: "success" | "failure" | "timeout";
+  compileTimeMs: number;
+  compilationCached?: boolean; // only for jobs run with a compilation cache, whether the program was taken from it
+  errorMessage?: string;
+  warnings?: string[];
+  testCases: BatchTestCaseResult[];
+}
+
+/**
+ * Outputs are compared ignoring trailing whitespace, including a missing or extra final newline.
+ */
+export function isOutputMatching(output: string, expectedOutput: string) {
+  return output.trimEnd() === expectedOutput.trimEnd();
+}
+
+export async function runBatchJob(
+  job: BatchJob,
+  cache?: CompilationCache,
+): Promise<BatchJobResult> {
+  const compileStartTime = performance.now();
+  const missesBefore = cache?.getMetrics().misses;
+  const compilationResult = await compile(job.source, cache, {
+    fuelMetering: typeof job.fuelLimit !== "undefined",
+  });
+  const result = await runCompiledBatchJob(
+    job,
+    compilationResult,
+    performance.now() - compileStartTime,
+  );
+  if (typeof cache === "undefined") {
+    return result;
+  }
+  return {
+    ...result,
+    compilationCached: cache.getMetrics().misses === missesBefore,
+  };
+}
+
+/**
+ * Runs the test cases of a job whose program has been compiled (with fuel metering if the job has a fuel limit).
+ */
+export async function runCompiledBatchJob(
+  job: BatchJob,
+  compilationResult: CompilationResult,
+  compileTimeMs: number,
+): Promise<BatchJobResult> {
+  const isFuelMetered = typeof job.fuelLimit !== "undefined";
+  if (compilationResult.status === "failure") {
+    return {
+      file: job.file,
+      status: "failure",
+      compileTimeMs,
+      errorMessage: compilationResult.errorMessage,
+      testCases: [],
+    };
+  }
+
+  const { wasm, dataSegmentSize, functionTableSize, importedModules } =
+    compilationResult;
+  const testCases = job.testCases.length > 0 ? job.testCases : [{}];
+  const testCaseResults: BatchTestCaseResult[] = [];
+  for (const testCase of testCases) {
+    const output: string[] = [];
+    const runStartTime = performance.now();
+    let errorMessage: string | undefined;
+    let fuelUsed: bigint | undefined;
+    let heapStats: HeapStats | undefined;
+    try {
+      const moduleRepository = await runWasm(
+        wasm,
+        dataSegmentSize,
+        functionTableSize,
+        importedModules,
+        {
+          printFunction: (str) => output.push(str),
+          fuelLimit: job.fuelLimit,
+          stdin: testCase.stdin,
+        },
+      );
+      fuelUsed = moduleRepository.getFuelUsed();
+      heapStats = moduleRepository.getHeapStats();
+    } catch (e) {
+      errorMessage = e instanceof Error ? e.message : String(e);
+      if (e instanceof FuelExhaustedError) {
+        fuelUsed = e.fuelLimit;
+      }
+    }
+    const runTimeMs = performance.now() - runStartTime;
+    const joinedOutput = output.join("\n");
+    let status: BatchTestCaseStatus;
+    if (typeof errorMessage !== "undefined") {
+      status = "error";
+    } else if (typeof testCase.expectedOutput === "undefined") {
+      status = "ran";
+    } else {
+      status = isOutputMatching(joinedOutput, testCase.expectedOutput)
+        ? "passed"
+        : "failed";
+    }
+    testCaseResults.push({
+      status,
+      runTimeMs,
+      output: joinedOutput,
+      ...(typeof errorMessage !== "undefined" ? { errorMessage } : {}),
+      ...(isFuelMetered && typeof fuelUsed !== "undefined"
+        ? { fuelUsed: Number(fuelUsed) }
+        : {}),
+      ...(typeof heapStats !== "undefined" ? { heapStats } : {}),
+    });
+  }
+
+  return {
+    file: job.file,
+    status: "success",
+    compileTimeMs,
+    warnings: compilationResult.warnings,
+    testCases: testCaseResults,
+  };
+}
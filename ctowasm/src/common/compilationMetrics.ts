@@ -0,0 +1,46 @@
+/**
+ * Metrics of a compilation, collected when compiling with the metrics option: the time taken by each phase of the
+ * compiler pipeline, and the sizes of what each phase produced.
+ */
+
+export interface CompilationPhaseTimings {
+  preprocessMs: number;
+  lexMs: number;
+  parseMs: number;
+  processMs: number;
+  translateMs: number;
+  generateWatMs: number;
+  compileWatToWasmMs?: number; // not for compilations to WAT
+}
+
+export interface CompilationMetrics {
+  phaseTimings: CompilationPhaseTimings;
+  totalMs: number; // includes the time taken to collect the metrics
+  cAstNodeCount: number;
+  processedCAstNodeCount: number;
+  wasmAstNodeCount: number;
+  watLength: number; // WAT is ASCII, so this is also its size in bytes
+  wasmByteLength?: number; // not for compilations to WAT
+  numberOfFunctions: number; // wasm functions, including the wrappers of imported functions
+}
+
+/**
+ * Counts the nodes (objects with a type) of an AST. The same node is counted as many times as it is referenced.
+ */
+export function countAstNodes(node: unknown): number {
+  if (typeof node !== "object" || node === null) {
+    return 0;
+  }
+  if (Array.isArray(node)) {
+    let count = 0;
+    for (const child of node) {
+      count += countAstNodes(child);
+    }
+    return count;
+  }
+  let count = typeof (node as { type?: unknown }).type === "string" ? 1 : 0;
+  for (const value of Object.values(node)) {
+    count += countAstNodes(value);
+  }
+  return count;
+}
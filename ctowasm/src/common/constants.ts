@@ -3,9 +3,12 @@
  * These constants are used across compiler modules.
  */
 
+import packageJson from "../../package.json";
+
 export const WASM_ADDR_SIZE = 4; // number of bytes of a wasm address
 export const POINTER_SIZE = WASM_ADDR_SIZE; // size of a pointer in bytes - should be same as WASM_ADDR_SIZE
 export const SIZE_T = "unsigned int"; // implmentation-defined
 export const PTRDIFF_T = "signed int"; // defined type for difference between pointers
 export const POINTER_TYPE = "unsigned int"; // type equivalent to pointer for this compiler implementation
 export const ENUM_DATA_TYPE = "signed int"; // the datatype that enum directly corresponds to in this compiler implementation
+export const COMPILER_VERSION: string = packageJson.version; // taken from package.json when built. Part of the key of cached compilation results.
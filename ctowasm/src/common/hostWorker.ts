@@ -0,0 +1,75 @@
+/**
+ * The host side of the workers that compiled programs run in (see src/workerRun.ts, src/threadsRun.ts and
+ * src/modules/pix_and_flix/filterPipeline.ts), adapted so that both browser Workers and Node.js worker_threads can be used.
+ */
+
+/**
+ * The interface the host uses to talk to a worker.
+ */
+export interface HostWorker<Request, Response> {
+  postMessage(message: Request): void;
+  setMessageHandler(handler: (message: Response) => void): void;
+  /**
+   * Sets the handler called with an error message if the worker fails without responding: an uncaught error in the
+   * worker, a message from it that could not be deserialized, or (for Node.js worker_threads) the worker exiting.
+   * Failures after the worker was terminated by the host should be ignored by the handler.
+   */
+  setFailureHandler(handler: (message: string) => void): void;
+  terminate(): void;
+}
+
+/**
+ * Adapts a browser Worker.
+ */
+export function fromBrowserWorker<Request, Response>(worker: {
+  postMessage(message: unknown): void;
+  onmessage: ((event: MessageEvent) => void) | null;
+  onerror: ((event: ErrorEvent) => void) | null;
+  onmessageerror: ((event: MessageEvent) => void) | null;
+  terminate(): void;
+}): HostWorker<Request, Response> {
+  return {
+    postMessage: (message) => worker.postMessage(message),
+    setMessageHandler: (handler) => {
+      worker.onmessage = (event) => handler(event.data);
+    },
+    setFailureHandler: (handler) => {
+      worker.onerror = (event) => {
+        event.preventDefault(); // handled here, rather than reported as uncaught on the page
+        handler(event.message);
+      };
+      worker.onmessageerror = () =>
+        handler("a message from the worker could not be deserialized");
+    },
+    terminate: () => worker.terminate(),
+  };
+}
+
+/**
+ * Adapts a Node.js worker_threads Worker.
+ */
+export function fromNodeWorker<Request, Response>(worker: {
+  postMessage(message: unknown): void;
+  on(event: "message", listener: (message: never) => void): unknown;
+  on(event: "error", listener: (error: Error) => void): unknown;
+  on(event: "messageerror", listener: (error: Error) => void): unknown;
+  on(event: "exit", listener: (exitCode: number) => void): unknown;
+  terminate(): unknown;
+}): HostWorker<Request, Response> {
+  return {
+    postMessage: (message) => worker.postMessage(message),
+    setMessageHandler: (handler) => {
+      worker.on("message", handler);
+    },
+    setFailureHandler: (handler) => {
+      worker.on("error", (error) => handler(error.message));
+      worker.on("messageerror", (error) => handler(error.message));
+      worker.on("exit", (exitCode) =>
+        handler(`worker exited with code ${exitCode}`),
+      );
+    },
+    terminate: () => {
+      worker.terminate();
+    },
+  };
+}
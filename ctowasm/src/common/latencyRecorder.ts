@@ -0,0 +1,46 @@
+export interface LatencyPercentiles {
+  count: number;
+  p50: number;
+  p90: number;
+  p99: number;
+  max: number;
+}
+
+const MAX_LATENCY_SAMPLES = 10000; // only the latest samples are kept for the percentiles
+
+/**
+ * Records latencies, keeping the latest MAX_LATENCY_SAMPLES samples.
+ */
+export default class LatencyRecorder {
+  private samples: number[] = [];
+  private nextIndex = 0;
+  count = 0;
+
+  record(latencyMs: number) {
+    if (this.samples.length < MAX_LATENCY_SAMPLES) {
+      this.samples.push(latencyMs);
+    } else {
+      this.samples[this.nextIndex] = latencyMs;
+      this.nextIndex = (this.nextIndex + 1) % MAX_LATENCY_SAMPLES;
+    }
+    ++this.count;
+  }
+
+  /**
+   * Returns the nearest-rank percentiles of the recorded samples.
+   */
+  getPercentiles(): LatencyPercentiles {
+    const sorted = [...this.samples].sort((a, b) => a - b);
+    const percentile = (p: number) =>
+      sorted.length === 0
+        ? 0
+        : sorted[Math.max(0, Math.ceil((p / 100) * sorted.length) - 1)];
+    return {
+      count: this.count,
+      p50: percentile(50),
+      p90: percentile(90),
+      p99: percentile(99),
+      max: sorted.length === 0 ? 0 : sorted[sorted.length - 1],
+    };
+  }
+}
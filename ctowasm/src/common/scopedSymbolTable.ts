@@ -0,0 +1,173 @@
+/**
+ * Symbol table design shared by the parser and the processor.
+ *
+ * Identifiers are interned to integer ids (by the lexer, see src/parser/tokenTable.ts, and the same IdentifierTable is
+ * then handed to the later stages). A ScopedSymbolTable is a single flat array, indexed by identifier id, of shadowing
+ * stacks: the top of the stack of an identifier is its innermost visible declaration. Looking up a symbol is therefore
+ * independent of how deeply scopes are nested.
+ *
+ * Scopes are delimited by markers in a log of the identifiers declared so far. Entering a scope pushes a marker, and
+ * exiting it pops the stacks of the identifiers declared since that marker.
+ */
+
+/**
+ * Interned identifier names, each distinct name getting an id (its index in names).
+ */
+export class IdentifierTable {
+  names: string[] = []; // by identifier id
+  private idsByName: Map<string, number> = new Map();
+
+  /**
+   * Returns the id of the given name, giving it a new id if it has none yet.
+   */
+  intern(name: string): number {
+    let id = this.idsByName.get(name);
+    if (typeof id === "undefined") {
+      id = this.names.length;
+      this.names.push(name);
+      this.idsByName.set(name, id);
+    }
+    return id;
+  }
+
+  /**
+   * Returns the id of the given name, or -1 if it was never interned.
+   */
+  getId(name: string): number {
+    const id = this.idsByName.get(name);
+    return typeof id === "undefined" ? -1 : id;
+  }
+
+  getName(id: number): string {
+    return this.names[id];
+  }
+}
+
+const GLOBAL_SCOPE_DEPTH = 0;
+
+export default class ScopedSymbolTable<T> {
+  readonly identifiers: IdentifierTable;
+  // shadowing stacks by identifier id, and the depth of the scope each entry was declared in
+  private entryStacks: T[][] = [];
+  private depthStacks: number[][] = [];
+  // ids of the identifiers declared in the open scopes, in order of declaration
+  private declaredIds: number[] = [];
+  // length of declaredIds when each open scope (other than the global scope) was entered
+  private scopeMarkers: number[] = [];
+
+  constructor(identifiers: IdentifierTable = new IdentifierTable()) {
+    this.identifiers = identifiers;
+  }
+
+  /**
+   * Depth of the current scope, the global scope being at depth 0.
+   */
+  get scopeDepth(): number {
+    return this.scopeMarkers.length;
+  }
+
+  enterScope() {
+    this.scopeMarkers.push(this.declaredIds.length);
+  }
+
+  /**
+   * Removes all the entries declared in the current scope, uncovering the entries they shadowed.
+   */
+  exitScope() {
+    if (this.scopeMarkers.length === GLOBAL_SCOPE_DEPTH) {
+      throw new Error("ScopedSymbolTable: cannot exit the global scope");
+    }
+    const marker = this.scopeMarkers.pop() as number;
+    while (this.declaredIds.length > marker) {
+      const id = this.declaredIds.pop() as number;
+      this.entryStacks[id].pop();
+      this.depthStacks[id].pop();
+    }
+  }
+
+  /**
+   * Declares the given name in the current scope, shadowing its declarations in enclosing scopes.
+   * An existing entry of the name in the current scope is replaced.
+   */
+  declare(name: string, entry: T) {
+    this.declareById(this.identifiers.intern(name), entry);
+  }
+
+  declareById(id: number, entry: T) {
+    const depth = this.scopeMarkers.length;
+    const entries = this.getEntryStack(id);
+    const depths = this.depthStacks[id];
+    if (depths.length > 0 && depths[depths.length - 1] === depth) {
+      entries[entries.length - 1] = entry;
+      return;
+    }
+    entries.push(entry);
+    depths.push(depth);
+    this.declaredIds.push(id);
+  }
+
+  /**
+   * Returns the innermost visible entry of the given name, or undefined if it is not declared.
+   */
+  lookup(name: string): T | undefined {
+    const id = this.identifiers.getId(name);
+    return id === -1 ? undefined : this.lookupById(id);
+  }
+
+  lookupById(id: number): T | undefined {
+    const entries = this.entryStacks[id];
+    return entries && entries.length > 0
+      ? entries[entries.length - 1]
+      : undefined;
+  }
+
+  /**
+   * Returns the entry of the given name declared in the current scope, or undefined if it is not declared in it.
+   */
+  lookupInCurrentScope(name: string): T | undefined {
+    const id = this.identifiers.getId(name);
+    if (id === -1) {
+      return undefined;
+    }
+    const depths = this.depthStacks[id];
+    return depths &&
+      depths.length > 0 &&
+      depths[depths.length - 1] === this.scopeMarkers.length
+      ? this.lookupById(id)
+      : undefined;
+  }
+
+  /**
+   * Pushes an entry onto the shadowing stack of the given name, outside of the scope markers.
+   * For users that track the extent of scopes themselves (the parser, which cannot tell where a scope ends until it has
+   * parsed it), each push is undone with pop(). Must not be mixed with declare() in the same table.
+   */
+  push(name: string, entry: T) {
+    const id = this.identifiers.intern(name);
+    this.getEntryStack(id).push(entry);
+    this.depthStacks[id].push(this.scopeMarkers.length);
+  }
+
+  /**
+   * Pops the innermost entry of the given name. Returns it, or undefined if the name has no entry.
+   */
+  pop(name: string): T | undefined {
+    const id = this.identifiers.getId(name);
+    const entries = id === -1 ? undefined : this.entryStacks[id];
+    if (!entries || entries.length === 0) {
+      return undefined;
+    }
+    this.depthStacks[id].pop();
+    return entries.pop();
+  }
+
+  private getEntryStack(id: number): T[] {
+    let entries = this.entryStacks[id];
+    if (!entries) {
+      entries = [];
+      this.entryStacks[id] = entries;
+      this.depthStacks[id] = [];
+    }
+    return entries;
+  }
+}
@@ -0,0 +1,297 @@
+/**
+ * Content-addressed cache of successful compilation results.
+ *
+ * Results are keyed by a SHA-256 hash of the source program, the compiler version, the compilation options and the
+ * signatures of all module functions, so a cached result is only ever reused for an identical compilation.
+ * The compiler version only changes on a release, so a persistent store should also be given a fingerprint of the build
+ * of the compiler (e.g. a hash of the built package, as cmd.js does), which keeps results of another build from being
+ * reused.
+ * Results are kept in a bounded in-memory LRU, and optionally in a persistent store (e.g. a directory on disk under Node.js)
+ * so that they survive across processes.
+ */
+
+import { COMPILER_VERSION } from "~src/common/constants";
+import {
+  CompilationResult,
+  SuccessfulCompilationResult,
+} from "~src/compiler";
+import ModuleRepository from "~src/modules";
+
+export const DEFAULT_CACHE_MAX_ENTRIES = 256;
+export const DEFAULT_CACHE_MAX_BYTES = 64 * 1024 * 1024; // total size of the wasm of the entries in memory
+
+/**
+ * Persistent store for cached compilation results.
+ */
+export interface CompilationCacheStore {
+  get(key: string): Promise<SuccessfulCompilationResult | undefined>;
+  set(key: string, result: SuccessfulCompilationResult): Promise<void>;
+}
+
+/**
+ * The subset of the Node.js "fs/promises" API used by DirectoryCompilationCacheStore.
+ */
+export interface CacheFileSystem {
+  readFile(path: string): Promise<Uint8Array>;
+  readFile(path: string, encoding: "utf-8"): Promise<string>;
+  writeFile(path: string, data: Uint8Array | string): Promise<void>;
+  rename(oldPath: string, newPath: string): Promise<void>;
+  mkdir(path: string, options: { recursive: true }): Promise<unknown>;
+}
+
+/**
+ * Stores each result as a "<key>.wasm" file with the wasm, and a "<key>.json" file with the rest of the result.
+ * Both files are written under a name of their own first and then renamed, the json file last, so an entry is only
+ * visible once completely written, even when several stores (e.g. in the workers of a batch) write the same entry.
+ * Usage under Node.js: new DirectoryCompilationCacheStore(await import("fs/promises"), cacheDirectory)
+ */
+export class DirectoryCompilationCacheStore implements CompilationCacheStore {
+  private fs: CacheFileSystem;
+  private directory: string;
+  private directoryCreated = false;
+  // distinguishes the temporary files of this store from those of other stores on the same directory
+  private temporaryFileSuffix = Math.random().toString(36).slice(2);
+  private numberOfWrites = 0;
+
+  constructor(fs: CacheFileSystem, directory: string) {
+    this.fs = fs;
+    this.directory = directory.replace(/\/+$/, "");
+  }
+
+  async get(key: string): Promise<SuccessfulCompilationResult | undefined> {
+    try {
+      const {
+        dataSegmentSize,
+        functionTableSize,
+        importedModules,
+        warnings,
+        profiledFunctionNames,
+        traceSymbols,
+        allocationSitePositions,
+        threads,
+      } = JSON.parse(
+        await this.fs.readFile(`${this.directory}/${key}.json`, "utf-8"),
+      );
+      const wasm = await this.fs.readFile(`${this.directory}/${key}.wasm`);
+      return {
+        status: "success",
+        wasm: new Uint8Array(wasm),
+        dataSegmentSize,
+        functionTableSize,
+        importedModules,
+        warnings,
+        ...(profiledFunctionNames ? { profiledFunctionNames } : {}),
+        ...(traceSymbols ? { traceSymbols } : {}),
+        ...(allocationSitePositions ? { allocationSitePositions } : {}),
+        ...(threads ? { threads } : {}),
+      };
+    } catch (e) {
+      return undefined; // not in the store, or unreadable
+    }
+  }
+
+  async set(key: string, result: SuccessfulCompilationResult): Promise<void> {
+    if (!this.directoryCreated) {
+      await this.fs.mkdir(this.directory, { recursive: true });
+      this.directoryCreated = true;
+    }
+    const wasmPath = `${this.directory}/${key}.wasm`;
+    const jsonPath = `${this.directory}/${key}.json`;
+    const temporarySuffix = `.${this.temporaryFileSuffix}-${++this.numberOfWrites}.tmp`;
+    await this.fs.writeFile(`${wasmPath}${temporarySuffix}`, result.wasm);
+    await this.fs.rename(`${wasmPath}${temporarySuffix}`, wasmPath);
+    await this.fs.writeFile(
+      `${jsonPath}${temporarySuffix}`,
+      JSON.stringify({
+        dataSegmentSize: result.dataSegmentSize,
+        functionTableSize: result.functionTableSize,
+        importedModules: result.importedModules,
+        warnings: result.warnings,
+        profiledFunctionNames: result.profiledFunctionNames,
+        traceSymbols: result.traceSymbols,
+        allocationSitePositions: result.allocationSitePositions,
+        threads: result.threads,
+      }),
+    );
+    await this.fs.rename(`${jsonPath}${temporarySuffix}`, jsonPath);
+  }
+}
+
+export interface CompilationCacheMetrics {
+  memoryHits: number;
+  storeHits: number;
+  misses: number;
+  evictions: number; // entries evicted from memory
+  entries: number; // entries currently in memory
+  bytes: number; // total wasm size of entries currently in memory
+}
+
+export interface CompilationCacheOptions {
+  maxEntries?: number;
+  maxBytes?: number;
+  store?: CompilationCacheStore;
+  compilerFingerprint?: string; // identifies the build of the compiler, part of every key
+}
+
+// signatures of the module functions of each module repository, computed once per repository
+const moduleSignatures: WeakMap<ModuleRepository, string> = new WeakMap();
+
+function getModuleSignatures(moduleRepository: ModuleRepository) {
+  let signatures = moduleSignatures.get(moduleRepository);
+  if (typeof signatures === "undefined") {
+    const functionTypes: Record<string, unknown> = {};
+    for (const [moduleName, module] of Object.entries(
+      moduleRepository.modules,
+    )) {
+      for (const [functionName, moduleFunction] of Object.entries(
+        module.moduleFunctions,
+      )) {
+        functionTypes[`${moduleName}.${functionName}`] =
+          moduleFunction.functionType;
+      }
+    }
+    // data types can contain bigints (e.g. number of elements of arrays)
+    signatures = JSON.stringify(functionTypes, (_, value) =>
+      typeof value === "bigint" ? value.toString() : value,
+    );
+    moduleSignatures.set(moduleRepository, signatures);
+  }
+  return signatures;
+}
+
+async function sha256(str: string): Promise<string> {
+  const digest = await crypto.subtle.digest(
+    "SHA-256",
+    new TextEncoder().encode(str),
+  );
+  return Array.from(new Uint8Array(digest), (byte) =>
+    byte.toString(16).padStart(2, "0"),
+  ).join("");
+}
+
+export default class CompilationCache {
+  private maxEntries: number;
+  private maxBytes: number;
+  private store?: CompilationCacheStore;
+  private compilerFingerprint: string;
+  // Map iteration order is insertion order, so the least recently used entry is always the first
+  private entries: Map<string, SuccessfulCompilationResult> = new Map();
+  private metrics: CompilationCacheMetrics = {
+    memoryHits: 0,
+    storeHits: 0,
+    misses: 0,
+    evictions: 0,
+    entries: 0,
+    bytes: 0,
+  };
+
+  constructor(options: CompilationCacheOptions = {}) {
+    this.maxEntries = options.maxEntries ?? DEFAULT_CACHE_MAX_ENTRIES;
+    this.maxBytes = options.maxBytes ?? DEFAULT_CACHE_MAX_BYTES;
+    this.store = options.store;
+    this.compilerFingerprint = options.compilerFingerprint ?? "";
+  }
+
+  /**
+   * Returns the key that identifies the compilation of given source program with given options.
+   */
+  async getKey(
+    cSourceCode: string,
+    moduleRepository: ModuleRepository,
+    options: object = {},
+  ): Promise<string> {
+    return sha256(
+      JSON.stringify([
+        COMPILER_VERSION,
+        this.compilerFingerprint,
+        options,
+        getModuleSignatures(moduleRepository),
+        cSourceCode,
+      ]),
+    );
+  }
+
+  async get(key: string): Promise<SuccessfulCompilationResult | undefined> {
+    const result = this.entries.get(key);
+    if (typeof result !== "undefined") {
+      // move to the most recently used position
+      this.entries.delete(key);
+      this.entries.set(key, result);
+      ++this.metrics.memoryHits;
+      return result;
+    }
+    if (typeof this.store !== "undefined") {
+      const storedResult = await this.store.get(key);
+      if (typeof storedResult !== "undefined") {
+        this.addToMemory(key, storedResult);
+        ++this.metrics.storeHits;
+        return storedResult;
+      }
+    }
+    ++this.metrics.misses;
+    return undefined;
+  }
+
+  async set(key: string, result: SuccessfulCompilationResult): Promise<void> {
+    this.addToMemory(key, result);
+    if (typeof this.store !== "undefined") {
+      await this.store.set(key, result);
+    }
+  }
+
+  /**
+   * Returns the cached result of the compilation identified by given source program and options,
+   * or compiles it with compileFunction if it is not cached. Failed compilations are not cached.
+   */
+  async getOrCompile(
+    cSourceCode: string,
+    moduleRepository: ModuleRepository,
+    compileFunction: () => Promise<CompilationResult>,
+    options: object = {},
+  ): Promise<CompilationResult> {
+    const key = await this.getKey(cSourceCode, moduleRepository, options);
+    const cachedResult = await this.get(key);
+    if (typeof cachedResult !== "undefined") {
+      return cachedResult;
+    }
+    const result = await compileFunction();
+    if (result.status === "success") {
+      await this.set(key, result);
+    }
+    return result;
+  }
+
+  getMetrics(): CompilationCacheMetrics {
+    return { ...this.metrics };
+  }
+
+  clear() {
+    this.entries.clear();
+    this.metrics.entries = 0;
+    this.metrics.bytes = 0;
+  }
+
+  private addToMemory(key: string, result: SuccessfulCompilationResult) {
+    const existing = this.entries.get(key);
+    if (typeof existing !== "undefined") {
+      this.entries.delete(key);
+      this.metrics.bytes -= existing.wasm.byteLength;
+    }
+    this.entries.set(key, result);
+    this.metrics.bytes += result.wasm.byteLength;
+    // evict least recently used entries, always keeping the newest
+    for (const [oldestKey, oldestResult] of this.entries) {
+      if (
+        this.entries.size <= 1 ||
+        (this.entries.size <= this.maxEntries &&
+          this.metrics.bytes <= this.maxBytes)
+      ) {
+        break;
+      }
+      this.entries.delete(oldestKey);
+      this.metrics.bytes -= oldestResult.wasm.byteLength;
+      ++this.metrics.evictions;
+    }
+    this.metrics.entries = this.entries.size;
+  }
+}
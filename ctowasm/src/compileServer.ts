@@ -0,0 +1,206 @@
+/**
+ * Request handling of the persistent compile server (see server.js), which keeps the compiler (parsers, wabt and
+ * any Emscripten library modules) loaded across requests instead of paying for process startup on every compilation.
+ *
+ * Requests and responses are JSON objects, one per line. Every request may have an "id", which is echoed in its response.
+ *   {"type": "compile", "source": "<C program>"}
+ *     -> {"status": "success", "wasm": "<base64>", "dataSegmentSize", "functionTableSize", "importedModules", "warnings"}
+ *   {"type": "compileAndRun", "source": "<C program>"}
+ *     -> {"status": "success", "output": "<printed output>", "warnings"}
+ *   {"type": "stats"} -> {"status": "success", "latency": {<request type>: {count, p50, p90, p99, max}}}
+ * Failed compilations respond with {"status": "failure", "errorMessage"}, and any other error with {"status": "error", "errorMessage"}.
+ * Every response also has "timeMs", the time taken to handle the request.
+ * Once the server is closing (see close()), every request is answered with an error.
+ */
+
+import CompilationCache from "~src/compilationCache";
+import { CompilationResult } from "~src/compiler";
+import { compile, compileAndRun } from "~src/index";
+import LatencyRecorder, {
+  LatencyPercentiles,
+} from "~src/common/latencyRecorder";
+
+export type CompileServerRequestType = "compile" | "compileAndRun" | "stats";
+
+export interface CompileServerRequest {
+  id?: unknown;
+  type: CompileServerRequestType;
+  source?: string;
+}
+
+/**
+ * The functions the server compiles and runs programs with, those of the package unless given otherwise (e.g. in tests).
+ */
+export interface CompileServerCompiler {
+  compile: typeof compile;
+  compileAndRun: typeof compileAndRun;
+}
+
+export type CompileServerResponse = {
+  id?: unknown;
+  status: "success" | "failure" | "error";
+  timeMs: number;
+} & Record<string, unknown>;
+
+function encodeBase64(bytes: Uint8Array) {
+  const CHUNK_SIZE = 0x8000; // avoids exceeding the maximum number of arguments to String.fromCharCode
+  let binary = "";
+  for (let i = 0; i < bytes.length; i += CHUNK_SIZE) {
+    binary += String.fromCharCode(...bytes.subarray(i, i + CHUNK_SIZE));
+  }
+  return btoa(binary);
+}
+
+export default class CompileServer {
+  private cache?: CompilationCache;
+  private compiler: CompileServerCompiler;
+  private latencies: Map<CompileServerRequestType, LatencyRecorder> =
+    new Map();
+  // requests are handled one at a time, in order of arrival
+  private queue: Promise<unknown> = Promise.resolve();
+  private closing = false;
+
+  constructor(
+    cache?: CompilationCache,
+    compiler: CompileServerCompiler = { compile, compileAndRun },
+  ) {
+    this.cache = cache;
+    this.compiler = compiler;
+  }
+
+  /**
+   * Handles one line of the protocol, returning the line of the response.
+   */
+  handleLine(line: string): Promise<string> {
+    if (this.closing) {
+      return Promise.resolve(
+        JSON.stringify({
+          status: "error",
+          errorMessage: "server is shutting down",
+          timeMs: 0,
+        }),
+      );
+    }
+    const response = this.queue.then(async () => {
+      let request: CompileServerRequest;
+      try {
+        request = JSON.parse(line);
+        if (typeof request !== "object" || request === null) {
+          throw new Error("request must be an object");
+        }
+      } catch (e) {
+        return JSON.stringify({
+          status: "error",
+          errorMessage: `invalid request: ${(e as Error).message}`,
+          timeMs: 0,
+        });
+      }
+      return JSON.stringify(await this.handleRequest(request));
+    });
+    this.queue = response;
+    return response;
+  }
+
+  async handleRequest(
+    request: CompileServerRequest,
+  ): Promise<CompileServerResponse> {
+    const startTime = performance.now();
+    let response: Record<string, unknown>;
+    try {
+      response = await this.getResponse(request);
+    } catch (e) {
+      response = {
+        status: "error",
+        errorMessage: e instanceof Error ? e.message : String(e),
+      };
+    }
+    const timeMs = performance.now() - startTime;
+    if (request.type !== "stats" && response.status !== "error") {
+      this.getLatencyRecorder(request.type).record(timeMs);
+    }
+    return {
+      ...(typeof request.id !== "undefined" ? { id: request.id } : {}),
+      ...response,
+      timeMs,
+    } as CompileServerResponse;
+  }
+
+  /**
+   * Stops accepting requests. Resolves once all the requests received before have been handled.
+   */
+  close(): Promise<void> {
+    this.closing = true;
+    return this.queue.then(() => {});
+  }
+
+  getLatencyStats(): Record<string, LatencyPercentiles> {
+    const stats: Record<string, LatencyPercentiles> = {};
+    for (const [type, recorder] of this.latencies) {
+      stats[type] = recorder.getPercentiles();
+    }
+    return stats;
+  }
+
+  private getLatencyRecorder(type: CompileServerRequestType) {
+    let recorder = this.latencies.get(type);
+    if (typeof recorder === "undefined") {
+      recorder = new LatencyRecorder();
+      this.latencies.set(type, recorder);
+    }
+    return recorder;
+  }
+
+  private async getResponse(
+    request: CompileServerRequest,
+  ): Promise<Record<string, unknown>> {
+    switch (request.type) {
+      case "compile": {
+        const result = await this.compiler.compile(
+          getSource(request),
+          this.cache,
+        );
+        if (result.status === "failure") {
+          return result;
+        }
+        return { ...result, wasm: encodeBase64(result.wasm) };
+      }
+      case "compileAndRun": {
+        const output: string[] = [];
+        let result: CompilationResult;
+        try {
+          result = await this.compiler.compileAndRun(
+            getSource(request),
+            { printFunction: (str) => output.push(str) },
+            this.cache,
+          );
+        } catch (e) {
+          // the program failed at runtime, its output up to then is still returned
+          return {
+            status: "error",
+            errorMessage: e instanceof Error ? e.message : String(e),
+            output: output.join("\n"),
+          };
+        }
+        if (result.status === "failure") {
+          return result;
+        }
+        return {
+          status: "success",
+          output: output.join("\n"),
+          warnings: result.warnings,
+        };
+      }
+      case "stats":
+        return { status: "success", latency: this.getLatencyStats() };
+      default:
+        throw new Error(`unknown request type: ${request.type}`);
+    }
+  }
+}
+
+function getSource(request: CompileServerRequest): string {
+  if (typeof request.source !== "string") {
+    throw new Error(`"${request.type}" request has no "source"`);
+  }
+  return request.source;
+}
@@ -1,11 +1,11 @@
 /**
  * Compiler for C to webassembly
  */
-import parse from "./parser";
+import parse, { ParserTracers } from "./parser";
 import process from "./processor";
 import { generateWat } from "./wat-generator";
 import { compileWatToWasm } from "./wat-to-wasm";
-import translate from "~src/translator";
+import translate, { TranslationOptions } from "~src/translator";
 import {
   ParserCompilationErrors,
   SourceCodeError,
@@ -13,6 +13,13 @@ import {
   toJson,
 } from "~src/errors";
 import ModuleRepository, { ModuleName } from "~src/modules";
+import { TraceSymbols } from "~src/translator/tracing";
+import { Position } from "~src/parser/c-ast/misc";
+import {
+  CompilationMetrics,
+  CompilationPhaseTimings,
+  countAstNodes,
+} from "~src/common/compilationMetrics";
 
 export interface SuccessfulCompilationResult {
   status: "success";
@@ -21,6 +28,11 @@ export interface SuccessfulCompilationResult {
   functionTableSize: number; // size of function table = to number of defined functions in program
   importedModules: ModuleName[]; // all the modules imported into this C program
   warnings: string[];
+  profiledFunctionNames?: string[]; // only if compiled with the profile option, used to create a Profiler for the program
+  traceSymbols?: TraceSymbols; // only if compiled with the trace option, used to create a TraceRecorder for the program
+  allocationSitePositions?: Position[]; // only if compiled with the allocationSites option, positions of the call sites of the heap events
+  threads?: boolean; // only if compiled with the threads option, such programs must be run in a worker (see threadsRun.ts)
+  metrics?: CompilationMetrics; // only if compiled with the metrics option
 }
 
 interface FailedCompilationResult {
@@ -32,24 +44,88 @@ export type CompilationResult =
   | SuccessfulCompilationResult
   | FailedCompilationResult;
 
+export interface CompilationOptions extends TranslationOptions {
+  metrics?: boolean; // collect the timings of each compilation phase and the sizes of their outputs
+}
+
+/**
+ * Runs the compiler pipeline up to the generation of the WAT, recording the phase timings and AST sizes in metrics if given.
+ */
+function compileToWatModule(
+  cSourceCode: string,
+  moduleRepository: ModuleRepository,
+  options: CompilationOptions,
+  metrics?: Partial<CompilationMetrics>,
+) {
+  const timings: Partial<CompilationPhaseTimings> = {};
+  const { cAstRoot, warnings, identifiers } = parse(
+    cSourceCode,
+    moduleRepository,
+    metrics ? timings : undefined,
+  );
+  if (metrics) {
+    metrics.cAstNodeCount = countAstNodes(cAstRoot);
+  }
+
+  let phaseStartTime = performance.now();
+  const {
+    astRootNode,
+    includedModules,
+    warnings: processorWarnings,
+  } = process(cAstRoot, moduleRepository, identifiers);
+  timings.processMs = performance.now() - phaseStartTime;
+  warnings.push(
+    ...processorWarnings.map((w) =>
+      generateCompilationWarningMessage(w.message, cSourceCode, w.position),
+    ),
+  );
+  if (metrics) {
+    metrics.processedCAstNodeCount = countAstNodes(astRootNode);
+  }
+
+  phaseStartTime = performance.now();
+  const wasmModule = translate(astRootNode, moduleRepository, options);
+  timings.translateMs = performance.now() - phaseStartTime;
+  if (metrics) {
+    metrics.wasmAstNodeCount = countAstNodes(wasmModule);
+    metrics.numberOfFunctions = Object.keys(wasmModule.functions).length;
+  }
+
+  phaseStartTime = performance.now();
+  const wat = generateWat(wasmModule);
+  timings.generateWatMs = performance.now() - phaseStartTime;
+  if (metrics) {
+    metrics.watLength = wat.length;
+    metrics.phaseTimings = timings as CompilationPhaseTimings;
+  }
+
+  return { wasmModule, wat, includedModules, warnings };
+}
+
 export async function compile(
   cSourceCode: string,
   moduleRepository: ModuleRepository,
+  options: CompilationOptions = {},
 ): Promise<CompilationResult> {
+  const startTime = performance.now();
   try {
-    const { cAstRoot, warnings } = parse(cSourceCode, moduleRepository);
-    const {
-      astRootNode,
-      includedModules,
-      warnings: processorWarnings,
-    } = process(cAstRoot, moduleRepository);
-    warnings.push(
-      ...processorWarnings.map((w) =>
-        generateCompilationWarningMessage(w.message, cSourceCode, w.position),
-      ),
+    const metrics: Partial<CompilationMetrics> | undefined = options.metrics
+      ? {}
+      : undefined;
+    const { wasmModule, wat, includedModules, warnings } = compileToWatModule(
+      cSourceCode,
+      moduleRepository,
+      options,
+      metrics,
     );
-    const wasmModule = translate(astRootNode, moduleRepository);
-    const output = await compileWatToWasm(generateWat(wasmModule));
+    const phaseStartTime = performance.now();
+    const output = await compileWatToWasm(wat);
+    if (metrics) {
+      (metrics.phaseTimings as CompilationPhaseTimings).compileWatToWasmMs =
+        performance.now() - phaseStartTime;
+      metrics.wasmByteLength = output.byteLength;
+      metrics.totalMs = performance.now() - startTime;
+    }
     return {
       status: "success",
       wasm: output,
@@ -57,6 +133,17 @@ export async function compile(
       functionTableSize: wasmModule.functionTable.size,
       importedModules: includedModules,
       warnings,
+      ...(wasmModule.profiledFunctionNames
+        ? { profiledFunctionNames: wasmModule.profiledFunctionNames }
+        : {}),
+      ...(wasmModule.traceSymbols
+        ? { traceSymbols: wasmModule.traceSymbols }
+        : {}),
+      ...(wasmModule.allocationSitePositions
+        ? { allocationSitePositions: wasmModule.allocationSitePositions }
+        : {}),
+      ...(wasmModule.threads ? { threads: true } : {}),
+      ...(metrics ? { metrics: metrics as CompilationMetrics } : {}),
     };
   } catch (e) {
     if (e instanceof SourceCodeError) {
@@ -79,6 +166,7 @@ interface SuccessfulWatCompilationResult {
   status: "success";
   watOutput: string;
   warnings: string[];
+  metrics?: CompilationMetrics; // only if compiled with the metrics option
 }
 
 interface FailedWatCompilationResult {
@@ -93,24 +181,27 @@ export type WatCompilationResult =
 export function compileToWat(
   cSourceCode: string,
   moduleRepository: ModuleRepository,
+  options: CompilationOptions = {},
 ): WatCompilationResult {
+  const startTime = performance.now();
   try {
-    const { cAstRoot, warnings } = parse(cSourceCode, moduleRepository);
-    const { astRootNode, warnings: processorWarnings } = process(
-      cAstRoot,
+    const metrics: Partial<CompilationMetrics> | undefined = options.metrics
+      ? {}
+      : undefined;
+    const { wat, warnings } = compileToWatModule(
+      cSourceCode,
       moduleRepository,
+      options,
+      metrics,
     );
-    warnings.push(
-      ...processorWarnings.map((w) =>
-        generateCompilationWarningMessage(w.message, cSourceCode, w.position),
-      ),
-    );
-    const wasmModule = translate(astRootNode, moduleRepository);
-    const output = generateWat(wasmModule);
+    if (metrics) {
+      metrics.totalMs = performance.now() - startTime;
+    }
     return {
       status: "success",
-      watOutput: output,
+      watOutput: wat,
       warnings,
+      ...(metrics ? { metrics: metrics as CompilationMetrics } : {}),
     };
   } catch (e) {
     if (e instanceof SourceCodeError) {
@@ -132,10 +223,16 @@ export function compileToWat(
 export function generate_C_AST(
   cSourceCode: string,
   moduleRepository: ModuleRepository,
+  tracers?: ParserTracers,
 ) {
   try {
-    const parsedResult = parse(cSourceCode, moduleRepository);
-    return toJson(parsedResult);
+    const { cAstRoot, warnings } = parse(
+      cSourceCode,
+      moduleRepository,
+      undefined,
+      tracers,
+    );
+    return toJson({ cAstRoot, warnings });
   } catch (e) {
     if (e instanceof SourceCodeError) {
       e.generateCompilationErrorMessage(cSourceCode);
@@ -149,8 +246,8 @@ export function generate_processed_C_AST(
   moduleRepository: ModuleRepository,
 ) {
   try {
-    const { cAstRoot } = parse(cSourceCode, moduleRepository);
-    const { astRootNode } = process(cAstRoot, moduleRepository);
+    const { cAstRoot, identifiers } = parse(cSourceCode, moduleRepository);
+    const { astRootNode } = process(cAstRoot, moduleRepository, identifiers);
     return toJson(astRootNode);
   } catch (e) {
     if (e instanceof SourceCodeError) {
@@ -164,8 +261,8 @@ export function generate_WAT_AST(
   cSourceCode: string,
   moduleRepository: ModuleRepository,
 ) {
-  const { cAstRoot } = parse(cSourceCode, moduleRepository);
-  const { astRootNode } = process(cAstRoot, moduleRepository);
+  const { cAstRoot, identifiers } = parse(cSourceCode, moduleRepository);
+  const { astRootNode } = process(cAstRoot, moduleRepository, identifiers);
   //checkForErrors(cSourceCode, CAst, Object.keys(wasmModuleImports)); // use semantic analyzer to check for semantic errors
   const wasmAst = translate(astRootNode, moduleRepository);
   return toJson(wasmAst);
@@ -1,7 +1,4 @@
-import ModuleRepository, {
-  ModuleName,
-  ModulesGlobalConfig,
-} from "~src/modules";
+import ModuleRepository, { ModulesGlobalConfig } from "~src/modules";
 import {
   compile as originalCompile,
   compileToWat as originalCompileToWat,
@@ -10,25 +7,51 @@ import {
   generate_processed_C_AST as original_generate_processed_C_AST,
   WatCompilationResult,
   CompilationResult,
+  CompilationOptions,
 } from "./compiler";
-import { calculateNumberOfPagesNeededForBytes } from "~src/common/utils";
-import { WASM_PAGE_SIZE } from "~src/translator/memoryUtil";
+import CompilationCache from "~src/compilationCache";
+import { ParserTracers } from "~src/parser";
+import { runWasm } from "~src/runWasm";
 
 export const defaultModuleRepository = new ModuleRepository(); // default repository containing module information without any custom configs or wasm memory
 
-export function compileToWat(program: string): WatCompilationResult {
-  return originalCompileToWat(program, defaultModuleRepository);
+export function compileToWat(
+  program: string,
+  options?: CompilationOptions,
+): WatCompilationResult {
+  return originalCompileToWat(program, defaultModuleRepository, options);
 }
 
 export function generate_WAT_AST(program: string) {
   return originalGenerate_WAT_AST(program, defaultModuleRepository);
 }
 
-export async function compile(program: string): Promise<CompilationResult> {
-  const compilationResult = await originalCompile(
+function compileWithCache(
+  program: string,
+  cache?: CompilationCache,
+  options: CompilationOptions = {},
+): Promise<CompilationResult> {
+  // metrics describe an actual compilation, so they are never taken from the cache
+  if (typeof cache === "undefined" || options.metrics) {
+    return originalCompile(program, defaultModuleRepository, options);
+  }
+  return cache.getOrCompile(
     program,
     defaultModuleRepository,
+    () => originalCompile(program, defaultModuleRepository, options),
+    options,
   );
+}
+
+/**
+ * Compiles the given C program. If a cache is given, the result is taken from the cache when available.
+ */
+export async function compile(
+  program: string,
+  cache?: CompilationCache,
+  options?: CompilationOptions,
+): Promise<CompilationResult> {
+  const compilationResult = await compileWithCache(program, cache, options);
 
   // check if compilation failed
   if (compilationResult.status === "failure") {
@@ -44,17 +67,21 @@ export async function compile(program: string): Promise<CompilationResult> {
 export async function compileAndRun(
   program: string,
   modulesConfig?: ModulesGlobalConfig,
+  cache?: CompilationCache,
+  options?: CompilationOptions,
 ): Promise<CompilationResult> {
-  const compilationResult = await originalCompile(
-    program,
-    defaultModuleRepository,
-  );
+  const compilationResult = await compileWithCache(program, cache, options);
 
   // check if compilation failed
   if (compilationResult.status === "failure") {
     return compilationResult;
   }
 
+  if (compilationResult.threads) {
+    throw new Error(
+      "Programs compiled with the threads option must be run in a worker (see WorkerRun)",
+    );
+  }
   const { wasm, dataSegmentSize, functionTableSize, importedModules } =
     compilationResult;
   await runWasm(
@@ -68,37 +95,87 @@ export async function compileAndRun(
   return compilationResult;
 }
 
-export async function runWasm(
-  wasm: Uint8Array,
-  dataSegmentSize: number,
-  functionTableSize: number,
-  importedModules: ModuleName[],
-  modulesConfig?: ModulesGlobalConfig,
-) {
-  const numberOfInitialPagesNeeded =
-    calculateNumberOfPagesNeededForBytes(dataSegmentSize);
-  const moduleRepository = new ModuleRepository(
-    new WebAssembly.Memory({ initial: numberOfInitialPagesNeeded }),
-    new WebAssembly.Table({ element: "anyfunc", initial: functionTableSize }),
-    modulesConfig,
-  );
-  moduleRepository.setStackPointerValue(
-    numberOfInitialPagesNeeded * WASM_PAGE_SIZE,
-  );
-  moduleRepository.setBasePointerValue(
-    numberOfInitialPagesNeeded * WASM_PAGE_SIZE,
-  );
-  moduleRepository.setHeapPointerValue(Math.ceil(dataSegmentSize / 4) * 4); // align to 4 bytes
-
-  const wasmImports =
-    await moduleRepository.createWasmImportsObject(importedModules);
-  await WebAssembly.instantiate(wasm, wasmImports);
-}
-
 export function generate_processed_C_AST(program: string) {
   return original_generate_processed_C_AST(program, defaultModuleRepository);
 }
 
-export function generate_C_AST(program: string) {
-  return original_generate_C_AST(program, defaultModuleRepository);
+/**
+ * @param tracers if given, receive the events of the parsers when they are generated with tracing.
+ */
+export function generate_C_AST(program: string, tracers?: ParserTracers) {
+  return original_generate_C_AST(program, defaultModuleRepository, tracers);
 }
+
+export { runWasm } from "~src/runWasm";
+export { default as FilterPipeline } from "~src/modules/pix_and_flix/filterPipeline";
+export { fromBrowserWorker, fromNodeWorker } from "~src/common/hostWorker";
+export type { HostWorker } from "~src/common/hostWorker";
+export type {
+  CompiledFilterProgram,
+  FilterPipelineOptions,
+  FrameTelemetry,
+} from "~src/modules/pix_and_flix/filterPipeline";
+export {
+  startFilterWorker,
+  browserWorkerPort,
+  nodeWorkerPort,
+} from "~src/modules/pix_and_flix/filterWorker";
+export { runHeadlessPipeline } from "~src/modules/pix_and_flix/headless";
+export {
+  default as CompilationCache,
+  DirectoryCompilationCacheStore,
+} from "~src/compilationCache";
+export type {
+  CompilationCacheMetrics,
+  CompilationCacheStore,
+} from "~src/compilationCache";
+export { default as CompileServer } from "~src/compileServer";
+export type { CompilationOptions } from "~src/compiler";
+export type { ParserTracer, ParserTracers } from "~src/parser";
+export type {
+  CompilationMetrics,
+  CompilationPhaseTimings,
+} from "~src/common/compilationMetrics";
+export { FuelExhaustedError } from "~src/modules";
+export { default as Profiler } from "~src/profiler";
+export type {
+  FlatProfileEntry,
+  CallGraphProfileEntry,
+} from "~src/profiler";
+export { default as TraceRecorder } from "~src/traceRecorder";
+export type {
+  TraceEventKind,
+  TraceFrame,
+  TraceRecorderOptions,
+} from "~src/traceRecorder";
+export type { TraceSymbols } from "~src/translator/tracing";
+export type {
+  HeapAllocationEvent,
+  HeapLeak,
+  HeapSizeHistogramBucket,
+  HeapStats,
+} from "~src/modules/source_stdlib/heapStats";
+export { default as WorkerRun } from "~src/workerRun";
+export type {
+  CompiledProgram,
+  WorkerRunOptions,
+  WorkerRunResult,
+  WorkerRunStatus,
+} from "~src/workerRun";
+export {
+  startProgramWorker,
+  browserProgramWorkerPort,
+  nodeProgramWorkerPort,
+} from "~src/programWorker";
+export { runThreadedProgram } from "~src/threadsRun";
+export type {
+  ThreadWorkerRequester,
+  ThreadWorkerSpawner,
+} from "~src/threadsRun";
+export { runBatchJob, isOutputMatching } from "~src/batch";
+export type {
+  BatchJob,
+  BatchJobResult,
+  BatchTestCase,
+  BatchTestCaseResult,
+} from "~src/batch";
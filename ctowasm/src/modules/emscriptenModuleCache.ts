@@ -0,0 +1,86 @@
+/**
+ * Process-wide cache of the compiled wasm modules of the Emscripten generated library modules (math, utility).
+ *
+ * The Emscripten modules are built with SINGLE_FILE, so their factory functions decode the base64 wasm binary embedded
+ * in them and compile it on every call. Instead, the binary is decoded and compiled once, the first time a program uses
+ * the library, and every later run only instantiates the cached WebAssembly.Module (through the instantiateWasm hook).
+ */
+
+const DATA_URI_PATTERN = /data:application\/octet-stream;base64,([A-Za-z0-9+/=]+)/;
+
+// eslint-disable-next-line
+type EmscriptenModuleFactory<T> = (moduleArg?: any) => Promise<T>;
+
+// null if the wasm binary of the factory could not be found, in which case the factory is called as is
+const compiledModules: Map<
+  EmscriptenModuleFactory<unknown>,
+  Promise<WebAssembly.Module | null>
+> = new Map();
+
+/**
+ * Extracts the wasm binary that a SINGLE_FILE Emscripten factory embeds as a base64 data URI.
+ * Returns null if the factory has no such data URI, e.g. as it was minified or built differently. The factories of
+ * the library modules are checked to have one by the unit tests, so that this does not go unnoticed.
+ */
+export function getEmbeddedWasmBinary(
+  factory: EmscriptenModuleFactory<unknown>,
+): Uint8Array | null {
+  const match = DATA_URI_PATTERN.exec(factory.toString());
+  if (match === null) {
+    return null;
+  }
+  const decoded = atob(match[1]);
+  const binary = new Uint8Array(decoded.length);
+  for (let i = 0; i < decoded.length; ++i) {
+    binary[i] = decoded.charCodeAt(i);
+  }
+  return binary;
+}
+
+function getCompiledModule(
+  factory: EmscriptenModuleFactory<unknown>,
+): Promise<WebAssembly.Module | null> {
+  let compiledModule = compiledModules.get(factory);
+  if (typeof compiledModule === "undefined") {
+    const binary = getEmbeddedWasmBinary(factory);
+    compiledModule =
+      binary === null ? Promise.resolve(null) : WebAssembly.compile(binary);
+    // a failed compilation is not cached, so that it is retried on the next run
+    compiledModule.catch(() => compiledModules.delete(factory));
+    compiledModules.set(factory, compiledModule);
+  }
+  return compiledModule;
+}
+
+/**
+ * Creates a new instance of the Emscripten module of given factory, compiling its wasm only on first use.
+ */
+export async function instantiateEmscriptenModule<T>(
+  factory: EmscriptenModuleFactory<T>,
+): Promise<T> {
+  const compiledModule = await getCompiledModule(factory);
+  if (compiledModule === null) {
+    return factory();
+  }
+  let rejectInstantiation: (reason: unknown) => void = () => {};
+  const instantiationFailure = new Promise<never>((_, reject) => {
+    rejectInstantiation = reject;
+  });
+  return Promise.race([
+    factory({
+      instantiateWasm: (
+        imports: WebAssembly.Imports,
+        receiveInstance: (
+          instance: WebAssembly.Instance,
+          module: WebAssembly.Module,
+        ) => void,
+      ) => {
+        WebAssembly.instantiate(compiledModule, imports)
+          .then((instance) => receiveInstance(instance, compiledModule))
+          .catch(rejectInstantiation);
+        return {}; // exports are provided asynchronously through receiveInstance
+      },
+    }),
+    instantiationFailure,
+  ]);
+}
@@ -0,0 +1,232 @@
+/**
+ * Exact formatting of doubles in the styles of the "%f", "%e" and "%g" conversions of printf,
+ * matching the output of glibc (which rounds the exact binary value half to even).
+ *
+ * Number.prototype.toFixed and Number.prototype.toExponential already produce correctly rounded digits of the
+ * exact binary value, except that they round exact ties upwards (away from zero). Such ties can be detected
+ * cheaply from the binary representation of the double, so no arbitrary precision arithmetic is needed except for
+ * precisions beyond what toFixed/toExponential support.
+ */
+
+const MAX_JS_PRECISION = 100; // largest precision accepted by toFixed and toExponential
+
+const float64View = new DataView(new ArrayBuffer(8));
+
+/**
+ * Decomposes a positive finite double into an odd integer mantissa and a binary exponent,
+ * such that value = mantissa * 2^exponent.
+ */
+function decomposeDouble(value: number): { mantissa: number; exponent: number } {
+  float64View.setFloat64(0, value);
+  const high = float64View.getUint32(0);
+  const low = float64View.getUint32(4);
+  const biasedExponent = (high >>> 20) & 0x7ff;
+  let mantissa = (high & 0xfffff) * 2 ** 32 + low;
+  let exponent: number;
+  if (biasedExponent === 0) {
+    exponent = -1074; // subnormal
+  } else {
+    mantissa += 2 ** 52;
+    exponent = biasedExponent - 1075;
+  }
+  // strip the trailing zero bits so that mantissa is odd
+  while (mantissa % 2 === 0) {
+    mantissa /= 2;
+    ++exponent;
+  }
+  return { mantissa, exponent };
+}
+
+/**
+ * Returns true if a positive finite double lies exactly halfway between two multiples of 10^-scale,
+ * i.e. if 2 * value * 10^scale is an odd integer.
+ */
+function isRoundingTie(value: number, scale: number): boolean {
+  const { mantissa, exponent } = decomposeDouble(value);
+  // 2 * mantissa * 2^exponent * 2^scale * 5^scale is odd only if all the powers of 2 cancel out
+  if (exponent + scale + 1 !== 0) {
+    return false;
+  }
+  // for negative scales, 5^-scale must also divide the (odd) mantissa
+  return scale >= 0 || mantissa % 5 ** -scale === 0;
+}
+
+/**
+ * Given digits that were rounded half up from an exact tie, returns the digits rounded half to even instead.
+ * When the rounded up last digit is odd, rounding to even rounds down instead, which never needs a borrow.
+ */
+function roundTieToEven(digits: string): string {
+  const lastDigitIndex = digits.length - 1;
+  const lastDigit = digits.charCodeAt(lastDigitIndex) - 48;
+  if (lastDigit % 2 === 0) {
+    return digits;
+  }
+  return digits.slice(0, lastDigitIndex) + String.fromCharCode(47 + lastDigit);
+}
+
+/**
+ * Returns value * 10^scale rounded half to even, computed exactly.
+ */
+function exactScaledRound(value: number, scale: number): bigint {
+  const { mantissa, exponent } = decomposeDouble(value);
+  let numerator = BigInt(mantissa);
+  let denominator = 1n;
+  if (scale >= 0) {
+    numerator *= 10n ** BigInt(scale);
+  } else {
+    denominator *= 10n ** BigInt(-scale);
+  }
+  if (exponent >= 0) {
+    numerator <<= BigInt(exponent);
+  } else {
+    denominator <<= BigInt(-exponent);
+  }
+  const quotient = numerator / denominator;
+  const twiceRemainder = (numerator % denominator) * 2n;
+  if (
+    twiceRemainder > denominator ||
+    (twiceRemainder === denominator && quotient % 2n === 1n)
+  ) {
+    return quotient + 1n;
+  }
+  return quotient;
+}
+
+/**
+ * Inserts a decimal point into a string of digits representing an integer scaled by 10^precision.
+ */
+function insertDecimalPoint(digits: string, precision: number) {
+  if (precision === 0) {
+    return digits;
+  }
+  digits = digits.padStart(precision + 1, "0");
+  return (
+    digits.slice(0, digits.length - precision) +
+    "." +
+    digits.slice(digits.length - precision)
+  );
+}
+
+/**
+ * Formats a non-negative finite double in "%f" style with given precision.
+ */
+export function formatFloatFixed(
+  value: number,
+  precision: number,
+  alternateForm = false,
+): string {
+  let str: string;
+  if (value === 0) {
+    str = precision > 0 ? "0." + "0".repeat(precision) : "0";
+  } else if (value >= 1e21) {
+    // toFixed switches to exponential notation for large values, which are always integers
+    str = BigInt(value).toString();
+    if (precision > 0) {
+      str += "." + "0".repeat(precision);
+    }
+  } else if (precision > MAX_JS_PRECISION) {
+    str = insertDecimalPoint(
+      exactScaledRound(value, precision).toString(),
+      precision,
+    );
+  } else {
+    str = value.toFixed(precision);
+    if (isRoundingTie(value, precision)) {
+      str = roundTieToEven(str);
+    }
+  }
+  if (alternateForm && precision === 0) {
+    str += ".";
+  }
+  return str;
+}
+
+/**
+ * Returns the mantissa digits (without decimal point) and decimal exponent of a positive finite double
+ * rounded to precision + 1 significant digits.
+ */
+function getExponentialDigits(
+  value: number,
+  precision: number,
+): { digits: string; exponent: number } {
+  if (precision <= MAX_JS_PRECISION) {
+    const str = value.toExponential(precision);
+    const exponentIndex = str.indexOf("e");
+    const exponent = parseInt(str.slice(exponentIndex + 1));
+    let digits =
+      precision === 0 ? str[0] : str[0] + str.slice(2, exponentIndex);
+    if (isRoundingTie(value, precision - exponent)) {
+      digits = roundTieToEven(digits);
+    }
+    return { digits, exponent };
+  }
+  // estimate the exponent, then correct it if the exactly rounded digits do not have precision + 1 digits
+  let exponent = parseInt(value.toExponential().split("e")[1]);
+  for (;;) {
+    const digits = exactScaledRound(value, precision - exponent).toString();
+    if (digits.length === precision + 2) {
+      ++exponent; // rounded up to the next power of 10
+    } else if (digits.length === precision) {
+      --exponent;
+    } else {
+      return { digits, exponent };
+    }
+  }
+}
+
+/**
+ * Formats a non-negative finite double in "%e" style with given precision.
+ */
+export function formatFloatExponential(
+  value: number,
+  precision: number,
+  alternateForm = false,
+): string {
+  let digits: string;
+  let exponent: number;
+  if (value === 0) {
+    digits = "0".repeat(precision + 1);
+    exponent = 0;
+  } else {
+    ({ digits, exponent } = getExponentialDigits(value, precision));
+  }
+  const mantissa =
+    precision > 0 || alternateForm ? digits[0] + "." + digits.slice(1) : digits;
+  // the exponent always has at least 2 digits
+  return (
+    mantissa +
+    "e" +
+    (exponent < 0 ? "-" : "+") +
+    Math.abs(exponent).toString().padStart(2, "0")
+  );
+}
+
+/**
+ * Formats a non-negative finite double in "%g" style with given precision.
+ */
+export function formatFloatGeneral(
+  value: number,
+  precision: number,
+  alternateForm = false,
+): string {
+  const significantDigits = precision === 0 ? 1 : precision;
+  // the exponent that the value would have in "%e" style
+  const exponent =
+    value === 0
+      ? 0
+      : getExponentialDigits(value, significantDigits - 1).exponent;
+  let str =
+    significantDigits > exponent && exponent >= -4
+      ? formatFloatFixed(value, significantDigits - 1 - exponent, alternateForm)
+      : formatFloatExponential(value, significantDigits - 1, alternateForm);
+  if (!alternateForm) {
+    // trailing zeros are removed from the fractional part, as well as the decimal point if no fraction remains
+    const exponentIndex = str.indexOf("e");
+    let mantissa = exponentIndex === -1 ? str : str.slice(0, exponentIndex);
+    if (mantissa.includes(".")) {
+      mantissa = mantissa.replace(/\.?0+$/, "");
+    }
+    str = mantissa + (exponentIndex === -1 ? "" : str.slice(exponentIndex));
+  }
+  return str;
+}
@@ -8,22 +8,61 @@ import {
   sourceStandardLibraryModuleImportName,
 } from "~src/modules/source_stdlib";
 import { Module } from "~src/modules/types";
+import OutputBuffer, { OutputBufferMode } from "~src/modules/outputBuffer";
 import { UtilityStdLibModule, utilityStdLibName } from "~src/modules/utility";
 import { WASM_ADDR_TYPE } from "~src/translator/memoryUtil";
+import Profiler from "~src/profiler";
+import TraceRecorder from "~src/traceRecorder";
+import { PthreadModule, pthreadModuleImportName } from "~src/modules/pthread";
+import { ThreadRuntime } from "~src/modules/pthread/threadControl";
+import {
+  HeapAllocationEvent,
+  HeapLeak,
+  HeapStats,
+  UNKNOWN_ALLOCATION_SITE,
+} from "~src/modules/source_stdlib/heapStats";
 
 export interface ModulesGlobalConfig {
   printFunction: (str: string) => void; // the print function to use for printing to "stdout"
   externalFunctions?: { [functionName: string]: Function };
+  stdoutBufferMode?: OutputBufferMode; // buffering of "stdout", "line" by default, which flushes every completed line
+  stdoutBufferSize?: number; // number of characters buffered before a forced flush
+  fuelLimit?: number | bigint; // steps a program compiled with fuel metering can run for, unlimited by default
+  profiler?: Profiler; // records the function calls of a program compiled with the profile option
+  tracer?: TraceRecorder; // records the execution trace of a program compiled with the trace option
+  stdin?: Uint8Array | string; // the whole input read by the program from "stdin" (strings are encoded as UTF-8), empty by default
+  threads?: ThreadRuntime; // set by the threads runtime for each thread of a program compiled with the threads option
+  heapEventLog?: boolean; // record every malloc and free of the program (see getHeapEvents)
+  onHeapLeaks?: (leaks: HeapLeak[]) => void; // called when the program exits, if it did not free all the blocks it allocated
 }
 
 const defaultModulesGlobalConfig: ModulesGlobalConfig = {
   printFunction: (str: string) => console.log(str),
 };
 
+// the largest value of an i64, the fuel given to programs when there is no fuel limit
+const UNLIMITED_FUEL = 0x7fffffffffffffffn;
+
+/**
+ * Thrown when a program compiled with fuel metering runs out of fuel.
+ */
+export class FuelExhaustedError extends Error {
+  fuelLimit: bigint;
+
+  constructor(fuelLimit: bigint) {
+    super(`Program ran out of fuel: exceeded the limit of ${fuelLimit} steps`);
+    this.name = "FuelExhaustedError";
+    this.fuelLimit = fuelLimit;
+  }
+}
+
 export interface SharedWasmGlobalVariables {
   stackPointer: WebAssembly.Global;
   heapPointer: WebAssembly.Global;
   basePointer: WebAssembly.Global;
+  stdinPosition: WebAssembly.Global; // address of the next unread byte of the input in linear memory
+  stdinEnd: WebAssembly.Global; // address just past the input in linear memory
+  allocationSite: WebAssembly.Global; // call site of the malloc or free being called (see src/translator/allocationSites.ts)
 }
 
 // all the names of the modules
@@ -31,7 +70,8 @@ export type ModuleName =
   | typeof sourceStandardLibraryModuleImportName
   | typeof pixAndFlixLibraryModuleImportName
   | typeof mathStdlibName
-  | typeof utilityStdLibName;
+  | typeof utilityStdLibName
+  | typeof pthreadModuleImportName;
 
 /**
  * Holds all the modules that define functions that can be imported and used in C source program.
@@ -42,6 +82,10 @@ export default class ModuleRepository {
   config: ModulesGlobalConfig;
   modules: Record<ModuleName, Module>;
   sharedWasmGlobalVariables: SharedWasmGlobalVariables;
+  stdout: OutputBuffer; // buffered "stdout" shared by all modules
+  fuelLimit: bigint;
+  fuel?: WebAssembly.Global; // fuel left, exported by programs compiled with fuel metering once they have run
+  heapAddress = 0; // address of the start of the heap, set when the program is instantiated
 
   constructor(
     memory?: WebAssembly.Memory,
@@ -55,6 +99,13 @@ export default class ModuleRepository {
     this.config = config
       ? { ...defaultModulesGlobalConfig, ...config }
       : defaultModulesGlobalConfig;
+    this.stdout = new OutputBuffer(
+      this.config.printFunction,
+      this.config.stdoutBufferMode,
+      this.config.stdoutBufferSize,
+    );
+
+    this.fuelLimit = BigInt(this.config.fuelLimit ?? UNLIMITED_FUEL);
 
     this.sharedWasmGlobalVariables = {
       stackPointer: new WebAssembly.Global(
@@ -69,6 +120,18 @@ export default class ModuleRepository {
         { value: WASM_ADDR_TYPE, mutable: true },
         0,
       ),
+      stdinPosition: new WebAssembly.Global(
+        { value: WASM_ADDR_TYPE, mutable: true },
+        0,
+      ),
+      stdinEnd: new WebAssembly.Global(
+        { value: WASM_ADDR_TYPE, mutable: true },
+        0,
+      ),
+      allocationSite: new WebAssembly.Global(
+        { value: "i32", mutable: true },
+        UNKNOWN_ALLOCATION_SITE,
+      ),
     };
 
     this.modules = {
@@ -77,28 +140,110 @@ export default class ModuleRepository {
         this.functionTable,
         this.config,
         this.sharedWasmGlobalVariables,
+        this.stdout,
       ),
       [pixAndFlixLibraryModuleImportName]: new PixAndFlixLibrary(
         this.memory,
         this.functionTable,
         this.config,
         this.sharedWasmGlobalVariables,
+        this.stdout,
       ),
       [mathStdlibName]: new MathStdLibModule(
         this.memory,
         this.functionTable,
         this.config,
         this.sharedWasmGlobalVariables,
+        this.stdout,
       ),
       [utilityStdLibName]: new UtilityStdLibModule(
         this.memory,
         this.functionTable,
         this.config,
         this.sharedWasmGlobalVariables,
+        this.stdout,
+      ),
+      [pthreadModuleImportName]: new PthreadModule(
+        this.memory,
+        this.functionTable,
+        this.config,
+        this.sharedWasmGlobalVariables,
+        this.stdout,
       ),
     };
   }
 
+  /**
+   * Flushes any output remaining in the "stdout" buffer. Should be called once the program exits.
+   */
+  flushStdout() {
+    this.stdout.flush();
+  }
+
+  /**
+   * Keeps the globals exported by the instance of the program, which the runtime reads after the program has run.
+   */
+  setProgramExports(exports: WebAssembly.Exports) {
+    if (exports.fuel instanceof WebAssembly.Global) {
+      this.fuel = exports.fuel;
+    }
+  }
+
+  /**
+   * Returns the amount of fuel used by a program compiled with fuel metering, which ran to completion.
+   * Programs that run out of fuel are stopped with a FuelExhaustedError instead.
+   */
+  getFuelUsed(): bigint {
+    return typeof this.fuel === "undefined"
+      ? 0n
+      : this.fuelLimit - BigInt(this.fuel.value);
+  }
+
+  /**
+   * Returns the statistics of the heap of the program, as allocated by malloc and free.
+   * Not kept for programs compiled with the threads option, whose threads share a heap (see SharedHeap).
+   */
+  getHeapStats(): HeapStats {
+    const { heapTracker, freeList } = this.getSourceStandardLibraryModule();
+    return heapTracker.getStats(
+      freeList,
+      this.sharedWasmGlobalVariables.heapPointer.value - this.heapAddress,
+    );
+  }
+
+  /**
+   * Returns the blocks allocated by the program that it has not freed, largest first.
+   */
+  getHeapLeaks(): HeapLeak[] {
+    return this.getSourceStandardLibraryModule().heapTracker.getLeaks();
+  }
+
+  /**
+   * Returns all the mallocs and frees of the program, if it was run with the heapEventLog option.
+   */
+  getHeapEvents(): HeapAllocationEvent[] {
+    return this.getSourceStandardLibraryModule().heapTracker.getEvents();
+  }
+
+  /**
+   * Reports the blocks that were not freed to the onHeapLeaks callback, if any. Should be called once the program exits.
+   */
+  reportHeapLeaks() {
+    if (typeof this.config.onHeapLeaks === "undefined") {
+      return;
+    }
+    const leaks = this.getHeapLeaks();
+    if (leaks.length > 0) {
+      this.config.onHeapLeaks(leaks);
+    }
+  }
+
+  private getSourceStandardLibraryModule() {
+    return this.modules[
+      sourceStandardLibraryModuleImportName
+    ] as SourceStandardLibraryModule;
+  }
+
   setStackPointerValue(value: number) {
     this.sharedWasmGlobalVariables.stackPointer.value = value;
   }
@@ -111,6 +256,18 @@ export default class ModuleRepository {
     this.sharedWasmGlobalVariables.heapPointer.value = value;
   }
 
+  /**
+   * Copies the given input bytes into linear memory at the given address, for reading from "stdin".
+   * Returns the address just past the input.
+   */
+  loadStdin(stdinBytes: Uint8Array, address: number): number {
+    new Uint8Array(this.memory.buffer).set(stdinBytes, address);
+    this.sharedWasmGlobalVariables.stdinPosition.value = address;
+    this.sharedWasmGlobalVariables.stdinEnd.value =
+      address + stdinBytes.length;
+    return address + stdinBytes.length;
+  }
+
   setMemory(numberOfPages: number) {
     this.memory = new WebAssembly.Memory({ initial: numberOfPages });
   }
@@ -122,6 +279,8 @@ export default class ModuleRepository {
   async createWasmImportsObject(
     importedModules: ModuleName[],
   ): Promise<WebAssembly.Imports> {
+    this.config.tracer?.attach(this.memory, this.sharedWasmGlobalVariables);
+    this.heapAddress = this.sharedWasmGlobalVariables.heapPointer.value;
     const imports: WebAssembly.Imports = {
       js: {
         mem: this.memory,
@@ -129,6 +288,30 @@ export default class ModuleRepository {
         sp: this.sharedWasmGlobalVariables.stackPointer,
         hp: this.sharedWasmGlobalVariables.heapPointer,
         bp: this.sharedWasmGlobalVariables.basePointer,
+        stdin_pos: this.sharedWasmGlobalVariables.stdinPosition,
+        stdin_end: this.sharedWasmGlobalVariables.stdinEnd,
+        alloc_site: this.sharedWasmGlobalVariables.allocationSite,
+        fuel_limit: this.fuelLimit,
+        fuel_exhausted: () => {
+          throw new FuelExhaustedError(this.fuelLimit);
+        },
+        // only called by programs compiled with the threads option, whose stacks cannot grow
+        stack_overflow: () => {
+          throw new Error("Stack overflow");
+        },
+        profile_enter: (functionIndex: number) =>
+          this.config.profiler?.enter(functionIndex),
+        profile_exit: (functionIndex: number) =>
+          this.config.profiler?.exit(functionIndex),
+        trace_statement: (statementIndex: number) =>
+          this.config.tracer?.recordEvent("statement", statementIndex),
+        trace_enter: (functionIndex: number) =>
+          this.config.tracer?.recordEvent("enter", functionIndex),
+        trace_exit: (functionIndex: number) =>
+          this.config.tracer?.recordEvent("exit", functionIndex),
+        trace_write: (address: number, size: number) =>
+          this.config.tracer?.recordWrite(address, size),
+        trace_external_call: () => this.config.tracer?.recordExternalCall(),
       },
     };
 
@@ -140,8 +323,12 @@ export default class ModuleRepository {
       }
       Object.keys(this.modules[moduleName].moduleFunctions).map(
         (moduleFunctionName) => {
-          moduleImportObject[moduleFunctionName] =
+          const jsFunction =
             module.moduleFunctions[moduleFunctionName].jsFunction;
+          // functions implemented in wasm are not imported
+          if (typeof jsFunction !== "undefined") {
+            moduleImportObject[moduleFunctionName] = jsFunction;
+          }
         },
       );
       imports[moduleName] = moduleImportObject;
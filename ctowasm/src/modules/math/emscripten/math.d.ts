@@ -19,4 +19,6 @@ interface MathModule extends EmscriptenModule {
   _floor(x: number): number;
 }
 
-export default function mathModuleFactoryFn(): Promise<MathModule>;
+export default function mathModuleFactoryFn(
+  moduleArg?: Partial<EmscriptenModule>,
+): Promise<MathModule>;
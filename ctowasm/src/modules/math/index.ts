@@ -2,6 +2,8 @@ import { ModulesGlobalConfig, SharedWasmGlobalVariables } from "~src/modules";
 import { Module, ModuleFunction } from "~src/modules/types";
 import { StructDataType } from "~src/parser/c-ast/dataTypes";
 import mathModuleFactoryFn from "~src/modules/math/emscripten/math";
+import { instantiateEmscriptenModule } from "~src/modules/emscriptenModuleCache";
+import OutputBuffer from "~src/modules/outputBuffer";
 
 // the name that this module is imported into wasm by,
 // as well as the include name to use in C program file.
@@ -17,12 +19,15 @@ export class MathStdLibModule extends Module {
     functionTable: WebAssembly.Table,
     config: ModulesGlobalConfig,
     sharedWasmGlobalVariables: SharedWasmGlobalVariables,
+    stdout?: OutputBuffer,
   ) {
-    super(memory, functionTable, config, sharedWasmGlobalVariables);
+    super(memory, functionTable, config, sharedWasmGlobalVariables, stdout);
     this.heapAddress = this.sharedWasmGlobalVariables.heapPointer.value;
     this.moduleDeclaredStructs = [];
     this.instantiate = async () => {
-      const mathModule = await mathModuleFactoryFn();
+      const mathModule = await instantiateEmscriptenModule(
+        mathModuleFactoryFn,
+      );
       // need to set the jsFunctions of all moduleFunctions here
       this.moduleFunctions.acos.jsFunction = mathModule._acos;
       this.moduleFunctions.asin.jsFunction = mathModule._asin;
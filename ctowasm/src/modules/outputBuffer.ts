@@ -0,0 +1,94 @@
+/**
+ * Definition of the buffered "stdout" stream that all modules write program output to.
+ */
+
+/**
+ * "line" - buffer is flushed whenever a newline is written (like stdout attached to a terminal).
+ *   Each write that completes a line calls the printFunction, so a loop of print_int calls (each printing its own line)
+ *   is not batched: it calls the printFunction once per iteration, as it would without any buffering.
+ * "full" - buffer is only flushed when it is full, or on explicit flush (like stdout redirected to a file).
+ *   Use this to batch output that is printed a line at a time, e.g. when the output is only read after the run.
+ * In both modes, a full buffer only delivers its complete lines, and keeps the line being written buffered (however
+ * long it gets) until it is completed or explicitly flushed, as the printFunction is given whole lines.
+ */
+export type OutputBufferMode = "line" | "full";
+
+export const DEFAULT_OUTPUT_BUFFER_SIZE = 4096; // number of characters held before a forced flush
+
+/**
+ * Buffers program output so that the (potentially expensive) printFunction is not called on every write.
+ * Each flush calls the printFunction once with all the buffered text, minus the trailing newline if there is one,
+ * so that line-buffered output is delivered to the printFunction one line (or group of lines) at a time.
+ */
+export default class OutputBuffer {
+  private chunks: string[] = [];
+  private length = 0; // total length of all chunks
+  private hasNewline = false; // whether any of the chunks contains a newline
+  private printFunction: (str: string) => void;
+  mode: OutputBufferMode;
+  capacity: number;
+
+  constructor(
+    printFunction: (str: string) => void,
+    mode: OutputBufferMode = "line",
+    capacity: number = DEFAULT_OUTPUT_BUFFER_SIZE,
+  ) {
+    this.printFunction = printFunction;
+    this.mode = mode;
+    this.capacity = capacity;
+  }
+
+  write(str: string) {
+    if (str.length === 0) {
+      return;
+    }
+    if (this.mode === "line") {
+      const lastNewlineIndex = str.lastIndexOf("\n");
+      if (lastNewlineIndex !== -1) {
+        // everything up to and including the last newline is flushed
+        this.chunks.push(str.slice(0, lastNewlineIndex + 1));
+        this.flush();
+        str = str.slice(lastNewlineIndex + 1);
+      }
+    }
+    if (str.length === 0) {
+      return;
+    }
+    this.chunks.push(str);
+    this.length += str.length;
+    this.hasNewline ||= str.includes("\n");
+    if (this.length >= this.capacity && this.hasNewline) {
+      this.flushCompleteLines();
+    }
+  }
+
+  /**
+   * Delivers the buffered output up to the last newline to the printFunction, keeping the incomplete line after it.
+   */
+  private flushCompleteLines() {
+    const output = this.chunks.join("");
+    const lastNewlineIndex = output.lastIndexOf("\n");
+    const incompleteLine = output.slice(lastNewlineIndex + 1);
+    this.chunks = incompleteLine.length > 0 ? [incompleteLine] : [];
+    this.length = incompleteLine.length;
+    this.hasNewline = false;
+    this.printFunction(output.slice(0, lastNewlineIndex));
+  }
+
+  /**
+   * Delivers all buffered output to the printFunction, including an incomplete last line (e.g. at the end of the run).
+   */
+  flush() {
+    if (this.chunks.length === 0) {
+      return;
+    }
+    let output = this.chunks.join("");
+    this.chunks = [];
+    this.length = 0;
+    this.hasNewline = false;
+    if (output.endsWith("\n")) {
+      output = output.slice(0, -1);
+    }
+    this.printFunction(output);
+  }
+}
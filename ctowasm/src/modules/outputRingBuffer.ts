@@ -0,0 +1,178 @@
+/**
+ * A ring buffer in a SharedArrayBuffer, through which a program running in a worker streams its output to the host
+ * (see src/workerRun.ts) without a message per print.
+ *
+ * There is a single reader (the host), and usually a single writer (the worker). The threads of a program compiled with
+ * the threads option are all writers, which take turns through a lock (see sharedLock.ts), so that the records of a
+ * string are never interleaved with those of another. Each string printed by the program is written as one or more
+ * records: a 4 byte little endian header holding the number of bytes of UTF-8 that follow, with the CONTINUED_FLAG bit
+ * set if the string continues in the next record. A string only spans several records if it does not fit in the
+ * buffer at once.
+ *
+ * The offsets in the buffer of the writer and the reader, and the lock of the writers, are kept at the start of the
+ * SharedArrayBuffer. One byte is always left free, so that a full buffer can be told apart from an empty one. The
+ * writer only publishes its offset once a record is complete, so the reader never sees a partial record. When the
+ * buffer is full, the writer blocks (with Atomics.wait, which workers may use) until the reader has made space. The
+ * reader never blocks, so that it can run on the main thread of a browser.
+ */
+
+import { lockSharedWord, unlockSharedWord } from "~src/modules/sharedLock";
+
+export const DEFAULT_OUTPUT_RING_BUFFER_SIZE = 64 * 1024; // bytes of output held before the writer blocks
+
+const WRITE_OFFSET = 0; // indexes in the Int32Array of offsets
+const READ_OFFSET = 1;
+const WRITER_LOCK = 2;
+const NUMBER_OF_OFFSETS = 3;
+const OFFSETS_BYTE_LENGTH = NUMBER_OF_OFFSETS * Int32Array.BYTES_PER_ELEMENT;
+const RECORD_HEADER_LENGTH = 4;
+const CONTINUED_FLAG = 0x80000000;
+const MIN_RING_BUFFER_SIZE = 2 * RECORD_HEADER_LENGTH;
+
+/**
+ * Creates the shared memory of a ring buffer that holds the given number of bytes.
+ */
+export function createOutputRingBuffer(
+  size: number = DEFAULT_OUTPUT_RING_BUFFER_SIZE,
+): SharedArrayBuffer {
+  if (size < MIN_RING_BUFFER_SIZE) {
+    throw new Error(
+      `Output ring buffer must hold at least ${MIN_RING_BUFFER_SIZE} bytes`,
+    );
+  }
+  return new SharedArrayBuffer(OFFSETS_BYTE_LENGTH + size);
+}
+
+function getUsedBytes(offsets: Int32Array, size: number) {
+  return (
+    (Atomics.load(offsets, WRITE_OFFSET) -
+      Atomics.load(offsets, READ_OFFSET) +
+      size) %
+    size
+  );
+}
+
+export class OutputRingBufferWriter {
+  private offsets: Int32Array;
+  private data: Uint8Array;
+  private encoder = new TextEncoder();
+
+  constructor(buffer: SharedArrayBuffer) {
+    this.offsets = new Int32Array(buffer, 0, NUMBER_OF_OFFSETS);
+    this.data = new Uint8Array(buffer, OFFSETS_BYTE_LENGTH);
+  }
+
+  /**
+   * Writes a string, blocking while the buffer is too full to hold it.
+   */
+  write(str: string) {
+    const bytes = this.encoder.encode(str);
+    const maxRecordLength = this.data.length - 1 - RECORD_HEADER_LENGTH;
+    let start = 0;
+    lockSharedWord(this.offsets, WRITER_LOCK);
+    try {
+      do {
+        const end = Math.min(start + maxRecordLength, bytes.length);
+        const header =
+          (end - start) | (end < bytes.length ? CONTINUED_FLAG : 0);
+        this.writeRecord(header, bytes.subarray(start, end));
+        start = end;
+      } while (start < bytes.length);
+    } finally {
+      unlockSharedWord(this.offsets, WRITER_LOCK);
+    }
+  }
+
+  private writeRecord(header: number, payload: Uint8Array) {
+    const size = this.data.length;
+    const recordLength = RECORD_HEADER_LENGTH + payload.length;
+    while (size - 1 - getUsedBytes(this.offsets, size) < recordLength) {
+      Atomics.wait(
+        this.offsets,
+        READ_OFFSET,
+        Atomics.load(this.offsets, READ_OFFSET),
+      );
+    }
+    let offset = Atomics.load(this.offsets, WRITE_OFFSET);
+    for (let i = 0; i < RECORD_HEADER_LENGTH; ++i) {
+      this.data[offset] = (header >>> (i * 8)) & 0xff;
+      offset = offset + 1 === size ? 0 : offset + 1;
+    }
+    const firstPartLength = Math.min(payload.length, size - offset);
+    this.data.set(payload.subarray(0, firstPartLength), offset);
+    this.data.set(payload.subarray(firstPartLength), 0);
+    Atomics.store(
+      this.offsets,
+      WRITE_OFFSET,
+      (offset + payload.length) % size,
+    );
+  }
+}
+
+export class OutputRingBufferReader {
+  private offsets: Int32Array;
+  private data: Uint8Array;
+  private decoder = new TextDecoder();
+  private pendingParts: Uint8Array[] = []; // parts of a string whose last record has not been read yet
+
+  constructor(buffer: SharedArrayBuffer) {
+    this.offsets = new Int32Array(buffer, 0, NUMBER_OF_OFFSETS);
+    this.data = new Uint8Array(buffer, OFFSETS_BYTE_LENGTH);
+  }
+
+  /**
+   * Returns the strings written since the last read, in order, and frees their space for the writer.
+   * @param includePartial whether to also return a string whose last record has not been written yet, e.g. when the
+   * writer has been stopped.
+   */
+  read(includePartial = false): string[] {
+    const strings: string[] = [];
+    const size = this.data.length;
+    let offset = Atomics.load(this.offsets, READ_OFFSET);
+    let usedBytes = getUsedBytes(this.offsets, size);
+    while (usedBytes > 0) {
+      let header = 0;
+      for (let i = 0; i < RECORD_HEADER_LENGTH; ++i) {
+        header |= this.data[offset] << (i * 8);
+        offset = offset + 1 === size ? 0 : offset + 1;
+      }
+      const payloadLength = header & ~CONTINUED_FLAG;
+      const payload = new Uint8Array(payloadLength);
+      const firstPartLength = Math.min(payloadLength, size - offset);
+      payload.set(this.data.subarray(offset, offset + firstPartLength));
+      payload.set(
+        this.data.subarray(0, payloadLength - firstPartLength),
+        firstPartLength,
+      );
+      this.pendingParts.push(payload);
+      if ((header & CONTINUED_FLAG) === 0) {
+        strings.push(this.decodePendingParts());
+      }
+      offset = (offset + payloadLength) % size;
+      usedBytes -= RECORD_HEADER_LENGTH + payloadLength;
+    }
+    Atomics.store(this.offsets, READ_OFFSET, offset);
+    Atomics.notify(this.offsets, READ_OFFSET);
+    if (includePartial && this.pendingParts.length > 0) {
+      strings.push(this.decodePendingParts());
+    }
+    return strings;
+  }
+
+  private decodePendingParts() {
+    const parts = this.pendingParts;
+    this.pendingParts = [];
+    if (parts.length === 1) {
+      return this.decoder.decode(parts[0]);
+    }
+    const bytes = new Uint8Array(
+      parts.reduce((length, part) => length + part.length, 0),
+    );
+    let offset = 0;
+    for (const part of parts) {
+      bytes.set(part, offset);
+      offset += part.length;
+    }
+    return this.decoder.decode(bytes);
+  }
+}
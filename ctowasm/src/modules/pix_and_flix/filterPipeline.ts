@@ -0,0 +1,326 @@
+/**
+ * Pipelined execution of pix_n_flix filters off the main thread.
+ *
+ * The compiled C program runs in a worker (see filterWorker.ts). Frames are passed through a fixed number of
+ * frame slots in shared memory, so that the host can submit a new frame while the previous one is being filtered.
+ * When all slots are in use, or when a frame has waited longer than the frame budget by the time the worker gets to it,
+ * the frame is dropped instead of stalling the host.
+ */
+
+import { ModuleName } from "~src/modules";
+import { FRAME_CHANNELS } from "~src/modules/pix_and_flix/frameBuffers";
+import { HostWorker } from "~src/common/hostWorker";
+
+export const PIPELINE_FRAME_SLOTS = 2; // frames are double buffered
+export const DEFAULT_PIPELINE_FPS = 30;
+
+/**
+ * The parts of a successful compilation result that are needed to run the program in the worker.
+ */
+export interface CompiledFilterProgram {
+  wasm: Uint8Array;
+  dataSegmentSize: number;
+  functionTableSize: number;
+  importedModules: ModuleName[];
+}
+
+// messages sent from the pipeline to the worker
+export type FilterWorkerRequest =
+  | {
+      type: "init";
+      program: CompiledFilterProgram;
+      height: number;
+      width: number;
+      slots: SharedArrayBuffer[]; // each slot holds the source frame followed by the destination frame
+    }
+  | {
+      type: "frame";
+      slot: number;
+      sequence: number;
+      submittedAt: number; // wall clock time in ms (see getWallClockTime)
+      budgetMs: number;
+    }
+  | { type: "stop" };
+
+// messages sent from the worker to the pipeline
+export type FilterWorkerResponse =
+  | { type: "ready" }
+  | { type: "print"; str: string }
+  | { type: "setFps"; fps: number }
+  | {
+      type: "frameDone";
+      slot: number;
+      sequence: number;
+      filterTimeMs: number;
+    }
+  | { type: "frameDropped"; slot: number; sequence: number }
+  | { type: "error"; message: string };
+
+/**
+ * The interface the pipeline uses to talk to its worker running filterWorker.ts (see src/common/hostWorker.ts for the
+ * adapters of browser Workers and Node.js worker_threads).
+ */
+export type PipelineWorker = HostWorker<
+  FilterWorkerRequest,
+  FilterWorkerResponse
+>;
+
+/**
+ * Returns the current time in ms, comparable between threads (unlike performance.now()).
+ */
+export function getWallClockTime() {
+  return performance.timeOrigin + performance.now();
+}
+
+export interface FrameTelemetry {
+  framesSubmitted: number;
+  framesFiltered: number;
+  framesDropped: number; // frames dropped as no slot was free, or as they were over budget when the worker got to them
+  queueDepth: number; // frames submitted that have not been filtered or dropped yet
+  lastFilterTimeMs: number;
+  averageFilterTimeMs: number;
+  maxFilterTimeMs: number;
+  frameBudgetMs: number;
+}
+
+export interface FilteredFrameStats {
+  sequence: number;
+  filterTimeMs: number; // time spent running the filter in the worker
+  latencyMs: number; // time from submission of the frame to it being filtered
+}
+
+export interface FilterPipelineOptions {
+  height: number;
+  width: number;
+  fps?: number; // target frame rate, which determines the frame budget. Can be changed by set_fps in the C program.
+  // called with each filtered frame. The frame view is only valid until the callback returns.
+  onFrame?: (frame: Uint8ClampedArray, stats: FilteredFrameStats) => void;
+  onFrameDropped?: (sequence: number) => void;
+  printFunction?: (str: string) => void; // print function for the output of the C program
+}
+
+interface FrameSlot {
+  src: Uint8ClampedArray;
+  dest: Uint8ClampedArray;
+  submittedAt: number;
+}
+
+export default class FilterPipeline {
+  private worker: PipelineWorker;
+  private options: FilterPipelineOptions;
+  private slots: FrameSlot[];
+  private freeSlots: number[];
+  private nextSequence = 0;
+  private totalFilterTimeMs = 0;
+  private telemetry: FrameTelemetry;
+  private error: Error | null = null;
+  private isStopped = false;
+  private idleWaiters: {
+    resolve: () => void;
+    reject: (e: Error) => void;
+  }[] = [];
+  private readyWaiter: {
+    resolve: () => void;
+    reject: (e: Error) => void;
+  } | null = null;
+
+  private constructor(worker: PipelineWorker, options: FilterPipelineOptions) {
+    if (typeof SharedArrayBuffer === "undefined") {
+      throw new Error(
+        "pix_n_flix: pipeline mode requires SharedArrayBuffer (the page must be cross-origin isolated)",
+      );
+    }
+    this.worker = worker;
+    this.options = options;
+    const frameSize = options.height * options.width * FRAME_CHANNELS;
+    this.slots = [];
+    this.freeSlots = [];
+    for (let i = 0; i < PIPELINE_FRAME_SLOTS; ++i) {
+      const buffer = new SharedArrayBuffer(2 * frameSize);
+      this.slots.push({
+        src: new Uint8ClampedArray(buffer, 0, frameSize),
+        dest: new Uint8ClampedArray(buffer, frameSize, frameSize),
+        submittedAt: 0,
+      });
+      this.freeSlots.push(i);
+    }
+    this.telemetry = {
+      framesSubmitted: 0,
+      framesFiltered: 0,
+      framesDropped: 0,
+      queueDepth: 0,
+      lastFilterTimeMs: 0,
+      averageFilterTimeMs: 0,
+      maxFilterTimeMs: 0,
+      frameBudgetMs: 1000 / (options.fps ?? DEFAULT_PIPELINE_FPS),
+    };
+    worker.setMessageHandler((message) => this.handleMessage(message));
+    worker.setFailureHandler((message) => this.fail(message));
+  }
+
+  /**
+   * Starts a pipeline running the given compiled program in the given worker.
+   * Resolves once the program has run and installed its filter.
+   */
+  static async start(
+    worker: PipelineWorker,
+    program: CompiledFilterProgram,
+    options: FilterPipelineOptions,
+  ): Promise<FilterPipeline> {
+    const pipeline = new FilterPipeline(worker, options);
+    const ready = new Promise<void>((resolve, reject) => {
+      pipeline.readyWaiter = { resolve, reject };
+    });
+    worker.postMessage({
+      type: "init",
+      program,
+      height: options.height,
+      width: options.width,
+      slots: pipeline.slots.map((slot) => slot.src.buffer as SharedArrayBuffer),
+    });
+    await ready;
+    return pipeline;
+  }
+
+  /**
+   * Submits an RGBA frame (e.g. ImageData.data) to be filtered. The frame is copied, so it can be reused after this returns.
+   * Returns false if the frame was dropped as the pipeline is full.
+   */
+  submitFrame(frame: ArrayLike<number>): boolean {
+    if (this.error !== null) {
+      throw this.error;
+    }
+    const sequence = this.nextSequence++;
+    ++this.telemetry.framesSubmitted;
+    const slotIndex = this.freeSlots.pop();
+    if (typeof slotIndex === "undefined") {
+      this.dropFrame(sequence);
+      return false;
+    }
+    const slot = this.slots[slotIndex];
+    if (frame.length !== slot.src.length) {
+      this.freeSlots.push(slotIndex);
+      throw new Error(
+        `pix_n_flix: frame has ${frame.length} bytes, expected ${slot.src.length}`,
+      );
+    }
+    slot.src.set(frame);
+    slot.submittedAt = getWallClockTime();
+    ++this.telemetry.queueDepth;
+    this.worker.postMessage({
+      type: "frame",
+      slot: slotIndex,
+      sequence,
+      submittedAt: slot.submittedAt,
+      budgetMs: this.telemetry.frameBudgetMs,
+    });
+    return true;
+  }
+
+  getTelemetry(): FrameTelemetry {
+    return { ...this.telemetry };
+  }
+
+  setFps(fps: number) {
+    if (fps > 0) {
+      this.telemetry.frameBudgetMs = 1000 / fps;
+    }
+  }
+
+  /**
+   * Resolves once all submitted frames have been filtered or dropped.
+   */
+  whenIdle(): Promise<void> {
+    if (this.error !== null) {
+      return Promise.reject(this.error);
+    }
+    if (this.telemetry.queueDepth === 0) {
+      return Promise.resolve();
+    }
+    return new Promise((resolve, reject) =>
+      this.idleWaiters.push({ resolve, reject }),
+    );
+  }
+
+  stop() {
+    this.isStopped = true;
+    this.worker.postMessage({ type: "stop" });
+    this.worker.terminate();
+  }
+
+  private dropFrame(sequence: number) {
+    ++this.telemetry.framesDropped;
+    if (typeof this.options.onFrameDropped !== "undefined") {
+      this.options.onFrameDropped(sequence);
+    }
+  }
+
+  private releaseSlot(slotIndex: number) {
+    this.freeSlots.push(slotIndex);
+    --this.telemetry.queueDepth;
+    if (this.telemetry.queueDepth === 0) {
+      const waiters = this.idleWaiters;
+      this.idleWaiters = [];
+      waiters.forEach((waiter) => waiter.resolve());
+    }
+  }
+
+  private handleMessage(message: FilterWorkerResponse) {
+    switch (message.type) {
+      case "ready":
+        this.readyWaiter?.resolve();
+        this.readyWaiter = null;
+        break;
+      case "print":
+        (this.options.printFunction ?? console.log)(message.str);
+        break;
+      case "setFps":
+        this.setFps(message.fps);
+        break;
+      case "frameDone": {
+        const telemetry = this.telemetry;
+        ++telemetry.framesFiltered;
+        this.totalFilterTimeMs += message.filterTimeMs;
+        telemetry.lastFilterTimeMs = message.filterTimeMs;
+        telemetry.averageFilterTimeMs =
+          this.totalFilterTimeMs / telemetry.framesFiltered;
+        telemetry.maxFilterTimeMs = Math.max(
+          telemetry.maxFilterTimeMs,
+          message.filterTimeMs,
+        );
+        const slot = this.slots[message.slot];
+        if (typeof this.options.onFrame !== "undefined") {
+          this.options.onFrame(slot.dest, {
+            sequence: message.sequence,
+            filterTimeMs: message.filterTimeMs,
+            latencyMs: getWallClockTime() - slot.submittedAt,
+          });
+        }
+        this.releaseSlot(message.slot);
+        break;
+      }
+      case "frameDropped":
+        this.dropFrame(message.sequence);
+        this.releaseSlot(message.slot);
+        break;
+      case "error":
+        this.fail(message.message);
+        break;
+    }
+  }
+
+  /**
+   * Fails the pipeline, and everything waiting on it, as the worker has reported an error or has failed.
+   */
+  private fail(message: string) {
+    if (this.isStopped || this.error !== null) {
+      return;
+    }
+    this.error = new Error(`pix_n_flix filter worker: ${message}`);
+    this.readyWaiter?.reject(this.error);
+    this.readyWaiter = null;
+    const waiters = this.idleWaiters;
+    this.idleWaiters = [];
+    waiters.forEach((waiter) => waiter.reject(this.error as Error));
+  }
+}
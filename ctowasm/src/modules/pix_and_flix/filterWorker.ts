@@ -0,0 +1,178 @@
+/**
+ * The worker side of the pix_n_flix filter pipeline (see filterPipeline.ts).
+ * Runs the compiled C program once to install its filter, then filters each frame submitted by the pipeline.
+ *
+ * A worker script only needs to call startFilterWorker with the port of the worker, e.g. in a browser worker:
+ *   startFilterWorker(browserWorkerPort(self));
+ * or in a Node.js worker thread:
+ *   startFilterWorker(nodeWorkerPort(parentPort));
+ */
+
+import { runWasm } from "~src/runWasm";
+import ModuleRepository from "~src/modules";
+import {
+  FilterWorkerRequest,
+  FilterWorkerResponse,
+  getWallClockTime,
+} from "~src/modules/pix_and_flix/filterPipeline";
+import { PixAndFlixFilter } from "~src/modules/pix_and_flix/types";
+
+/**
+ * The interface the worker uses to talk to the pipeline.
+ */
+export interface FilterWorkerPort {
+  postMessage(message: FilterWorkerResponse): void;
+  setMessageHandler(handler: (message: FilterWorkerRequest) => void): void;
+}
+
+/**
+ * Adapts the global scope of a browser Worker.
+ */
+export function browserWorkerPort(scope: {
+  postMessage(message: unknown): void;
+  onmessage: ((event: MessageEvent) => void) | null;
+}): FilterWorkerPort {
+  return {
+    postMessage: (message) => scope.postMessage(message),
+    setMessageHandler: (handler) => {
+      scope.onmessage = (event) => handler(event.data);
+    },
+  };
+}
+
+/**
+ * Adapts the parentPort of a Node.js worker thread.
+ */
+export function nodeWorkerPort(parentPort: {
+  postMessage(message: unknown): void;
+  on(event: "message", listener: (message: never) => void): unknown;
+  close(): void;
+}): FilterWorkerPort {
+  return {
+    postMessage: (message) => parentPort.postMessage(message),
+    setMessageHandler: (handler) => {
+      parentPort.on("message", (message: FilterWorkerRequest) => {
+        handler(message);
+        if (message.type === "stop") {
+          parentPort.close();
+        }
+      });
+    },
+  };
+}
+
+interface FilterWorkerState {
+  height: number;
+  width: number;
+  slots: { src: Uint8ClampedArray; dest: Uint8ClampedArray }[];
+  moduleRepository: ModuleRepository;
+  installed: { filter: PixAndFlixFilter | null }; // filter is null if the program has reset the filter
+}
+
+export function startFilterWorker(port: FilterWorkerPort) {
+  let state: FilterWorkerState | null = null;
+
+  const postError = (e: unknown) =>
+    port.postMessage({
+      type: "error",
+      message: e instanceof Error ? e.message : String(e),
+    });
+
+  port.setMessageHandler(async (message) => {
+    switch (message.type) {
+      case "init": {
+        const { program, height, width } = message;
+        const installed: { filter: PixAndFlixFilter | null } = {
+          filter: null,
+        };
+        try {
+          // frames come from the pipeline, so the source and resolution related functions only need to stand in for the host
+          const moduleRepository = await runWasm(
+            program.wasm,
+            program.dataSegmentSize,
+            program.functionTableSize,
+            program.importedModules,
+            {
+              printFunction: (str) => port.postMessage({ type: "print", str }),
+              externalFunctions: {
+                install_filter: (filter: PixAndFlixFilter) => {
+                  installed.filter = filter;
+                },
+                reset_filter: () => {
+                  installed.filter = null;
+                },
+                set_fps: (fps: number) =>
+                  port.postMessage({ type: "setFps", fps }),
+                image_height: () => height,
+                image_width: () => width,
+                set_dimensions: () => {},
+                use_image_url: () => {},
+                use_video_url: () => {},
+                start: () => {},
+              },
+            },
+          );
+          if (installed.filter === null) {
+            throw new Error("program did not install a filter");
+          }
+          state = {
+            height,
+            width,
+            slots: message.slots.map((buffer) => {
+              const frameSize = buffer.byteLength / 2;
+              return {
+                src: new Uint8ClampedArray(buffer, 0, frameSize),
+                dest: new Uint8ClampedArray(buffer, frameSize, frameSize),
+              };
+            }),
+            moduleRepository,
+            installed,
+          };
+          port.postMessage({ type: "ready" });
+        } catch (e) {
+          postError(e);
+        }
+        break;
+      }
+      case "frame": {
+        if (state === null) {
+          postError("frame submitted before the worker was ready");
+          return;
+        }
+        const { slot, sequence } = message;
+        // frames that waited longer than the frame budget are stale, and are dropped to let the pipeline catch up
+        if (getWallClockTime() - message.submittedAt > message.budgetMs) {
+          port.postMessage({ type: "frameDropped", slot, sequence });
+          return;
+        }
+        const { src, dest } = state.slots[slot];
+        const { filter } = state.installed;
+        const startTime = performance.now();
+        try {
+          if (filter === null) {
+            dest.set(src);
+          } else {
+            filter.getFrameBuffers(state.height, state.width).src.set(src);
+            filter.applyFilter();
+            // memory may have grown while filtering, so the views are fetched again
+            dest.set(filter.getFrameBuffers(state.height, state.width).dest);
+          }
+          state.moduleRepository.flushStdout();
+        } catch (e) {
+          postError(e);
+          return;
+        }
+        port.postMessage({
+          type: "frameDone",
+          slot,
+          sequence,
+          filterTimeMs: performance.now() - startTime,
+        });
+        break;
+      }
+      case "stop":
+        state = null;
+        break;
+    }
+  });
+}
@@ -0,0 +1,105 @@
+/**
+ * Persistent frame buffers that pix_n_flix filters read from and write to.
+ * The buffers live in the linear memory of the wasm module and are only reallocated when the frame resolution changes,
+ * so that the host can fill the source frame and read the filtered frame in place without any per-frame allocation.
+ */
+
+export const FRAME_CHANNELS = 4; // each pixel is stored as RGBA, one byte per channel
+
+export interface FrameBufferViews {
+  src: Uint8ClampedArray; // source frame, laid out in the same way as ImageData.data
+  dest: Uint8ClampedArray; // destination frame that the filter writes to
+}
+
+export default class FrameBuffers {
+  private memory: WebAssembly.Memory;
+  private allocate: (numBytes: number) => number;
+  private deallocate: (address: number) => void;
+  height = 0;
+  width = 0;
+  isAllocated = false;
+  srcAddress = 0; // address of the source frame
+  destAddress = 0; // address of the destination frame, directly after the source frame
+  // views are recreated only when the memory buffer changes (i.e. memory grows)
+  private viewsBuffer: ArrayBufferLike | null = null;
+  private views: FrameBufferViews | null = null;
+
+  constructor(
+    memory: WebAssembly.Memory,
+    allocate: (numBytes: number) => number,
+    deallocate: (address: number) => void,
+  ) {
+    this.memory = memory;
+    this.allocate = allocate;
+    this.deallocate = deallocate;
+  }
+
+  get frameSize() {
+    return this.height * this.width * FRAME_CHANNELS;
+  }
+
+  /**
+   * Makes sure the buffers fit a frame of given resolution, reallocating them if the resolution changed.
+   * Returns true if the buffers were reallocated.
+   */
+  ensureResolution(height: number, width: number): boolean {
+    if (height <= 0 || width <= 0) {
+      throw new Error(
+        `pix_n_flix: invalid frame resolution ${height} x ${width}`,
+      );
+    }
+    if (this.isAllocated && height === this.height && width === this.width) {
+      return false;
+    }
+    this.release();
+    this.height = height;
+    this.width = width;
+    // both frames are allocated as one block
+    this.srcAddress = this.allocate(2 * this.frameSize);
+    this.destAddress = this.srcAddress + this.frameSize;
+    this.isAllocated = true;
+    return true;
+  }
+
+  /**
+   * Returns views of the source and destination frames.
+   * The returned views must not be held across calls into the wasm module, as memory may grow during a call.
+   */
+  getViews(): FrameBufferViews {
+    if (!this.isAllocated) {
+      throw new Error("pix_n_flix: frame buffers have not been allocated");
+    }
+    if (this.views === null || this.viewsBuffer !== this.memory.buffer) {
+      this.viewsBuffer = this.memory.buffer;
+      this.views = {
+        src: new Uint8ClampedArray(
+          this.memory.buffer,
+          this.srcAddress,
+          this.frameSize,
+        ),
+        dest: new Uint8ClampedArray(
+          this.memory.buffer,
+          this.destAddress,
+          this.frameSize,
+        ),
+      };
+    }
+    return this.views;
+  }
+
+  /**
+   * Frees the buffers, if allocated.
+   */
+  release() {
+    if (this.isAllocated) {
+      this.deallocate(this.srcAddress);
+    }
+    this.isAllocated = false;
+    this.srcAddress = 0;
+    this.destAddress = 0;
+    this.height = 0;
+    this.width = 0;
+    this.views = null;
+    this.viewsBuffer = null;
+  }
+}
@@ -0,0 +1,60 @@
+/**
+ * Headless stand-in for the pix_n_flix host, which feeds synthetic frames to a filter pipeline at a fixed frame rate.
+ * Allows filters to be run and measured (e.g. under Node.js) without a camera or video element.
+ */
+
+import FilterPipeline, {
+  FrameTelemetry,
+} from "~src/modules/pix_and_flix/filterPipeline";
+import { FRAME_CHANNELS } from "~src/modules/pix_and_flix/frameBuffers";
+
+/**
+ * Fills an RGBA frame with a gradient pattern that moves with frameIndex.
+ */
+export function fillSyntheticFrame(
+  frame: Uint8ClampedArray,
+  height: number,
+  width: number,
+  frameIndex: number,
+) {
+  let currAddress = 0;
+  for (let i = 0; i < height; ++i) {
+    for (let j = 0; j < width; ++j) {
+      frame[currAddress++] = (i + frameIndex) & 0xff;
+      frame[currAddress++] = (j + frameIndex) & 0xff;
+      frame[currAddress++] = (i + j) & 0xff;
+      frame[currAddress++] = 255;
+    }
+  }
+}
+
+export interface HeadlessRunOptions {
+  height: number;
+  width: number;
+  numberOfFrames: number;
+  fps: number; // rate at which frames are submitted
+}
+
+/**
+ * Submits numberOfFrames synthetic frames to the pipeline at the given frame rate.
+ * Resolves with the telemetry of the pipeline once all frames have been filtered or dropped.
+ */
+export async function runHeadlessPipeline(
+  pipeline: FilterPipeline,
+  { height, width, numberOfFrames, fps }: HeadlessRunOptions,
+): Promise<FrameTelemetry> {
+  const frame = new Uint8ClampedArray(height * width * FRAME_CHANNELS);
+  const frameIntervalMs = 1000 / fps;
+  const startTime = performance.now();
+  for (let frameIndex = 0; frameIndex < numberOfFrames; ++frameIndex) {
+    // frames are submitted on schedule, however long the filter takes, like a camera would
+    const delayMs = startTime + frameIndex * frameIntervalMs - performance.now();
+    if (delayMs > 0) {
+      await new Promise((resolve) => setTimeout(resolve, delayMs));
+    }
+    fillSyntheticFrame(frame, height, width, frameIndex);
+    pipeline.submitFrame(frame);
+  }
+  await pipeline.whenIdle();
+  return pipeline.getTelemetry();
+}
@@ -4,13 +4,18 @@ import {
   freeFunction,
   mallocFunction,
 } from "~src/modules/source_stdlib/memory";
-import wrapFunctionPtrCall from "~src/modules/stackFrameUtils";
-import { Module, ModuleFunction, StackFrameArg } from "~src/modules/types";
+import { getFunctionPtrTrampoline } from "~src/modules/stackFrameUtils";
+import { Module, ModuleFunction } from "~src/modules/types";
+import FrameBuffers, {
+  FRAME_CHANNELS,
+} from "~src/modules/pix_and_flix/frameBuffers";
+import { PixAndFlixFilter } from "~src/modules/pix_and_flix/types";
 import {
   extractCStyleStringFromMemory,
   getExternalFunction,
 } from "~src/modules/util";
 import { StructDataType } from "~src/parser/c-ast/dataTypes";
+import OutputBuffer from "~src/modules/outputBuffer";
 
 // the name that this module is imported into wasm by,
 // as well as the include name to use in C program file.
@@ -20,15 +25,34 @@ export class PixAndFlixLibrary extends Module {
   moduleDeclaredStructs: StructDataType[];
   moduleFunctions: Record<string, ModuleFunction>;
   sharedWasmGlobalVariables: SharedWasmGlobalVariables;
+  frameBuffers: FrameBuffers; // reused across all frames of the installed filter
 
   constructor(
     memory: WebAssembly.Memory,
     functionTable: WebAssembly.Table,
     config: ModulesGlobalConfig,
     sharedWasmGlobalVariables: SharedWasmGlobalVariables,
+    stdout?: OutputBuffer,
   ) {
-    super(memory, functionTable, config, sharedWasmGlobalVariables);
+    super(memory, functionTable, config, sharedWasmGlobalVariables, stdout);
     this.sharedWasmGlobalVariables = sharedWasmGlobalVariables;
+    this.frameBuffers = new FrameBuffers(
+      memory,
+      (numBytes) =>
+        mallocFunction({
+          memory,
+          sharedWasmGlobalVariables,
+          freeList: this.freeList,
+          allocatedBlocks: this.allocatedBlocks,
+          bytesRequested: numBytes,
+        }),
+      (address) =>
+        freeFunction({
+          address,
+          freeList: this.freeList,
+          allocatedBlocks: this.allocatedBlocks,
+        }),
+    );
     this.moduleDeclaredStructs = [];
     this.moduleFunctions = {
       use_image_url: {
@@ -215,88 +239,7 @@ export class PixAndFlixLibrary extends Module {
           returnType: voidDataType,
         },
         jsFunction: (funcPtr: number) => {
-          const filter = (src: number[][][], dest: number[][][]) => {
-            const memSize = src.length * src[0].length * src[0][0].length;
-
-            // allocate buffers on the heap
-            const srcAddress = mallocFunction({
-              memory,
-              sharedWasmGlobalVariables,
-              freeList: this.freeList,
-              allocatedBlocks: this.allocatedBlocks,
-              bytesRequested: memSize,
-            });
-            const destAddress = mallocFunction({
-              memory,
-              sharedWasmGlobalVariables,
-              freeList: this.freeList,
-              allocatedBlocks: this.allocatedBlocks,
-              bytesRequested: memSize,
-            });
-
-            // copy the values in
-            let currAddress = 0;
-            const srcArr = new Uint8Array(memory.buffer, srcAddress, memSize);
-            for (let i = 0; i < src.length; ++i) {
-              for (let j = 0; j < src[0].length; ++j) {
-                for (let k = 0; k < src[0][0].length; ++k) {
-                  srcArr[currAddress++] = src[i][j][k];
-                }
-              }
-            }
-
-            const stackFrameArgs: StackFrameArg[] = [
-              {
-                value: BigInt(srcAddress),
-                type: "unsigned int",
-              },
-              {
-                value: BigInt(destAddress),
-                type: "unsigned int",
-              },
-              {
-                value: BigInt(src.length),
-                type: "unsigned int",
-              },
-              {
-                value: BigInt(src[0].length),
-                type: "unsigned int",
-              },
-            ];
-
-            // call the function pointer
-            wrapFunctionPtrCall(
-              memory,
-              functionTable,
-              funcPtr,
-              sharedWasmGlobalVariables,
-              stackFrameArgs,
-              [],
-            );
-
-            // copy the values out
-            const destArr = new Uint8Array(memory.buffer, destAddress, memSize);
-            currAddress = 0;
-            for (let i = 0; i < dest.length; ++i) {
-              for (let j = 0; j < dest[0].length; ++j) {
-                for (let k = 0; k < dest[0][0].length; ++k) {
-                  dest[i][j][k] = destArr[currAddress++];
-                }
-              }
-            }
-
-            // free both buffers
-            freeFunction({
-              address: srcAddress,
-              freeList: this.freeList,
-              allocatedBlocks: this.allocatedBlocks,
-            });
-            freeFunction({
-              address: destAddress,
-              freeList: this.freeList,
-              allocatedBlocks: this.allocatedBlocks,
-            });
-          };
+          const filter = this.createFilter(funcPtr);
           getExternalFunction("install_filter", config)(filter);
         },
       },
@@ -323,10 +266,73 @@ export class PixAndFlixLibrary extends Module {
           ],
           returnType: voidDataType,
         },
-        jsFunction: () => {
-          getExternalFunction("set_fps", config)();
+        jsFunction: (fps: number) => {
+          getExternalFunction("set_fps", config)(fps);
         },
       },
     };
   }
+
+  /**
+   * Creates the filter that is given to the host for the filter function pointed to by funcPtr.
+   * The filter reads and writes the persistent frame buffers, which are only reallocated when the resolution changes.
+   */
+  createFilter(funcPtr: number): PixAndFlixFilter {
+    // filter(src, dest, height, width)
+    const trampoline = getFunctionPtrTrampoline(
+      ["pointer", "pointer", "signed int", "signed int"],
+      [],
+    );
+    const callContext = {
+      memory: this.memory,
+      functionTable: this.functionTable,
+      sharedWasmGlobalVariables: this.sharedWasmGlobalVariables,
+    };
+
+    const applyFilter = () => {
+      const { height, width, srcAddress, destAddress } = this.frameBuffers;
+      trampoline(callContext, funcPtr, [srcAddress, destAddress, height, width]);
+    };
+
+    // copying filter for hosts that still pass frames as nested arrays
+    const filter = (src: number[][][], dest: number[][][]) => {
+      const height = src.length;
+      const width = src[0].length;
+      this.frameBuffers.ensureResolution(height, width);
+      const srcView = this.frameBuffers.getViews().src;
+      let currAddress = 0;
+      for (let i = 0; i < height; ++i) {
+        const row = src[i];
+        for (let j = 0; j < width; ++j) {
+          const pixel = row[j];
+          for (let k = 0; k < FRAME_CHANNELS; ++k) {
+            srcView[currAddress++] = pixel[k];
+          }
+        }
+      }
+
+      applyFilter();
+
+      // memory may have grown during the call, so the views are fetched again
+      const destView = this.frameBuffers.getViews().dest;
+      currAddress = 0;
+      for (let i = 0; i < height; ++i) {
+        const row = dest[i];
+        for (let j = 0; j < width; ++j) {
+          const pixel = row[j];
+          for (let k = 0; k < FRAME_CHANNELS; ++k) {
+            pixel[k] = destView[currAddress++];
+          }
+        }
+      }
+    };
+
+    return Object.assign(filter, {
+      getFrameBuffers: (height: number, width: number) => {
+        this.frameBuffers.ensureResolution(height, width);
+        return this.frameBuffers.getViews();
+      },
+      applyFilter,
+    });
+  }
 }
@@ -1,4 +1,21 @@
+import { FrameBufferViews } from "~src/modules/pix_and_flix/frameBuffers";
+
 export interface PixAndFlixExternalLibraryFunctions {
   use_image_url: (url: string) => void;
   start: () => void;
+  install_filter: (filter: PixAndFlixFilter) => void;
+}
+
+/**
+ * The filter given to the host by install_filter.
+ * Calling it directly copies frames given as nested [row][column][RGBA channel] arrays in and out of the module.
+ * Hosts that can work on flat RGBA data should instead fill the source frame view from getFrameBuffers
+ * (e.g. with ImageData.data), call applyFilter, and read the destination frame view, which avoids any copying.
+ */
+export interface PixAndFlixFilter {
+  (src: number[][][], dest: number[][][]): void;
+  // returns the frame buffer views for given resolution, reallocating the buffers only if the resolution changed
+  getFrameBuffers: (height: number, width: number) => FrameBufferViews;
+  // runs the filter on the frame buffers, in place
+  applyFilter: () => void;
 }
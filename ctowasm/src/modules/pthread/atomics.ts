@@ -0,0 +1,285 @@
+/**
+ * The atomic operations and mutexes of the pthread module, implemented directly in wasm with atomic instructions, so
+ * that they take no call into JS.
+ *
+ * All of them operate on ints, which must be 4 byte aligned, or the atomic instructions trap.
+ * A mutex is an int that is 0 when unlocked, 1 when locked, and 2 when locked with other threads possibly waiting for
+ * it, with the same algorithm as the locks of the JS runtime (see src/modules/sharedLock.ts). Waiting threads block in
+ * memory.atomic.wait32 until woken up by the unlocking thread.
+ */
+
+import { ExternalFunction } from "~src/processor/c-ast/core";
+import {
+  breakIf,
+  i32Const,
+  i32Op,
+  i32Variables,
+  ifThen,
+  loadI32Params,
+  localGet,
+  localSet,
+  loop,
+  storeReturnValue,
+} from "~src/modules/wasmImplementationUtil";
+import { WasmExpression } from "~src/translator/wasm-ast/core";
+import { WasmFunction } from "~src/translator/wasm-ast/functions";
+import { WasmAtomicRmwOperation } from "~src/translator/wasm-ast/memory";
+
+export const EBUSY = 16; // returned by pthread_mutex_trylock when the mutex is locked
+
+const UNLOCKED = 0;
+const LOCKED = 1;
+const LOCKED_WITH_WAITERS = 2;
+
+function atomicRmw(
+  operation: WasmAtomicRmwOperation,
+  addr: WasmExpression,
+  value: WasmExpression,
+): WasmExpression {
+  return { type: "AtomicRmw", operation, addr, value };
+}
+
+function atomicCmpxchg(
+  addr: WasmExpression,
+  expected: WasmExpression,
+  replacement: WasmExpression,
+): WasmExpression {
+  return { type: "AtomicCmpxchg", addr, expected, replacement };
+}
+
+/**
+ * Returns the wasm implementation of a function that applies the read-modify-write operation to an int and a value,
+ * returning the previous value of the int e.g. atomic_fetch_add(int *obj, int arg).
+ */
+export function createAtomicRmwWasmImplementation(
+  operation: WasmAtomicRmwOperation,
+) {
+  return (externalFunction: ExternalFunction): WasmFunction[] => [
+    {
+      type: "Function",
+      name: externalFunction.name,
+      locals: i32Variables("obj", "value"),
+      body: [
+        ...loadI32Params(externalFunction, ["obj", "value"]),
+        storeReturnValue(
+          externalFunction,
+          atomicRmw(operation, localGet("obj"), localGet("value")),
+        ),
+      ],
+    },
+  ];
+}
+
+/**
+ * Returns the wasm implementation of atomic_load(int *obj).
+ */
+export function createAtomicLoadWasmImplementation(
+  externalFunction: ExternalFunction,
+): WasmFunction[] {
+  return [
+    {
+      type: "Function",
+      name: externalFunction.name,
+      locals: i32Variables("obj"),
+      body: [
+        ...loadI32Params(externalFunction, ["obj"]),
+        storeReturnValue(externalFunction, {
+          type: "AtomicLoad",
+          addr: localGet("obj"),
+        }),
+      ],
+    },
+  ];
+}
+
+/**
+ * Returns the wasm implementation of atomic_store(int *obj, int desired).
+ */
+export function createAtomicStoreWasmImplementation(
+  externalFunction: ExternalFunction,
+): WasmFunction[] {
+  return [
+    {
+      type: "Function",
+      name: externalFunction.name,
+      locals: i32Variables("obj", "desired"),
+      body: [
+        ...loadI32Params(externalFunction, ["obj", "desired"]),
+        {
+          type: "AtomicStore",
+          addr: localGet("obj"),
+          value: localGet("desired"),
+        },
+      ],
+    },
+  ];
+}
+
+/**
+ * Returns the wasm implementation of atomic_compare_exchange(int *obj, int expected, int desired), which stores desired
+ * in the int if it equals expected, returning the previous value of the int.
+ */
+export function createAtomicCompareExchangeWasmImplementation(
+  externalFunction: ExternalFunction,
+): WasmFunction[] {
+  return [
+    {
+      type: "Function",
+      name: externalFunction.name,
+      locals: i32Variables("obj", "expected", "desired"),
+      body: [
+        ...loadI32Params(externalFunction, ["obj", "expected", "desired"]),
+        storeReturnValue(
+          externalFunction,
+          atomicCmpxchg(
+            localGet("obj"),
+            localGet("expected"),
+            localGet("desired"),
+          ),
+        ),
+      ],
+    },
+  ];
+}
+
+/**
+ * Returns the wasm implementation of pthread_mutex_init(int *mutex, void *attr), which unlocks the mutex.
+ * The attributes are ignored.
+ */
+export function createMutexInitWasmImplementation(
+  externalFunction: ExternalFunction,
+): WasmFunction[] {
+  return [
+    {
+      type: "Function",
+      name: externalFunction.name,
+      locals: i32Variables("mutex", "attr"),
+      body: [
+        ...loadI32Params(externalFunction, ["mutex", "attr"]),
+        {
+          type: "AtomicStore",
+          addr: localGet("mutex"),
+          value: i32Const(UNLOCKED),
+        },
+        storeReturnValue(externalFunction, i32Const(0)),
+      ],
+    },
+  ];
+}
+
+/**
+ * Returns the wasm implementation of pthread_mutex_lock(int *mutex), which blocks until the mutex is locked by the
+ * calling thread.
+ */
+export function createMutexLockWasmImplementation(
+  externalFunction: ExternalFunction,
+): WasmFunction[] {
+  const mutex = localGet("mutex");
+  const state = localGet("state");
+  const exchangeWithWaiters = localSet(
+    "state",
+    atomicRmw("xchg", mutex, i32Const(LOCKED_WITH_WAITERS)),
+  );
+  return [
+    {
+      type: "Function",
+      name: externalFunction.name,
+      locals: i32Variables("mutex", "state"),
+      body: [
+        ...loadI32Params(externalFunction, ["mutex"]),
+        localSet(
+          "state",
+          atomicCmpxchg(mutex, i32Const(UNLOCKED), i32Const(LOCKED)),
+        ),
+        ifThen(i32Op("ne", state, i32Const(UNLOCKED)), [
+          ifThen(i32Op("ne", state, i32Const(LOCKED_WITH_WAITERS)), [
+            exchangeWithWaiters,
+          ]),
+          loop("wait", [
+            breakIf("wait", i32Op("eq", state, i32Const(UNLOCKED))),
+            // the result of the wait is not needed, as the mutex is tried again either way
+            localSet("state", {
+              type: "AtomicWait",
+              addr: mutex,
+              expected: i32Const(LOCKED_WITH_WAITERS),
+              timeout: {
+                type: "IntegerConst",
+                wasmDataType: "i64",
+                value: -1n, // no timeout
+              },
+            }),
+            exchangeWithWaiters,
+          ]),
+        ]),
+        storeReturnValue(externalFunction, i32Const(0)),
+      ],
+    },
+  ];
+}
+
+/**
+ * Returns the wasm implementation of pthread_mutex_trylock(int *mutex), which locks the mutex if it is unlocked,
+ * returning 0, or returns EBUSY otherwise.
+ */
+export function createMutexTrylockWasmImplementation(
+  externalFunction: ExternalFunction,
+): WasmFunction[] {
+  return [
+    {
+      type: "Function",
+      name: externalFunction.name,
+      locals: i32Variables("mutex"),
+      body: [
+        ...loadI32Params(externalFunction, ["mutex"]),
+        ifThen(
+          i32Op(
+            "eq",
+            atomicCmpxchg(
+              localGet("mutex"),
+              i32Const(UNLOCKED),
+              i32Const(LOCKED),
+            ),
+            i32Const(UNLOCKED),
+          ),
+          [storeReturnValue(externalFunction, i32Const(0))],
+          [storeReturnValue(externalFunction, i32Const(EBUSY))],
+        ),
+      ],
+    },
+  ];
+}
+
+/**
+ * Returns the wasm implementation of pthread_mutex_unlock(int *mutex), which unlocks the mutex, waking up a waiting
+ * thread if there may be one.
+ */
+export function createMutexUnlockWasmImplementation(
+  externalFunction: ExternalFunction,
+): WasmFunction[] {
+  const mutex = localGet("mutex");
+  return [
+    {
+      type: "Function",
+      name: externalFunction.name,
+      locals: i32Variables("mutex", "woken"),
+      body: [
+        ...loadI32Params(externalFunction, ["mutex"]),
+        ifThen(
+          i32Op(
+            "eq",
+            atomicRmw("xchg", mutex, i32Const(UNLOCKED)),
+            i32Const(LOCKED_WITH_WAITERS),
+          ),
+          [
+            localSet("woken", {
+              type: "AtomicNotify",
+              addr: mutex,
+              count: i32Const(1),
+            }),
+          ],
+        ),
+        storeReturnValue(externalFunction, i32Const(0)),
+      ],
+    },
+  ];
+}
@@ -0,0 +1,214 @@
+import { ModulesGlobalConfig, SharedWasmGlobalVariables } from "~src/modules";
+import { Module, ModuleFunction } from "~src/modules/types";
+import {
+  DataType,
+  FunctionDataType,
+  StructDataType,
+} from "~src/parser/c-ast/dataTypes";
+import OutputBuffer from "~src/modules/outputBuffer";
+import {
+  createAtomicCompareExchangeWasmImplementation,
+  createAtomicLoadWasmImplementation,
+  createAtomicRmwWasmImplementation,
+  createAtomicStoreWasmImplementation,
+  createMutexInitWasmImplementation,
+  createMutexLockWasmImplementation,
+  createMutexTrylockWasmImplementation,
+  createMutexUnlockWasmImplementation,
+} from "~src/modules/pthread/atomics";
+import {
+  ThreadRuntime,
+  joinThread,
+} from "~src/modules/pthread/threadControl";
+import { WasmAtomicRmwOperation } from "~src/translator/wasm-ast/memory";
+
+// the name that this module is imported into wasm by,
+// as well as the include name to use in C program file.
+export const pthreadModuleImportName = "pthread";
+
+const EAGAIN = 11; // returned by pthread_create when there is no memory left for the thread
+
+// a pthread_t is an unsigned int, and a pthread_mutex_t is an int (see atomics.ts)
+function pthreadType(): DataType {
+  return { type: "primary", primaryDataType: "unsigned int" };
+}
+
+function intType(): DataType {
+  return { type: "primary", primaryDataType: "signed int" };
+}
+
+function pointerTo(pointeeType: DataType): DataType {
+  return { type: "pointer", pointeeType };
+}
+
+function voidPointerType(): DataType {
+  return pointerTo({ type: "void" });
+}
+
+function functionType(
+  parameters: DataType[],
+  returnType: DataType,
+): FunctionDataType {
+  return { type: "function", parameters, returnType };
+}
+
+/**
+ * A subset of POSIX threads, with atomic operations on ints.
+ * Threads can only be created by programs compiled with the threads option, which run each thread in its own worker
+ * (see src/threadsRun.ts). The mutexes and atomic operations work in any program.
+ */
+export class PthreadModule extends Module {
+  moduleDeclaredStructs: StructDataType[];
+  moduleFunctions: Record<string, ModuleFunction>;
+
+  constructor(
+    memory: WebAssembly.Memory,
+    functionTable: WebAssembly.Table,
+    config: ModulesGlobalConfig,
+    sharedWasmGlobalVariables: SharedWasmGlobalVariables,
+    stdout?: OutputBuffer,
+  ) {
+    super(memory, functionTable, config, sharedWasmGlobalVariables, stdout);
+    this.moduleDeclaredStructs = [];
+    this.moduleFunctions = {
+      // int pthread_create(pthread_t *thread, void *attr, void *(*start_routine)(void *), void *arg)
+      // the attributes are ignored
+      pthread_create: {
+        parentImportedObject: pthreadModuleImportName,
+        functionType: functionType(
+          [
+            pointerTo(pthreadType()),
+            voidPointerType(),
+            pointerTo(functionType([voidPointerType()], voidPointerType())),
+            voidPointerType(),
+          ],
+          intType(),
+        ),
+        jsFunction: (
+          threadAddress: number,
+          _attr: number,
+          startRoutine: number,
+          arg: number,
+        ) => {
+          const id = this.getThreadRuntime("pthread_create").createThread(
+            startRoutine,
+            arg,
+          );
+          if (id === 0) {
+            return EAGAIN;
+          }
+          new DataView(this.memory.buffer).setUint32(threadAddress, id, true);
+          return 0;
+        },
+      },
+      // int pthread_join(pthread_t thread, void **retval)
+      pthread_join: {
+        parentImportedObject: pthreadModuleImportName,
+        functionType: functionType(
+          [pthreadType(), pointerTo(voidPointerType())],
+          intType(),
+        ),
+        jsFunction: (thread: number, returnValueAddress: number) => {
+          const returnValue = joinThread(
+            this.getThreadRuntime("pthread_join").heap,
+            thread,
+          );
+          if (returnValueAddress !== 0) {
+            new DataView(this.memory.buffer).setUint32(
+              returnValueAddress,
+              returnValue,
+              true,
+            );
+          }
+          return 0;
+        },
+      },
+      // returns the id of the calling thread, 0 in programs that were not compiled with the threads option
+      pthread_self: {
+        parentImportedObject: pthreadModuleImportName,
+        functionType: functionType([], pthreadType()),
+        jsFunction: () => this.config.threads?.threadId ?? 0,
+      },
+      pthread_mutex_init: {
+        parentImportedObject: pthreadModuleImportName,
+        functionType: functionType(
+          [pointerTo(intType()), voidPointerType()],
+          intType(),
+        ),
+        wasmImplementation: createMutexInitWasmImplementation,
+      },
+      pthread_mutex_destroy: {
+        parentImportedObject: pthreadModuleImportName,
+        functionType: functionType([pointerTo(intType())], intType()),
+        jsFunction: () => 0, // there is nothing to free
+      },
+      pthread_mutex_lock: {
+        parentImportedObject: pthreadModuleImportName,
+        functionType: functionType([pointerTo(intType())], intType()),
+        wasmImplementation: createMutexLockWasmImplementation,
+      },
+      pthread_mutex_trylock: {
+        parentImportedObject: pthreadModuleImportName,
+        functionType: functionType([pointerTo(intType())], intType()),
+        wasmImplementation: createMutexTrylockWasmImplementation,
+      },
+      pthread_mutex_unlock: {
+        parentImportedObject: pthreadModuleImportName,
+        functionType: functionType([pointerTo(intType())], intType()),
+        wasmImplementation: createMutexUnlockWasmImplementation,
+      },
+      // int atomic_load(int *obj)
+      atomic_load: {
+        parentImportedObject: pthreadModuleImportName,
+        functionType: functionType([pointerTo(intType())], intType()),
+        wasmImplementation: createAtomicLoadWasmImplementation,
+      },
+      // void atomic_store(int *obj, int desired)
+      atomic_store: {
+        parentImportedObject: pthreadModuleImportName,
+        functionType: functionType([pointerTo(intType()), intType()], {
+          type: "void",
+        }),
+        wasmImplementation: createAtomicStoreWasmImplementation,
+      },
+      // int atomic_compare_exchange(int *obj, int expected, int desired), returns the previous value of obj
+      atomic_compare_exchange: {
+        parentImportedObject: pthreadModuleImportName,
+        functionType: functionType(
+          [pointerTo(intType()), intType(), intType()],
+          intType(),
+        ),
+        wasmImplementation: createAtomicCompareExchangeWasmImplementation,
+      },
+    };
+
+    // int atomic_fetch_add(int *obj, int arg) etc., which return the previous value of obj
+    const readModifyWriteFunctions: Record<string, WasmAtomicRmwOperation> = {
+      atomic_fetch_add: "add",
+      atomic_fetch_sub: "sub",
+      atomic_fetch_and: "and",
+      atomic_fetch_or: "or",
+      atomic_fetch_xor: "xor",
+      atomic_exchange: "xchg",
+    };
+    for (const [name, operation] of Object.entries(readModifyWriteFunctions)) {
+      this.moduleFunctions[name] = {
+        parentImportedObject: pthreadModuleImportName,
+        functionType: functionType(
+          [pointerTo(intType()), intType()],
+          intType(),
+        ),
+        wasmImplementation: createAtomicRmwWasmImplementation(operation),
+      };
+    }
+  }
+
+  private getThreadRuntime(functionName: string): ThreadRuntime {
+    if (typeof this.config.threads === "undefined") {
+      throw new Error(
+        `${functionName}(): threads are only supported in programs compiled with the threads option, run in a worker`,
+      );
+    }
+    return this.config.threads;
+  }
+}
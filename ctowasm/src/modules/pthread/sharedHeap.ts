@@ -0,0 +1,173 @@
+/**
+ * The heap of programs compiled with the threads option, used for malloc and free from all threads at once.
+ *
+ * The free list and allocated blocks of the heap of a single threaded program are kept in JS (see
+ * src/modules/source_stdlib/memory.ts), where other threads cannot see them. The state of this heap is instead kept
+ * in the shared memory itself, so that every thread can allocate from it:
+ * - a control block, holding the lock of the heap (see sharedLock.ts), the address of the first byte after the heap,
+ *   and the address of the first block of the free list.
+ * - a header before each block, holding the size of the block, and the address of the next block of the free list if
+ *   the block is free, or ALLOCATED_MARK if it is allocated.
+ * As with the single threaded heap, free blocks are taken first fit and split, and the heap grows (growing memory if
+ * needed) when there is no free block large enough. Blocks are 8 byte aligned.
+ */
+
+import { lockSharedWord, unlockSharedWord } from "~src/modules/sharedLock";
+import { calculateNumberOfPagesNeededForBytes } from "~src/common/utils";
+
+// indexes in the control block, in words
+const LOCK = 0;
+const HEAP_END = 1;
+const FREE_LIST_HEAD = 2;
+export const SHARED_HEAP_CONTROL_BLOCK_SIZE = 16;
+
+// offsets in the header of a block, in words
+const BLOCK_SIZE = 0;
+const BLOCK_NEXT = 1;
+const BLOCK_HEADER_SIZE = 8;
+const ALLOCATED_MARK = -1;
+
+const ALIGNMENT = 8;
+const MIN_BLOCK_SIZE = ALIGNMENT; // a free block is only split off if it can hold this many bytes
+
+function align(value: number) {
+  return Math.ceil(value / ALIGNMENT) * ALIGNMENT;
+}
+
+export default class SharedHeap {
+  memory: WebAssembly.Memory;
+  controlBlockAddress: number;
+
+  /**
+   * @param controlBlockAddress the address of the control block of a heap created with SharedHeap.create()
+   */
+  constructor(memory: WebAssembly.Memory, controlBlockAddress: number) {
+    this.memory = memory;
+    this.controlBlockAddress = controlBlockAddress;
+  }
+
+  /**
+   * Creates an empty heap with its control block at the given 8 byte aligned address. The heap starts right after it.
+   */
+  static create(
+    memory: WebAssembly.Memory,
+    controlBlockAddress: number,
+  ): SharedHeap {
+    const heap = new SharedHeap(memory, controlBlockAddress);
+    const view = heap.getView();
+    const control = controlBlockAddress / 4;
+    Atomics.store(view, control + LOCK, 0);
+    Atomics.store(
+      view,
+      control + HEAP_END,
+      controlBlockAddress + SHARED_HEAP_CONTROL_BLOCK_SIZE,
+    );
+    Atomics.store(view, control + FREE_LIST_HEAD, 0);
+    return heap;
+  }
+
+  // the buffer of a shared memory is replaced when it grows, so a view is made for each use
+  private getView() {
+    return new Int32Array(this.memory.buffer);
+  }
+
+  /**
+   * Returns the address of the first byte after the heap.
+   */
+  getHeapEnd(): number {
+    return Atomics.load(
+      this.getView(),
+      this.controlBlockAddress / 4 + HEAP_END,
+    );
+  }
+
+  /**
+   * Allocates a block of at least the given number of bytes, returning its address, or 0 if memory is full.
+   */
+  malloc(bytesRequested: number): number {
+    const size = Math.max(MIN_BLOCK_SIZE, align(bytesRequested));
+    const control = this.controlBlockAddress / 4;
+    let view = this.getView();
+    lockSharedWord(view, control + LOCK);
+    try {
+      // first fit from the free list
+      let previous = 0; // header address of the previous free block, 0 if there is none
+      let block = view[control + FREE_LIST_HEAD];
+      while (block !== 0) {
+        const blockSize = view[block / 4 + BLOCK_SIZE];
+        if (blockSize >= size) {
+          let next = view[block / 4 + BLOCK_NEXT];
+          if (blockSize - size >= BLOCK_HEADER_SIZE + MIN_BLOCK_SIZE) {
+            // split off the rest of the block, which takes its place in the free list
+            const rest = block + BLOCK_HEADER_SIZE + size;
+            view[rest / 4 + BLOCK_SIZE] = blockSize - size - BLOCK_HEADER_SIZE;
+            view[rest / 4 + BLOCK_NEXT] = next;
+            view[block / 4 + BLOCK_SIZE] = size;
+            next = rest;
+          }
+          view[
+            previous === 0
+              ? control + FREE_LIST_HEAD
+              : previous / 4 + BLOCK_NEXT
+          ] = next;
+          view[block / 4 + BLOCK_NEXT] = ALLOCATED_MARK;
+          return block + BLOCK_HEADER_SIZE;
+        }
+        previous = block;
+        block = view[block / 4 + BLOCK_NEXT];
+      }
+
+      // no suitable block on the free list, need to expand heap
+      block = view[control + HEAP_END];
+      const heapEnd = block + BLOCK_HEADER_SIZE + size;
+      if (heapEnd > this.memory.buffer.byteLength) {
+        try {
+          this.memory.grow(
+            calculateNumberOfPagesNeededForBytes(
+              heapEnd - this.memory.buffer.byteLength,
+            ),
+          );
+        } catch (e) {
+          if (e instanceof RangeError) {
+            return 0; // the memory is at its maximum size
+          }
+          throw e;
+        }
+        view = this.getView();
+      }
+      view[control + HEAP_END] = heapEnd;
+      view[block / 4 + BLOCK_SIZE] = size;
+      view[block / 4 + BLOCK_NEXT] = ALLOCATED_MARK;
+      return block + BLOCK_HEADER_SIZE;
+    } finally {
+      unlockSharedWord(view, control + LOCK);
+    }
+  }
+
+  /**
+   * Frees the block at the given address, which must have been allocated by malloc. Freeing address 0 does nothing.
+   */
+  free(address: number) {
+    if (address === 0) {
+      return;
+    }
+    const control = this.controlBlockAddress / 4;
+    const view = this.getView();
+    const block = address - BLOCK_HEADER_SIZE;
+    lockSharedWord(view, control + LOCK);
+    try {
+      if (
+        address % ALIGNMENT !== 0 ||
+        block < this.controlBlockAddress + SHARED_HEAP_CONTROL_BLOCK_SIZE ||
+        address >= view[control + HEAP_END] ||
+        view[block / 4 + BLOCK_NEXT] !== ALLOCATED_MARK
+      ) {
+        throw new Error("free(): No allocated block with given address");
+      }
+      view[block / 4 + BLOCK_NEXT] = view[control + FREE_LIST_HEAD];
+      view[control + FREE_LIST_HEAD] = block;
+    } finally {
+      unlockSharedWord(view, control + LOCK);
+    }
+  }
+}
@@ -0,0 +1,112 @@
+/**
+ * The threads of a program compiled with the threads option, as seen from the pthread module.
+ *
+ * Each thread has a block allocated from the shared heap (see sharedHeap.ts), holding its control block followed by
+ * its stack. The id of a thread (its pthread_t) is the address of its control block, which holds the state of the
+ * thread and the return value of its start routine. A joining thread waits on the state with Atomics.wait, and a
+ * thread notifies its joiners when it ends. The block of a thread is freed once it has been joined.
+ */
+
+import SharedHeap from "~src/modules/pthread/sharedHeap";
+
+export const THREAD_STACK_SIZE = 1024 * 1024; // bytes
+const THREAD_CONTROL_BLOCK_SIZE = 16;
+
+// indexes in the control block, in words
+const STATE = 0;
+const RETURN_VALUE = 1;
+
+const RUNNING = 0;
+const FINISHED = 1;
+const FAILED = 2; // the thread threw an error (e.g. it trapped)
+
+export interface ThreadRegion {
+  id: number; // address of the control block
+  stackBase: number; // lowest address of the stack
+  stackTop: number; // address just past the stack
+}
+
+/**
+ * The threads runtime that a running thread uses to create other threads (see src/threadsRun.ts).
+ */
+export interface ThreadRuntime {
+  heap: SharedHeap;
+  threadId: number; // id of the running thread
+  // starts a thread running the start routine (a function pointer) with the given arg. Returns the id of the thread,
+  // or 0 if there is no memory left for it.
+  createThread(startRoutine: number, arg: number): number;
+}
+
+/**
+ * Allocates the control block and stack of a new running thread. Returns null if there is no memory left for it.
+ */
+export function allocateThread(heap: SharedHeap): ThreadRegion | null {
+  const id = heap.malloc(THREAD_CONTROL_BLOCK_SIZE + THREAD_STACK_SIZE);
+  if (id === 0) {
+    return null;
+  }
+  const controlBlock = new Int32Array(
+    heap.memory.buffer,
+    id,
+    THREAD_CONTROL_BLOCK_SIZE / 4,
+  );
+  Atomics.store(controlBlock, STATE, RUNNING);
+  Atomics.store(controlBlock, RETURN_VALUE, 0);
+  const stackBase = id + THREAD_CONTROL_BLOCK_SIZE;
+  return { id, stackBase, stackTop: stackBase + THREAD_STACK_SIZE };
+}
+
+function endThread(
+  memory: WebAssembly.Memory,
+  id: number,
+  state: number,
+  returnValue: number,
+) {
+  const controlBlock = new Int32Array(
+    memory.buffer,
+    id,
+    THREAD_CONTROL_BLOCK_SIZE / 4,
+  );
+  Atomics.store(controlBlock, RETURN_VALUE, returnValue);
+  Atomics.store(controlBlock, STATE, state);
+  Atomics.notify(controlBlock, STATE);
+}
+
+/**
+ * Marks the thread as finished with the given return value of its start routine, waking up its joiners.
+ */
+export function finishThread(
+  memory: WebAssembly.Memory,
+  id: number,
+  returnValue: number,
+) {
+  endThread(memory, id, FINISHED, returnValue);
+}
+
+/**
+ * Marks the thread as having ended with an error, waking up its joiners.
+ */
+export function failThread(memory: WebAssembly.Memory, id: number) {
+  endThread(memory, id, FAILED, 0);
+}
+
+/**
+ * Blocks until the thread with the given id has ended, then frees it. Returns the return value of its start routine.
+ */
+export function joinThread(heap: SharedHeap, id: number): number {
+  const controlBlock = new Int32Array(
+    heap.memory.buffer,
+    id,
+    THREAD_CONTROL_BLOCK_SIZE / 4,
+  );
+  while (Atomics.load(controlBlock, STATE) === RUNNING) {
+    Atomics.wait(controlBlock, STATE, RUNNING);
+  }
+  const state = Atomics.load(controlBlock, STATE);
+  const returnValue = Atomics.load(controlBlock, RETURN_VALUE);
+  heap.free(id);
+  if (state === FAILED) {
+    throw new Error(`pthread_join(): thread ${id} ended with an error`);
+  }
+  return returnValue;
+}
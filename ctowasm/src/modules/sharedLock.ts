@@ -0,0 +1,38 @@
+/**
+ * A lock held in one 32 bit word of shared memory, for mutual exclusion between workers.
+ *
+ * The word is 0 when unlocked, 1 when locked, and 2 when locked with other workers possibly waiting for it, so that
+ * unlocking only notifies waiters when there may be some. Waiting uses Atomics.wait, so the lock can only be taken by
+ * workers (and the main thread of Node.js), not by the main thread of a browser.
+ * The same algorithm is used for the mutexes of C programs (see src/modules/pthread/atomics.ts).
+ */
+
+const UNLOCKED = 0;
+const LOCKED = 1;
+const LOCKED_WITH_WAITERS = 2;
+
+/**
+ * Takes the lock in the word at the given index of the view, blocking until it is free.
+ */
+export function lockSharedWord(view: Int32Array, index: number) {
+  let state = Atomics.compareExchange(view, index, UNLOCKED, LOCKED);
+  if (state === UNLOCKED) {
+    return;
+  }
+  if (state !== LOCKED_WITH_WAITERS) {
+    state = Atomics.exchange(view, index, LOCKED_WITH_WAITERS);
+  }
+  while (state !== UNLOCKED) {
+    Atomics.wait(view, index, LOCKED_WITH_WAITERS);
+    state = Atomics.exchange(view, index, LOCKED_WITH_WAITERS);
+  }
+}
+
+/**
+ * Releases the lock in the word at the given index of the view, which must be held by the caller.
+ */
+export function unlockSharedWord(view: Int32Array, index: number) {
+  if (Atomics.exchange(view, index, UNLOCKED) === LOCKED_WITH_WAITERS) {
+    Atomics.notify(view, index, 1);
+  }
+}
@@ -0,0 +1,153 @@
+/**
+ * Statistics of the heap of a program, kept as it calls malloc and free (see the source_stdlib module).
+ *
+ * Usage:
+ *   const moduleRepository = await runWasm(...);
+ *   moduleRepository.getHeapStats(); moduleRepository.getHeapLeaks();
+ *
+ * Programs compiled with the allocationSites option set the call site of each malloc and free before calling it, which
+ * is given with each allocation event and leak (see src/translator/allocationSites.ts). It is -1 otherwise.
+ */
+
+import { MemoryBlock } from "~src/modules/source_stdlib/memory";
+
+export const UNKNOWN_ALLOCATION_SITE = -1;
+
+export interface HeapAllocationEvent {
+  type: "malloc" | "free";
+  address: number;
+  size: number; // of the block allocated or freed
+  allocationSite: number; // index of the call site in the allocation sites of the program, -1 if not known
+}
+
+export interface HeapLeak {
+  address: number;
+  size: number;
+  allocationSite: number; // of the malloc that allocated the block
+}
+
+export interface HeapSizeHistogramBucket {
+  maxSize: number; // the bucket counts the allocations of more than half of this size, up to this size
+  count: number;
+}
+
+export interface HeapStats {
+  liveBytes: number; // allocated and not yet freed
+  liveBlocks: number;
+  peakLiveBytes: number;
+  numberOfAllocations: number;
+  numberOfFrees: number;
+  totalBytesAllocated: number;
+  sizeHistogram: HeapSizeHistogramBucket[]; // by powers of 2, only the buckets with allocations
+  freeListLength: number;
+  freeBytes: number; // in the blocks of the free list
+  largestFreeBlock: number;
+  // share of the free bytes that are not in the largest free block, 0 when all of them can be allocated at once
+  fragmentation: number;
+  heapSize: number; // bytes between the start of the heap and the heap pointer
+}
+
+interface LiveBlock {
+  size: number;
+  allocationSite: number;
+}
+
+/**
+ * Index of the histogram bucket of an allocation of given size, the smallest i with size <= 2^i.
+ */
+function getSizeBucket(size: number) {
+  return size <= 1 ? 0 : 32 - Math.clz32(size - 1);
+}
+
+export default class HeapTracker {
+  private liveBlocks: Map<number, LiveBlock> = new Map();
+  private liveBytes = 0;
+  private peakLiveBytes = 0;
+  private numberOfAllocations = 0;
+  private numberOfFrees = 0;
+  private totalBytesAllocated = 0;
+  private sizeHistogram: number[] = [];
+  private events?: HeapAllocationEvent[]; // only if the event log is enabled
+
+  constructor(logEvents = false) {
+    if (logEvents) {
+      this.events = [];
+    }
+  }
+
+  recordMalloc(address: number, size: number, allocationSite: number) {
+    this.liveBlocks.set(address, { size, allocationSite });
+    this.liveBytes += size;
+    this.peakLiveBytes = Math.max(this.peakLiveBytes, this.liveBytes);
+    ++this.numberOfAllocations;
+    this.totalBytesAllocated += size;
+    const bucket = getSizeBucket(size);
+    while (this.sizeHistogram.length <= bucket) {
+      this.sizeHistogram.push(0);
+    }
+    ++this.sizeHistogram[bucket];
+    this.events?.push({ type: "malloc", address, size, allocationSite });
+  }
+
+  /**
+   * Called after a successful free, so the block is always live.
+   */
+  recordFree(address: number, allocationSite: number) {
+    const block = this.liveBlocks.get(address);
+    if (typeof block === "undefined") {
+      return;
+    }
+    this.liveBlocks.delete(address);
+    this.liveBytes -= block.size;
+    ++this.numberOfFrees;
+    this.events?.push({
+      type: "free",
+      address,
+      size: block.size,
+      allocationSite,
+    });
+  }
+
+  getStats(freeList: MemoryBlock[], heapSize: number): HeapStats {
+    let freeBytes = 0;
+    let largestFreeBlock = 0;
+    for (const block of freeList) {
+      freeBytes += block.size;
+      largestFreeBlock = Math.max(largestFreeBlock, block.size);
+    }
+    return {
+      liveBytes: this.liveBytes,
+      liveBlocks: this.liveBlocks.size,
+      peakLiveBytes: this.peakLiveBytes,
+      numberOfAllocations: this.numberOfAllocations,
+      numberOfFrees: this.numberOfFrees,
+      totalBytesAllocated: this.totalBytesAllocated,
+      sizeHistogram: this.sizeHistogram
+        .map((count, bucket) => ({ maxSize: 2 ** bucket, count }))
+        .filter(({ count }) => count > 0),
+      freeListLength: freeList.length,
+      freeBytes,
+      largestFreeBlock,
+      fragmentation: freeBytes > 0 ? 1 - largestFreeBlock / freeBytes : 0,
+      heapSize,
+    };
+  }
+
+  /**
+   * Returns the blocks that are allocated and not freed, largest first.
+   */
+  getLeaks(): HeapLeak[] {
+    return Array.from(this.liveBlocks, ([address, block]) => ({
+      address,
+      size: block.size,
+      allocationSite: block.allocationSite,
+    })).sort((a, b) => b.size - a.size || a.address - b.address);
+  }
+
+  /**
+   * Returns the log of all the mallocs and frees of the program, in order. Empty if the event log is not enabled.
+   */
+  getEvents(): HeapAllocationEvent[] {
+    return this.events ?? [];
+  }
+}
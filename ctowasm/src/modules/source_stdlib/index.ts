@@ -10,8 +10,21 @@ import { Module, ModuleFunction } from "~src/modules/types";
 import {
   convertFloatToCStyleString,
   extractCStyleStringFromMemory,
+  getUtf8ByteLength,
+  writeCStyleStringToMemory,
 } from "~src/modules/util";
+import { formatPrintfString } from "~src/modules/source_stdlib/printf";
 import { StructDataType } from "~src/parser/c-ast/dataTypes";
+import OutputBuffer from "~src/modules/outputBuffer";
+import {
+  createGetcharWasmImplementation,
+  createReadIntegerWasmImplementation,
+  scanFormattedInput,
+  stdinImportedGlobals,
+} from "~src/modules/source_stdlib/stdin";
+import HeapTracker, {
+  UNKNOWN_ALLOCATION_SITE,
+} from "~src/modules/source_stdlib/heapStats";
 
 // the name that this module is imported into wasm by,
 // as well as the include name to use in C program file.
@@ -21,15 +34,18 @@ export class SourceStandardLibraryModule extends Module {
   moduleDeclaredStructs: StructDataType[];
   moduleFunctions: Record<string, ModuleFunction>;
   heapAddress: number; // address of first item in heap
+  heapTracker: HeapTracker; // statistics of the blocks allocated by malloc and free
 
   constructor(
     memory: WebAssembly.Memory,
     functionTable: WebAssembly.Table,
     config: ModulesGlobalConfig,
     sharedWasmGlobalVariables: SharedWasmGlobalVariables,
+    stdout?: OutputBuffer,
   ) {
-    super(memory, functionTable, config, sharedWasmGlobalVariables);
+    super(memory, functionTable, config, sharedWasmGlobalVariables, stdout);
     this.heapAddress = this.sharedWasmGlobalVariables.heapPointer.value;
+    this.heapTracker = new HeapTracker(config.heapEventLog);
     this.moduleDeclaredStructs = [];
     this.moduleFunctions = {
       print_int: {
@@ -213,6 +229,34 @@ export class SourceStandardLibraryModule extends Module {
           this.print(str);
         },
       },
+      // formatted printing to buffered stdout, returns the number of bytes written (as UTF-8)
+      printf: {
+        parentImportedObject: sourceStandardLibraryModuleImportName,
+        functionType: {
+          type: "function",
+          parameters: [
+            {
+              type: "pointer",
+              pointeeType: {
+                type: "primary",
+                primaryDataType: "signed char",
+                isConst: true,
+              },
+            },
+          ],
+          returnType: { type: "primary", primaryDataType: "signed int" },
+          isVariadic: true,
+        },
+        jsFunction: (formatAddress: number, varArgsAddress: number) => {
+          const str = formatPrintfString(
+            this.memory,
+            formatAddress,
+            varArgsAddress,
+          );
+          this.write(str);
+          return getUtf8ByteLength(str);
+        },
+      },
       malloc: {
         parentImportedObject: sourceStandardLibraryModuleImportName,
         functionType: {
@@ -228,14 +272,25 @@ export class SourceStandardLibraryModule extends Module {
             pointeeType: { type: "void" },
           },
         },
-        jsFunction: (numBytes: number) =>
-          mallocFunction({
+        // the threads of a program compiled with the threads option share a heap in the shared memory
+        jsFunction: (numBytes: number) => {
+          if (typeof this.config.threads !== "undefined") {
+            return this.config.threads.heap.malloc(numBytes);
+          }
+          const address = mallocFunction({
             memory: this.memory,
             sharedWasmGlobalVariables: this.sharedWasmGlobalVariables,
             freeList: this.freeList,
             allocatedBlocks: this.allocatedBlocks,
             bytesRequested: numBytes,
-          }),
+          });
+          this.heapTracker.recordMalloc(
+            address,
+            numBytes,
+            this.takeAllocationSite(),
+          );
+          return address;
+        },
       },
       free: {
         parentImportedObject: sourceStandardLibraryModuleImportName,
@@ -249,12 +304,18 @@ export class SourceStandardLibraryModule extends Module {
           ],
           returnType: { type: "void" },
         },
-        jsFunction: (address: number) =>
+        jsFunction: (address: number) => {
+          if (typeof this.config.threads !== "undefined") {
+            this.config.threads.heap.free(address);
+            return;
+          }
           freeFunction({
             address,
             freeList: this.freeList,
             allocatedBlocks: this.allocatedBlocks,
-          }),
+          });
+          this.heapTracker.recordFree(address, this.takeAllocationSite());
+        },
       },
       print_heap: {
         parentImportedObject: sourceStandardLibraryModuleImportName,
@@ -291,7 +352,10 @@ export class SourceStandardLibraryModule extends Module {
           parameters: [],
           returnType: { type: "primary", primaryDataType: "signed int" },
         },
-        jsFunction: () => prompt("Enter a signed integer"),
+        jsFunction: () => {
+          this.stdout.flush(); // make sure any pending output is shown before prompting
+          return prompt("Enter a signed integer");
+        },
       },
       prompt_long: {
         parentImportedObject: sourceStandardLibraryModuleImportName,
@@ -300,7 +364,10 @@ export class SourceStandardLibraryModule extends Module {
           parameters: [],
           returnType: { type: "primary", primaryDataType: "signed long" },
         },
-        jsFunction: () => prompt("Enter a long signed integer"),
+        jsFunction: () => {
+          this.stdout.flush(); // make sure any pending output is shown before prompting
+          return prompt("Enter a long signed integer");
+        },
       },
       // only works in browser environment, node.js support can be added in future
       prompt_float: {
@@ -310,7 +377,10 @@ export class SourceStandardLibraryModule extends Module {
           parameters: [],
           returnType: { type: "primary", primaryDataType: "float" },
         },
-        jsFunction: () => prompt("Enter a float"),
+        jsFunction: () => {
+          this.stdout.flush(); // make sure any pending output is shown before prompting
+          return prompt("Enter a float");
+        },
       },
       prompt_double: {
         parentImportedObject: sourceStandardLibraryModuleImportName,
@@ -319,7 +389,10 @@ export class SourceStandardLibraryModule extends Module {
           parameters: [],
           returnType: { type: "primary", primaryDataType: "double" },
         },
-        jsFunction: () => prompt("Enter a double"),
+        jsFunction: () => {
+          this.stdout.flush(); // make sure any pending output is shown before prompting
+          return prompt("Enter a double");
+        },
       },
       // only works in browser environment, node.js support can be added in future
       prompt_string: {
@@ -337,21 +410,73 @@ export class SourceStandardLibraryModule extends Module {
           ],
           returnType: { type: "void" },
         },
+        writesMemory: true,
         jsFunction: (strAddr: number) => {
+          this.stdout.flush();
           const str = prompt("Enter a string");
-          const encoder = new TextEncoder();
-          const strBuffer = new Uint8Array(this.memory.buffer, strAddr);
-          if (str === null) {
-            strBuffer[0] = 0;
-            return;
-          }
-          const buf = encoder.encode(str);
-          for (let i = 0; i < str.length; ++i) {
-            strBuffer[i] = buf[i];
-          }
-          strBuffer[str.length] = 0;
+          writeCStyleStringToMemory(this.memory.buffer, strAddr, str ?? "");
         },
       },
+      // the following read from the input preloaded from the stdin of the modules config (see stdin.ts)
+      // returns the next byte of input as an unsigned char, or EOF (-1) at the end of input
+      getchar: {
+        parentImportedObject: sourceStandardLibraryModuleImportName,
+        functionType: {
+          type: "function",
+          parameters: [],
+          returnType: { type: "primary", primaryDataType: "signed int" },
+        },
+        wasmImplementation: createGetcharWasmImplementation,
+        wasmImplementationGlobals: stdinImportedGlobals,
+      },
+      // skips whitespace and reads a decimal integer, returns 0 if there is none
+      read_int: {
+        parentImportedObject: sourceStandardLibraryModuleImportName,
+        functionType: {
+          type: "function",
+          parameters: [],
+          returnType: { type: "primary", primaryDataType: "signed int" },
+        },
+        wasmImplementation: createReadIntegerWasmImplementation,
+        wasmImplementationGlobals: stdinImportedGlobals,
+      },
+      read_long: {
+        parentImportedObject: sourceStandardLibraryModuleImportName,
+        functionType: {
+          type: "function",
+          parameters: [],
+          returnType: { type: "primary", primaryDataType: "signed long" },
+        },
+        wasmImplementation: createReadIntegerWasmImplementation,
+        wasmImplementationGlobals: stdinImportedGlobals,
+      },
+      // formatted reading, returns the number of values stored or EOF (-1) if input ended before the first conversion
+      scanf: {
+        parentImportedObject: sourceStandardLibraryModuleImportName,
+        functionType: {
+          type: "function",
+          parameters: [
+            {
+              type: "pointer",
+              pointeeType: {
+                type: "primary",
+                primaryDataType: "signed char",
+                isConst: true,
+              },
+            },
+          ],
+          returnType: { type: "primary", primaryDataType: "signed int" },
+          isVariadic: true,
+        },
+        writesMemory: true,
+        jsFunction: (formatAddress: number, varArgsAddress: number) =>
+          scanFormattedInput(
+            this.memory,
+            this.sharedWasmGlobalVariables,
+            formatAddress,
+            varArgsAddress,
+          ),
+      },
       // EXAMPLE of how to have a function taking aggregate type and returning aggreate type - TESTED AND WORKING
       // adjust_a: {
       //   parentImportedObject: sourceStandardLibraryModuleImportName,
@@ -430,4 +555,15 @@ export class SourceStandardLibraryModule extends Module {
       // },
     };
   }
+
+  /**
+   * Returns the call site of the malloc or free being called, set by programs compiled with the allocationSites option,
+   * and clears it so that it is not reused for calls that do not set it.
+   */
+  private takeAllocationSite(): number {
+    const allocationSite = this.sharedWasmGlobalVariables.allocationSite.value;
+    this.sharedWasmGlobalVariables.allocationSite.value =
+      UNKNOWN_ALLOCATION_SITE;
+    return allocationSite;
+  }
 }
@@ -26,13 +26,16 @@ export function mallocFunction({
   allocatedBlocks,
   freeList,
 }: MallocFunctionParams): number {
+  // blocks are kept by their address, so even malloc(0) takes a byte, to return an address no other block has
+  const blockSize = Math.max(bytesRequested, 1);
+
   // see if freeList has any deallocated memory blocks
   // simple first fit algorithm
   let i = 0;
   let foundBlock = false;
   for (; i < freeList.length; ++i) {
     const block = freeList[i];
-    if (block.size >= bytesRequested) {
+    if (block.size >= blockSize) {
       foundBlock = true;
       break;
     }
@@ -42,29 +45,25 @@ export function mallocFunction({
   if (foundBlock) {
     const block = freeList[i];
     freeList.splice(i, 1);
-    if (block.size > bytesRequested) {
+    if (block.size > blockSize) {
       const splitBlock = {
-        address: block.address + bytesRequested,
-        size: block.size - bytesRequested,
+        address: block.address + blockSize,
+        size: block.size - blockSize,
       };
       freeList.push(splitBlock);
     }
-    allocatedBlocks.set(block.address, bytesRequested);
+    allocatedBlocks.set(block.address, blockSize);
     return block.address;
   }
 
   // no suitable block on the free list, need to expand heap
-  checkAndExpandMemoryIfNeeded(
-    memory,
-    bytesRequested,
-    sharedWasmGlobalVariables,
-  );
+  checkAndExpandMemoryIfNeeded(memory, blockSize, sharedWasmGlobalVariables);
 
   // enlarge heap segment
   const address = sharedWasmGlobalVariables.heapPointer.value;
-  sharedWasmGlobalVariables.heapPointer.value += bytesRequested;
+  sharedWasmGlobalVariables.heapPointer.value += blockSize;
 
-  allocatedBlocks.set(address, bytesRequested);
+  allocatedBlocks.set(address, blockSize);
   return address;
 }
 
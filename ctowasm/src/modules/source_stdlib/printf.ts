@@ -0,0 +1,435 @@
+/**
+ * Implementation of the formatting done by printf.
+ * Follows the behaviour of glibc printf for the supported conversion specifications.
+ *
+ * Like C, formatting works on bytes: the format string, "%s" strings and "%c" characters are copied as raw bytes
+ * (held one byte per character in a "byte string"), and field widths and "%s" precisions count bytes. The formatted
+ * bytes are decoded as UTF-8 once at the end, so a multi-byte character can be printed one "%c" at a time.
+ */
+
+import { getCStyleStringBytes } from "~src/modules/util";
+import {
+  formatFloatExponential,
+  formatFloatFixed,
+  formatFloatGeneral,
+} from "~src/modules/floatFormatting";
+
+/**
+ * Reads the variadic args of a call to a variadic imported function.
+ * The variadic args are placed in the stack frame after the named parameters - from high to low address,
+ * each occupying the size of its (default argument promoted) data type.
+ */
+export class VariadicArgsReader {
+  private view: DataView;
+  private address: number; // address just above the next arg to read
+
+  constructor(memory: WebAssembly.Memory, varArgsAddress: number) {
+    this.view = new DataView(memory.buffer);
+    this.address = varArgsAddress;
+  }
+
+  private next(size: number) {
+    this.address -= size;
+    return this.address;
+  }
+
+  nextInt32() {
+    return this.view.getInt32(this.next(4), true);
+  }
+
+  nextUint32() {
+    return this.view.getUint32(this.next(4), true);
+  }
+
+  nextBigInt64() {
+    return this.view.getBigInt64(this.next(8), true);
+  }
+
+  nextDouble() {
+    return this.view.getFloat64(this.next(8), true);
+  }
+}
+
+type LengthModifier = "hh" | "h" | "l" | "ll" | "j" | "z" | "t" | "L" | "";
+
+interface ConversionSpecification {
+  leftJustify: boolean; // "-" flag
+  forceSign: boolean; // "+" flag
+  spaceSign: boolean; // " " flag
+  alternateForm: boolean; // "#" flag
+  zeroPad: boolean; // "0" flag
+  width: number;
+  precision: number | null; // null if not specified
+  length: LengthModifier;
+  conversion: string;
+}
+
+const CONVERSION_CHARS = "diuoxXcspfFeEgGaA%n";
+
+const BYTE_STRING_CHUNK_SIZE = 8192; // bytes converted per call of String.fromCharCode
+const utf8Decoder = new TextDecoder();
+
+/**
+ * Returns a string holding each of the given bytes as one character.
+ */
+function toByteString(bytes: Uint8Array): string {
+  let str = "";
+  for (let i = 0; i < bytes.length; i += BYTE_STRING_CHUNK_SIZE) {
+    str += String.fromCharCode(
+      ...bytes.subarray(i, i + BYTE_STRING_CHUNK_SIZE),
+    );
+  }
+  return str;
+}
+
+/**
+ * Decodes the bytes held by a byte string as UTF-8.
+ */
+function decodeByteString(str: string): string {
+  // eslint-disable-next-line no-control-regex
+  if (!/[\x80-\xff]/.test(str)) {
+    return str; // ASCII
+  }
+  const bytes = new Uint8Array(str.length);
+  for (let i = 0; i < str.length; ++i) {
+    bytes[i] = str.charCodeAt(i);
+  }
+  return utf8Decoder.decode(bytes);
+}
+
+/**
+ * Returns the string that results from formatting the C format string located at formatAddress,
+ * with the variadic args that start at varArgsAddress.
+ */
+export function formatPrintfString(
+  memory: WebAssembly.Memory,
+  formatAddress: number,
+  varArgsAddress: number,
+): string {
+  const format = toByteString(
+    getCStyleStringBytes(memory.buffer, formatAddress),
+  );
+  const args = new VariadicArgsReader(memory, varArgsAddress);
+  let result = "";
+  let i = 0;
+  while (i < format.length) {
+    const percentIndex = format.indexOf("%", i);
+    if (percentIndex === -1) {
+      result += format.slice(i);
+      break;
+    }
+    result += format.slice(i, percentIndex);
+    i = percentIndex + 1;
+
+    const spec: ConversionSpecification = {
+      leftJustify: false,
+      forceSign: false,
+      spaceSign: false,
+      alternateForm: false,
+      zeroPad: false,
+      width: 0,
+      precision: null,
+      length: "",
+      conversion: "",
+    };
+
+    // flags
+    for (; i < format.length; ++i) {
+      const c = format[i];
+      if (c === "-") {
+        spec.leftJustify = true;
+      } else if (c === "+") {
+        spec.forceSign = true;
+      } else if (c === " ") {
+        spec.spaceSign = true;
+      } else if (c === "#") {
+        spec.alternateForm = true;
+      } else if (c === "0") {
+        spec.zeroPad = true;
+      } else {
+        break;
+      }
+    }
+
+    // field width
+    if (format[i] === "*") {
+      ++i;
+      const width = args.nextInt32();
+      if (width < 0) {
+        // negative width is taken as "-" flag followed by positive width
+        spec.leftJustify = true;
+        spec.width = -width;
+      } else {
+        spec.width = width;
+      }
+    } else {
+      const start = i;
+      while (isDigit(format[i])) {
+        ++i;
+      }
+      spec.width = start === i ? 0 : parseInt(format.slice(start, i));
+    }
+
+    // precision
+    if (format[i] === ".") {
+      ++i;
+      if (format[i] === "*") {
+        ++i;
+        const precision = args.nextInt32();
+        // negative precision is taken as if precision were omitted
+        spec.precision = precision < 0 ? null : precision;
+      } else {
+        const start = i;
+        while (isDigit(format[i])) {
+          ++i;
+        }
+        spec.precision = start === i ? 0 : parseInt(format.slice(start, i));
+      }
+    }
+
+    // length modifier
+    if (format.startsWith("hh", i) || format.startsWith("ll", i)) {
+      spec.length = format.slice(i, i + 2) as LengthModifier;
+      i += 2;
+    } else if ("hljztL".includes(format[i] ?? "\0")) {
+      spec.length = format[i] as LengthModifier;
+      ++i;
+    }
+
+    if (i >= format.length || !CONVERSION_CHARS.includes(format[i])) {
+      throw new Error(
+        `printf(): invalid conversion specification: "${decodeByteString(
+          format.slice(percentIndex, i + 1),
+        )}"`,
+      );
+    }
+    spec.conversion = format[i++];
+    result += formatConversion(spec, args, memory);
+  }
+  return decodeByteString(result);
+}
+
+function isDigit(c: string | undefined) {
+  return typeof c !== "undefined" && c >= "0" && c <= "9";
+}
+
+function formatConversion(
+  spec: ConversionSpecification,
+  args: VariadicArgsReader,
+  memory: WebAssembly.Memory,
+): string {
+  switch (spec.conversion) {
+    case "%":
+      return "%";
+    case "d":
+    case "i":
+      return formatSignedInteger(spec, readSignedIntegerArg(spec, args));
+    case "u":
+    case "o":
+    case "x":
+    case "X":
+      return formatUnsignedInteger(spec, readUnsignedIntegerArg(spec, args));
+    case "c":
+      return pad(spec, String.fromCharCode(args.nextInt32() & 0xff));
+    case "s": {
+      const strAddress = args.nextUint32();
+      let str =
+        strAddress === 0
+          ? "(null)"
+          : toByteString(getCStyleStringBytes(memory.buffer, strAddress));
+      if (spec.precision !== null) {
+        str = str.slice(0, spec.precision);
+      }
+      return pad(spec, str);
+    }
+    case "p": {
+      const address = args.nextUint32();
+      return pad(spec, address === 0 ? "(nil)" : "0x" + address.toString(16));
+    }
+    case "f":
+    case "F":
+    case "e":
+    case "E":
+    case "g":
+    case "G":
+      return formatFloat(spec, args.nextDouble());
+    default:
+      throw new Error(
+        `printf(): unsupported conversion specifier: "%${spec.conversion}"`,
+      );
+  }
+}
+
+/**
+ * Pads a formatted conversion with spaces to the field width.
+ */
+function pad(spec: ConversionSpecification, str: string) {
+  if (str.length >= spec.width) {
+    return str;
+  }
+  return spec.leftJustify
+    ? str.padEnd(spec.width, " ")
+    : str.padStart(spec.width, " ");
+}
+
+/**
+ * Pads a formatted number with given sign (or base prefix) and digits to the field width.
+ * Zero padding is inserted between the prefix and the digits.
+ */
+function padNumber(
+  spec: ConversionSpecification,
+  prefix: string,
+  digits: string,
+  allowZeroPad: boolean,
+) {
+  const length = prefix.length + digits.length;
+  if (length >= spec.width) {
+    return prefix + digits;
+  }
+  if (spec.leftJustify) {
+    return (prefix + digits).padEnd(spec.width, " ");
+  }
+  if (spec.zeroPad && allowZeroPad) {
+    return prefix + digits.padStart(spec.width - prefix.length, "0");
+  }
+  return (prefix + digits).padStart(spec.width, " ");
+}
+
+function getSignPrefix(spec: ConversionSpecification, isNegative: boolean) {
+  if (isNegative) {
+    return "-";
+  } else if (spec.forceSign) {
+    return "+";
+  } else if (spec.spaceSign) {
+    return " ";
+  }
+  return "";
+}
+
+function isEightByteLength(length: LengthModifier) {
+  return length === "l" || length === "ll" || length === "j";
+}
+
+function readSignedIntegerArg(
+  spec: ConversionSpecification,
+  args: VariadicArgsReader,
+): bigint {
+  if (isEightByteLength(spec.length)) {
+    return args.nextBigInt64();
+  }
+  const value = args.nextInt32();
+  if (spec.length === "hh") {
+    return BigInt((value << 24) >> 24);
+  } else if (spec.length === "h") {
+    return BigInt((value << 16) >> 16);
+  }
+  return BigInt(value);
+}
+
+function readUnsignedIntegerArg(
+  spec: ConversionSpecification,
+  args: VariadicArgsReader,
+): bigint {
+  if (isEightByteLength(spec.length)) {
+    return BigInt.asUintN(64, args.nextBigInt64());
+  }
+  const value = args.nextUint32();
+  if (spec.length === "hh") {
+    return BigInt(value & 0xff);
+  } else if (spec.length === "h") {
+    return BigInt(value & 0xffff);
+  }
+  return BigInt(value);
+}
+
+/**
+ * Applies the integer precision (minimum number of digits) to a string of digits.
+ */
+function applyIntegerPrecision(
+  spec: ConversionSpecification,
+  value: bigint,
+  digits: string,
+) {
+  if (spec.precision === null) {
+    return digits;
+  }
+  if (spec.precision === 0 && value === 0n) {
+    return ""; // zero with zero precision produces no characters
+  }
+  return digits.padStart(spec.precision, "0");
+}
+
+function formatSignedInteger(spec: ConversionSpecification, value: bigint) {
+  const isNegative = value < 0n;
+  const digits = applyIntegerPrecision(
+    spec,
+    value,
+    (isNegative ? -value : value).toString(),
+  );
+  return padNumber(
+    spec,
+    getSignPrefix(spec, isNegative),
+    digits,
+    spec.precision === null,
+  );
+}
+
+function formatUnsignedInteger(spec: ConversionSpecification, value: bigint) {
+  let prefix = "";
+  let digits: string;
+  if (spec.conversion === "o") {
+    digits = applyIntegerPrecision(spec, value, value.toString(8));
+    if (spec.alternateForm && !digits.startsWith("0")) {
+      digits = "0" + digits;
+    }
+  } else if (spec.conversion === "x" || spec.conversion === "X") {
+    digits = applyIntegerPrecision(spec, value, value.toString(16));
+    if (spec.alternateForm && value !== 0n) {
+      prefix = "0x";
+    }
+    if (spec.conversion === "X") {
+      digits = digits.toUpperCase();
+      prefix = prefix.toUpperCase();
+    }
+  } else {
+    digits = applyIntegerPrecision(spec, value, value.toString());
+  }
+  return padNumber(spec, prefix, digits, spec.precision === null);
+}
+
+/**
+ * Formats a double with the "f", "e" or "g" conversion.
+ */
+function formatFloat(spec: ConversionSpecification, value: number) {
+  const isUpperCase = spec.conversion === spec.conversion.toUpperCase();
+  const isNegative = value < 0 || Object.is(value, -0);
+  const sign = getSignPrefix(spec, isNegative);
+  if (!isFinite(value)) {
+    const str = isNaN(value) ? "nan" : "inf";
+    // zero padding does not apply to infinity and nan
+    return padNumber(spec, sign, isUpperCase ? str.toUpperCase() : str, false);
+  }
+  const magnitude = Math.abs(value);
+  const precision = spec.precision ?? 6;
+  let digits: string;
+  switch (spec.conversion.toLowerCase()) {
+    case "f":
+      digits = formatFloatFixed(magnitude, precision, spec.alternateForm);
+      break;
+    case "e":
+      digits = formatFloatExponential(
+        magnitude,
+        precision,
+        spec.alternateForm,
+      );
+      break;
+    default:
+      digits = formatFloatGeneral(magnitude, precision, spec.alternateForm);
+  }
+  return padNumber(
+    spec,
+    sign,
+    isUpperCase ? digits.toUpperCase() : digits,
+    true,
+  );
+}
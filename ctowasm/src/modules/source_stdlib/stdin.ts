@@ -0,0 +1,498 @@
+/**
+ * Reading of "stdin", which is preloaded in full from the stdin of the modules config.
+ *
+ * Before the program runs, the input bytes are copied into linear memory, between the data segment and the heap
+ * (see ModuleRepository.loadStdin). The "stdin_pos" and "stdin_end" globals, imported by the program, hold the address
+ * of the next unread byte and the address just past the input. getchar, read_int and read_long are implemented
+ * directly in wasm, parsing straight from linear memory, so that reading large inputs does not take a call into JS per
+ * character or number. scanf is imported from JS, and reads from the same input by moving the same globals.
+ */
+
+import { SharedWasmGlobalVariables } from "~src/modules";
+import { VariadicArgsReader } from "~src/modules/source_stdlib/printf";
+import { extractCStyleStringFromMemory } from "~src/modules/util";
+import {
+  breakIf,
+  globalGet,
+  globalSet,
+  i32Const,
+  i32Op,
+  i32Variables,
+  ifThen,
+  localGet,
+  localSet,
+  localVariables,
+  loop,
+  storeReturnValue,
+} from "~src/modules/wasmImplementationUtil";
+import { ExternalFunction } from "~src/processor/c-ast/core";
+import { WasmExpression } from "~src/translator/wasm-ast/core";
+import { WasmFunction } from "~src/translator/wasm-ast/functions";
+import { WasmImportedGlobalVariable } from "~src/translator/wasm-ast/variables";
+
+export const STDIN_POSITION_GLOBAL = "stdin_pos";
+export const STDIN_END_GLOBAL = "stdin_end";
+
+export const EOF = -1;
+
+// the globals used by the wasm implementations of the stdin functions
+export const stdinImportedGlobals: WasmImportedGlobalVariable[] = [
+  {
+    type: "ImportedGlobalVariable",
+    name: STDIN_POSITION_GLOBAL,
+    wasmDataType: "i32",
+  },
+  {
+    type: "ImportedGlobalVariable",
+    name: STDIN_END_GLOBAL,
+    wasmDataType: "i32",
+  },
+];
+
+/**
+ * Returns the given input as bytes, encoding strings as UTF-8.
+ */
+export function getStdinBytes(stdin?: Uint8Array | string): Uint8Array {
+  if (typeof stdin === "undefined") {
+    return new Uint8Array(0);
+  }
+  return typeof stdin === "string" ? new TextEncoder().encode(stdin) : stdin;
+}
+
+const position = globalGet(STDIN_POSITION_GLOBAL);
+const isAtEnd = i32Op("ge_u", position, globalGet(STDIN_END_GLOBAL));
+const advance = globalSet(
+  STDIN_POSITION_GLOBAL,
+  i32Op("add", position, i32Const(1)),
+);
+
+// the next unread byte, as an unsigned char
+const nextByte = i32Op(
+  "and",
+  { type: "MemoryLoad", addr: position, wasmDataType: "i32", numOfBytes: 1 },
+  i32Const(0xff),
+);
+
+/**
+ * Returns the wasm implementation of getchar, which returns the next byte of input, or EOF at the end of input.
+ */
+export function createGetcharWasmImplementation(
+  externalFunction: ExternalFunction,
+): WasmFunction[] {
+  return [
+    {
+      type: "Function",
+      name: externalFunction.name,
+      body: [
+        ifThen(
+          isAtEnd,
+          [storeReturnValue(externalFunction, i32Const(EOF))],
+          [storeReturnValue(externalFunction, nextByte), advance],
+        ),
+      ],
+    },
+  ];
+}
+
+/**
+ * Returns the wasm implementation of read_int or read_long, which skip whitespace and read a decimal integer with an
+ * optional sign. Returns 0 if there is no integer before the end of input or a non digit character. The integer
+ * wraps around on overflow.
+ */
+export function createReadIntegerWasmImplementation(
+  externalFunction: ExternalFunction,
+): WasmFunction[] {
+  const c = localGet("c");
+  const value = localGet("value");
+  const i64Op = (
+    instruction: string,
+    leftExpr: WasmExpression,
+    rightExpr: WasmExpression,
+  ): WasmExpression => ({
+    type: "BinaryExpression",
+    instruction: `i64.${instruction}`,
+    leftExpr,
+    rightExpr,
+  });
+  const isLong =
+    externalFunction.returnObjects![0].dataType === "signed long";
+  return [
+    {
+      type: "Function",
+      name: externalFunction.name,
+      locals: [
+        ...i32Variables("c", "is_negative"),
+        ...localVariables("i64", "value"),
+      ],
+      body: [
+        // skip whitespace: ' ', '\t', '\n', '\v', '\f' and '\r'
+        loop("whitespace", [
+          breakIf("whitespace", isAtEnd),
+          localSet("c", nextByte),
+          breakIf(
+            "whitespace",
+            i32Op(
+              "and",
+              i32Op("ne", c, i32Const(32)),
+              i32Op("gt_u", i32Op("sub", c, i32Const(9)), i32Const(4)),
+            ),
+          ),
+          advance,
+        ]),
+        // sign
+        ifThen(i32Op("lt_u", position, globalGet(STDIN_END_GLOBAL)), [
+          localSet("c", nextByte),
+          ifThen(
+            i32Op("eq", c, i32Const(45)), // '-'
+            [localSet("is_negative", i32Const(1)), advance],
+            [ifThen(i32Op("eq", c, i32Const(43)), [advance])], // '+'
+          ),
+        ]),
+        // digits
+        loop("digits", [
+          breakIf("digits", isAtEnd),
+          localSet("c", i32Op("sub", nextByte, i32Const(48))),
+          breakIf("digits", i32Op("gt_u", c, i32Const(9))),
+          localSet(
+            "value",
+            i64Op(
+              "add",
+              i64Op("mul", value, {
+                type: "IntegerConst",
+                wasmDataType: "i64",
+                value: 10n,
+              }),
+              {
+                type: "NumericWrapper",
+                instruction: "i64.extend_i32_u",
+                expr: c,
+              },
+            ),
+          ),
+          advance,
+        ]),
+        ifThen(localGet("is_negative"), [
+          localSet(
+            "value",
+            i64Op(
+              "sub",
+              { type: "IntegerConst", wasmDataType: "i64", value: 0n },
+              value,
+            ),
+          ),
+        ]),
+        storeReturnValue(
+          externalFunction,
+          isLong
+            ? value
+            : {
+                type: "NumericWrapper",
+                instruction: "i32.wrap_i64",
+                expr: value,
+              },
+        ),
+      ],
+    },
+  ];
+}
+
+/**
+ * Reads the preloaded input from linear memory, for the stdin functions imported from JS.
+ * The position reached is only written back to the stdin position global by commit().
+ */
+class StdinReader {
+  private bytes: Uint8Array;
+  private stdinPosition: WebAssembly.Global;
+  private end: number;
+  position: number;
+
+  constructor(
+    memory: WebAssembly.Memory,
+    sharedWasmGlobalVariables: SharedWasmGlobalVariables,
+  ) {
+    this.bytes = new Uint8Array(memory.buffer);
+    this.stdinPosition = sharedWasmGlobalVariables.stdinPosition;
+    this.position = this.stdinPosition.value;
+    this.end = sharedWasmGlobalVariables.stdinEnd.value;
+  }
+
+  isAtEnd() {
+    return this.position >= this.end;
+  }
+
+  // returns the next character without reading it, or "" at the end of input
+  peek() {
+    return this.isAtEnd()
+      ? ""
+      : String.fromCharCode(this.bytes[this.position]);
+  }
+
+  skipWhitespace() {
+    while (isWhitespace(this.peek())) {
+      ++this.position;
+    }
+  }
+
+  /**
+   * Reads characters while they match the given pattern, up to a maximum number.
+   */
+  readWhile(pattern: RegExp, maxLength: number) {
+    let str = "";
+    while (str.length < maxLength && pattern.test(this.peek())) {
+      str += this.peek();
+      ++this.position;
+    }
+    return str;
+  }
+
+  commit() {
+    this.stdinPosition.value = this.position;
+  }
+}
+
+function isWhitespace(c: string) {
+  return c !== "" && " \t\n\v\f\r".includes(c);
+}
+
+/**
+ * Returns the longest prefix of the given string that is a number of the given base, with an optional sign.
+ * Base 0 detects the base from the prefix of the number, as strtol does.
+ */
+function readIntegerString(
+  reader: StdinReader,
+  base: number,
+  maxLength: number,
+): { str: string; base: number } {
+  let str = reader.readWhile(/[+-]/, Math.min(1, maxLength));
+  if (
+    (base === 0 || base === 16) &&
+    reader.peek() === "0" &&
+    str.length < maxLength
+  ) {
+    str += reader.readWhile(/0/, 1);
+    if (/[xX]/.test(reader.peek()) && str.length < maxLength) {
+      str += reader.readWhile(/[xX]/, 1);
+      base = 16;
+    } else if (base === 0) {
+      base = 8;
+    }
+  }
+  if (base === 0) {
+    base = 10;
+  }
+  const digitPattern =
+    base === 16 ? /[0-9a-fA-F]/ : base === 8 ? /[0-7]/ : /[0-9]/;
+  str += reader.readWhile(digitPattern, maxLength - str.length);
+  return { str, base };
+}
+
+function parseInteger(str: string, base: number): bigint | null {
+  const match = /^([+-]?)(?:0[xX])?([0-9a-fA-F]+)$/.exec(str);
+  if (match === null) {
+    // a lone "0" followed by "x" is the number 0 (the "x" has been read, as glibc does)
+    return /^[+-]?0[xX]$/.test(str) ? 0n : null;
+  }
+  let value = 0n;
+  for (const digit of match[2]) {
+    value = value * BigInt(base) + BigInt(parseInt(digit, base));
+  }
+  return match[1] === "-" ? -value : value;
+}
+
+const FLOAT_PREFIX_PATTERN =
+  /^[+-]?(?:\d*\.?\d*(?:[eE][+-]?\d*)?|i(?:n(?:f(?:i(?:n(?:i(?:t(?:y)?)?)?)?)?)?)?|n(?:a(?:n)?)?)$/i;
+const FLOAT_PATTERN =
+  /^[+-]?(?:(?:\d+\.?\d*|\.\d+)(?:[eE][+-]?\d+)?|inf(?:inity)?|nan)/i;
+
+/**
+ * Reads the longest prefix of the input, up to a maximum length, that is a floating point number.
+ */
+function readFloatString(reader: StdinReader, maxLength: number): string {
+  let str = "";
+  // extend the string while it is still the prefix of some float
+  while (str.length < maxLength && !reader.isAtEnd()) {
+    const next = str + reader.peek();
+    if (!FLOAT_PREFIX_PATTERN.test(next)) {
+      break;
+    }
+    str = next;
+    ++reader.position;
+  }
+  return str;
+}
+
+/**
+ * Reads from stdin according to the C format string at formatAddress, storing the converted values at the pointers
+ * in the variadic args. Follows the behaviour of glibc scanf for the supported conversion specifications
+ * (d, i, u, o, x, X, f, e, E, g, G, a, A, c, s, n and %, with the hh, h, l and ll length modifiers and "*").
+ * Returns the number of values stored, or EOF if the end of input was reached before the first conversion.
+ */
+export function scanFormattedInput(
+  memory: WebAssembly.Memory,
+  sharedWasmGlobalVariables: SharedWasmGlobalVariables,
+  formatAddress: number,
+  varArgsAddress: number,
+): number {
+  const format = extractCStyleStringFromMemory(memory.buffer, formatAddress);
+  const args = new VariadicArgsReader(memory, varArgsAddress);
+  const view = new DataView(memory.buffer);
+  const reader = new StdinReader(memory, sharedWasmGlobalVariables);
+  const startPosition = reader.position;
+  let numberOfAssignments = 0;
+  let isInputFailure = false;
+
+  let i = 0;
+  while (i < format.length) {
+    const f = format[i];
+    if (isWhitespace(f)) {
+      reader.skipWhitespace();
+      ++i;
+      continue;
+    }
+    if (f !== "%" || format[i + 1] === "%") {
+      if (f === "%") {
+        ++i;
+        reader.skipWhitespace();
+      }
+      if (reader.isAtEnd()) {
+        isInputFailure = true;
+        break;
+      }
+      if (reader.peek() !== format[i]) {
+        break;
+      }
+      ++reader.position;
+      ++i;
+      continue;
+    }
+
+    ++i;
+    const isSuppressed = format[i] === "*";
+    if (isSuppressed) {
+      ++i;
+    }
+    const widthStart = i;
+    while (/[0-9]/.test(format[i] ?? "")) {
+      ++i;
+    }
+    const width =
+      widthStart === i ? Infinity : parseInt(format.slice(widthStart, i));
+    let length = "";
+    while ("hlLqjzt".includes(format[i] ?? "x")) {
+      length += format[i++];
+    }
+    const conversion = format[i++];
+    if (typeof conversion === "undefined") {
+      break;
+    }
+
+    if (conversion === "n") {
+      if (!isSuppressed) {
+        view.setInt32(
+          args.nextUint32(),
+          reader.position - startPosition,
+          true,
+        );
+      }
+      continue;
+    }
+
+    if (conversion !== "c") {
+      reader.skipWhitespace();
+    }
+    if (reader.isAtEnd()) {
+      isInputFailure = true;
+      break;
+    }
+
+    if ("diuoxX".includes(conversion)) {
+      const base =
+        conversion === "i"
+          ? 0
+          : conversion === "o"
+          ? 8
+          : conversion === "x" || conversion === "X"
+          ? 16
+          : 10;
+      const integer = readIntegerString(reader, base, width);
+      const value = parseInteger(integer.str, integer.base);
+      if (value === null) {
+        break;
+      }
+      if (!isSuppressed) {
+        const address = args.nextUint32();
+        if (length === "hh") {
+          view.setInt8(address, Number(BigInt.asIntN(8, value)));
+        } else if (length === "h") {
+          view.setInt16(address, Number(BigInt.asIntN(16, value)), true);
+        } else if (length === "l" || length === "ll" || length === "q") {
+          view.setBigInt64(address, BigInt.asIntN(64, value), true);
+        } else {
+          view.setInt32(address, Number(BigInt.asIntN(32, value)), true);
+        }
+        ++numberOfAssignments;
+      }
+    } else if ("feEgGaA".includes(conversion)) {
+      const str = readFloatString(reader, width);
+      // the characters read may only start with a float, e.g. "1e" followed by a non digit
+      const match = FLOAT_PATTERN.exec(str);
+      if (match === null) {
+        break;
+      }
+      const floatStr = match[0];
+      let value = parseFloat(floatStr);
+      if (/nan/i.test(floatStr)) {
+        value = NaN;
+      } else if (/inf/i.test(floatStr)) {
+        value = floatStr.startsWith("-") ? -Infinity : Infinity;
+      }
+      if (!isSuppressed) {
+        const address = args.nextUint32();
+        if (length === "l" || length === "L") {
+          view.setFloat64(address, value, true);
+        } else {
+          view.setFloat32(address, value, true);
+        }
+        ++numberOfAssignments;
+      }
+    } else if (conversion === "c") {
+      const count = width === Infinity ? 1 : width;
+      const address = isSuppressed ? 0 : args.nextUint32();
+      for (let k = 0; k < count && !reader.isAtEnd(); ++k) {
+        if (!isSuppressed) {
+          view.setUint8(address + k, reader.peek().charCodeAt(0));
+        }
+        ++reader.position;
+      }
+      if (!isSuppressed) {
+        ++numberOfAssignments;
+      }
+    } else if (conversion === "s") {
+      const address = isSuppressed ? 0 : args.nextUint32();
+      let k = 0;
+      while (
+        k < width &&
+        !reader.isAtEnd() &&
+        !isWhitespace(reader.peek())
+      ) {
+        if (!isSuppressed) {
+          view.setUint8(address + k, reader.peek().charCodeAt(0));
+        }
+        ++reader.position;
+        ++k;
+      }
+      if (!isSuppressed) {
+        view.setUint8(address + k, 0);
+        ++numberOfAssignments;
+      }
+    } else {
+      // unsupported conversion specification
+      break;
+    }
+  }
+
+  reader.commit();
+  return isInputFailure && numberOfAssignments === 0
+    ? EOF
+    : numberOfAssignments;
+}
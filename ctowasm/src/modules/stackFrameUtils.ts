@@ -1,5 +1,9 @@
 /**
  * Contains utility function related to setting up a stack frame to wrap wasm function calls made from the JS runtime.
+ *
+ * Calls are made through trampolines that are specialised to the signature (param and return types) of the function,
+ * and cached, so that the layout of the stack frame and the accessors for each param and return are only worked out once
+ * per signature instead of on every call.
  */
 
 import { WASM_ADDR_SIZE } from "~src/common/constants";
@@ -9,194 +13,210 @@ import { SharedWasmGlobalVariables } from "~src/modules";
 import { StackFrameArg } from "~src/modules/types";
 import { checkAndExpandMemoryIfNeeded } from "~src/modules/util";
 
+type ScalarValue = number | bigint;
+
 /**
- * For a call of a function ptr from the JS runtime, handles:
- * 1. Instantiation of the stack frame for the function call
- * 2. Calling of the function
- * 3. Teardown of the function stack frame
+ * The state of a running program that a trampoline needs to call one of its function pointers.
  */
-export default function wrapFunctionPtrCall(
-  memory: WebAssembly.Memory,
-  functionTable: WebAssembly.Table,
+export interface FunctionPtrCallContext {
+  memory: WebAssembly.Memory;
+  functionTable: WebAssembly.Table;
+  sharedWasmGlobalVariables: SharedWasmGlobalVariables;
+}
+
+/**
+ * Calls the function pointed to by functionPtr with the given args (one per param type of the trampoline's signature),
+ * returning its return values.
+ */
+export type FunctionPtrTrampoline = (
+  context: FunctionPtrCallContext,
   functionPtr: number,
-  sharedWasmGlobalVariables: SharedWasmGlobalVariables,
-  stackFrameArgs: StackFrameArg[],
-  returnTypes: ScalarCDataType[], // data type of the returns of the function
-): (number | bigint)[] {
-  const sizeOfReturns = returnTypes.reduce(
-    (prv, curr) => prv + getSizeOfScalarDataType(curr),
-    0,
-  );
-  // instantiate stack frame
-  const stackFrameSize = loadStackFrame(
-    memory,
-    sharedWasmGlobalVariables,
-    stackFrameArgs,
-    sizeOfReturns,
-  );
+  args: ScalarValue[],
+) => ScalarValue[];
+
+interface ScalarAccessor {
+  get: (view: DataView, offset: number) => ScalarValue;
+  set: (view: DataView, offset: number, value: ScalarValue) => void;
+}
 
-  // call the function pointed to be functionPtr
-  functionTable.get(functionPtr)();
+const scalarAccessors: Record<ScalarCDataType, ScalarAccessor> = {
+  "signed char": {
+    get: (view, offset) => view.getInt8(offset),
+    set: (view, offset, value) => view.setInt8(offset, Number(value)),
+  },
+  "unsigned char": {
+    get: (view, offset) => view.getUint8(offset),
+    set: (view, offset, value) => view.setUint8(offset, Number(value)),
+  },
+  "signed short": {
+    get: (view, offset) => view.getInt16(offset, true),
+    set: (view, offset, value) => view.setInt16(offset, Number(value), true),
+  },
+  "unsigned short": {
+    get: (view, offset) => view.getUint16(offset, true),
+    set: (view, offset, value) => view.setUint16(offset, Number(value), true),
+  },
+  "signed int": {
+    get: (view, offset) => view.getInt32(offset, true),
+    set: (view, offset, value) => view.setInt32(offset, Number(value), true),
+  },
+  "unsigned int": {
+    get: (view, offset) => view.getUint32(offset, true),
+    set: (view, offset, value) => view.setUint32(offset, Number(value), true),
+  },
+  pointer: {
+    get: (view, offset) => view.getUint32(offset, true),
+    set: (view, offset, value) => view.setUint32(offset, Number(value), true),
+  },
+  "signed long": {
+    get: (view, offset) => view.getBigInt64(offset, true),
+    set: (view, offset, value) =>
+      view.setBigInt64(offset, BigInt(value), true),
+  },
+  "unsigned long": {
+    get: (view, offset) => view.getBigUint64(offset, true),
+    set: (view, offset, value) =>
+      view.setBigUint64(offset, BigInt(value), true),
+  },
+  float: {
+    get: (view, offset) => view.getFloat32(offset, true),
+    set: (view, offset, value) => view.setFloat32(offset, Number(value), true),
+  },
+  double: {
+    get: (view, offset) => view.getFloat64(offset, true),
+    set: (view, offset, value) => view.setFloat64(offset, Number(value), true),
+  },
+};
 
-  const stackFrameReturnObjectView = new DataView(
-    memory.buffer,
-    sharedWasmGlobalVariables.basePointer.value + WASM_ADDR_SIZE,
-    sizeOfReturns,
-  );
+// the view of the whole of the most recently used memory buffer. Recreated only when the buffer changes.
+let cachedBuffer: ArrayBufferLike | null = null;
+let cachedDataView: DataView = new DataView(new ArrayBuffer(0));
 
-  const returnValues: (number | bigint)[] = [];
-  let currOffset = 0;
-  for (const returnType of returnTypes) {
-    switch (returnType) {
-      case "double":
-        returnValues.push(
-          stackFrameReturnObjectView.getFloat64(currOffset, true),
-        );
-        break;
-      case "float":
-        returnValues.push(
-          stackFrameReturnObjectView.getFloat32(currOffset, true),
-        );
-        break;
-      case "signed char":
-        returnValues.push(stackFrameReturnObjectView.getInt8(currOffset));
-        break;
-      case "unsigned char":
-      case "pointer":
-        returnValues.push(stackFrameReturnObjectView.getUint8(currOffset));
-        break;
-      case "signed short":
-        returnValues.push(
-          stackFrameReturnObjectView.getInt16(currOffset, true),
-        );
-        break;
-      case "unsigned short":
-        returnValues.push(
-          stackFrameReturnObjectView.getUint16(currOffset, true),
-        );
-        break;
-      case "signed int":
-        returnValues.push(
-          stackFrameReturnObjectView.getInt32(currOffset, true),
-        );
-        break;
-      case "unsigned int":
-        returnValues.push(
-          stackFrameReturnObjectView.getUint32(currOffset, true),
-        );
-        break;
-      case "signed long":
-        returnValues.push(
-          stackFrameReturnObjectView.getBigInt64(currOffset, true),
-        );
-        break;
-      case "unsigned long":
-        returnValues.push(
-          stackFrameReturnObjectView.getBigUint64(currOffset, true),
-        );
-        break;
-    }
-    currOffset += getSizeOfScalarDataType(returnType);
+function getDataView(buffer: ArrayBufferLike): DataView {
+  if (buffer !== cachedBuffer) {
+    cachedBuffer = buffer;
+    cachedDataView = new DataView(buffer);
   }
-  // extract return value
-  tearDownStackFrame(
-    memory,
-    stackFrameSize,
-    sharedWasmGlobalVariables.stackPointer,
-    sharedWasmGlobalVariables.basePointer,
-  );
+  return cachedDataView;
+}
+
+const trampolines: Map<string, FunctionPtrTrampoline> = new Map();
 
-  return returnValues;
+/**
+ * Returns the trampoline for calling functions with given param and return types, creating it on first use.
+ */
+export function getFunctionPtrTrampoline(
+  paramTypes: ScalarCDataType[],
+  returnTypes: ScalarCDataType[],
+): FunctionPtrTrampoline {
+  const signature = `${paramTypes.join(",")}:${returnTypes.join(",")}`;
+  let trampoline = trampolines.get(signature);
+  if (typeof trampoline === "undefined") {
+    trampoline = createFunctionPtrTrampoline(paramTypes, returnTypes);
+    trampolines.set(signature, trampoline);
+  }
+  return trampoline;
 }
 
-function loadStackFrame(
-  memory: WebAssembly.Memory,
-  sharedWasmGlobalVariables: SharedWasmGlobalVariables,
-  stackFrameArgs: StackFrameArg[],
-  sizeOfReturn: number,
-): number {
-  const totalArgsSize = stackFrameArgs.reduce(
-    (prv, curr) => prv + getSizeOfScalarDataType(curr.type),
-    0,
-  );
-  const bytesNeeded = totalArgsSize + sizeOfReturn + WASM_ADDR_SIZE; // need to add base pointer
-  checkAndExpandMemoryIfNeeded(memory, bytesNeeded, sharedWasmGlobalVariables);
+/**
+ * Creates a trampoline that handles, for a call of a function ptr from the JS runtime:
+ * 1. Instantiation of the stack frame for the function call
+ * 2. Calling of the function
+ * 3. Teardown of the function stack frame
+ *
+ * The stack frame, from high to low address, consists of the return values, the old base pointer, and the params.
+ */
+function createFunctionPtrTrampoline(
+  paramTypes: ScalarCDataType[],
+  returnTypes: ScalarCDataType[],
+): FunctionPtrTrampoline {
+  const paramSetters = paramTypes.map((type) => scalarAccessors[type].set);
+  const returnGetters = returnTypes.map((type) => scalarAccessors[type].get);
 
-  const stackFrameDataView = new DataView(
-    memory.buffer,
-    sharedWasmGlobalVariables.stackPointer.value - bytesNeeded,
-    bytesNeeded,
-  );
+  // offsets of params relative to the new base pointer, first param is closest to the base pointer
+  const paramOffsets: number[] = [];
+  let totalParamsSize = 0;
+  for (const type of paramTypes) {
+    totalParamsSize += getSizeOfScalarDataType(type);
+    paramOffsets.push(-totalParamsSize);
+  }
+  // offsets of returns relative to the new base pointer, first return is just above the old base pointer
+  const returnOffsets: number[] = [];
+  let totalReturnsSize = 0;
+  for (const type of returnTypes) {
+    returnOffsets.push(WASM_ADDR_SIZE + totalReturnsSize);
+    totalReturnsSize += getSizeOfScalarDataType(type);
+  }
+  const stackFrameSize = totalParamsSize + WASM_ADDR_SIZE + totalReturnsSize;
+  const numParams = paramTypes.length;
+  const numReturns = returnTypes.length;
 
-  // fill in old bp
-  stackFrameDataView.setUint32(
-    totalArgsSize,
-    sharedWasmGlobalVariables.basePointer.value,
-    true, //little endian
-  );
+  return (context, functionPtr, args) => {
+    const { memory, functionTable, sharedWasmGlobalVariables } = context;
+    const { stackPointer, basePointer, heapPointer } =
+      sharedWasmGlobalVariables;
+    if (stackPointer.value - heapPointer.value < stackFrameSize) {
+      checkAndExpandMemoryIfNeeded(
+        memory,
+        stackFrameSize,
+        sharedWasmGlobalVariables,
+      );
+    }
 
-  // fill in param values
-  let currOffset = bytesNeeded - sizeOfReturn - WASM_ADDR_SIZE;
-  for (const arg of stackFrameArgs) {
-    currOffset -= getSizeOfScalarDataType(arg.type);
-    switch (arg.type) {
-      case "double":
-        stackFrameDataView.setFloat64(currOffset, Number(arg.value), true);
-        break;
-      case "float":
-        stackFrameDataView.setFloat32(currOffset, Number(arg.value), true);
-        break;
-      case "signed char":
-        stackFrameDataView.setInt8(currOffset, Number(arg.value));
-        break;
-      case "unsigned char":
-      case "pointer":
-        stackFrameDataView.setUint8(currOffset, Number(arg.value));
-        break;
-      case "signed short":
-        stackFrameDataView.setInt16(currOffset, Number(arg.value), true);
-        break;
-      case "unsigned short":
-        stackFrameDataView.setUint16(currOffset, Number(arg.value), true);
-        break;
-      case "signed int":
-        stackFrameDataView.setInt32(currOffset, Number(arg.value), true);
-        break;
-      case "unsigned int":
-        stackFrameDataView.setUint32(currOffset, Number(arg.value), true);
-        break;
-      case "signed long":
-        stackFrameDataView.setBigInt64(currOffset, BigInt(arg.value), true);
-        break;
-      case "unsigned long":
-        stackFrameDataView.setBigUint64(currOffset, BigInt(arg.value), true);
-        break;
+    // instantiate stack frame
+    let view = getDataView(memory.buffer);
+    const oldBasePointer = basePointer.value;
+    const newBasePointer =
+      stackPointer.value - totalReturnsSize - WASM_ADDR_SIZE;
+    view.setUint32(newBasePointer, oldBasePointer, true);
+    for (let i = 0; i < numParams; ++i) {
+      paramSetters[i](view, newBasePointer + paramOffsets[i], args[i]);
     }
-  }
+    basePointer.value = newBasePointer;
+    stackPointer.value -= stackFrameSize;
+
+    // call the function pointed to be functionPtr
+    functionTable.get(functionPtr)();
 
-  // set the value of bp
-  sharedWasmGlobalVariables.basePointer.value =
-    sharedWasmGlobalVariables.stackPointer.value -
-    sizeOfReturn -
-    WASM_ADDR_SIZE;
-  // set the value of sp
-  sharedWasmGlobalVariables.stackPointer.value =
-    sharedWasmGlobalVariables.stackPointer.value - bytesNeeded;
+    // extract return values. memory may have grown during the call, moving the stack, so the base pointer is read again
+    view = getDataView(memory.buffer);
+    const currentBasePointer = basePointer.value;
+    const returnValues: ScalarValue[] = new Array(numReturns);
+    for (let i = 0; i < numReturns; ++i) {
+      returnValues[i] = returnGetters[i](
+        view,
+        currentBasePointer + returnOffsets[i],
+      );
+    }
 
-  return bytesNeeded;
+    // tear down stack frame
+    stackPointer.value += stackFrameSize;
+    basePointer.value = view.getUint32(currentBasePointer, true);
+
+    return returnValues;
+  };
 }
 
-function tearDownStackFrame(
+/**
+ * For a call of a function ptr from the JS runtime, handles:
+ * 1. Instantiation of the stack frame for the function call
+ * 2. Calling of the function
+ * 3. Teardown of the function stack frame
+ */
+export default function wrapFunctionPtrCall(
   memory: WebAssembly.Memory,
-  stackFrameSize: number,
-  stackPointer: WebAssembly.Global,
-  basePointer: WebAssembly.Global,
-) {
-  stackPointer.value += stackFrameSize;
-  const dataView = new DataView(
-    memory.buffer,
-    basePointer.value,
-    WASM_ADDR_SIZE,
+  functionTable: WebAssembly.Table,
+  functionPtr: number,
+  sharedWasmGlobalVariables: SharedWasmGlobalVariables,
+  stackFrameArgs: StackFrameArg[],
+  returnTypes: ScalarCDataType[], // data type of the returns of the function
+): (number | bigint)[] {
+  return getFunctionPtrTrampoline(
+    stackFrameArgs.map((arg) => arg.type),
+    returnTypes,
+  )(
+    { memory, functionTable, sharedWasmGlobalVariables },
+    functionPtr,
+    stackFrameArgs.map((arg) => arg.value),
   );
-  basePointer.value = dataView.getUint32(0, true);
 }
@@ -5,6 +5,10 @@ import {
 } from "~src/common/types";
 import { ModulesGlobalConfig, SharedWasmGlobalVariables } from "~src/modules";
 import { MemoryBlock } from "~src/modules/source_stdlib/memory";
+import OutputBuffer from "~src/modules/outputBuffer";
+import { ExternalFunction } from "~src/processor/c-ast/core";
+import { WasmFunction } from "~src/translator/wasm-ast/functions";
+import { WasmImportedGlobalVariable } from "~src/translator/wasm-ast/variables";
 import { FunctionDataType, StructDataType } from "~src/parser/c-ast/dataTypes";
 
 // Configuration parameters for WasmModuleImports object
@@ -19,7 +23,12 @@ export interface ModuleFunction {
   parentImportedObject: string; // parent imported object
   functionType: FunctionDataType;
   // eslint-disable-next-line
-  jsFunction: Function; // the actual JS function that is called
+  jsFunction?: Function; // the actual JS function that is called. Not needed if wasmImplementation is given.
+  writesMemory?: boolean; // whether jsFunction may write to memory directly (e.g. through a pointer arg), which traced programs check for after each call (see src/translator/tracing.ts)
+  // generates the wasm functions that implement this function directly in the compiled module, instead of importing jsFunction.
+  // the function with the same name as this module function must follow the memory model calling convention.
+  wasmImplementation?: (externalFunction: ExternalFunction) => WasmFunction[];
+  wasmImplementationGlobals?: WasmImportedGlobalVariable[]; // the globals imported from JS that wasmImplementation uses
 }
 
 /**
@@ -32,6 +41,7 @@ export abstract class Module {
   freeList: MemoryBlock[] = [];
   allocatedBlocks: Map<number, number> = new Map(); // allocated memory blocks <address, size>
   sharedWasmGlobalVariables: SharedWasmGlobalVariables;
+  stdout: OutputBuffer; // buffered "stdout", shared between all modules
   instantiate?: () => Promise<void>; // any instantiation of the module that must be done before use
   abstract moduleDeclaredStructs: StructDataType[];
   abstract moduleFunctions: Record<string, ModuleFunction>; // all the functions within this module
@@ -41,18 +51,27 @@ export abstract class Module {
     functionTable: WebAssembly.Table,
     config: ModulesGlobalConfig,
     sharedWasmGlobalVariables: SharedWasmGlobalVariables,
+    stdout?: OutputBuffer,
   ) {
     this.memory = memory;
     this.functionTable = functionTable;
     this.config = config;
     this.sharedWasmGlobalVariables = sharedWasmGlobalVariables;
+    this.stdout = stdout ?? new OutputBuffer(config.printFunction);
   }
 
   /**
-   * Print to "stdout" by calling the printFunction defined in config.
+   * Print a line to "stdout".
    */
   print(str: string) {
-    this.config.printFunction(str);
+    this.stdout.write(str + "\n");
+  }
+
+  /**
+   * Write a string to "stdout" as is (no newline appended).
+   */
+  write(str: string) {
+    this.stdout.write(str);
   }
 }
 
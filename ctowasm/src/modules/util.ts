@@ -1,6 +1,6 @@
-import BigNumber from "bignumber.js";
 import { calculateNumberOfPagesNeededForBytes } from "~src/common/utils";
 import { ModulesGlobalConfig, SharedWasmGlobalVariables } from "~src/modules";
+import { formatFloatFixed } from "~src/modules/floatFormatting";
 
 // export function extractImportedFunctionCDetails(
 //   wasmModuleImports: Record<string, ImportedFunction>
@@ -17,37 +17,114 @@ import { ModulesGlobalConfig, SharedWasmGlobalVariables } from "~src/modules";
  * Function for converting a float to the c style ("%f" format specifier) - 6 decimal places.
  */
 export function convertFloatToCStyleString(float: number): string {
-  if (float === Infinity) {
-    return "inf";
-  } else if (float === -Infinity) {
-    return "-inf";
+  if (isNaN(float)) {
+    return "nan";
   }
+  const sign = float < 0 || Object.is(float, -0) ? "-" : "";
+  const magnitude = Math.abs(float);
+  if (magnitude === Infinity) {
+    return sign + "inf";
+  }
+  return sign + formatFloatFixed(magnitude, 6);
+}
 
-  let floatStr = float.toString(16);
-  if (floatStr[0] === "-") {
-    floatStr = "-0x" + floatStr.slice(1, floatStr.length);
-  } else {
-    floatStr = "0x" + floatStr;
+// the byte view of the most recently accessed memory buffer. Recreated only when the buffer changes (e.g. memory grows).
+let cachedBuffer: ArrayBufferLike | null = null;
+let cachedByteView: Uint8Array = new Uint8Array(0);
+
+/**
+ * Returns a Uint8Array view over the whole of the given buffer, reusing the previous view if possible.
+ */
+export function getByteView(buffer: ArrayBufferLike): Uint8Array {
+  if (buffer !== cachedBuffer) {
+    cachedBuffer = buffer;
+    cachedByteView = new Uint8Array(buffer);
   }
-  const bigNumber = new BigNumber(floatStr);
-  return bigNumber.toFixed(6);
+  return cachedByteView;
+}
+
+const cStringDecoder = new TextDecoder();
+const cStringEncoder = new TextEncoder();
+
+/**
+ * Returns the view (without copying) of the bytes of a C-style string in memory buffer, excluding the null terminator.
+ */
+export function getCStyleStringBytes(
+  buffer: ArrayBufferLike,
+  strAddress: number,
+): Uint8Array {
+  const bytes = getByteView(buffer);
+  let end = bytes.indexOf(0, strAddress);
+  if (end === -1) {
+    end = bytes.length; // unterminated string - stop at end of memory
+  }
+  return bytes.subarray(strAddress, end);
 }
 
 /**
  * Extracts a C-style string from memory buffer, starting at given address.
+ * The string is decoded as UTF-8.
  */
 export function extractCStyleStringFromMemory(
-  buffer: ArrayBuffer,
+  buffer: ArrayBufferLike,
   strAddress: number,
 ) {
-  const uInt8Arr = new Uint8Array(buffer);
-  let str = "";
-  let i = strAddress;
-  while (uInt8Arr[i] !== 0) {
-    // keep recording chars until null terminator
-    str += String.fromCharCode(uInt8Arr[i++]);
+  const strBytes = getCStyleStringBytes(buffer, strAddress);
+  if (strBytes.length === 0) {
+    return "";
+  }
+  // TextDecoder does not accept views of shared memory, which need to be copied out first
+  return cStringDecoder.decode(
+    strBytes.buffer instanceof ArrayBuffer ? strBytes : strBytes.slice(),
+  );
+}
+
+/**
+ * Writes a string as a null terminated UTF-8 C-style string into memory buffer at given address,
+ * encoding it directly into memory. At most maxBytes bytes (including the null terminator) are written.
+ * Returns the number of bytes written, excluding the null terminator.
+ */
+export function writeCStyleStringToMemory(
+  buffer: ArrayBufferLike,
+  strAddress: number,
+  str: string,
+  maxBytes: number = buffer.byteLength - strAddress,
+): number {
+  if (maxBytes <= 0) {
+    return 0;
   }
-  return str;
+  const bytes = getByteView(buffer);
+  const { written } = cStringEncoder.encodeInto(
+    str,
+    bytes.subarray(strAddress, strAddress + maxBytes - 1),
+  );
+  bytes[strAddress + written] = 0;
+  return written;
+}
+
+/**
+ * Returns the number of bytes of the UTF-8 encoding of a string, without encoding it.
+ */
+export function getUtf8ByteLength(str: string): number {
+  let byteLength = str.length;
+  for (let i = 0; i < str.length; ++i) {
+    const codeUnit = str.charCodeAt(i);
+    if (codeUnit >= 0xd800 && codeUnit <= 0xdbff && i + 1 < str.length) {
+      const next = str.charCodeAt(i + 1);
+      if (next >= 0xdc00 && next <= 0xdfff) {
+        // a surrogate pair (2 code units) is encoded in 4 bytes
+        byteLength += 2;
+        ++i;
+        continue;
+      }
+    }
+    if (codeUnit >= 0x800) {
+      byteLength += 2; // includes lone surrogates, encoded as U+FFFD
+    } else if (codeUnit >= 0x80) {
+      byteLength += 1;
+    }
+  }
+  return byteLength;
 }
 
 export function getExternalFunction(
@@ -72,6 +149,13 @@ export function checkAndExpandMemoryIfNeeded(
   const basePointer = sharedWasmGlobalVariables.basePointer;
   const freeSpace = stackPointer.value - heapPointer.value;
   if (freeSpace < bytesRequested) {
+    if (
+      typeof SharedArrayBuffer !== "undefined" &&
+      memory.buffer instanceof SharedArrayBuffer
+    ) {
+      // a thread of a program compiled with the threads option, whose stack is a fixed region (see src/translator/threads.ts)
+      throw new Error("Stack overflow");
+    }
     // need to grow memory
     const additionalPagesNeeded = calculateNumberOfPagesNeededForBytes(
       bytesRequested - freeSpace,
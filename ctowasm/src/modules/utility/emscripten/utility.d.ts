@@ -24,4 +24,6 @@ interface UtilityEmscriptenModule extends EmscriptenModule {
   wasmMemory: WebAssembly.Memory;
 }
 
-export default function utilityEmscriptenModuleFactoryFn(): Promise<UtilityEmscriptenModule>;
+export default function utilityEmscriptenModuleFactoryFn(
+  moduleArg?: Partial<EmscriptenModule>,
+): Promise<UtilityEmscriptenModule>;
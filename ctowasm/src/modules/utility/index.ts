@@ -1,14 +1,12 @@
 import { ModulesGlobalConfig, SharedWasmGlobalVariables } from "~src/modules";
-import { Module, ModuleFunction, StackFrameArg } from "~src/modules/types";
+import { Module, ModuleFunction } from "~src/modules/types";
 import { StructDataType } from "~src/parser/c-ast/dataTypes";
 import { SIZE_T } from "~src/common/constants";
 import utilityEmscriptenModuleFactoryFn from "~src/modules/utility/emscripten/utility";
-import { extractCStyleStringFromMemory } from "~src/modules/util";
-import wrapFunctionPtrCall from "~src/modules/stackFrameUtils";
-import {
-  freeFunction,
-  mallocFunction,
-} from "~src/modules/source_stdlib/memory";
+import { instantiateEmscriptenModule } from "~src/modules/emscriptenModuleCache";
+import { getCStyleStringBytes } from "~src/modules/util";
+import { createQsortWasmImplementation } from "~src/modules/utility/qsort";
+import OutputBuffer from "~src/modules/outputBuffer";
 
 // the name that this module is imported into wasm by,
 // as well as the include name to use in C program file.
@@ -20,8 +18,6 @@ export class UtilityStdLibModule extends Module {
   heapAddress: number; // address of first item in heap
 
   // functions whose value is be filled later after this.instantiate() is called.
-  stringToNewUTF8: Function = () => {};
-  addFunction: Function = () => {};
   malloc: Function = () => {};
   free: Function = () => {};
   atof: Function = () => {};
@@ -31,7 +27,6 @@ export class UtilityStdLibModule extends Module {
   labs: Function = () => {};
   rand: Function = () => {};
   srand: Function = () => {};
-  qsort: Function = () => {};
   emscriptenMemory?: WebAssembly.Memory;
 
   constructor(
@@ -39,15 +34,16 @@ export class UtilityStdLibModule extends Module {
     functionTable: WebAssembly.Table,
     config: ModulesGlobalConfig,
     sharedWasmGlobalVariables: SharedWasmGlobalVariables,
+    stdout?: OutputBuffer,
   ) {
-    super(memory, functionTable, config, sharedWasmGlobalVariables);
+    super(memory, functionTable, config, sharedWasmGlobalVariables, stdout);
     this.heapAddress = this.sharedWasmGlobalVariables.heapPointer.value;
     this.moduleDeclaredStructs = [];
     this.instantiate = async () => {
-      const utilityModule = await utilityEmscriptenModuleFactoryFn();
+      const utilityModule = await instantiateEmscriptenModule(
+        utilityEmscriptenModuleFactoryFn,
+      );
       // need to set the jsFunctions of all moduleFunctions here
-      this.stringToNewUTF8 = utilityModule.stringToNewUTF8;
-      this.addFunction = utilityModule.addFunction;
       this.malloc = utilityModule._malloc;
       this.free = utilityModule._free;
       this.atof = utilityModule._atof;
@@ -57,7 +53,6 @@ export class UtilityStdLibModule extends Module {
       this.labs = utilityModule._labs;
       this.rand = utilityModule._rand;
       this.srand = utilityModule._srand;
-      this.qsort = utilityModule._qsort;
       this.emscriptenMemory = utilityModule.wasmMemory;
     };
     this.moduleFunctions = {
@@ -78,8 +73,7 @@ export class UtilityStdLibModule extends Module {
           returnType: { type: "primary", primaryDataType: "double" },
         },
         jsFunction: (strAddress: number) => {
-          const str = extractCStyleStringFromMemory(memory.buffer, strAddress);
-          const strPtr = this.stringToNewUTF8(str);
+          const strPtr = this.copyCStyleStringToEmscriptenMemory(strAddress);
           const floatVal = this.atof(strPtr);
           this.free(strPtr);
           return floatVal;
@@ -102,8 +96,7 @@ export class UtilityStdLibModule extends Module {
           returnType: { type: "primary", primaryDataType: "signed int" },
         },
         jsFunction: (strAddress: number) => {
-          const str = extractCStyleStringFromMemory(memory.buffer, strAddress);
-          const strPtr = this.stringToNewUTF8(str);
+          const strPtr = this.copyCStyleStringToEmscriptenMemory(strAddress);
           const intVal = this.atoi(strPtr);
           this.free(strPtr);
           return intVal;
@@ -126,8 +119,7 @@ export class UtilityStdLibModule extends Module {
           returnType: { type: "primary", primaryDataType: "signed long" },
         },
         jsFunction: (strAddress: number) => {
-          const str = extractCStyleStringFromMemory(memory.buffer, strAddress);
-          const strPtr = this.stringToNewUTF8(str);
+          const strPtr = this.copyCStyleStringToEmscriptenMemory(strAddress);
           const intVal = this.atol(strPtr);
           this.free(strPtr);
           return intVal;
@@ -236,113 +228,26 @@ export class UtilityStdLibModule extends Module {
           ],
           returnType: { type: "void" },
         },
-        jsFunction: (
-          ptr: number,
-          count: number,
-          size: number,
-          funcPtr: number,
-        ) => {
-          const sortFn = (a: number, b: number) => {
-            // need to allocate and copy a and b pointer objects to our memory (they are pointers to emscripten memory)
-            const copiedAAddr: number = mallocFunction({
-              memory,
-              sharedWasmGlobalVariables,
-              freeList: this.freeList,
-              allocatedBlocks: this.allocatedBlocks,
-              bytesRequested: size,
-            });
-            const copiedBAddr: number = mallocFunction({
-              memory,
-              sharedWasmGlobalVariables,
-              freeList: this.freeList,
-              allocatedBlocks: this.allocatedBlocks,
-              bytesRequested: size,
-            });
-            const copiedABuff = new Uint8Array(
-              this.memory.buffer,
-              copiedAAddr,
-              size,
-            );
-            const copiedBBuff = new Uint8Array(
-              this.memory.buffer,
-              copiedBAddr,
-              size,
-            );
-            const origABuff = new Uint8Array(
-              this.emscriptenMemory!.buffer,
-              a,
-              size,
-            );
-            const origBBuff = new Uint8Array(
-              this.emscriptenMemory!.buffer,
-              b,
-              size,
-            );
-            for (let i = 0; i < size; ++i) {
-              copiedABuff[i] = origABuff[i];
-              copiedBBuff[i] = origBBuff[i];
-            }
-
-            // a and b are pointers to objects in memory
-            const stackFrameArgs: StackFrameArg[] = [
-              { value: BigInt(copiedAAddr), type: "unsigned int" },
-              { value: BigInt(copiedBAddr), type: "unsigned int" },
-            ];
-
-            // call the function pointer
-            const result = wrapFunctionPtrCall(
-              memory,
-              functionTable,
-              funcPtr,
-              sharedWasmGlobalVariables,
-              stackFrameArgs,
-              ["signed int"],
-            )[0];
-
-            freeFunction({
-              address: copiedAAddr,
-              freeList: this.freeList,
-              allocatedBlocks: this.allocatedBlocks,
-            });
-            freeFunction({
-              address: copiedBAddr,
-              freeList: this.freeList,
-              allocatedBlocks: this.allocatedBlocks,
-            });
-            return result;
-          };
-          // create funcPtr for the emscripten compiled module - 2nd arg is the function siganture,
-          // see https://emscripten.org/docs/porting/connecting_cpp_and_javascript/Interacting-with-code.html
-          // section on "Calling JavaScript functions as function pointers from C"
-          const emscriptenFuncPtr = this.addFunction(sortFn, "iii");
-
-          const memSize = count * size;
-
-          // allocate space in emscripten module memory space
-          const copiedObjectAddress: number = this.malloc(memSize);
-
-          // copy contents from our memory space to the emscripten memory
-          const srcBuffer = new Uint8Array(this.memory.buffer, ptr, memSize);
-          const destBuffer = new Uint8Array(
-            this.emscriptenMemory!.buffer,
-            copiedObjectAddress,
-            memSize,
-          );
-          for (let i = 0; i < memSize; ++i) {
-            destBuffer[i] = srcBuffer[i];
-          }
-          // perform the sorting operation
-          this.qsort(copiedObjectAddress, count, size, emscriptenFuncPtr);
-
-          // copy sorted result back into our memory
-          for (let i = 0; i < memSize; ++i) {
-            srcBuffer[i] = destBuffer[i];
-          }
-
-          // free buffer from emscriptens memory
-          this.free(copiedObjectAddress);
-        },
+        // implemented directly in wasm, so that the comparator can be called without leaving wasm
+        wasmImplementation: (externalFunction) =>
+          createQsortWasmImplementation(
+            this.moduleFunctions.qsort.functionType,
+            externalFunction,
+          ),
       },
     };
   }
+
+  /**
+   * Copies a null terminated string in program memory into newly malloced emscripten memory, without decoding it.
+   * Returns the address of the copied string in emscripten memory, which must be freed after use.
+   */
+  copyCStyleStringToEmscriptenMemory(strAddress: number): number {
+    const strBytes = getCStyleStringBytes(this.memory.buffer, strAddress);
+    const strPtr = this.malloc(strBytes.length + 1);
+    const emscriptenBytes = new Uint8Array(this.emscriptenMemory!.buffer);
+    emscriptenBytes.set(strBytes, strPtr);
+    emscriptenBytes[strPtr + strBytes.length] = 0;
+    return strPtr;
+  }
 }
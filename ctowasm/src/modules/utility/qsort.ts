@@ -0,0 +1,462 @@
+/**
+ * Implementation of qsort directly in wasm.
+ * Sorts in place with an introsort (quicksort with median of 3 pivot, falling back to heapsort when recursion gets
+ * too deep, and to insertion sort for small ranges). The comparator is called with call_indirect on pointers into the
+ * array being sorted, so no copying or allocation is needed.
+ */
+
+import { FunctionDataType, PointerDataType } from "~src/parser/c-ast/dataTypes";
+import { ExternalFunction } from "~src/processor/c-ast/core";
+import { FunctionDetails } from "~src/processor/c-ast/function";
+import {
+  convertFunctionDataTypeToFunctionDetails,
+} from "~src/processor/dataTypeUtil";
+import {
+  BASE_POINTER,
+  STACK_POINTER,
+  getFunctionCallStackFrameSetupStatements,
+  getFunctionCallStackFrameTeardownStatements,
+  getRegisterPointerArithmeticNode,
+} from "~src/translator/memoryUtil";
+import { WasmExpression, WasmStatement } from "~src/translator/wasm-ast/core";
+import { WasmFunction } from "~src/translator/wasm-ast/functions";
+import {
+  breakIf,
+  call,
+  decrement,
+  i32Const,
+  i32Op,
+  i32Variables,
+  ifThen,
+  increment,
+  localGet,
+  localSet,
+  loop,
+} from "~src/modules/wasmImplementationUtil";
+
+// names of the helper functions (not valid C identifiers, so they cannot clash with user functions)
+const SORT_FUNCTION = "qsort.sort";
+const INSERTION_SORT_FUNCTION = "qsort.insertion_sort";
+const HEAPSORT_FUNCTION = "qsort.heapsort";
+const SIFT_DOWN_FUNCTION = "qsort.sift_down";
+const SWAP_FUNCTION = "qsort.swap";
+
+const INSERTION_SORT_THRESHOLD = 16; // ranges with at most this number of elements are insertion sorted
+
+/**
+ * Returns the address of the element at given index.
+ */
+function elementAddress(index: WasmExpression): WasmExpression {
+  return i32Op("add", localGet("lo"), i32Op("mul", index, localGet("size")));
+}
+
+function swap(a: WasmExpression, b: WasmExpression): WasmStatement {
+  return call(SWAP_FUNCTION, [a, b, localGet("size")]);
+}
+
+/**
+ * Returns the expression that calls the comparator (held in local "cmp") on the elements at given addresses,
+ * and evaluates to its result.
+ */
+function compare(
+  comparatorDetails: FunctionDetails,
+  a: WasmExpression,
+  b: WasmExpression,
+): WasmExpression {
+  return {
+    type: "PreStatementExpression",
+    statements: [
+      {
+        type: "IndirectFunctionCall",
+        index: localGet("cmp"),
+        stackFrameSetup: getFunctionCallStackFrameSetupStatements(
+          comparatorDetails,
+          [a, b],
+        ),
+        stackFrameTearDown:
+          getFunctionCallStackFrameTeardownStatements(comparatorDetails),
+      },
+    ],
+    // the return object lies just below the stack pointer after the call
+    expr: {
+      type: "MemoryLoad",
+      addr: getRegisterPointerArithmeticNode(
+        STACK_POINTER,
+        "-",
+        comparatorDetails.sizeOfReturn,
+      ),
+      wasmDataType: "i32",
+      numOfBytes: 4,
+    },
+  };
+}
+
+/**
+ * Swaps the "size" bytes at addresses "a" and "b", 4 bytes at a time where possible.
+ */
+function createSwapFunction(): WasmFunction {
+  const swapUnit = (numOfBytes: 1 | 4): WasmStatement[] => {
+    const addrA = i32Op("add", localGet("a"), localGet("k"));
+    const addrB = i32Op("add", localGet("b"), localGet("k"));
+    return [
+      localSet("tmp", {
+        type: "MemoryLoad",
+        addr: addrA,
+        wasmDataType: "i32",
+        numOfBytes,
+      }),
+      {
+        type: "MemoryStore",
+        addr: addrA,
+        value: {
+          type: "MemoryLoad",
+          addr: addrB,
+          wasmDataType: "i32",
+          numOfBytes,
+        },
+        wasmDataType: "i32",
+        numOfBytes,
+      },
+      {
+        type: "MemoryStore",
+        addr: addrB,
+        value: localGet("tmp"),
+        wasmDataType: "i32",
+        numOfBytes,
+      },
+      increment("k", i32Const(numOfBytes)),
+    ];
+  };
+  return {
+    type: "Function",
+    name: SWAP_FUNCTION,
+    params: i32Variables("a", "b", "size"),
+    locals: i32Variables("k", "tmp"),
+    body: [
+      loop("words", [
+        breakIf(
+          "words",
+          i32Op(
+            "gt_u",
+            i32Op("add", localGet("k"), i32Const(4)),
+            localGet("size"),
+          ),
+        ),
+        ...swapUnit(4),
+      ]),
+      loop("bytes", [
+        breakIf("bytes", i32Op("ge_u", localGet("k"), localGet("size"))),
+        ...swapUnit(1),
+      ]),
+    ],
+  };
+}
+
+/**
+ * Insertion sorts the elements from address "lo" to "hi" inclusive.
+ */
+function createInsertionSortFunction(
+  comparatorDetails: FunctionDetails,
+): WasmFunction {
+  const previous = i32Op("sub", localGet("q"), localGet("size"));
+  return {
+    type: "Function",
+    name: INSERTION_SORT_FUNCTION,
+    params: i32Variables("lo", "hi", "size", "cmp"),
+    locals: i32Variables("p", "q"),
+    body: [
+      localSet("p", i32Op("add", localGet("lo"), localGet("size"))),
+      loop("outer", [
+        breakIf("outer", i32Op("gt_u", localGet("p"), localGet("hi"))),
+        localSet("q", localGet("p")),
+        // move the element at p backwards until it is in order
+        loop("inner", [
+          breakIf("inner", i32Op("le_u", localGet("q"), localGet("lo"))),
+          breakIf(
+            "inner",
+            i32Op(
+              "le_s",
+              compare(comparatorDetails, previous, localGet("q")),
+              i32Const(0),
+            ),
+          ),
+          swap(previous, localGet("q")),
+          decrement("q", localGet("size")),
+        ]),
+        increment("p", localGet("size")),
+      ]),
+    ],
+  };
+}
+
+/**
+ * Sifts the element at index "root" down the max heap of "n" elements starting at address "lo".
+ */
+function createSiftDownFunction(
+  comparatorDetails: FunctionDetails,
+): WasmFunction {
+  const child = elementAddress(localGet("child"));
+  return {
+    type: "Function",
+    name: SIFT_DOWN_FUNCTION,
+    params: i32Variables("lo", "root", "n", "size", "cmp"),
+    locals: i32Variables("child"),
+    body: [
+      loop("sift", [
+        localSet(
+          "child",
+          i32Op(
+            "add",
+            i32Op("shl", localGet("root"), i32Const(1)),
+            i32Const(1),
+          ),
+        ),
+        breakIf("sift", i32Op("ge_u", localGet("child"), localGet("n"))),
+        // pick the larger child
+        ifThen(
+          i32Op(
+            "lt_u",
+            i32Op("add", localGet("child"), i32Const(1)),
+            localGet("n"),
+          ),
+          [
+            ifThen(
+              i32Op(
+                "lt_s",
+                compare(
+                  comparatorDetails,
+                  child,
+                  i32Op("add", child, localGet("size")),
+                ),
+                i32Const(0),
+              ),
+              [increment("child", i32Const(1))],
+            ),
+          ],
+        ),
+        breakIf(
+          "sift",
+          i32Op(
+            "ge_s",
+            compare(comparatorDetails, elementAddress(localGet("root")), child),
+            i32Const(0),
+          ),
+        ),
+        swap(elementAddress(localGet("root")), child),
+        localSet("root", localGet("child")),
+      ]),
+    ],
+  };
+}
+
+/**
+ * Heapsorts the "n" elements starting at address "lo".
+ */
+function createHeapsortFunction(): WasmFunction {
+  const siftDown = (root: WasmExpression, n: WasmExpression) =>
+    call(SIFT_DOWN_FUNCTION, [
+      localGet("lo"),
+      root,
+      n,
+      localGet("size"),
+      localGet("cmp"),
+    ]);
+  return {
+    type: "Function",
+    name: HEAPSORT_FUNCTION,
+    params: i32Variables("lo", "n", "size", "cmp"),
+    locals: i32Variables("start", "end"),
+    body: [
+      // build the max heap
+      localSet("start", i32Op("shr_u", localGet("n"), i32Const(1))),
+      loop("heapify", [
+        breakIf("heapify", i32Op("eq", localGet("start"), i32Const(0))),
+        decrement("start", i32Const(1)),
+        siftDown(localGet("start"), localGet("n")),
+      ]),
+      // repeatedly move the max to the end
+      localSet("end", localGet("n")),
+      loop("extract", [
+        breakIf("extract", i32Op("le_u", localGet("end"), i32Const(1))),
+        decrement("end", i32Const(1)),
+        swap(localGet("lo"), elementAddress(localGet("end"))),
+        siftDown(i32Const(0), localGet("end")),
+      ]),
+    ],
+  };
+}
+
+/**
+ * Introsorts the elements from address "lo" to "hi" inclusive, heapsorting once "depth" reaches 0.
+ * Recurses into the smaller partition and loops on the larger one, so recursion depth is logarithmic.
+ */
+function createSortFunction(comparatorDetails: FunctionDetails): WasmFunction {
+  const cmp = (a: WasmExpression, b: WasmExpression) =>
+    compare(comparatorDetails, a, b);
+  const sort = (lo: WasmExpression, hi: WasmExpression) =>
+    call(SORT_FUNCTION, [
+      lo,
+      hi,
+      localGet("size"),
+      localGet("cmp"),
+      localGet("depth"),
+    ]);
+  const lo = localGet("lo");
+  const hi = localGet("hi");
+  const mid = localGet("mid");
+  const i = localGet("i");
+  const j = localGet("j");
+  const size = localGet("size");
+  return {
+    type: "Function",
+    name: SORT_FUNCTION,
+    params: i32Variables("lo", "hi", "size", "cmp", "depth"),
+    locals: i32Variables("count", "mid", "i", "j"),
+    body: [
+      loop("partition", [
+        ifThen(i32Op("le_u", hi, lo), [{ type: "ReturnStatement" }]),
+        localSet(
+          "count",
+          i32Op("add", i32Op("div_u", i32Op("sub", hi, lo), size), i32Const(1)),
+        ),
+        ifThen(
+          i32Op("le_u", localGet("count"), i32Const(INSERTION_SORT_THRESHOLD)),
+          [
+            call(INSERTION_SORT_FUNCTION, [lo, hi, size, localGet("cmp")]),
+            { type: "ReturnStatement" },
+          ],
+        ),
+        ifThen(i32Op("eq", localGet("depth"), i32Const(0)), [
+          call(HEAPSORT_FUNCTION, [
+            lo,
+            localGet("count"),
+            size,
+            localGet("cmp"),
+          ]),
+          { type: "ReturnStatement" },
+        ]),
+        decrement("depth", i32Const(1)),
+
+        // order lo, mid and hi, then use the median as pivot by moving it to lo
+        localSet(
+          "mid",
+          i32Op(
+            "add",
+            lo,
+            i32Op("mul", i32Op("shr_u", localGet("count"), i32Const(1)), size),
+          ),
+        ),
+        ifThen(i32Op("lt_s", cmp(mid, lo), i32Const(0)), [swap(mid, lo)]),
+        ifThen(i32Op("lt_s", cmp(hi, mid), i32Const(0)), [
+          swap(hi, mid),
+          ifThen(i32Op("lt_s", cmp(mid, lo), i32Const(0)), [swap(mid, lo)]),
+        ]),
+        swap(lo, mid),
+
+        // partition the rest of the range around the pivot at lo
+        localSet("i", i32Op("add", lo, size)),
+        localSet("j", hi),
+        loop("scan", [
+          loop("scan_up", [
+            breakIf("scan_up", i32Op("gt_u", i, j)),
+            breakIf("scan_up", i32Op("ge_s", cmp(i, lo), i32Const(0))),
+            increment("i", size),
+          ]),
+          loop("scan_down", [
+            breakIf("scan_down", i32Op("gt_u", i, j)),
+            breakIf("scan_down", i32Op("le_s", cmp(j, lo), i32Const(0))),
+            decrement("j", size),
+          ]),
+          breakIf("scan", i32Op("ge_u", i, j)),
+          swap(i, j),
+          increment("i", size),
+          decrement("j", size),
+        ]),
+        // place the pivot in its final position j
+        swap(lo, j),
+
+        ifThen(
+          i32Op("lt_u", i32Op("sub", j, lo), i32Op("sub", hi, j)),
+          [
+            // left partition is smaller
+            ifThen(i32Op("lt_u", lo, j), [sort(lo, i32Op("sub", j, size))]),
+            localSet("lo", i32Op("add", j, size)),
+          ],
+          [
+            ifThen(i32Op("lt_u", j, hi), [sort(i32Op("add", j, size), hi)]),
+            ifThen(i32Op("le_u", j, lo), [{ type: "ReturnStatement" }]),
+            localSet("hi", i32Op("sub", j, size)),
+          ],
+        ),
+      ]),
+    ],
+  };
+}
+
+/**
+ * Returns the wasm functions implementing qsort.
+ * The "qsort" function itself follows the memory model calling convention, loading its params from the stack frame.
+ */
+export function createQsortWasmImplementation(
+  qsortType: FunctionDataType,
+  externalFunction: ExternalFunction,
+): WasmFunction[] {
+  const comparatorDetails = convertFunctionDataTypeToFunctionDetails(
+    (qsortType.parameters[3] as PointerDataType)
+      .pointeeType as FunctionDataType,
+  );
+
+  // params are in declaration order: base, count, size, comparator
+  const paramNames = ["base", "count", "size", "cmp"];
+  const loadParams: WasmStatement[] = externalFunction.parameters.map(
+    (param, i) =>
+      localSet(paramNames[i], {
+        type: "MemoryLoad",
+        addr: getRegisterPointerArithmeticNode(BASE_POINTER, "+", param.offset),
+        wasmDataType: "i32",
+        numOfBytes: 4,
+      }),
+  );
+
+  const count = localGet("count");
+  const qsortFunction: WasmFunction = {
+    type: "Function",
+    name: externalFunction.name,
+    locals: i32Variables(...paramNames, "depth", "m"),
+    body: [
+      ...loadParams,
+      ifThen(i32Op("gt_u", count, i32Const(1)), [
+        ifThen(i32Op("ne", localGet("size"), i32Const(0)), [
+          // recursion depth limit of 2 * floor(log2(count))
+          localSet("depth", i32Const(0)),
+          localSet("m", count),
+          loop("log2", [
+            breakIf("log2", i32Op("le_u", localGet("m"), i32Const(1))),
+            localSet("m", i32Op("shr_u", localGet("m"), i32Const(1))),
+            increment("depth", i32Const(2)),
+          ]),
+          call(SORT_FUNCTION, [
+            localGet("base"),
+            i32Op(
+              "add",
+              localGet("base"),
+              i32Op("mul", i32Op("sub", count, i32Const(1)), localGet("size")),
+            ),
+            localGet("size"),
+            localGet("cmp"),
+            localGet("depth"),
+          ]),
+        ]),
+      ]),
+    ],
+  };
+
+  return [
+    qsortFunction,
+    createSortFunction(comparatorDetails),
+    createInsertionSortFunction(comparatorDetails),
+    createHeapsortFunction(),
+    createSiftDownFunction(comparatorDetails),
+    createSwapFunction(),
+  ];
+}
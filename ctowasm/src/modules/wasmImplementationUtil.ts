@@ -0,0 +1,157 @@
+/**
+ * Helpers for building the wasm AST of module functions that are implemented directly in wasm (see wasmImplementation
+ * in types.ts).
+ */
+
+import {
+  BASE_POINTER,
+  WASM_ADDR_TYPE,
+  getRegisterPointerArithmeticNode,
+} from "~src/translator/memoryUtil";
+import { WasmExpression, WasmStatement } from "~src/translator/wasm-ast/core";
+import { WasmBooleanExpression } from "~src/translator/wasm-ast/expressions";
+import { WasmDataType } from "~src/translator/wasm-ast/dataTypes";
+import { WasmLocalVariable } from "~src/translator/wasm-ast/variables";
+import { ExternalFunction } from "~src/processor/c-ast/core";
+import { WASM_ADDR_SIZE } from "~src/common/constants";
+
+export function i32Const(value: number): WasmExpression {
+  return { type: "IntegerConst", wasmDataType: "i32", value: BigInt(value) };
+}
+
+export function localGet(name: string): WasmExpression {
+  return { type: "LocalGet", name };
+}
+
+export function localSet(name: string, value: WasmExpression): WasmStatement {
+  return { type: "LocalSet", name, value };
+}
+
+export function globalGet(name: string): WasmExpression {
+  return { type: "GlobalGet", name };
+}
+
+export function globalSet(name: string, value: WasmExpression): WasmStatement {
+  return { type: "GlobalSet", name, value };
+}
+
+/**
+ * Returns the binary expression for an i32 instruction e.g. "add", "lt_u".
+ */
+export function i32Op(
+  instruction: string,
+  leftExpr: WasmExpression,
+  rightExpr: WasmExpression,
+): WasmExpression {
+  return {
+    type: "BinaryExpression",
+    instruction: `${WASM_ADDR_TYPE}.${instruction}`,
+    leftExpr,
+    rightExpr,
+  };
+}
+
+export function condition(expr: WasmExpression): WasmBooleanExpression {
+  return { type: "BooleanExpression", expr, wasmDataType: "i32" };
+}
+
+export function ifThen(
+  cond: WasmExpression,
+  actions: WasmStatement[],
+  elseStatements: WasmStatement[] = [],
+): WasmStatement {
+  return {
+    type: "SelectionStatement",
+    condition: condition(cond),
+    actions,
+    elseStatements,
+  };
+}
+
+/**
+ * Returns an infinite loop with given body. The loop can be exited using breakIf with the same label.
+ */
+export function loop(label: string, body: WasmStatement[]): WasmStatement {
+  return {
+    type: "Block",
+    label: `${label}_exit`,
+    body: [
+      {
+        type: "Loop",
+        label,
+        body: [...body, { type: "Branch", label }],
+      },
+    ],
+  };
+}
+
+export function breakIf(label: string, cond: WasmExpression): WasmStatement {
+  return { type: "BranchIf", label: `${label}_exit`, condition: cond };
+}
+
+export function call(name: string, args: WasmExpression[]): WasmStatement {
+  return { type: "RegularFunctionCall", name, args };
+}
+
+export function localVariables(
+  wasmDataType: WasmDataType,
+  ...names: string[]
+): WasmLocalVariable[] {
+  return names.map((name) => ({
+    type: "LocalVariable",
+    name,
+    wasmDataType,
+  }));
+}
+
+export function i32Variables(...names: string[]): WasmLocalVariable[] {
+  return localVariables(WASM_ADDR_TYPE, ...names);
+}
+
+export function increment(name: string, value: WasmExpression): WasmStatement {
+  return localSet(name, i32Op("add", localGet(name), value));
+}
+
+export function decrement(name: string, value: WasmExpression): WasmStatement {
+  return localSet(name, i32Op("sub", localGet(name), value));
+}
+
+/**
+ * Returns the statement that stores the return value of a function following the memory model calling convention.
+ */
+export function storeReturnValue(
+  externalFunction: ExternalFunction,
+  value: WasmExpression,
+): WasmStatement {
+  const returnObject = externalFunction.returnObjects![0];
+  const numOfBytes = returnObject.dataType === "signed long" ? 8 : 4;
+  return {
+    type: "MemoryStore",
+    addr: getRegisterPointerArithmeticNode(
+      BASE_POINTER,
+      "+",
+      WASM_ADDR_SIZE + returnObject.offset,
+    ),
+    value,
+    wasmDataType: numOfBytes === 8 ? "i64" : "i32",
+    numOfBytes,
+  };
+}
+
+/**
+ * Returns the statements that load the i32 (int or pointer) params of a function following the memory model calling
+ * convention into the locals with the given names, in declaration order.
+ */
+export function loadI32Params(
+  externalFunction: ExternalFunction,
+  paramNames: string[],
+): WasmStatement[] {
+  return externalFunction.parameters.map((param, i) =>
+    localSet(paramNames[i], {
+      type: "MemoryLoad",
+      addr: getRegisterPointerArithmeticNode(BASE_POINTER, "+", param.offset),
+      wasmDataType: "i32",
+      numOfBytes: 4,
+    }),
+  );
+}
@@ -42,6 +42,7 @@ export interface FunctionDataType extends DataTypeBase {
   type: "function";
   returnType: DataType;
   parameters: DataType[];
+  isVariadic?: boolean; // true if the function takes a variable number of arguments after its parameters (only for module functions e.g. printf)
 }
 
 export interface StructDataType extends DataTypeBase {
@@ -9,33 +9,98 @@ import preprocessor from "~src/parser/peggyjs/preprocessor"
 import lexer from "~src/parser/peggyjs/lexer"
 import parser from "~src/parser/peggyjs/parser"
 import { Position } from "~src/parser/c-ast/misc";
+import { CompilationPhaseTimings } from "~src/common/compilationMetrics";
+import TokenTable from "~src/parser/tokenTable";
+import ScopedSymbolTable, {
+  IdentifierTable,
+} from "~src/common/scopedSymbolTable";
 
 
+/**
+ * Receives the events of a parser generated with tracing ("peggy --trace"), such as the "rule.enter" event of each try
+ * of a rule. Parsers generated without tracing never call it.
+ */
+export interface ParserTracer {
+  trace(event: {
+    type: string;
+    rule: string;
+    location: { start: { offset: number } };
+  }): void;
+}
+
+export interface ParserTracers {
+  preprocessor?: ParserTracer;
+  lexer?: ParserTracer;
+  parser?: ParserTracer;
+}
+
+// a traced parser given no tracer at all prints its events, so the option is only given with a tracer
+function getParseOptions(tracer?: ParserTracer) {
+  return typeof tracer !== "undefined" ? { tracer } : {};
+}
+
 export interface ParserOutput {
   cAstRoot: CAstRoot;
   warnings: string[];
+  identifiers: IdentifierTable; // interned by the lexer, for the symbol table of the processor
 }
 
+/**
+ * @param timings if given, the times taken to preprocess, lex and parse are recorded in it.
+ * @param tracers if given, receive the events of the parsers generated with tracing (see bench/parserRuleHits.js).
+ */
 export default function parse(
   sourceCode: string,
   moduleRepository: ModuleRepository,
-) {
+  timings?: Partial<CompilationPhaseTimings>,
+  tracers: ParserTracers = {},
+): ParserOutput {
   try {
     // eslint-disable-next-line
     // @ts-ignore
     parser.moduleRepository = moduleRepository; // make moduleRepository available to parser object
-    const preprocessedOutput = preprocessor.parse(sourceCode);
+    let phaseStartTime = performance.now();
+    const preprocessedOutput = preprocessor.parse(
+      sourceCode,
+      getParseOptions(tracers.preprocessor),
+    );
+    if (timings) {
+      timings.preprocessMs = performance.now() - phaseStartTime;
+      phaseStartTime = performance.now();
+    }
+    const tokenTable = new TokenTable(
+      sourceCode,
+      // eslint-disable-next-line
+      // @ts-ignore
+      preprocessor.falseNewlinePositions,
+    );
     // eslint-disable-next-line
     // @ts-ignore
-    lexer.falseNewlinePositions = preprocessor.falseNewlinePositions;
-    const lexedOutput = lexer.parse(preprocessedOutput);
+    lexer.tokenTable = tokenTable;
+    const lexedOutput = lexer.parse(
+      preprocessedOutput,
+      getParseOptions(tracers.lexer),
+    );
+    if (timings) {
+      timings.lexMs = performance.now() - phaseStartTime;
+      phaseStartTime = performance.now();
+    }
+    // eslint-disable-next-line
+    // @ts-ignore
+    parser.tokenTable = tokenTable; // the parser takes the tokens lexed above from here
     // eslint-disable-next-line
     // @ts-ignore
-    parser.tokenPositions = lexer.tokenPositions;
+    parser.symbolTable = {
+      identifiers: new ScopedSymbolTable(tokenTable.identifiers),
+      tags: new ScopedSymbolTable(tokenTable.identifiers),
+    };
 
     try {
       const { rootNode, compilationErrors, warnings } =
-        parser.parse(lexedOutput);
+        parser.parse(lexedOutput, getParseOptions(tracers.parser));
+      if (timings) {
+        timings.parseMs = performance.now() - phaseStartTime;
+      }
 
       if (compilationErrors.length > 0) {
         // this handles any errors that were detected but didnt stop parsing
@@ -49,15 +114,21 @@ export default function parse(
         warnings: warnings.map((w: { message: string; position: Position }) =>
           generateCompilationWarningMessage(w.message, sourceCode, w.position),
         ),
+        identifiers: tokenTable.identifiers,
       };
     } catch (e) {
       // catch syntax errors detected by peggy js
       // or any error that required immediately ending of parsing
       if ("location" in (e as object)) {
         // parser locations from syntax errors (or any thrown immediate errors) need to be adjusted
-        if (
-          !(lexer as any).tokenPositions.has((e as any).location.start.offset)
-        ) {
+        const adjustedLocation = tokenTable.getPosition(
+          (e as any).location.start.offset,
+          Math.max(
+            (e as any).location.start.offset,
+            (e as any).location.end.offset - 1,
+          ),
+        );
+        if (adjustedLocation === null) {
           // in case the location was a artificial whitespace separating tokens
           throw new ParserCompilationErrors(sourceCode, [
             {
@@ -69,17 +140,6 @@ export default function parse(
             },
           ]);
         }
-        const adjustedLocation = {
-          start: (lexer as any).tokenPositions.get(
-            (e as any).location.start.offset,
-          ).start,
-          end: (lexer as any).tokenPositions.get(
-            Math.max(
-              (e as any).location.start.offset,
-              (e as any).location.end.offset - 1,
-            ),
-          ).end,
-        };
         throw new ParserCompilationErrors(sourceCode, [
           { message: (e as any).message, position: adjustedLocation },
         ]);
@@ -1 +1,5 @@
-export function parse(input: string): string;
+import { ParserTracer } from "~src/parser";
+export function parse(
+  input: string,
+  options?: { tracer?: ParserTracer },
+): string;
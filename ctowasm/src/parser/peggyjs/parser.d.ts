@@ -1,6 +1,10 @@
 import { CAstRoot } from "~src/parser/c-ast/core";
 import { Position } from "~src/parser/c-ast/misc";
-export function parse(input: string): {
+import { ParserTracer } from "~src/parser";
+export function parse(
+  input: string,
+  options?: { tracer?: ParserTracer },
+): {
   rootNode: CAstRoot;
   compilationErrors: { message: string; position: Position }[];
   warnings: { message: string; position: Position }[];
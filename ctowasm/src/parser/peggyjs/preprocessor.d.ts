@@ -1,2 +1,6 @@
 import { Position } from "~src/parser/c-ast/misc";
-export function parse(input: string): string;
+import { ParserTracer } from "~src/parser";
+export function parse(
+  input: string,
+  options?: { tracer?: ParserTracer },
+): string;
@@ -0,0 +1,161 @@
+/**
+ * Post-processes the parsers generated by "peggy --cache" so that only selected rules are memoised.
+ *
+ * With --cache, peggy memoises the result of every rule at every position, so the memory used grows with the number of
+ * rules times the length of the input, even though most rules are never tried twice at the same position. This removes
+ * the memoisation from all rules except those listed in MEMOISED_RULES.
+ *
+ * Usage: node src/parser/peggyjs/restrictMemoization.js
+ * (run after generating the parsers, see the gen-parsers-selective script in package.json)
+ *
+ * The generated code is matched by its shape, and any rule function that does not have the shape of a memoised rule of
+ * peggy 3 fails the build, rather than leaving the parser memoised differently than listed.
+ */
+import * as fs from "fs";
+import * as path from "node:path";
+import { dirname } from "path";
+import { fileURLToPath, pathToFileURL } from "url";
+
+const __dirname = dirname(fileURLToPath(import.meta.url));
+
+/**
+ * The rules that stay memoised in each generated parser:
+ * - the rules that bench/parserRuleHits.js finds tried again at a position they were already tried at, over the
+ *   benchmark programs and test samples. The parsers then never evaluate a rule twice at a position on that corpus,
+ *   exactly as with full memoisation, and rules tried again on other programs are only evaluated again.
+ * - the rules whose actions change the state of the parser (the token table, the symbol table, errors and warnings),
+ *   which must not run twice at a position however rarely that happens.
+ */
+export const MEMOISED_RULES = {
+  preprocessor: [
+    // changes the parser state
+    "preprocess_match",
+  ],
+  lexer: [
+    // tried again
+    "_",
+    "digit",
+    "identifier",
+    "unsigned_suffix",
+    // changes the parser state
+    "preprocess_match",
+  ],
+  parser: [
+    // tried again: each binary expression level is tried with an operator and then again without, and the
+    // alternatives of declarations and statements start with the same tokens
+    "_",
+    "add_subtract_expression",
+    "assignment_expression",
+    "bitwise_and_expression",
+    "bitwise_or_expression",
+    "bitwise_shift_expression",
+    "bitwise_xor_expression",
+    "compound_statement",
+    "constant_expression",
+    "declaration_specifier",
+    "declaration_specifiers",
+    "declarator",
+    "direct_declarator_helper",
+    "enumeration_constant",
+    "equality_relational_expression",
+    "expression",
+    "identifier",
+    "init_declarator_list",
+    "logical_and_expression",
+    "logical_or_expression",
+    "multiply_divide_expression",
+    "pointer",
+    "primary_expression",
+    "relative_relational_expression",
+    "specifier_qualifier_list_item",
+    "statement",
+    "unary_expression",
+    // changes the parser state
+    "declaration",
+    "direct_abstract_declarator",
+    "direct_declarator",
+    "function_definition",
+    "include",
+    "iteration_statement",
+    "parameter_declaration",
+    "parameter_list",
+    "selection_statement",
+    "struct_declaration",
+    "struct_specifier",
+    "translation_unit",
+    "type_name",
+  ],
+};
+
+const RULE_FUNCTION_REGEX = /^( *)function peg\$parse(\w+)\(\) \{$/gm;
+
+/**
+ * Removes the memoisation from all the rules of the given parser (generated with --cache) except the given ones.
+ * Returns the resulting source code.
+ */
+export function restrictMemoization(parserSource, memoisedRules) {
+  const ruleFunctions = [...parserSource.matchAll(RULE_FUNCTION_REGEX)];
+  if (ruleFunctions.length === 0) {
+    throw new Error("No rule functions found in the generated parser");
+  }
+  const ruleNames = new Set(ruleFunctions.map((match) => match[2]));
+  for (const rule of memoisedRules) {
+    if (!ruleNames.has(rule)) {
+      throw new Error(`Memoised rule "${rule}" is not a rule of the grammar`);
+    }
+  }
+
+  let result = parserSource.slice(0, ruleFunctions[0].index);
+  ruleFunctions.forEach((match, i) => {
+    const end =
+      i + 1 < ruleFunctions.length
+        ? ruleFunctions[i + 1].index
+        : findFunctionEnd(parserSource, match);
+    const ruleFunction = parserSource.slice(match.index, end);
+    result += memoisedRules.includes(match[2])
+      ? ruleFunction
+      : removeMemoization(ruleFunction, match[2]);
+  });
+  const lastMatch = ruleFunctions[ruleFunctions.length - 1];
+  result += parserSource.slice(findFunctionEnd(parserSource, lastMatch));
+  return result;
+}
+
+function findFunctionEnd(source, match) {
+  const closingBrace = `\n${match[1]}}\n`;
+  const end = source.indexOf(closingBrace, match.index);
+  if (end === -1) {
+    throw new Error(`End of the function of rule "${match[2]}" not found`);
+  }
+  return end + closingBrace.length;
+}
+
+/**
+ * Removes the lookup of the cached result at the start of a rule function, and the caching of its result at the end.
+ */
+function removeMemoization(ruleFunction, rule) {
+  const lookup =
+    /\n( *)var key = peg\$currPos \* \d+ \+ \d+;\n *var cached = peg\$resultsCache\[key\];\n\s*if \(cached\) \{\n[\s\S]*?\n\1\}\n/;
+  const store =
+    /\n *peg\$resultsCache\[key\] = \{ nextPos: peg\$currPos, result: \w+ \};/;
+  if (!lookup.test(ruleFunction) || !store.test(ruleFunction)) {
+    throw new Error(
+      `Rule "${rule}" is not memoised, the parser must be generated with --cache`,
+    );
+  }
+  return ruleFunction.replace(lookup, "\n").replace(store, "");
+}
+
+if (
+  process.argv[1] &&
+  import.meta.url === pathToFileURL(process.argv[1]).href
+) {
+  for (const [grammar, memoisedRules] of Object.entries(MEMOISED_RULES)) {
+    const parserFile = path.resolve(__dirname, `${grammar}.js`);
+    fs.writeFileSync(
+      parserFile,
+      restrictMemoization(fs.readFileSync(parserFile, "utf-8"), memoisedRules),
+    );
+    console.log(`${grammar}: memoised rules ${memoisedRules.join(", ") || "none"}`);
+  }
+}
@@ -0,0 +1,241 @@
+/**
+ * Side table of the tokens produced by the lexer. The parser still runs over the space-joined output of the lexer,
+ * matching keywords and punctuators as literals, but takes identifiers, literals and includes whole from this table
+ * instead of lexing their characters again, and maps its offsets back to the source code through it.
+ *
+ * Tokens are stored by index in parallel typed arrays: their kind, their start and end offsets in the lexer output, and
+ * their start and end offsets in the source code. Identifiers are interned, each distinct name getting an id, and the
+ * values of literals (constants and string literals) are already evaluated by the lexer.
+ *
+ * Lines and columns are not stored, but computed when a position is asked for, by binary search in the offsets at which
+ * each line of the source code starts.
+ */
+
+import { Position } from "~src/parser/c-ast/misc";
+import { IdentifierTable } from "~src/common/scopedSymbolTable";
+
+export enum TokenKind {
+  Include,
+  Keyword,
+  Identifier,
+  IntegerConstant,
+  FloatingConstant,
+  CharacterConstant,
+  StringLiteral,
+  Punctuator,
+}
+
+export interface IntegerConstantValue {
+  value: string; // in a form accepted by BigInt()
+  suffix: string;
+}
+
+export interface FloatingConstantValue {
+  value: string;
+  suffix: string;
+}
+
+const INITIAL_CAPACITY = 1024;
+const NO_TOKEN = -1;
+const FALSE_NEWLINE_LENGTH = 2; // "\\\n" removed by the preprocessor
+
+/**
+ * Returns the number of elements among the first given number of elements of the sorted array that are less than or
+ * equal to the given value.
+ */
+function countLessThanOrEqual(
+  sortedArray: Uint32Array,
+  value: number,
+  length = sortedArray.length,
+) {
+  let low = 0;
+  let high = length;
+  while (low < high) {
+    const mid = (low + high) >>> 1;
+    if (sortedArray[mid] <= value) {
+      low = mid + 1;
+    } else {
+      high = mid;
+    }
+  }
+  return low;
+}
+
+export default class TokenTable {
+  readonly TokenKind = TokenKind; // for the grammars, which cannot import the enum
+  numberOfTokens = 0;
+  kinds: Uint8Array = new Uint8Array(INITIAL_CAPACITY);
+  starts: Uint32Array = new Uint32Array(INITIAL_CAPACITY);
+  ends: Uint32Array = new Uint32Array(INITIAL_CAPACITY);
+  sourceStarts: Uint32Array = new Uint32Array(INITIAL_CAPACITY);
+  sourceEnds: Uint32Array = new Uint32Array(INITIAL_CAPACITY);
+  identifierIds: Int32Array = new Int32Array(INITIAL_CAPACITY); // -1 for tokens that are not identifiers
+  // evaluated values of literals and names of included modules, undefined for other tokens
+  values: unknown[] = [];
+  // interned identifier names, handed on to the symbol tables of the parser and the processor
+  identifiers: IdentifierTable = new IdentifierTable();
+  // the parser looks up the same offset several times in a row (to check the kind of a token, then consume it)
+  private lastLookedUpOffset = NO_TOKEN;
+  private lastLookedUpIndex = NO_TOKEN;
+  // offsets in the source code at which each line starts
+  private lineStarts: Uint32Array;
+  // offsets in the preprocessed source code at which a "\\\n" was removed, in ascending order
+  private falseNewlineOffsets: Uint32Array;
+
+  /**
+   * @param falseNewlinePositions offsets in the source code of the "\\\n" that the preprocessor removed, in ascending order.
+   */
+  constructor(sourceCode: string, falseNewlinePositions: number[] = []) {
+    const lineStarts = [0];
+    for (
+      let i = sourceCode.indexOf("\n");
+      i !== -1;
+      i = sourceCode.indexOf("\n", i + 1)
+    ) {
+      lineStarts.push(i + 1);
+    }
+    this.lineStarts = Uint32Array.from(lineStarts);
+    // each removal shifts the rest of the preprocessed source code back by the length of a false newline
+    this.falseNewlineOffsets = Uint32Array.from(
+      falseNewlinePositions,
+      (position, i) => position - i * FALSE_NEWLINE_LENGTH,
+    );
+  }
+
+  /**
+   * Adds a token spanning [start, end) of the lexer output, and [preprocessedStart, preprocessedEnd) of the preprocessed
+   * source code (the input of the lexer). Tokens must be added in order of their offsets.
+   * @param value the name of an identifier, the value of a literal or the name of an included module.
+   */
+  addToken(
+    kind: TokenKind,
+    start: number,
+    end: number,
+    preprocessedStart: number,
+    preprocessedEnd: number,
+    value?: unknown,
+  ) {
+    if (this.numberOfTokens === this.kinds.length) {
+      this.grow();
+    }
+    const index = this.numberOfTokens++;
+    this.kinds[index] = kind;
+    this.starts[index] = start;
+    this.ends[index] = end;
+    this.sourceStarts[index] = this.getSourceOffset(preprocessedStart);
+    this.sourceEnds[index] = this.getSourceOffset(preprocessedEnd - 1) + 1;
+    if (kind === TokenKind.Identifier) {
+      this.identifierIds[index] = this.identifiers.intern(value as string);
+      this.values.push(undefined);
+    } else {
+      this.identifierIds[index] = NO_TOKEN;
+      this.values.push(value);
+    }
+  }
+
+  /**
+   * Returns the index of the token starting at the given offset of the lexer output, or -1 if no token starts there.
+   */
+  getTokenIndexAt(offset: number): number {
+    if (offset === this.lastLookedUpOffset) {
+      return this.lastLookedUpIndex;
+    }
+    let low = 0;
+    let high = this.numberOfTokens - 1;
+    let index = NO_TOKEN;
+    while (low <= high) {
+      const mid = (low + high) >>> 1;
+      const start = this.starts[mid];
+      if (start === offset) {
+        index = mid;
+        break;
+      } else if (start < offset) {
+        low = mid + 1;
+      } else {
+        high = mid - 1;
+      }
+    }
+    this.lastLookedUpOffset = offset;
+    this.lastLookedUpIndex = index;
+    return index;
+  }
+
+  /**
+   * Returns the kind of the token starting at the given offset, or -1 if no token starts there.
+   */
+  getTokenKindAt(offset: number): TokenKind | -1 {
+    const index = this.getTokenIndexAt(offset);
+    return index === NO_TOKEN ? NO_TOKEN : this.kinds[index];
+  }
+
+  /**
+   * Returns the index of the token that the given offset of the lexer output is in, or -1 if it is between tokens.
+   */
+  getTokenIndexContaining(offset: number): number {
+    const index =
+      countLessThanOrEqual(this.starts, offset, this.numberOfTokens) - 1;
+    return index !== NO_TOKEN && offset < this.ends[index] ? index : NO_TOKEN;
+  }
+
+  /**
+   * Returns the position in the source code spanned by the tokens that the given offsets of the lexer output are in,
+   * or null if either offset is between tokens.
+   */
+  getPosition(startOffset: number, lastOffset: number): Position | null {
+    const startIndex = this.getTokenIndexContaining(startOffset);
+    const endIndex = this.getTokenIndexContaining(lastOffset);
+    if (startIndex === NO_TOKEN || endIndex === NO_TOKEN) {
+      return null;
+    }
+    return {
+      start: this.getPoint(this.sourceStarts[startIndex]),
+      end: this.getPoint(this.sourceEnds[endIndex]),
+    };
+  }
+
+  getTokenLength(index: number): number {
+    return this.ends[index] - this.starts[index];
+  }
+
+  getIdentifierName(index: number): string {
+    return this.identifiers.getName(this.identifierIds[index]);
+  }
+
+  /**
+   * Converts an offset of the preprocessed source code to an offset of the source code.
+   */
+  private getSourceOffset(preprocessedOffset: number) {
+    return (
+      preprocessedOffset +
+      FALSE_NEWLINE_LENGTH *
+        countLessThanOrEqual(this.falseNewlineOffsets, preprocessedOffset)
+    );
+  }
+
+  private getPoint(offset: number) {
+    const line = countLessThanOrEqual(this.lineStarts, offset);
+    return { offset, line, column: offset - this.lineStarts[line - 1] + 1 };
+  }
+
+  private grow() {
+    const capacity = this.kinds.length * 2;
+    const kinds = new Uint8Array(capacity);
+    kinds.set(this.kinds);
+    this.kinds = kinds;
+    const starts = new Uint32Array(capacity);
+    starts.set(this.starts);
+    this.starts = starts;
+    const ends = new Uint32Array(capacity);
+    ends.set(this.ends);
+    this.ends = ends;
+    const sourceStarts = new Uint32Array(capacity);
+    sourceStarts.set(this.sourceStarts);
+    this.sourceStarts = sourceStarts;
+    const sourceEnds = new Uint32Array(capacity);
+    sourceEnds.set(this.sourceEnds);
+    this.sourceEnds = sourceEnds;
+    const identifierIds = new Int32Array(capacity);
+    identifierIds.set(this.identifierIds);
+    this.identifierIds = identifierIds;
+  }
+}
@@ -5,8 +5,10 @@
 import { ProcessingError } from "~src/errors";
 import { ConstantP } from "~src/processor/c-ast/expression/constants";
 import { DataType, StructSelfPointer } from "~src/parser/c-ast/dataTypes";
-import evaluateCompileTimeExpression from "~src/processor/evaluateCompileTimeExpression";
-import { getDataTypeSize } from "~src/processor/dataTypeUtil";
+import {
+  getDataTypeSize,
+  getNumberOfElementsInArray,
+} from "~src/processor/dataTypeUtil";
 import { isIntegerType, primaryDataTypeSizes } from "~src/common/utils";
 import {
   FloatDataType,
@@ -29,9 +31,7 @@ export function getZeroInializerByteStrForDataType(
       byteStr += "\\00";
     }
   } else if (dataType.type === "array") {
-    const numElements = evaluateCompileTimeExpression(
-      dataType.numElements,
-    ).value;
+    const numElements = getNumberOfElementsInArray(dataType);
     const elementZeroStr = getZeroInializerByteStrForDataType(
       dataType.elementDataType,
     );
@@ -28,6 +28,7 @@ import { JumpStatementP } from "~src/processor/c-ast/statement/jumpStatement";
 import { PrimaryDataTypeMemoryObjectDetails } from "~src/processor/dataTypeUtil";
 import { ModuleName } from "~src/modules";
 import { FunctionTable } from "~src/processor/symbolTable";
+import { Position } from "~src/parser/c-ast/misc";
 
 export type CNodeP = FunctionDefinitionP | StatementP | ExpressionP;
 
@@ -36,6 +37,7 @@ export type CNodeP = FunctionDefinitionP | StatementP | ExpressionP;
  */
 export interface CNodePBase {
   type: string;
+  position?: Position; // position of the C statement that a processed statement was produced from, only set on the first statement produced from each
 }
 
 export type StatementP =
@@ -24,7 +24,7 @@ export interface FunctionDetails {
  * Function calls are simply statements - i.e. they do not load any data type. The loading of the return object
  * of the function must be added after the function call.
  */
-export interface FunctionCallP {
+export interface FunctionCallP extends CNodePBase {
   type: "FunctionCall";
   calledFunction: CalledFunction;
   functionDetails: FunctionDetails; // details of the function being called
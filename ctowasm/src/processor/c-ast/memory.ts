@@ -3,7 +3,11 @@
  */
 
 import { ScalarCDataType } from "~src/common/types";
-import { ExpressionP, ExpressionPBase } from "~src/processor/c-ast/core";
+import {
+  CNodePBase,
+  ExpressionP,
+  ExpressionPBase,
+} from "~src/processor/c-ast/core";
 import { IntegerConstantP } from "~src/processor/c-ast/expression/constants";
 
 /**
@@ -79,7 +83,7 @@ export interface MemoryLoad extends ExpressionPBase {
 }
 
 // Represents the storing of a primary data type object in an address in memory
-export interface MemoryStore {
+export interface MemoryStore extends CNodePBase {
   type: "MemoryStore";
   address: Address;
   value: ExpressionP;
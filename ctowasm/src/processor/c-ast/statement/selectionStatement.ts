@@ -8,7 +8,7 @@ export interface SelectionStatementP extends CNodePBase {
   elseStatements: StatementP[] | null;
 }
 
-export interface SwitchStatementP {
+export interface SwitchStatementP extends CNodePBase {
   type: "SwitchStatement";
   targetExpression: ExpressionP;
   cases: SwitchStatementCaseP[];
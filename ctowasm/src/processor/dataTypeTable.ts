@@ -0,0 +1,164 @@
+/**
+ * Hash-consing of data types.
+ *
+ * Data types are plain objects that are created anew all over the parser and processor, so structurally equal data
+ * types are usually different objects. Each data type is interned into a canonical node, shared by all the data types
+ * that are structurally equal to it and identified by a unique id. The layout of a data type (size, primary objects,
+ * number of array elements), its string form and its compatibility with other data types are computed once and cached
+ * on its canonical node (see dataTypeUtil.ts).
+ *
+ * The canonical node of each data type object is remembered, so interning the same object again is a single lookup.
+ * Data type objects must not be modified once they have been interned.
+ */
+
+import { ArrayDataType, DataType } from "~src/parser/c-ast/dataTypes";
+import { ProcessingError, toJson } from "~src/errors";
+import evaluateCompileTimeExpression from "~src/processor/evaluateCompileTimeExpression";
+import { PrimaryDataTypeMemoryObjectDetails } from "~src/processor/dataTypeUtil";
+
+export interface CanonicalDataType {
+  id: number;
+  numElements?: number; // for arrays
+  // the following are computed when first asked for
+  size?: number;
+  primaryObjects?: PrimaryDataTypeMemoryObjectDetails[];
+  string?: string;
+  // results of compatibility checks with other data types, by the key from getCompatibilityKey()
+  compatibility: Map<number, boolean>;
+}
+
+let nextId = 0;
+let canonicalDataTypes: Map<string, CanonicalDataType> = new Map(); // by structural key
+let canonicalDataTypesByObject: WeakMap<DataType, CanonicalDataType> =
+  new WeakMap();
+// data types whose key is being computed, to stop at cycles
+const dataTypesBeingInterned: Set<DataType> = new Set();
+
+/**
+ * Forgets the canonical data types of the previous program. Ids are never reused, so canonical nodes that are still
+ * referenced stay distinct from new ones.
+ */
+export function clearDataTypeTable() {
+  canonicalDataTypes = new Map();
+  canonicalDataTypesByObject = new WeakMap();
+}
+
+function getNumberOfElementsInArray(dataType: ArrayDataType): number {
+  try {
+    const numElementsConstant = evaluateCompileTimeExpression(
+      dataType.numElements,
+    );
+    if (numElementsConstant.type === "FloatConstant") {
+      throw new ProcessingError("array size must be an integer-type");
+    }
+    return Number(numElementsConstant.value);
+  } catch (e) {
+    if (e instanceof ProcessingError) {
+      throw new ProcessingError(
+        "Array size must be compile-time constant expression (Variable Length Arrays not supported)",
+      );
+    } else {
+      throw e;
+    }
+  }
+}
+
+/**
+ * Returns the key of a data type that is a component of another data type being interned.
+ */
+function getComponentKey(dataType: DataType): string {
+  if (dataTypesBeingInterned.has(dataType)) {
+    // a pointer back to a struct that encloses it, through pointers to other structs, e.g. from "struct B { struct A *a; }"
+    // where "struct A { struct B *b; }". The struct is identified by its tag instead, as its key is not known yet.
+    const tag = "tag" in dataType ? dataType.tag : "";
+    return `enclosing ${dataType.type} ${tag}`;
+  }
+  return String(internDataType(dataType).id);
+}
+
+/**
+ * Returns a key that is equal for two data types if and only if they are structurally equal.
+ * @param numElements the number of elements of an array data type, undefined for an incomplete array (e.g. the array
+ * pointed to by "int (*p)[]").
+ */
+function getDataTypeKey(dataType: DataType, numElements?: number): string {
+  const qualifier = dataType.isConst ? "const " : "";
+  switch (dataType.type) {
+    case "primary":
+      return `${qualifier}${dataType.primaryDataType}`;
+    case "pointer":
+      return `${qualifier}pointer ${getComponentKey(dataType.pointeeType)}`;
+    case "array":
+      return `${qualifier}array ${numElements ?? "?"} ${getComponentKey(
+        dataType.elementDataType,
+      )}`;
+    case "function":
+      return `${qualifier}function ${getComponentKey(
+        dataType.returnType,
+      )} (${dataType.parameters.map(getComponentKey).join(",")}${
+        dataType.isVariadic ? ",..." : ""
+      })`;
+    case "struct":
+      return `${qualifier}struct ${dataType.tag ?? ""} {${dataType.fields
+        .map(
+          (field) =>
+            `${field.isConst ? "const " : ""}${field.tag}:${
+              field.dataType.type === "struct self pointer"
+                ? "self"
+                : getComponentKey(field.dataType)
+            }`,
+        )
+        .join(";")}}`;
+    case "enum":
+      return `${qualifier}enum ${dataType.tag ?? ""}`;
+    case "void":
+      return `${qualifier}void`;
+    default:
+      throw new Error(
+        `getDataTypeKey(): unhandled data type: ${toJson(dataType)}`,
+      );
+  }
+}
+
+/**
+ * Returns the canonical node of a data type, shared by all structurally equal data types.
+ */
+export function internDataType(dataType: DataType): CanonicalDataType {
+  let canonicalDataType = canonicalDataTypesByObject.get(dataType);
+  if (typeof canonicalDataType !== "undefined") {
+    return canonicalDataType;
+  }
+  // the size of an incomplete array is not known
+  const numElements =
+    dataType.type === "array" && typeof dataType.numElements !== "undefined"
+      ? getNumberOfElementsInArray(dataType)
+      : undefined;
+  dataTypesBeingInterned.add(dataType);
+  let key: string;
+  try {
+    key = getDataTypeKey(dataType, numElements);
+  } finally {
+    dataTypesBeingInterned.delete(dataType);
+  }
+  canonicalDataType = canonicalDataTypes.get(key);
+  if (typeof canonicalDataType === "undefined") {
+    canonicalDataType = {
+      id: nextId++,
+      numElements,
+      compatibility: new Map(),
+    };
+    canonicalDataTypes.set(key, canonicalDataType);
+  }
+  canonicalDataTypesByObject.set(dataType, canonicalDataType);
+  return canonicalDataType;
+}
+
+/**
+ * Returns the key of the result of a compatibility check with the given data type in the compatibility map of another.
+ */
+export function getCompatibilityKey(
+  other: CanonicalDataType,
+  ignoreQualifiers: boolean,
+) {
+  return other.id * 2 + (ignoreQualifiers ? 1 : 0);
+}
@@ -14,7 +14,6 @@ import {
 } from "~src/parser/c-ast/dataTypes";
 
 import { ProcessingError, toJson } from "~src/errors";
-import evaluateCompileTimeExpression from "~src/processor/evaluateCompileTimeExpression";
 import { ScalarCDataType } from "~src/common/types";
 import {
   getSizeOfScalarDataType,
@@ -26,25 +25,16 @@ import { ENUM_DATA_TYPE, POINTER_SIZE } from "~src/common/constants";
 import { FunctionDetails } from "~src/processor/c-ast/function";
 import { ExpressionWrapperP } from "~src/processor/c-ast/expression/expressions";
 import { getDataTypeOfExpression } from "~src/processor/util";
+import {
+  getCompatibilityKey,
+  internDataType,
+} from "~src/processor/dataTypeTable";
 
-function getNumberOfElementsInArray(dataType: ArrayDataType): number {
-  try {
-    const numElementsConstant = evaluateCompileTimeExpression(
-      dataType.numElements,
-    );
-    if (numElementsConstant.type === "FloatConstant") {
-      throw new ProcessingError("array size must be an integer-type");
-    }
-    return Number(numElementsConstant.value);
-  } catch (e) {
-    if (e instanceof ProcessingError) {
-      throw new ProcessingError(
-        "Array size must be compile-time constant expression (Variable Length Arrays not supported)",
-      );
-    } else {
-      throw e;
-    }
-  }
+/**
+ * Returns the number of elements of an array data type, which must be a compile-time constant.
+ */
+export function getNumberOfElementsInArray(dataType: ArrayDataType): number {
+  return internDataType(dataType).numElements as number;
 }
 
 /**
@@ -53,15 +43,20 @@ function getNumberOfElementsInArray(dataType: ArrayDataType): number {
 export function getDataTypeSize(
   dataType: DataType | StructSelfPointer,
 ): number {
-  if (
-    dataType.type === "primary" ||
-    dataType.type === "pointer" ||
-    dataType.type === "struct self pointer"
-  ) {
+  if (dataType.type === "struct self pointer") {
+    return POINTER_SIZE;
+  }
+  const canonicalDataType = internDataType(dataType);
+  if (typeof canonicalDataType.size === "undefined") {
+    canonicalDataType.size = calculateDataTypeSize(dataType);
+  }
+  return canonicalDataType.size;
+}
+
+function calculateDataTypeSize(dataType: DataType): number {
+  if (dataType.type === "primary" || dataType.type === "pointer") {
     return getSizeOfScalarDataType(
-      dataType.type === "pointer" || dataType.type === "struct self pointer"
-        ? "pointer"
-        : dataType.primaryDataType,
+      dataType.type === "pointer" ? "pointer" : dataType.primaryDataType,
     );
   } else if (dataType.type === "array") {
     return (
@@ -83,7 +78,7 @@ export function getDataTypeSize(
     throw new ProcessingError(`void value not ignored as it should be`);
   } else {
     throw new Error(
-      `getDataTypeSize(): unhandled data type: ${toJson(dataType)}`,
+      `calculateDataTypeSize(): unhandled data type: ${toJson(dataType)}`,
     );
   }
 }
@@ -190,12 +185,22 @@ export function getFunctionPointerOfFunction(
 // }
 
 export function stringifyDataType(dataType: DataType): string {
+  const canonicalDataType = internDataType(dataType);
+  if (typeof canonicalDataType.string === "undefined") {
+    canonicalDataType.string = createDataTypeString(dataType);
+  }
+  return canonicalDataType.string;
+}
+
+function createDataTypeString(dataType: DataType): string {
   if (dataType.type === "primary") {
     return `${dataType.isConst ? "const " : ""}${dataType.primaryDataType}`;
   } else if (dataType.type === "array") {
-    return `${dataType.isConst ? "const " : ""}array with size ${
-      evaluateCompileTimeExpression(dataType.numElements).value
-    } of ${stringifyDataType(dataType.elementDataType)}`;
+    return `${
+      dataType.isConst ? "const " : ""
+    }array with size ${getNumberOfElementsInArray(
+      dataType,
+    )} of ${stringifyDataType(dataType.elementDataType)}`;
   } else if (dataType.type === "pointer") {
     return `${dataType.isConst ? "const " : ""}pointer to ${stringifyDataType(
       dataType.pointeeType,
@@ -203,7 +208,9 @@ export function stringifyDataType(dataType: DataType): string {
   } else if (dataType.type === "function") {
     return `function (${dataType.parameters
       .map(stringifyDataType)
-      .join(", ")}) returning ${stringifyDataType(dataType.returnType)}`;
+      .join(", ")}${
+      dataType.isVariadic ? ", ..." : ""
+    }) returning ${stringifyDataType(dataType.returnType)}`;
   } else if (dataType.type === "struct") {
     return `struct ${dataType.tag ? dataType.tag : " "}`;
   } else if (dataType.type === "enum") {
@@ -211,7 +218,7 @@ export function stringifyDataType(dataType: DataType): string {
   } else if (dataType.type === "void") {
     return `void`;
   } else {
-    console.assert(false, "stringifyDataType() unreachable else");
+    console.assert(false, "createDataTypeString() unreachable else");
     return "";
   }
 }
@@ -242,12 +249,36 @@ function checkStructFieldCompatibility(
 
 /**
  * Checks the compatibility of two data types. Returns true if two data types are compatible as per the C17 standard.
+ * Structurally equal data types share a canonical node, and so are compatible without being compared further. The
+ * results of other comparisons are cached.
  * @param ignoreQualifiers to check if the unqualified data types of a and b are compatible.
  */
 export function checkDataTypeCompatibility(
   a: DataType,
   b: DataType,
   ignoreQualifiers = false,
+): boolean {
+  const canonicalA = internDataType(a);
+  const canonicalB = internDataType(b);
+  if (canonicalA === canonicalB) {
+    return true;
+  }
+  const key = getCompatibilityKey(canonicalB, ignoreQualifiers);
+  let result = canonicalA.compatibility.get(key);
+  if (typeof result === "undefined") {
+    result = compareDataTypes(a, b, ignoreQualifiers);
+    canonicalA.compatibility.set(key, result);
+  }
+  return result;
+}
+
+/**
+ * Compares the structure of two data types that are not structurally equal, for checkDataTypeCompatibility().
+ */
+function compareDataTypes(
+  a: DataType,
+  b: DataType,
+  ignoreQualifiers: boolean,
 ): boolean {
   if (
     a.type !== b.type ||
@@ -260,8 +291,7 @@ export function checkDataTypeCompatibility(
     return a.primaryDataType === b.primaryDataType;
   } else if (a.type === "array" && b.type === "array") {
     return (
-      evaluateCompileTimeExpression(a.numElements).value ===
-        evaluateCompileTimeExpression(b.numElements).value &&
+      getNumberOfElementsInArray(a) === getNumberOfElementsInArray(b) &&
       checkDataTypeCompatibility(
         a.elementDataType,
         b.elementDataType,
@@ -286,7 +316,10 @@ export function checkDataTypeCompatibility(
         return false;
       }
     }
-    if (a.parameters.length !== b.parameters.length) {
+    if (
+      a.parameters.length !== b.parameters.length ||
+      !!a.isVariadic !== !!b.isVariadic
+    ) {
       return false;
     }
     for (let i = 0; i < a.parameters.length; ++i) {
@@ -338,7 +371,7 @@ export function checkDataTypeCompatibility(
   } else if (a.type === "void" && b.type === "void") {
     return true;
   } else {
-    console.assert(false, "checkDataTypeCompatibility(): Unhandled case");
+    console.assert(false, "compareDataTypes(): Unhandled case");
     return false;
   }
 }
@@ -351,106 +384,65 @@ export interface PrimaryDataTypeMemoryObjectDetails {
   offset: number; // offset in number of bytes from the first byte of the memory object that this primary data type object belongs in.
 }
 /**
- * Unpacks an data type into its constituent primary data types (including multi dim arrays and structs)
+ * Unpacks an data type into its constituent primary data types (including multi dim arrays and structs).
+ * The returned array is cached and shared by all structurally equal data types, so it must not be modified.
  */
 export function unpackDataType(
   dataType: DataType,
-): PrimaryDataTypeMemoryObjectDetails[] {
-  let currOffset = 0;
-  const memoryObjects: PrimaryDataTypeMemoryObjectDetails[] = [];
-  function recursiveHelper(dataType: DataType) {
-    if (dataType.type === "primary") {
-      memoryObjects.push({
-        dataType: dataType.primaryDataType,
-        offset: currOffset,
-      });
-      currOffset += getDataTypeSize(dataType);
-    } else if (dataType.type === "pointer") {
-      memoryObjects.push({
-        dataType: "pointer",
-        offset: currOffset,
-      });
-      currOffset += getDataTypeSize(dataType);
-    } else if (dataType.type === "array") {
-      const numElements = getNumberOfElementsInArray(dataType);
-      for (let i = 0; i < numElements; ++i) {
-        recursiveHelper(dataType.elementDataType);
-      }
-    } else if (dataType.type === "struct") {
-      for (const field of dataType.fields) {
-        if (field.dataType.type === "struct self pointer") {
-          // pointer to the struct itself
-          memoryObjects.push({
-            dataType: "pointer",
-            offset: currOffset,
-          });
-          currOffset += getDataTypeSize(dataType);
-        } else {
-          recursiveHelper(field.dataType);
-        }
-      }
-    } else if (dataType.type === "enum") {
-      memoryObjects.push({
-        dataType: ENUM_DATA_TYPE,
-        offset: currOffset,
-      });
-      currOffset += getDataTypeSize(dataType);
-    } else {
-      // should not happen
-      throw new Error(
-        `unpackDataType(): Invalid data type to unpack: ${toJson(dataType)}`,
-      );
-    }
+): readonly PrimaryDataTypeMemoryObjectDetails[] {
+  const canonicalDataType = internDataType(dataType);
+  if (typeof canonicalDataType.primaryObjects === "undefined") {
+    canonicalDataType.primaryObjects = calculatePrimaryObjects(dataType);
   }
-  recursiveHelper(dataType);
-  return memoryObjects;
+  return canonicalDataType.primaryObjects;
 }
 
-/**
- * Returns the number of primary objects that compose a data type.
- */
-function getDataTypeNumberOfPrimaryObjects(dataType: DataType): number {
-  if (
-    dataType.type === "primary" ||
-    dataType.type === "pointer" ||
-    dataType.type === "enum"
-  ) {
-    return 1;
+function calculatePrimaryObjects(
+  dataType: DataType,
+): PrimaryDataTypeMemoryObjectDetails[] {
+  if (dataType.type === "primary") {
+    return [{ dataType: dataType.primaryDataType, offset: 0 }];
+  } else if (dataType.type === "pointer") {
+    return [{ dataType: "pointer", offset: 0 }];
+  } else if (dataType.type === "enum") {
+    return [{ dataType: ENUM_DATA_TYPE, offset: 0 }];
   } else if (dataType.type === "array") {
-    try {
-      const numElementsConstant = evaluateCompileTimeExpression(
-        dataType.numElements,
-      );
-      if (numElementsConstant.type === "FloatConstant") {
-        throw new ProcessingError("array size must be an integer-type");
+    const memoryObjects: PrimaryDataTypeMemoryObjectDetails[] = [];
+    const elementObjects = unpackDataType(dataType.elementDataType);
+    const elementSize = getDataTypeSize(dataType.elementDataType);
+    const numElements = getNumberOfElementsInArray(dataType);
+    for (let i = 0; i < numElements; ++i) {
+      for (const elementObject of elementObjects) {
+        memoryObjects.push({
+          dataType: elementObject.dataType,
+          offset: i * elementSize + elementObject.offset,
+        });
       }
-      return (
-        getDataTypeNumberOfPrimaryObjects(dataType.elementDataType) *
-        Number(numElementsConstant.value)
-      );
-    } catch (e) {
-      if (e instanceof ProcessingError) {
-        throw new ProcessingError(
-          "array size must be compile-time constant expression (Variable Length Arrays not supported)",
-        );
+    }
+    return memoryObjects;
+  } else if (dataType.type === "struct") {
+    const memoryObjects: PrimaryDataTypeMemoryObjectDetails[] = [];
+    let currOffset = 0;
+    for (const field of dataType.fields) {
+      if (field.dataType.type === "struct self pointer") {
+        // pointer to the struct itself
+        memoryObjects.push({ dataType: "pointer", offset: currOffset });
+        currOffset += POINTER_SIZE;
       } else {
-        throw e;
+        for (const fieldObject of unpackDataType(field.dataType)) {
+          memoryObjects.push({
+            dataType: fieldObject.dataType,
+            offset: currOffset + fieldObject.offset,
+          });
+        }
+        currOffset += getDataTypeSize(field.dataType);
       }
     }
-  } else if (dataType.type === "struct") {
-    return dataType.fields.reduce(
-      (sum, field) =>
-        sum +
-        (field.dataType.type === "struct self pointer"
-          ? 1
-          : getDataTypeNumberOfPrimaryObjects(field.dataType)),
-      0,
-    );
+    return memoryObjects;
   } else {
+    // should not happen
     throw new Error(
-      `getDataTypeNumberOfPrimaryObjects(): unhandled data type: ${toJson(
-        dataType,
-      )}`,
+      `unpackDataType(): Invalid data type to unpack: ${toJson(dataType)}`,
     );
   }
 }
@@ -472,7 +464,7 @@ export function determineIndexAndDataTypeOfFieldInStruct(
     currIndex +=
       field.dataType.type === "struct self pointer"
         ? 1
-        : getDataTypeNumberOfPrimaryObjects(field.dataType);
+        : unpackDataType(field.dataType).length;
   }
   throw new ProcessingError(
     `struct${
@@ -530,6 +522,29 @@ export function convertFunctionDataTypeToFunctionDetails(
   return functionDetails;
 }
 
+/**
+ * Returns the function details of a particular call of a variadic function.
+ * The variadic arguments are placed in the stack frame right after the parameters, in the same way as parameters are.
+ * @param variadicArgDataTypes data types of the variadic arguments (after default argument promotions)
+ */
+export function addVariadicArgsToFunctionDetails(
+  functionDetails: FunctionDetails,
+  variadicArgDataTypes: ScalarCDataType[],
+): FunctionDetails {
+  const callFunctionDetails: FunctionDetails = {
+    ...functionDetails,
+    parameters: [...functionDetails.parameters],
+  };
+  let offset = -functionDetails.sizeOfParams;
+  for (const dataType of variadicArgDataTypes) {
+    const dataTypeSize = getSizeOfScalarDataType(dataType);
+    offset -= dataTypeSize;
+    callFunctionDetails.sizeOfParams += dataTypeSize;
+    callFunctionDetails.parameters.push({ dataType, offset });
+  }
+  return callFunctionDetails;
+}
+
 export function isNullPointerConstant(expr: ExpressionWrapperP) {
   return (
     expr.exprs[0].type === "IntegerConstant" &&
@@ -626,3 +641,28 @@ export function getIntegerPromotedDataType(dataType: DataType): DataType {
   }
   return dataType;
 }
+
+/**
+ * Returns the scalar data type that an argument of given data type is converted to when passed as a variadic argument.
+ * Follows the default argument promotions in 6.5.2.2/6 of C17 standard.
+ */
+export function getDefaultArgumentPromotedDataType(
+  dataType: DataType,
+): ScalarCDataType {
+  if (dataType.type === "pointer") {
+    return "pointer";
+  }
+  if (dataType.type === "enum") {
+    return ENUM_DATA_TYPE;
+  }
+  if (dataType.type === "primary") {
+    if (dataType.primaryDataType === "float") {
+      return "double";
+    }
+    return (getIntegerPromotedDataType(dataType) as PrimaryDataType)
+      .primaryDataType;
+  }
+  throw new ProcessingError(
+    `cannot pass '${stringifyDataType(dataType)}' as a variadic argument`,
+  );
+}
@@ -11,24 +11,29 @@ import ModuleRepository, { ModuleName } from "~src/modules";
 import { ProcessingError } from "~src/errors";
 import { Warning, clearWarnings, warnings } from "~src/processor/warningUtil";
 import { resetProcessorAuxInfo } from "~src/processor/processBlockItem";
+import { IdentifierTable } from "~src/common/scopedSymbolTable";
+import { clearDataTypeTable } from "~src/processor/dataTypeTable";
 
 /**
  * Processes the C AST tree generated by parsing, to add additional needed information for certain nodes.
  * @param ast
  * @param sourceCode
+ * @param identifiers the identifiers interned by the lexer (see ParserOutput), so that they are not interned again.
  * @returns { astRootNode: root node of processed C AST, includedModules: list of all modules included in the C program}
  */
 export default function process(
   ast: CAstRoot,
   moduleRepository: ModuleRepository,
+  identifiers?: IdentifierTable,
 ): {
   astRootNode: CAstRootP;
   includedModules: ModuleName[];
   warnings: Warning[];
 } {
   clearWarnings();
+  clearDataTypeTable();
   const includedModules: ModuleName[] = [];
-  const symbolTable = new SymbolTable();
+  const symbolTable = new SymbolTable(null, identifiers);
   const processedExternalFunctions = symbolTable.setExternalFunctions(
     ast.includedModules,
     moduleRepository,
@@ -58,6 +58,7 @@ function processLoopBody(
  * This function is to be used to process any node that is used in a context where it is expected to correspond
  * to a statement - i.e an action that occurs.
  * Thus it can process Expression types as well, specifically expressions which have side effects.
+ * The first processed statement of each C statement is given the position of the C statement.
  * @param ast
  * @param sourceCode
  */
@@ -65,6 +66,23 @@ export default function processBlockItem(
   node: BlockItem,
   symbolTable: SymbolTable,
   enclosingFunc: FunctionDefinitionP,
+): StatementP[] {
+  const statements = processBlockItemNode(node, symbolTable, enclosingFunc);
+  // the statements of a block already have the positions of the statements in the block
+  if (
+    node.type !== "Block" &&
+    statements.length > 0 &&
+    typeof statements[0].position === "undefined"
+  ) {
+    statements[0].position = node.position;
+  }
+  return statements;
+}
+
+function processBlockItemNode(
+  node: BlockItem,
+  symbolTable: SymbolTable,
+  enclosingFunc: FunctionDefinitionP,
 ): StatementP[] {
   try {
     if (node.type === "Block") {
@@ -81,6 +99,7 @@ export default function processBlockItem(
           statements.push(result);
         }
       });
+      blockSymbolTable.exitScope();
       return statements;
     } else if (node.type === "ForLoop") {
       let clause: StatementP[];
@@ -121,6 +140,9 @@ export default function processBlockItem(
             : [],
         body: processLoopBody(node.body, forLoopSymbolTable, enclosingFunc),
       };
+      if (forLoopSymbolTable !== symbolTable) {
+        forLoopSymbolTable.exitScope();
+      }
 
       return [processedForLoopNode];
     } else if (node.type === "DoWhileLoop" || node.type === "WhileLoop") {
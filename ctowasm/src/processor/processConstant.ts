@@ -109,7 +109,8 @@ function getCappedIntegerValue(value: bigint, dataType: IntegerDataType) {
   if (value > 0) {
     if (isUnsignedIntegerType(dataType)) {
       return (
-        value % getMaxValueOfUnsignedIntType(dataType as UnsignedIntegerType)
+        value %
+        (getMaxValueOfUnsignedIntType(dataType as UnsignedIntegerType) + 1n)
       );
     } else {
       return handlePositiveSignedIntegerOverflow(
@@ -10,6 +10,7 @@ import { FunctionDefinitionP } from "~src/processor/c-ast/function";
 import {
   checkAssignability,
   getDataTypeSize,
+  getNumberOfElementsInArray,
   isFloatDataType,
   isScalarDataType,
   stringifyDataType,
@@ -317,9 +318,7 @@ export function unpackLocalVariableInitializerAccordingToDataType(
       if (initializer.type === "InitializerSingle") {
         throw new ProcessingError("invalid initializer for aggregate type");
       }
-      const numElements = evaluateCompileTimeExpression(
-        dataType.numElements,
-      ).value;
+      const numElements = getNumberOfElementsInArray(dataType);
       for (let i = 0; i < numElements; i++) {
         if (
           dataType.elementDataType.type === "pointer" ||
@@ -579,9 +578,7 @@ export function unpackDataSegmentInitializerAccordingToDataType(
       if (initializer.type === "InitializerSingle") {
         throw new ProcessingError("invalid initializer for aggregate type");
       }
-      const numElements = evaluateCompileTimeExpression(
-        dataType.numElements,
-      ).value;
+      const numElements = getNumberOfElementsInArray(dataType);
       for (let i = 0; i < numElements; i++) {
         if (
           dataType.elementDataType.type === "pointer" ||
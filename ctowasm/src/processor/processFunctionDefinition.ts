@@ -8,6 +8,7 @@ import { ExpressionP, StatementP } from "~src/processor/c-ast/core";
 import {
   FunctionCallP,
   FunctionDefinitionP,
+  FunctionDetails,
 } from "~src/processor/c-ast/function";
 import { FunctionSymbolEntry, SymbolTable } from "~src/processor/symbolTable";
 import processExpression from "~src/processor/processExpression";
@@ -21,8 +22,10 @@ import processBlockItem from "~src/processor/processBlockItem";
 import { FunctionCall } from "~src/parser/c-ast/expression/unaryExpression";
 import { getSizeOfScalarDataType } from "~src/common/utils";
 import {
+  addVariadicArgsToFunctionDetails,
   checkAssignability,
   convertFunctionDataTypeToFunctionDetails,
+  getDefaultArgumentPromotedDataType,
   stringifyDataType,
 } from "~src/processor/dataTypeUtil";
 import { DataType, FunctionDataType } from "~src/parser/c-ast/dataTypes";
@@ -64,6 +67,7 @@ export default function processFunctionDefinition(
     functionDefinitionNode,
   );
   functionDefinitionNode.body = body; // body is a Block, an array of StatementP will be returned
+  funcSymbolTable.exitScope();
   return functionDefinitionNode;
 }
 
@@ -131,6 +135,13 @@ export function convertFunctionCallToFunctionCallP(
       node.expr.name,
     ) as FunctionSymbolEntry;
 
+    const { args, functionDetails } = processFunctionCallArgs(
+      node.args,
+      symbolEntry.dataType,
+      symbolEntry.functionDetails,
+      symbolTable,
+    );
+
     return {
       functionCallP: {
         type: "FunctionCall",
@@ -138,12 +149,8 @@ export function convertFunctionCallToFunctionCallP(
           type: "DirectlyCalledFunction",
           functionName: node.expr.name,
         },
-        functionDetails: symbolEntry.functionDetails,
-        args: processFunctionCallArgs(
-          node.args,
-          symbolEntry.dataType,
-          symbolTable,
-        ),
+        functionDetails,
+        args,
       },
       returnType: symbolEntry.dataType.returnType,
     };
@@ -160,6 +167,13 @@ export function convertFunctionCallToFunctionCallP(
   const functionDataType =
     extractFunctionDataTypeFromFunctionPointer(dataTypeOfCalledExpr);
 
+  const { args, functionDetails } = processFunctionCallArgs(
+    node.args,
+    functionDataType,
+    convertFunctionDataTypeToFunctionDetails(functionDataType),
+    symbolTable,
+  );
+
   return {
     returnType: functionDataType.returnType,
     functionCallP: {
@@ -168,18 +182,23 @@ export function convertFunctionCallToFunctionCallP(
         type: "IndirectlyCalledFunction",
         functionAddress: processedCalledExpr.exprs[0],
       },
-      functionDetails:
-        convertFunctionDataTypeToFunctionDetails(functionDataType),
-      args: processFunctionCallArgs(node.args, functionDataType, symbolTable),
+      functionDetails,
+      args,
     },
   };
 }
 
+/**
+ * Processes the args of a function call.
+ * Returns the function details to use for this particular call, which only differ from the given function details
+ * when the function is variadic (the variadic args are appended as extra parameters).
+ */
 function processFunctionCallArgs(
   args: Expression[],
   fnDataType: FunctionDataType,
+  fnDetails: FunctionDetails,
   symbolTable: SymbolTable,
-): ExpressionP[] {
+): { args: ExpressionP[]; functionDetails: FunctionDetails } {
   const argExpressions = [];
   const argExpressionWrappers: ExpressionWrapperP[] = [];
   for (const arg of args) {
@@ -191,7 +210,30 @@ function processFunctionCallArgs(
   }
 
   checkFunctionCallArgsAreCompatible(fnDataType, argExpressionWrappers);
-  return argExpressions;
+
+  if (!fnDataType.isVariadic) {
+    return { args: argExpressions, functionDetails: fnDetails };
+  }
+
+  // the variadic args undergo default argument promotions and are passed after the named params
+  const variadicArgDataTypes = argExpressionWrappers
+    .slice(fnDataType.parameters.length)
+    .map((expr) =>
+      getDefaultArgumentPromotedDataType(
+        getDataTypeOfExpression({
+          expression: expr,
+          convertArrayToPointer: true,
+          convertFunctionToPointer: true,
+        }),
+      ),
+    );
+  return {
+    args: argExpressions,
+    functionDetails: addVariadicArgsToFunctionDetails(
+      fnDetails,
+      variadicArgDataTypes,
+    ),
+  };
 }
 
 /**
@@ -204,12 +246,16 @@ function checkFunctionCallArgsAreCompatible(
   fnDataType: FunctionDataType,
   args: ExpressionWrapperP[],
 ) {
-  if (args.length != fnDataType.parameters.length) {
+  if (
+    fnDataType.isVariadic
+      ? args.length < fnDataType.parameters.length
+      : args.length != fnDataType.parameters.length
+  ) {
     throw new ProcessingError(
       "number of arguments provided to function call does not match number of parameters specfied in prototype",
     );
   }
-  for (let i = 0; i < args.length; ++i) {
+  for (let i = 0; i < fnDataType.parameters.length; ++i) {
     if (!checkAssignability(fnDataType.parameters[i], args[i])) {
       throw new ProcessingError(
         `cannot assign function call argument to parameter\nFunction parameter type: "${stringifyDataType(
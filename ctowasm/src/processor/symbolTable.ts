@@ -11,6 +11,9 @@ import {
 import ModuleRepository, { ModuleName } from "~src/modules";
 import { unpackDataSegmentInitializerAccordingToDataType } from "~src/processor/processDeclaration";
 import { convertIntegerToByteString } from "~src/processor/byteStrUtil";
+import ScopedSymbolTable, {
+  IdentifierTable,
+} from "~src/common/scopedSymbolTable";
 
 /**
  * Definition of symbol table used by processor and semantic analyser
@@ -50,6 +53,11 @@ export interface FunctionTableEntry {
   isDefined: boolean; // whether the given function has been defined
 }
 
+/**
+ * A scope of the program. All the scopes share a single ScopedSymbolTable, so looking up a symbol does not walk the
+ * enclosing scopes. Creating a SymbolTable with a parent enters a new scope, and exitScope() must be called once the
+ * scope has been processed, before its parent is used again.
+ */
 export class SymbolTable {
   parentTable: SymbolTable | null;
   currOffset: { value: number }; // current offset saved as "value" in an object. Used to make it sharable as a reference across tables
@@ -57,13 +65,19 @@ export class SymbolTable {
   dataSegmentOffset: { value: number }; // the current offset at data segment (address of next allocated data segment object)
   functionTable: FunctionTableEntry[]; // list of all functions declared in the program in one table
   functionTableIndexes: Record<string, number>; // map function name to index in functionTable for fast lookup
-  symbols: Record<string, SymbolEntry>;
+  symbols: ScopedSymbolTable<SymbolEntry>; // symbols of this scope and all its enclosing scopes
   externalFunctions: Record<string, FunctionSymbolEntry>;
 
-  constructor(parentTable?: SymbolTable | null) {
-    this.symbols = {};
-
+  /**
+   * @param identifiers the identifiers interned by the lexer, for the global scope.
+   */
+  constructor(
+    parentTable?: SymbolTable | null,
+    identifiers?: IdentifierTable,
+  ) {
     if (parentTable) {
+      this.symbols = parentTable.symbols;
+      this.symbols.enterScope();
       this.externalFunctions = parentTable.externalFunctions;
       this.parentTable = parentTable;
       this.dataSegmentByteStr = parentTable.dataSegmentByteStr;
@@ -71,6 +85,7 @@ export class SymbolTable {
       this.functionTable = parentTable.functionTable;
       this.functionTableIndexes = parentTable.functionTableIndexes;
     } else {
+      this.symbols = new ScopedSymbolTable(identifiers);
       this.externalFunctions = {};
       this.parentTable = null;
       // Initial value to reserve for the null space
@@ -91,6 +106,13 @@ export class SymbolTable {
     }
   }
 
+  /**
+   * Removes the symbols declared in this scope, uncovering the symbols of enclosing scopes that they shadowed.
+   */
+  exitScope() {
+    this.symbols.exitScope();
+  }
+
   /**
    * Add all the functions of imoprted modules to global scope.
    */
@@ -152,7 +174,7 @@ export class SymbolTable {
       dataType: { type: "primary", primaryDataType: ENUM_DATA_TYPE },
       value: enumeratorValue,
     };
-    this.symbols[enumeratorName] = entry;
+    this.symbols.declare(enumeratorName, entry);
     return entry;
   }
 
@@ -179,13 +201,13 @@ export class SymbolTable {
     dataType: DataType,
     storageClass: "auto" | "static",
   ): VariableSymbolEntry {
-    if (name in this.symbols) {
+    const symbolEntry = this.symbols.lookupInCurrentScope(name);
+    if (typeof symbolEntry !== "undefined") {
       // given variable already exists in given scope
       // multiple declarations only allowed outside of function bodies
       if (this.parentTable !== null) {
         throw new ProcessingError(`redeclaration of ${name}`);
       }
-      const symbolEntry = this.symbols[name];
       if (
         symbolEntry.type === "function" ||
         symbolEntry.type === "enumerator"
@@ -200,7 +222,7 @@ export class SymbolTable {
           )}" instead of ${stringifyDataType(symbolEntry.dataType)}`,
         ); //TODO: stringify there datatype in english instead of just printing json
       }
-      return this.symbols[name] as VariableSymbolEntry;
+      return symbolEntry;
     }
 
     let entry: SymbolEntry;
@@ -234,7 +256,7 @@ export class SymbolTable {
         );
       }
     }
-    this.symbols[name] = entry;
+    this.symbols.declare(name, entry);
     return entry;
   }
 
@@ -243,16 +265,19 @@ export class SymbolTable {
     dataType: FunctionDataType,
     isExternalFunction?: boolean,
   ): FunctionSymbolEntry {
-    if (!isExternalFunction && name in this.symbols) {
+    const symbolEntry = isExternalFunction
+      ? undefined
+      : this.symbols.lookupInCurrentScope(name);
+    if (typeof symbolEntry !== "undefined") {
       // function was already declared before
       // simple check that symbol is a function and the params and return types match
-      if (this.symbols[name].type !== "function") {
+      if (symbolEntry.type !== "function") {
         throw new ProcessingError(
           `redeclaration of ${name} as different kind of symbol: function instead of variable`,
         );
       }
 
-      return this.symbols[name] as FunctionSymbolEntry;
+      return symbolEntry;
     }
 
     const entry: FunctionSymbolEntry = {
@@ -264,7 +289,7 @@ export class SymbolTable {
     if (isExternalFunction) {
       this.externalFunctions[name] = entry;
     } else {
-      this.symbols[name] = entry;
+      this.symbols.declare(name, entry);
     }
 
     this.functionTable.push({
@@ -277,30 +302,19 @@ export class SymbolTable {
   }
 
   hasSymbol(name: string): boolean {
-    let curr: SymbolTable | null = this;
-    while (curr !== null) {
-      if (name in curr.symbols) {
-        return true;
-      }
-      curr = curr.parentTable;
-    }
-
-    if (name in this.externalFunctions) {
-      return true;
-    }
-    return false;
+    return (
+      typeof this.symbols.lookup(name) !== "undefined" ||
+      name in this.externalFunctions
+    );
   }
 
   /**
-   * Look up the symbol starting from the lowest symbol table (most recent).
+   * Look up the symbol in the innermost scope that declares it.
    */
   getSymbolEntry(name: string): SymbolEntry {
-    let curr: SymbolTable | null = this;
-    while (curr !== null) {
-      if (name in curr.symbols) {
-        return curr.symbols[name];
-      }
-      curr = curr.parentTable;
+    const symbolEntry = this.symbols.lookup(name);
+    if (typeof symbolEntry !== "undefined") {
+      return symbolEntry;
     }
 
     if (name in this.externalFunctions) {
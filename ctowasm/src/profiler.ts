@@ -0,0 +1,203 @@
+/**
+ * Function-level profiler for programs compiled with the profile option (see src/translator/profiling.ts).
+ *
+ * Usage:
+ *   const result = await compile(program, undefined, { profile: true });
+ *   const profiler = new Profiler(result.profiledFunctionNames);
+ *   await runWasm(..., { printFunction, profiler });
+ *   profiler.getFlatProfile(); profiler.getCallGraphProfile();
+ *
+ * Calls are timed with the given clock, performance.now() by default. Any other monotonic counter can be used instead.
+ */
+
+export interface FlatProfileEntry {
+  name: string;
+  calls: number;
+  inclusiveTime: number; // time spent in the function and the functions it calls
+  exclusiveTime: number; // time spent in the function itself
+  exclusivePercentage: number; // of the total time of the program
+}
+
+export interface CallGraphProfileEntry {
+  caller: string | null; // null for the entry point of the program
+  callee: string;
+  calls: number;
+  inclusiveTime: number; // time spent in the callee (and the functions it calls) when called by the caller
+}
+
+const INITIAL_CALL_STACK_SIZE = 256;
+const NO_CALLER = -1;
+
+export default class Profiler {
+  functionNames: string[];
+  private clock: () => number;
+  private calls: Float64Array;
+  private inclusiveTimes: Float64Array;
+  private exclusiveTimes: Float64Array;
+  // number of currently running calls of each function, so that the inclusive time of recursive calls is only counted once
+  private activeCalls: Uint32Array;
+  // keyed by (caller index + 1) * number of functions + callee index
+  private callGraphEdges: Map<number, { calls: number; inclusiveTime: number }> =
+    new Map();
+
+  // shadow call stack of the running calls
+  private callStackSize = 0;
+  private callStackFunctions: Int32Array = new Int32Array(
+    INITIAL_CALL_STACK_SIZE,
+  );
+  private callStackStartTimes: Float64Array = new Float64Array(
+    INITIAL_CALL_STACK_SIZE,
+  );
+  private callStackChildTimes: Float64Array = new Float64Array(
+    INITIAL_CALL_STACK_SIZE,
+  );
+
+  constructor(functionNames: string[] = [], clock?: () => number) {
+    this.functionNames = functionNames;
+    this.clock = clock ?? (() => performance.now());
+    this.calls = new Float64Array(functionNames.length);
+    this.inclusiveTimes = new Float64Array(functionNames.length);
+    this.exclusiveTimes = new Float64Array(functionNames.length);
+    this.activeCalls = new Uint32Array(functionNames.length);
+  }
+
+  /**
+   * Called in the prologue of the function with given index.
+   */
+  enter(functionIndex: number) {
+    if (this.callStackSize === this.callStackFunctions.length) {
+      this.growCallStack();
+    }
+    const i = this.callStackSize++;
+    this.callStackFunctions[i] = functionIndex;
+    this.callStackChildTimes[i] = 0;
+    ++this.calls[functionIndex];
+    ++this.activeCalls[functionIndex];
+    // read last, so that the bookkeeping above is not timed
+    this.callStackStartTimes[i] = this.clock();
+  }
+
+  /**
+   * Called in the epilogue of the function with given index.
+   */
+  exit(functionIndex: number) {
+    const endTime = this.clock();
+    if (
+      this.callStackSize === 0 ||
+      this.callStackFunctions[this.callStackSize - 1] !== functionIndex
+    ) {
+      throw new Error(
+        `Profiler: exit of function "${this.functionNames[functionIndex]}" does not match the call stack`,
+      );
+    }
+    this.closeCall(endTime);
+  }
+
+  /**
+   * Returns the functions that were called, sorted by exclusive time, highest first.
+   */
+  getFlatProfile(): FlatProfileEntry[] {
+    this.closeRunningCalls();
+    let totalTime = 0;
+    for (let i = 0; i < this.exclusiveTimes.length; ++i) {
+      totalTime += this.exclusiveTimes[i];
+    }
+    const entries: FlatProfileEntry[] = [];
+    this.functionNames.forEach((name, i) => {
+      if (this.calls[i] > 0) {
+        entries.push({
+          name,
+          calls: this.calls[i],
+          inclusiveTime: this.inclusiveTimes[i],
+          exclusiveTime: this.exclusiveTimes[i],
+          exclusivePercentage:
+            totalTime > 0 ? (this.exclusiveTimes[i] / totalTime) * 100 : 0,
+        });
+      }
+    });
+    return entries.sort((a, b) => b.exclusiveTime - a.exclusiveTime);
+  }
+
+  /**
+   * Returns each caller-callee pair of functions, sorted by inclusive time, highest first.
+   */
+  getCallGraphProfile(): CallGraphProfileEntry[] {
+    this.closeRunningCalls();
+    const numberOfFunctions = this.functionNames.length;
+    const entries: CallGraphProfileEntry[] = [];
+    for (const [key, edge] of this.callGraphEdges) {
+      const callerIndex = Math.floor(key / numberOfFunctions) - 1;
+      const calleeIndex = key % numberOfFunctions;
+      entries.push({
+        caller:
+          callerIndex === NO_CALLER ? null : this.functionNames[callerIndex],
+        callee: this.functionNames[calleeIndex],
+        calls: edge.calls,
+        inclusiveTime: edge.inclusiveTime,
+      });
+    }
+    return entries.sort((a, b) => b.inclusiveTime - a.inclusiveTime);
+  }
+
+  reset() {
+    this.calls.fill(0);
+    this.inclusiveTimes.fill(0);
+    this.exclusiveTimes.fill(0);
+    this.activeCalls.fill(0);
+    this.callGraphEdges.clear();
+    this.callStackSize = 0;
+  }
+
+  /**
+   * Ends the call at the top of the call stack at the given time.
+   */
+  private closeCall(endTime: number) {
+    const i = --this.callStackSize;
+    const functionIndex = this.callStackFunctions[i];
+    const elapsedTime = endTime - this.callStackStartTimes[i];
+    this.exclusiveTimes[functionIndex] +=
+      elapsedTime - this.callStackChildTimes[i];
+    if (--this.activeCalls[functionIndex] === 0) {
+      this.inclusiveTimes[functionIndex] += elapsedTime;
+    }
+    const callerIndex = i > 0 ? this.callStackFunctions[i - 1] : NO_CALLER;
+    if (i > 0) {
+      this.callStackChildTimes[i - 1] += elapsedTime;
+    }
+    // offset by 1 so that NO_CALLER maps to a non-negative key
+    const key = (callerIndex + 1) * this.functionNames.length + functionIndex;
+    const edge = this.callGraphEdges.get(key);
+    if (typeof edge === "undefined") {
+      this.callGraphEdges.set(key, { calls: 1, inclusiveTime: elapsedTime });
+    } else {
+      ++edge.calls;
+      edge.inclusiveTime += elapsedTime;
+    }
+  }
+
+  /**
+   * Ends the calls that never exited, e.g. because the program trapped or ran out of fuel.
+   */
+  private closeRunningCalls() {
+    if (this.callStackSize === 0) {
+      return;
+    }
+    const endTime = this.clock();
+    while (this.callStackSize > 0) {
+      this.closeCall(endTime);
+    }
+  }
+
+  private growCallStack() {
+    const size = this.callStackFunctions.length * 2;
+    const functions = new Int32Array(size);
+    functions.set(this.callStackFunctions);
+    this.callStackFunctions = functions;
+    const startTimes = new Float64Array(size);
+    startTimes.set(this.callStackStartTimes);
+    this.callStackStartTimes = startTimes;
+    const childTimes = new Float64Array(size);
+    childTimes.set(this.callStackChildTimes);
+    this.callStackChildTimes = childTimes;
+  }
+}
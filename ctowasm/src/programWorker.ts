@@ -0,0 +1,114 @@
+/**
+ * The worker side of running programs off the calling thread (see workerRun.ts).
+ * Runs the program it is sent, writing its output to the shared output ring buffer, and reports when it has finished.
+ *
+ * A worker script only needs to call startProgramWorker with the port of the worker, e.g. in a browser worker:
+ *   startProgramWorker(browserProgramWorkerPort(self));
+ * or in a Node.js worker thread:
+ *   startProgramWorker(nodeProgramWorkerPort(parentPort));
+ *
+ * The threads of programs compiled with the threads option run in other workers running the same script, which the
+ * worker asks the host to start (see the spawnThreadWorker option of WorkerRun and threadsRun.ts).
+ */
+
+import { runWasm } from "~src/runWasm";
+import { OutputRingBufferWriter } from "~src/modules/outputRingBuffer";
+import {
+  ProgramWorkerRequest,
+  ProgramWorkerResponse,
+} from "~src/workerRun";
+import {
+  ThreadWorkerRequester,
+  runThread,
+  runThreadedProgram,
+} from "~src/threadsRun";
+
+/**
+ * The interface the worker uses to talk to the host.
+ */
+export interface ProgramWorkerPort {
+  postMessage(message: ProgramWorkerResponse): void;
+  setMessageHandler(handler: (message: ProgramWorkerRequest) => void): void;
+}
+
+/**
+ * Adapts the global scope of a browser Worker.
+ */
+export function browserProgramWorkerPort(scope: {
+  postMessage(message: unknown): void;
+  onmessage: ((event: MessageEvent) => void) | null;
+}): ProgramWorkerPort {
+  return {
+    postMessage: (message) => scope.postMessage(message),
+    setMessageHandler: (handler) => {
+      scope.onmessage = (event) => handler(event.data);
+    },
+  };
+}
+
+/**
+ * Adapts the parentPort of a Node.js worker thread.
+ */
+export function nodeProgramWorkerPort(parentPort: {
+  postMessage(message: unknown): void;
+  on(event: "message", listener: (message: never) => void): unknown;
+}): ProgramWorkerPort {
+  return {
+    postMessage: (message) => parentPort.postMessage(message),
+    setMessageHandler: (handler) => {
+      parentPort.on("message", handler);
+    },
+  };
+}
+
+function getErrorMessage(e: unknown) {
+  return e instanceof Error ? e.message : String(e);
+}
+
+export function startProgramWorker(port: ProgramWorkerPort) {
+  const requestThreadWorker: ThreadWorkerRequester = (request) =>
+    port.postMessage({ type: "thread", request });
+  port.setMessageHandler(async (message) => {
+    if (message.type === "thread") {
+      try {
+        await runThread(message, requestThreadWorker);
+        port.postMessage({ type: "exit" });
+      } catch (e) {
+        port.postMessage({ type: "error", message: getErrorMessage(e) });
+      }
+      return;
+    }
+    if (message.type !== "run") {
+      return;
+    }
+    const { program, outputBuffer, modulesConfig } = message;
+    const outputWriter = new OutputRingBufferWriter(outputBuffer);
+    try {
+      const moduleRepository = program.threads
+        ? await runThreadedProgram(
+            program,
+            outputBuffer,
+            modulesConfig,
+            requestThreadWorker,
+          )
+        : await runWasm(
+            program.wasm,
+            program.dataSegmentSize,
+            program.functionTableSize,
+            program.importedModules,
+            {
+              ...modulesConfig,
+              printFunction: (str) => outputWriter.write(str),
+            },
+          );
+      port.postMessage({
+        type: "exit",
+        ...(typeof modulesConfig.fuelLimit !== "undefined"
+          ? { fuelUsed: Number(moduleRepository.getFuelUsed()) }
+          : {}),
+      });
+    } catch (e) {
+      port.postMessage({ type: "error", message: getErrorMessage(e) });
+    }
+  });
+}
@@ -0,0 +1,60 @@
+/**
+ * Running of compiled programs in the current thread.
+ * Kept apart from src/index.ts so that the worker sides of the filter pipeline and of WorkerRun can run programs
+ * without importing the whole package, which re-exports them.
+ */
+
+import ModuleRepository, {
+  ModuleName,
+  ModulesGlobalConfig,
+} from "~src/modules";
+import { calculateNumberOfPagesNeededForBytes } from "~src/common/utils";
+import { WASM_PAGE_SIZE } from "~src/translator/memoryUtil";
+import { getStdinBytes } from "~src/modules/source_stdlib/stdin";
+
+/**
+ * Runs a compiled program. Returns the module repository the program ran with,
+ * which remains usable for calling back into the program (e.g. an installed filter).
+ */
+export async function runWasm(
+  wasm: Uint8Array,
+  dataSegmentSize: number,
+  functionTableSize: number,
+  importedModules: ModuleName[],
+  modulesConfig?: ModulesGlobalConfig,
+): Promise<ModuleRepository> {
+  // the input read from "stdin" is placed between the data segment and the heap, in pages of its own, so that the
+  // heap and stack are left as much room as without input
+  const stdinAddress = Math.ceil(dataSegmentSize / 4) * 4;
+  const stdinBytes = getStdinBytes(modulesConfig?.stdin);
+  const numberOfInitialPagesNeeded =
+    calculateNumberOfPagesNeededForBytes(dataSegmentSize) +
+    (stdinBytes.length > 0
+      ? calculateNumberOfPagesNeededForBytes(stdinBytes.length)
+      : 0);
+  const moduleRepository = new ModuleRepository(
+    new WebAssembly.Memory({ initial: numberOfInitialPagesNeeded }),
+    new WebAssembly.Table({ element: "anyfunc", initial: functionTableSize }),
+    modulesConfig,
+  );
+  moduleRepository.setStackPointerValue(
+    numberOfInitialPagesNeeded * WASM_PAGE_SIZE,
+  );
+  moduleRepository.setBasePointerValue(
+    numberOfInitialPagesNeeded * WASM_PAGE_SIZE,
+  );
+  const stdinEnd = moduleRepository.loadStdin(stdinBytes, stdinAddress);
+  moduleRepository.setHeapPointerValue(Math.ceil(stdinEnd / 4) * 4); // align to 4 bytes
+
+  const wasmImports =
+    await moduleRepository.createWasmImportsObject(importedModules);
+  try {
+    const { instance } = await WebAssembly.instantiate(wasm, wasmImports);
+    moduleRepository.setProgramExports(instance.exports);
+  } finally {
+    // any output left in the stdout buffer is written out on program exit, even if the program trapped
+    moduleRepository.flushStdout();
+  }
+  moduleRepository.reportHeapLeaks();
+  return moduleRepository;
+}
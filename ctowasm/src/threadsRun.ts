@@ -0,0 +1,265 @@
+/**
+ * Running of programs compiled with the threads option (see src/translator/threads.ts), whose POSIX threads (see
+ * src/modules/pthread) run in parallel, each in its own worker.
+ *
+ * Threaded programs are run through WorkerRun like other programs, so that the main thread also runs in a worker,
+ * where it may block (e.g. in pthread_join). For each thread created by the program, the worker of the creating thread
+ * asks the host to start another worker running programWorker.ts. The host starts and watches the workers of all
+ * threads (see startThreadWorker), as a creating thread that is blocked cannot handle the events of its workers: if a
+ * worker fails before its thread has ended, the host marks the thread as failed so that its joiners are woken up.
+ * Every thread instantiates the same compiled program, importing the same shared memory, with its own sp and bp
+ * pointing into its own stack, and writes its output to the same output ring buffer.
+ *
+ * The shared memory holds the data segment, then the input read from "stdin" (which only the main thread reads), then
+ * the shared heap (see sharedHeap.ts), from which the control blocks and stacks of all threads are allocated as well
+ * as the blocks of malloc. The program ends when main returns, stopping any threads that are still running.
+ */
+
+import ModuleRepository from "~src/modules";
+import { OutputRingBufferWriter } from "~src/modules/outputRingBuffer";
+import SharedHeap, {
+  SHARED_HEAP_CONTROL_BLOCK_SIZE,
+} from "~src/modules/pthread/sharedHeap";
+import {
+  ThreadRegion,
+  ThreadRuntime,
+  allocateThread,
+  failThread,
+  finishThread,
+} from "~src/modules/pthread/threadControl";
+import { getStdinBytes } from "~src/modules/source_stdlib/stdin";
+import { getFunctionPtrTrampoline } from "~src/modules/stackFrameUtils";
+import { calculateNumberOfPagesNeededForBytes } from "~src/common/utils";
+import {
+  INIT_DATA_SEGMENT_FUNCTION,
+  MAIN_FUNCTION,
+  THREADS_MAXIMUM_MEMORY_PAGES,
+} from "~src/translator/threads";
+import {
+  CompiledProgram,
+  ProgramWorker,
+  ThreadWorkerRequest,
+  WorkerModulesConfig,
+} from "~src/workerRun";
+
+const MAIN_RETURN_VALUE_SIZE = 16; // room left above the stack frame of main for its return value
+
+/**
+ * Starts a worker running programWorker.ts, for a new thread (called on the host).
+ */
+export type ThreadWorkerSpawner = () => ProgramWorker;
+
+/**
+ * Asks the host to start a worker running the given thread (called in the worker of the creating thread).
+ */
+export type ThreadWorkerRequester = (request: ThreadWorkerRequest) => void;
+
+// the state of a running program that is shared by all its threads
+interface ThreadedProgramState {
+  program: CompiledProgram;
+  outputBuffer: SharedArrayBuffer;
+  modulesConfig: WorkerModulesConfig;
+  memory: WebAssembly.Memory;
+  heap: SharedHeap;
+  requestThreadWorker: ThreadWorkerRequester;
+}
+
+// start routines are of type void *(*)(void *)
+const startRoutineTrampoline = getFunctionPtrTrampoline(
+  ["pointer"],
+  ["pointer"],
+);
+
+function createThreadRuntime(
+  state: ThreadedProgramState,
+  threadId: number,
+): ThreadRuntime {
+  return {
+    heap: state.heap,
+    threadId,
+    createThread: (startRoutine, arg) => {
+      const thread = allocateThread(state.heap);
+      if (thread === null) {
+        return 0;
+      }
+      const request: ThreadWorkerRequest = {
+        type: "thread",
+        program: state.program,
+        outputBuffer: state.outputBuffer,
+        modulesConfig: state.modulesConfig,
+        memory: state.memory,
+        heapAddress: state.heap.controlBlockAddress,
+        thread,
+        startRoutine,
+        arg,
+      };
+      state.requestThreadWorker(request);
+      return thread.id;
+    },
+  };
+}
+
+/**
+ * Creates the module repository of a thread, whose stack grows down from the given stack pointer.
+ */
+function createThreadModuleRepository(
+  state: ThreadedProgramState,
+  thread: ThreadRegion,
+  stackPointer: number,
+): ModuleRepository {
+  const outputWriter = new OutputRingBufferWriter(state.outputBuffer);
+  const moduleRepository = new ModuleRepository(
+    state.memory,
+    new WebAssembly.Table({
+      element: "anyfunc",
+      initial: state.program.functionTableSize,
+    }),
+    {
+      ...state.modulesConfig,
+      printFunction: (str) => outputWriter.write(str),
+      threads: createThreadRuntime(state, thread.id),
+    },
+  );
+  moduleRepository.setStackPointerValue(stackPointer);
+  moduleRepository.setBasePointerValue(stackPointer);
+  // the stack check at the start of functions stops the stack at the heap pointer
+  moduleRepository.setHeapPointerValue(thread.stackBase);
+  return moduleRepository;
+}
+
+async function instantiateProgram(
+  state: ThreadedProgramState,
+  moduleRepository: ModuleRepository,
+): Promise<WebAssembly.Exports> {
+  const wasmImports = await moduleRepository.createWasmImportsObject(
+    state.program.importedModules,
+  );
+  const { instance } = await WebAssembly.instantiate(
+    state.program.wasm,
+    wasmImports,
+  );
+  moduleRepository.setProgramExports(instance.exports);
+  return instance.exports;
+}
+
+/**
+ * Runs the main thread of a program compiled with the threads option, on the calling thread, which must be allowed to
+ * block. Returns the module repository of the main thread.
+ * @param requestThreadWorker asks the host to start the workers of the threads the main thread creates.
+ */
+export async function runThreadedProgram(
+  program: CompiledProgram,
+  outputBuffer: SharedArrayBuffer,
+  modulesConfig: WorkerModulesConfig,
+  requestThreadWorker: ThreadWorkerRequester,
+): Promise<ModuleRepository> {
+  const stdinAddress = Math.ceil(program.dataSegmentSize / 4) * 4;
+  const stdinBytes = getStdinBytes(modulesConfig.stdin);
+  const heapAddress = Math.ceil((stdinAddress + stdinBytes.length) / 8) * 8;
+  // the memory is grown by the heap as needed, starting with the stack of the main thread
+  const memory = new WebAssembly.Memory({
+    initial: calculateNumberOfPagesNeededForBytes(
+      heapAddress + SHARED_HEAP_CONTROL_BLOCK_SIZE,
+    ),
+    maximum: THREADS_MAXIMUM_MEMORY_PAGES,
+    shared: true,
+  });
+  const heap = SharedHeap.create(memory, heapAddress);
+  const mainThread = allocateThread(heap);
+  if (mainThread === null) {
+    throw new Error("Not enough memory for the stack of the main thread");
+  }
+  const state: ThreadedProgramState = {
+    program,
+    outputBuffer,
+    modulesConfig,
+    memory,
+    heap,
+    requestThreadWorker,
+  };
+  const moduleRepository = createThreadModuleRepository(
+    state,
+    mainThread,
+    mainThread.stackTop - MAIN_RETURN_VALUE_SIZE,
+  );
+  moduleRepository.loadStdin(stdinBytes, stdinAddress);
+  try {
+    const exports = await instantiateProgram(state, moduleRepository);
+    (exports[INIT_DATA_SEGMENT_FUNCTION] as () => void)();
+    (exports[MAIN_FUNCTION] as () => void)();
+  } finally {
+    moduleRepository.flushStdout();
+  }
+  return moduleRepository;
+}
+
+/**
+ * Runs a thread created by pthread_create, on the calling thread, which must be allowed to block.
+ * Its joiners are woken up when it ends, whether its start routine returned or threw an error.
+ * @param requestThreadWorker asks the host to start the workers of the threads this thread creates.
+ */
+export async function runThread(
+  request: ThreadWorkerRequest,
+  requestThreadWorker: ThreadWorkerRequester,
+) {
+  const { memory, thread } = request;
+  const state: ThreadedProgramState = {
+    ...request,
+    heap: new SharedHeap(memory, request.heapAddress),
+    requestThreadWorker,
+  };
+  const moduleRepository = createThreadModuleRepository(
+    state,
+    thread,
+    thread.stackTop,
+  );
+  try {
+    await instantiateProgram(state, moduleRepository);
+    const [returnValue] = startRoutineTrampoline(
+      moduleRepository,
+      request.startRoutine,
+      [request.arg],
+    );
+    moduleRepository.flushStdout();
+    finishThread(memory, thread.id, Number(returnValue));
+  } catch (e) {
+    moduleRepository.flushStdout();
+    failThread(memory, thread.id);
+    throw e;
+  }
+}
+
+/**
+ * Starts a worker running the thread of the given request, on the host, which must not block. The worker is terminated
+ * once its thread has ended. If the worker fails before that (e.g. its script failed to load, or it exited), the thread
+ * is marked as failed, waking up its joiners. Returns a function that terminates the worker.
+ * @param onThreadWorkerRequest handles the requests of the thread for the workers of the threads it creates.
+ */
+export function startThreadWorker(
+  spawnWorker: ThreadWorkerSpawner,
+  request: ThreadWorkerRequest,
+  onThreadWorkerRequest: ThreadWorkerRequester,
+): () => void {
+  const worker = spawnWorker();
+  let hasEnded = false;
+  const endWorker = () => {
+    hasEnded = true;
+    worker.terminate();
+  };
+  worker.setMessageHandler((message) => {
+    if (message.type === "thread") {
+      onThreadWorkerRequest(message.request);
+    } else {
+      // runThread has already ended the thread, whether it finished or failed
+      endWorker();
+    }
+  });
+  worker.setFailureHandler(() => {
+    if (!hasEnded) {
+      failThread(request.memory, request.thread.id);
+      endWorker();
+    }
+  });
+  worker.postMessage(request);
+  return endWorker;
+}
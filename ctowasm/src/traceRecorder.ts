@@ -0,0 +1,454 @@
+/**
+ * Recorder of the execution trace of a program compiled with the trace option (see src/translator/tracing.ts), from
+ * which the state of the program at every step of its run can be reconstructed, e.g. to visualise the run.
+ *
+ * Usage:
+ *   const result = await compile(program, undefined, { trace: true });
+ *   const recorder = new TraceRecorder(result.traceSymbols);
+ *   await runWasm(..., { printFunction, tracer: recorder });
+ *   recorder.getFrame(step); for (const frame of recorder.frames()) { ... }
+ *
+ * Each event of the program (the start of a statement, or the entry or exit of a function) is a step, at which the
+ * registers are recorded. Memory is not copied in full at each step: only the ranges of bytes written since the
+ * previous step are, found from the log of the stores of the program (adjacent and overlapping writes are merged).
+ * A full copy of memory (a keyframe) is taken at the first step, every keyframeInterval steps after, and whenever
+ * memory has grown. The memory at a step is reconstructed by applying the writes of the steps after the keyframe
+ * before it, so reconstructing any step replays at most keyframeInterval steps.
+ * Functions imported from JS that write to memory directly (e.g. scanf, see writesMemory of ModuleFunction) do not log
+ * their writes, so after each call to one, memory is compared with a copy of its state at the last step, and the
+ * changed bytes are recorded like logged writes.
+ *
+ * Recording stops, and the trace is marked as truncated, once the trace takes more than maxBytes, so that runs with
+ * any number of steps can be traced within a bounded amount of memory. This counts all the memory held by the
+ * recorder: the spare capacity of its arrays and the copy of memory as of the last step as well.
+ */
+
+import { SharedWasmGlobalVariables } from "~src/modules";
+import { Position } from "~src/parser/c-ast/misc";
+import { TraceSymbols } from "~src/translator/tracing";
+
+export type TraceEventKind = "statement" | "enter" | "exit";
+
+export interface TraceFrame {
+  step: number;
+  event: TraceEventKind;
+  position?: Position; // of the statement about to run, for statement events
+  functionName?: string; // of the function entered or exited, for enter and exit events
+  stackPointer: number;
+  basePointer: number;
+  heapPointer: number;
+  memory: Uint8Array; // the whole linear memory at the step
+}
+
+export interface TraceRecorderOptions {
+  keyframeInterval?: number; // the most steps between keyframes
+  maxBytes?: number; // the most bytes the trace may take, after which recording stops
+}
+
+const DEFAULT_KEYFRAME_INTERVAL = 4096;
+const DEFAULT_MAX_BYTES = 256 * 1024 * 1024;
+const EVENT_KINDS: TraceEventKind[] = ["statement", "enter", "exit"];
+const INITIAL_CAPACITY = 1024;
+// bytes taken by each step: the event kind and index, the registers, and the ends of its writes
+const BYTES_PER_STEP = 1 + 4 + 3 * 4 + 4 + 8;
+const BYTES_PER_WRITE = 2 * 4; // the address and length of each recorded (or pending) write
+
+function growUint32Array(array: Uint32Array, minLength: number): Uint32Array {
+  if (array.length >= minLength) {
+    return array;
+  }
+  const grown = new Uint32Array(Math.max(minLength, array.length * 2));
+  grown.set(array);
+  return grown;
+}
+
+export default class TraceRecorder {
+  symbols: TraceSymbols;
+  numberOfSteps = 0;
+  truncated = false; // whether recording stopped as the trace reached the most bytes it may take
+  private keyframeInterval: number;
+  private maxBytes: number;
+  private memory: WebAssembly.Memory | null = null;
+  private registers: SharedWasmGlobalVariables | null = null;
+
+  // each step
+  private eventKinds = new Uint8Array(INITIAL_CAPACITY);
+  private eventIndexes = new Uint32Array(INITIAL_CAPACITY);
+  private stepRegisters = new Uint32Array(3 * INITIAL_CAPACITY); // sp, bp and hp of each step
+  private stepWritesEnds = new Uint32Array(INITIAL_CAPACITY); // index just past the last write of each step
+  private stepBytesEnds = new Float64Array(INITIAL_CAPACITY); // offset just past the last written byte of each step
+
+  // the writes of all the steps, with their bytes stored one after another
+  private numberOfWrites = 0;
+  private writeAddresses = new Uint32Array(INITIAL_CAPACITY);
+  private writeLengths = new Uint32Array(INITIAL_CAPACITY);
+  private writtenBytesLength = 0;
+  private writtenBytes = new Uint8Array(INITIAL_CAPACITY);
+
+  private keyframeSteps: number[] = [];
+  private keyframes: Uint8Array[] = [];
+  private stepsSinceKeyframe = 0;
+  private keyframesByteLength = 0;
+  private needsKeyframe = true;
+  private lastMemory: Uint8Array | null = null; // copy of memory as of the last step and the writes recorded since
+
+  // writes logged since the last step, not yet recorded
+  private numberOfPendingWrites = 0;
+  private pendingAddresses = new Uint32Array(INITIAL_CAPACITY);
+  private pendingLengths = new Uint32Array(INITIAL_CAPACITY);
+
+  constructor(
+    symbols: TraceSymbols = { functionNames: [], statementPositions: [] },
+    options: TraceRecorderOptions = {},
+  ) {
+    this.symbols = symbols;
+    this.keyframeInterval =
+      options.keyframeInterval ?? DEFAULT_KEYFRAME_INTERVAL;
+    this.maxBytes = options.maxBytes ?? DEFAULT_MAX_BYTES;
+  }
+
+  /**
+   * Called when the program is instantiated, with the memory and registers it runs with.
+   */
+  attach(memory: WebAssembly.Memory, registers: SharedWasmGlobalVariables) {
+    this.memory = memory;
+    this.registers = registers;
+    this.needsKeyframe = true;
+  }
+
+  /**
+   * Called before each store to memory of the program.
+   */
+  recordWrite(address: number, length: number) {
+    if (this.truncated) {
+      return;
+    }
+    // consecutive writes to adjacent bytes (e.g. of the fields of a struct) are merged right away
+    const last = this.numberOfPendingWrites - 1;
+    if (
+      last >= 0 &&
+      address === this.pendingAddresses[last] + this.pendingLengths[last]
+    ) {
+      this.pendingLengths[last] += length;
+      return;
+    }
+    if (this.numberOfPendingWrites === this.pendingAddresses.length) {
+      this.pendingAddresses = growUint32Array(
+        this.pendingAddresses,
+        this.numberOfPendingWrites + 1,
+      );
+      this.pendingLengths = growUint32Array(
+        this.pendingLengths,
+        this.numberOfPendingWrites + 1,
+      );
+    }
+    this.pendingAddresses[this.numberOfPendingWrites] = address;
+    this.pendingLengths[this.numberOfPendingWrites] = length;
+    ++this.numberOfPendingWrites;
+  }
+
+  /**
+   * Called after each call of the program to a function imported from JS that writes to memory directly.
+   */
+  recordExternalCall() {
+    if (this.truncated || this.needsKeyframe || this.lastMemory === null) {
+      return;
+    }
+    const memoryBytes = this.getMemoryBytes();
+    if (memoryBytes.length !== this.lastMemory.length) {
+      // memory grew, which may have moved the stack
+      this.needsKeyframe = true;
+      return;
+    }
+    this.recordPendingWrites(memoryBytes);
+    // compare 4 bytes at a time, memory is always a whole number of pages
+    const words = new Uint32Array(
+      memoryBytes.buffer,
+      0,
+      memoryBytes.length / 4,
+    );
+    const lastWords = new Uint32Array(
+      this.lastMemory.buffer,
+      0,
+      this.lastMemory.length / 4,
+    );
+    let i = 0;
+    while (i < words.length) {
+      if (words[i] === lastWords[i]) {
+        ++i;
+        continue;
+      }
+      const start = i;
+      while (i < words.length && words[i] !== lastWords[i]) {
+        ++i;
+      }
+      this.recordWrittenBytes(memoryBytes, start * 4, i * 4);
+    }
+  }
+
+  /**
+   * Called on each event of the program, with the index of the statement or function of the event.
+   */
+  recordEvent(event: TraceEventKind, index: number) {
+    if (this.truncated) {
+      return;
+    }
+    if (this.getByteLength() > this.maxBytes) {
+      this.truncated = true;
+      this.numberOfPendingWrites = 0;
+      this.lastMemory = null;
+      return;
+    }
+    const memoryBytes = this.getMemoryBytes();
+    if (
+      this.needsKeyframe ||
+      this.lastMemory === null ||
+      memoryBytes.length !== this.lastMemory.length ||
+      this.stepsSinceKeyframe >= this.keyframeInterval
+    ) {
+      this.takeKeyframe(memoryBytes);
+    } else {
+      this.recordPendingWrites(memoryBytes);
+      ++this.stepsSinceKeyframe;
+    }
+
+    const step = this.numberOfSteps++;
+    if (step === this.eventKinds.length) {
+      this.growSteps();
+    }
+    this.eventKinds[step] = EVENT_KINDS.indexOf(event);
+    this.eventIndexes[step] = index;
+    const registers = this.registers as SharedWasmGlobalVariables;
+    this.stepRegisters[3 * step] = registers.stackPointer.value;
+    this.stepRegisters[3 * step + 1] = registers.basePointer.value;
+    this.stepRegisters[3 * step + 2] = registers.heapPointer.value;
+    this.stepWritesEnds[step] = this.numberOfWrites;
+    this.stepBytesEnds[step] = this.writtenBytesLength;
+  }
+
+  /**
+   * Returns the number of bytes held by the recorder, including the spare capacity of its arrays.
+   */
+  getByteLength(): number {
+    return (
+      this.eventKinds.length * BYTES_PER_STEP +
+      (this.writeAddresses.length + this.pendingAddresses.length) *
+        BYTES_PER_WRITE +
+      this.writtenBytes.length +
+      this.keyframesByteLength +
+      (this.lastMemory?.length ?? 0)
+    );
+  }
+
+  getNumberOfKeyframes(): number {
+    return this.keyframes.length;
+  }
+
+  /**
+   * Returns the state of the program at the given step.
+   */
+  getFrame(step: number): TraceFrame {
+    if (!Number.isInteger(step) || step < 0 || step >= this.numberOfSteps) {
+      throw new Error(
+        `TraceRecorder: step ${step} is out of range, ${this.numberOfSteps} steps were recorded`,
+      );
+    }
+    // the last keyframe at or before the step
+    let low = 0;
+    let high = this.keyframeSteps.length - 1;
+    while (low < high) {
+      const middle = Math.ceil((low + high) / 2);
+      if (this.keyframeSteps[middle] <= step) {
+        low = middle;
+      } else {
+        high = middle - 1;
+      }
+    }
+    const memory = this.keyframes[low].slice();
+    for (let s = this.keyframeSteps[low] + 1; s <= step; ++s) {
+      this.applyWrites(memory, s);
+    }
+    return this.createFrame(step, memory);
+  }
+
+  /**
+   * Returns the states of the program at each step from start up to (excluding) end, reconstructing each from the
+   * one before. All the frames share the same memory array, which is updated in place for each step, so it must be
+   * copied to be kept.
+   */
+  *frames(start = 0, end = this.numberOfSteps): Generator<TraceFrame> {
+    if (start >= end) {
+      return;
+    }
+    let memory = this.getFrame(start).memory;
+    let nextKeyframe = this.keyframeSteps.findIndex((s) => s > start);
+    for (let step = start; step < end; ++step) {
+      if (step > start) {
+        if (nextKeyframe !== -1 && this.keyframeSteps[nextKeyframe] === step) {
+          memory = this.keyframes[nextKeyframe].slice();
+          nextKeyframe =
+            nextKeyframe + 1 < this.keyframeSteps.length
+              ? nextKeyframe + 1
+              : -1;
+        } else {
+          this.applyWrites(memory, step);
+        }
+      }
+      yield this.createFrame(step, memory);
+    }
+  }
+
+  reset() {
+    this.numberOfSteps = 0;
+    this.truncated = false;
+    this.numberOfWrites = 0;
+    this.writtenBytesLength = 0;
+    this.keyframeSteps = [];
+    this.keyframes = [];
+    this.stepsSinceKeyframe = 0;
+    this.keyframesByteLength = 0;
+    this.needsKeyframe = true;
+    this.lastMemory = null;
+    this.numberOfPendingWrites = 0;
+  }
+
+  private getMemoryBytes(): Uint8Array {
+    if (this.memory === null) {
+      throw new Error(
+        "TraceRecorder: the recorder is not attached to a program, pass it as the tracer of the modules config",
+      );
+    }
+    return new Uint8Array(this.memory.buffer);
+  }
+
+  private createFrame(step: number, memory: Uint8Array): TraceFrame {
+    const event = EVENT_KINDS[this.eventKinds[step]];
+    const index = this.eventIndexes[step];
+    return {
+      step,
+      event,
+      ...(event === "statement"
+        ? { position: this.symbols.statementPositions[index] }
+        : { functionName: this.symbols.functionNames[index] }),
+      stackPointer: this.stepRegisters[3 * step],
+      basePointer: this.stepRegisters[3 * step + 1],
+      heapPointer: this.stepRegisters[3 * step + 2],
+      memory,
+    };
+  }
+
+  /**
+   * Applies the writes recorded at the given step to the memory of the step before.
+   */
+  private applyWrites(memory: Uint8Array, step: number) {
+    let offset = this.stepBytesEnds[step - 1];
+    const writesEnd = this.stepWritesEnds[step];
+    for (let i = this.stepWritesEnds[step - 1]; i < writesEnd; ++i) {
+      const length = this.writeLengths[i];
+      memory.set(
+        this.writtenBytes.subarray(offset, offset + length),
+        this.writeAddresses[i],
+      );
+      offset += length;
+    }
+  }
+
+  private takeKeyframe(memoryBytes: Uint8Array) {
+    this.keyframeSteps.push(this.numberOfSteps);
+    this.keyframes.push(memoryBytes.slice());
+    this.keyframesByteLength += memoryBytes.length;
+    if (
+      this.lastMemory === null ||
+      this.lastMemory.length !== memoryBytes.length
+    ) {
+      this.lastMemory = memoryBytes.slice();
+    } else {
+      this.lastMemory.set(memoryBytes);
+    }
+    this.numberOfPendingWrites = 0;
+    this.needsKeyframe = false;
+    this.stepsSinceKeyframe = 0;
+  }
+
+  /**
+   * Records the bytes of the pending writes as written at the current step, merging the writes that overlap.
+   */
+  private recordPendingWrites(memoryBytes: Uint8Array) {
+    const count = this.numberOfPendingWrites;
+    if (count === 0) {
+      return;
+    }
+    const order = Array.from({ length: count }, (_, i) => i);
+    if (count > 1) {
+      order.sort(
+        (a, b) => this.pendingAddresses[a] - this.pendingAddresses[b],
+      );
+    }
+    let start = this.pendingAddresses[order[0]];
+    let end = start + this.pendingLengths[order[0]];
+    for (let i = 1; i < count; ++i) {
+      const address = this.pendingAddresses[order[i]];
+      if (address > end) {
+        this.recordWrittenBytes(memoryBytes, start, end);
+        start = address;
+      }
+      end = Math.max(end, address + this.pendingLengths[order[i]]);
+    }
+    this.recordWrittenBytes(memoryBytes, start, end);
+    this.numberOfPendingWrites = 0;
+  }
+
+  /**
+   * Records the bytes of memory from start up to (excluding) end as written at the current step.
+   */
+  private recordWrittenBytes(
+    memoryBytes: Uint8Array,
+    start: number,
+    end: number,
+  ) {
+    end = Math.min(end, memoryBytes.length); // a write out of bounds traps, after it was logged
+    if (start >= end) {
+      return;
+    }
+    const bytes = memoryBytes.subarray(start, end);
+    if (this.numberOfWrites === this.writeAddresses.length) {
+      this.writeAddresses = growUint32Array(
+        this.writeAddresses,
+        this.numberOfWrites + 1,
+      );
+      this.writeLengths = growUint32Array(
+        this.writeLengths,
+        this.numberOfWrites + 1,
+      );
+    }
+    this.writeAddresses[this.numberOfWrites] = start;
+    this.writeLengths[this.numberOfWrites] = bytes.length;
+    ++this.numberOfWrites;
+    if (this.writtenBytesLength + bytes.length > this.writtenBytes.length) {
+      const grown = new Uint8Array(
+        Math.max(
+          this.writtenBytesLength + bytes.length,
+          this.writtenBytes.length * 2,
+        ),
+      );
+      grown.set(this.writtenBytes.subarray(0, this.writtenBytesLength));
+      this.writtenBytes = grown;
+    }
+    this.writtenBytes.set(bytes, this.writtenBytesLength);
+    this.writtenBytesLength += bytes.length;
+    (this.lastMemory as Uint8Array).set(bytes, start);
+  }
+
+  private growSteps() {
+    const size = this.eventKinds.length * 2;
+    const eventKinds = new Uint8Array(size);
+    eventKinds.set(this.eventKinds);
+    this.eventKinds = eventKinds;
+    this.eventIndexes = growUint32Array(this.eventIndexes, size);
+    this.stepRegisters = growUint32Array(this.stepRegisters, 3 * size);
+    this.stepWritesEnds = growUint32Array(this.stepWritesEnds, size);
+    const stepBytesEnds = new Float64Array(size);
+    stepBytesEnds.set(this.stepBytesEnds);
+    this.stepBytesEnds = stepBytesEnds;
+  }
+}
@@ -0,0 +1,84 @@
+/**
+ * Instrumentation of a translated wasm module to give the runtime the call site of each malloc and free, for the
+ * allocation events and leaks of the heap statistics (see src/modules/source_stdlib/heapStats.ts).
+ *
+ * Before each direct call of malloc or free, the index of the call site is set in the "alloc_site" global, which is
+ * imported from JS and read by the runtime when the call reaches it. The position of a call site is that of the C
+ * statement the call is in.
+ */
+
+import { WasmModule, WasmStatement } from "~src/translator/wasm-ast/core";
+import { Position } from "~src/parser/c-ast/misc";
+
+export const ALLOCATION_SITE_GLOBAL = "alloc_site";
+const ALLOCATION_FUNCTIONS = new Set(["malloc", "free"]);
+
+interface AllocationSitesState {
+  positions: Position[]; // by call site index
+  currentPosition?: Position; // of the last C statement reached
+}
+
+/**
+ * Instruments the statements nested in the given node.
+ */
+function instrumentChildren(node: object, state: AllocationSitesState) {
+  const astNode = node as Record<string, unknown>;
+  for (const key in astNode) {
+    const child = astNode[key];
+    if (Array.isArray(child)) {
+      astNode[key] = instrumentStatements(child, state);
+    } else if (typeof child === "object" && child !== null) {
+      instrumentChildren(child, state);
+    }
+  }
+}
+
+function instrumentStatements(
+  statements: WasmStatement[],
+  state: AllocationSitesState,
+): WasmStatement[] {
+  const instrumented: WasmStatement[] = [];
+  for (const statement of statements) {
+    if (typeof statement.position !== "undefined") {
+      state.currentPosition = statement.position;
+    }
+    instrumentChildren(statement, state);
+    if (
+      statement.type === "FunctionCall" &&
+      ALLOCATION_FUNCTIONS.has(statement.name) &&
+      typeof state.currentPosition !== "undefined"
+    ) {
+      const allocationSite = state.positions.push(state.currentPosition) - 1;
+      instrumented.push({
+        type: "GlobalSet",
+        name: ALLOCATION_SITE_GLOBAL,
+        value: {
+          type: "IntegerConst",
+          wasmDataType: "i32",
+          value: BigInt(allocationSite),
+        },
+      });
+    }
+    instrumented.push(statement);
+  }
+  return instrumented;
+}
+
+/**
+ * Instruments all the functions of the module, returning the positions of the call sites by index.
+ */
+export default function instrumentAllocationSites(
+  wasmRoot: WasmModule,
+): Position[] {
+  wasmRoot.importedGlobalWasmVariables.push({
+    type: "ImportedGlobalVariable",
+    name: ALLOCATION_SITE_GLOBAL,
+    wasmDataType: "i32",
+  });
+  const state: AllocationSitesState = { positions: [] };
+  for (const func of Object.values(wasmRoot.functions)) {
+    state.currentPosition = undefined;
+    func.body = instrumentStatements(func.body, state);
+  }
+  return state.positions;
+}
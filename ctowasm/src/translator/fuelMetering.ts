@@ -0,0 +1,137 @@
+/**
+ * Instrumentation of a translated wasm module for fuel metering, which bounds the number of steps a program can run for.
+ *
+ * The program is given an amount of fuel (the imported "fuel_limit" global), which it counts down in its own "fuel"
+ * global, exported so that the runtime can read the fuel left once the program has run. A global defined in the module
+ * is accessed directly, where an imported mutable global would be accessed through an indirection on every charge.
+ * Fuel is only charged at the start of every function body and loop iteration, as a program can only run without
+ * bound by looping or recursing. Each charge covers all the instructions up to the next charge point, including both
+ * arms of any if/else, so that the counter is only updated once per loop iteration or call.
+ * When the fuel runs out, the imported "fuel_exhausted" function is called, which throws a FuelExhaustedError.
+ * The fuel left after a run is a deterministic measure of the cost of the run.
+ */
+
+import { WasmModule, WasmStatement } from "~src/translator/wasm-ast/core";
+
+export const FUEL_GLOBAL = "fuel";
+export const FUEL_LIMIT_GLOBAL = "fuel_limit";
+export const FUEL_EXHAUSTED_FUNCTION = "fuel_exhausted";
+
+/**
+ * Returns the number of instructions (wasm AST nodes) in the given node, excluding those in the bodies of nested loops,
+ * which are charged separately.
+ */
+function countInstructions(node: unknown): number {
+  if (typeof node !== "object" || node === null) {
+    return 0;
+  }
+  if (Array.isArray(node)) {
+    let count = 0;
+    for (const child of node) {
+      count += countInstructions(child);
+    }
+    return count;
+  }
+  const astNode = node as Record<string, unknown>;
+  if (astNode.type === "Loop") {
+    return 1;
+  }
+  let count = typeof astNode.type === "string" ? 1 : 0;
+  for (const key in astNode) {
+    count += countInstructions(astNode[key]);
+  }
+  return count;
+}
+
+/**
+ * Creates the statements that charge the given amount of fuel, and stop the program if the fuel has run out.
+ */
+function createFuelCharge(amount: number): WasmStatement[] {
+  return [
+    {
+      type: "GlobalSet",
+      name: FUEL_GLOBAL,
+      value: {
+        type: "BinaryExpression",
+        instruction: "i64.sub",
+        leftExpr: { type: "GlobalGet", name: FUEL_GLOBAL },
+        rightExpr: {
+          type: "IntegerConst",
+          wasmDataType: "i64",
+          value: BigInt(amount),
+        },
+      },
+    },
+    {
+      type: "SelectionStatement",
+      condition: {
+        type: "BooleanExpression",
+        wasmDataType: "i32",
+        expr: {
+          type: "BinaryExpression",
+          instruction: "i64.lt_s",
+          leftExpr: { type: "GlobalGet", name: FUEL_GLOBAL },
+          rightExpr: { type: "IntegerConst", wasmDataType: "i64", value: 0n },
+        },
+      },
+      actions: [
+        { type: "RegularFunctionCall", name: FUEL_EXHAUSTED_FUNCTION, args: [] },
+      ],
+      elseStatements: [],
+    },
+  ];
+}
+
+/**
+ * Charges fuel at the start of the given body, and instruments all the loops within it.
+ */
+function instrumentBody(body: WasmStatement[]): WasmStatement[] {
+  for (const statement of body) {
+    instrumentNestedBodies(statement);
+  }
+  return [...createFuelCharge(Math.max(1, countInstructions(body))), ...body];
+}
+
+function instrumentNestedBodies(node: unknown) {
+  if (typeof node !== "object" || node === null) {
+    return;
+  }
+  if (Array.isArray(node)) {
+    node.forEach(instrumentNestedBodies);
+    return;
+  }
+  const astNode = node as Record<string, unknown>;
+  if (astNode.type === "Loop") {
+    // charged on every iteration, as branching to the loop label restarts the loop body
+    astNode.body = instrumentBody(astNode.body as WasmStatement[]);
+    return;
+  }
+  for (const key in astNode) {
+    instrumentNestedBodies(astNode[key]);
+  }
+}
+
+export default function instrumentFuelMetering(wasmRoot: WasmModule) {
+  wasmRoot.importedGlobalWasmVariables.push({
+    type: "ImportedGlobalVariable",
+    name: FUEL_LIMIT_GLOBAL,
+    wasmDataType: "i64",
+    isConst: true,
+  });
+  wasmRoot.globalWasmVariables.push({
+    type: "GlobalVariable",
+    name: FUEL_GLOBAL,
+    wasmDataType: "i64",
+    initializerValue: { type: "GlobalGet", name: FUEL_LIMIT_GLOBAL },
+    isExported: true,
+  });
+  wasmRoot.importedFunctions.push({
+    name: FUEL_EXHAUSTED_FUNCTION,
+    importPath: ["js", FUEL_EXHAUSTED_FUNCTION],
+    wasmParamTypes: [],
+    returnWasmTypes: [],
+  });
+  for (const func of Object.values(wasmRoot.functions)) {
+    func.body = instrumentBody(func.body);
+  }
+}
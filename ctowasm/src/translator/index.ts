@@ -10,11 +10,32 @@ import translateFunction from "~src/translator/translateFunction";
 import { CAstRootP } from "~src/processor/c-ast/core";
 import processIncludedModules from "~src/translator/processImportedFunctions";
 import ModuleRepository from "~src/modules";
+import instrumentFuelMetering from "~src/translator/fuelMetering";
+import instrumentProfiling from "~src/translator/profiling";
+import prepareForThreads from "~src/translator/threads";
+import instrumentTracing from "~src/translator/tracing";
+import instrumentAllocationSites from "~src/translator/allocationSites";
+import { TranslationError } from "~src/errors";
+
+export interface TranslationOptions {
+  fuelMetering?: boolean; // instrument the program to count and limit the steps it runs for (see fuelMetering.ts)
+  profile?: boolean; // instrument the program to report the calls of its functions to a profiler (see profiling.ts)
+  threads?: boolean; // compile the program to run its POSIX threads in workers on a shared memory (see threads.ts)
+  trace?: boolean; // instrument the program to report every statement, call and write to memory to a trace recorder (see tracing.ts)
+  allocationSites?: boolean; // instrument the program to give the call site of each malloc and free to the heap statistics (see allocationSites.ts)
+}
 
 export default function translate(
   CAstRoot: CAstRootP,
   moduleRepository: ModuleRepository,
+  options: TranslationOptions = {},
 ) {
+  if (options.trace && options.threads) {
+    throw new TranslationError(
+      "Programs compiled with the threads option cannot be traced",
+    );
+  }
+
   const wasmRoot: WasmModule = {
     type: "Module",
     dataSegmentByteStr: CAstRoot.dataSegmentByteStr, // byte str to set the data segment to
@@ -32,6 +53,9 @@ export default function translate(
   );
 
   wasmRoot.importedFunctions = processedImportedFunctions.functionImports;
+  wasmRoot.importedGlobalWasmVariables.push(
+    ...processedImportedFunctions.globalImports,
+  );
   // add function wrappers of imported functions
   processedImportedFunctions.wrappedFunctions.forEach((wrappedFunction) => {
     wasmRoot.functions[wrappedFunction.name] = wrappedFunction;
@@ -43,5 +67,25 @@ export default function translate(
 
   setPseudoRegisters(wasmRoot);
 
+  if (options.profile) {
+    wasmRoot.profiledFunctionNames = instrumentProfiling(wasmRoot);
+  }
+
+  if (options.trace) {
+    wasmRoot.traceSymbols = instrumentTracing(wasmRoot);
+  }
+
+  if (options.allocationSites) {
+    wasmRoot.allocationSitePositions = instrumentAllocationSites(wasmRoot);
+  }
+
+  if (options.fuelMetering) {
+    instrumentFuelMetering(wasmRoot);
+  }
+
+  if (options.threads) {
+    prepareForThreads(wasmRoot);
+  }
+
   return wasmRoot;
 }
@@ -9,12 +9,14 @@ import { ExternalFunction } from "~src/processor/c-ast/core";
 import { unpackDataType } from "~src/processor/dataTypeUtil";
 import {
   BASE_POINTER,
+  WASM_ADDR_TYPE,
   getRegisterPointerArithmeticNode,
 } from "~src/translator/memoryUtil";
 import { getSizeOfScalarDataType } from "~src/common/utils";
 import { WASM_ADDR_SIZE } from "~src/common/constants";
 import ModuleRepository from "~src/modules";
 import { WasmDataType } from "~src/translator/wasm-ast/dataTypes";
+import { WasmImportedGlobalVariable } from "~src/translator/wasm-ast/variables";
 
 /**
  * Process the imported functions.
@@ -27,9 +29,11 @@ export default function processImportedFunctions(
 ): {
   functionImports: WasmImportedFunction[]; // the wasm function imports
   wrappedFunctions: WasmFunction[]; // the wrapped imported functions (what is actually called directly by user code)
+  globalImports: WasmImportedGlobalVariable[]; // the globals used by functions implemented directly in wasm
 } {
   const functionImports: WasmImportedFunction[] = [];
   const wrappedFunctions: WasmFunction[] = [];
+  const globalImports: Map<string, WasmImportedGlobalVariable> = new Map();
 
   for (const externalCFunction of externalCFunctions) {
     const importedFunction =
@@ -37,6 +41,17 @@ export default function processImportedFunctions(
         externalCFunction.name
       ];
 
+    if (typeof importedFunction.wasmImplementation !== "undefined") {
+      // function is implemented directly in wasm, so there is nothing to import or wrap
+      wrappedFunctions.push(
+        ...importedFunction.wasmImplementation(externalCFunction),
+      );
+      for (const global of importedFunction.wasmImplementationGlobals ?? []) {
+        globalImports.set(global.name, global);
+      }
+      continue;
+    }
+
     // need to unpack the datatype of each parameter of this external function into primary data types -> wasm types, in param order
     // for aggregate parameters, their parameters should also remain in the same order as they were in the aggregate
     const wasmParams: WasmDataType[] = [];
@@ -46,6 +61,10 @@ export default function processImportedFunctions(
         wasmParams.push(convertScalarDataTypeToWasmType(scalarType.dataType));
       }
     }
+    // variadic functions take the address of their first variadic arg as an extra last param
+    if (importedFunction.functionType.isVariadic) {
+      wasmParams.push(WASM_ADDR_TYPE);
+    }
 
     console.assert(
       typeof importedFunction !== "undefined",
@@ -63,6 +82,7 @@ export default function processImportedFunctions(
             convertScalarDataTypeToWasmType(retObj.dataType),
           )
         : [],
+      ...(importedFunction.writesMemory ? { writesMemory: true } : {}),
     });
 
     // create the function wrapper
@@ -116,6 +136,18 @@ export default function processImportedFunctions(
       }
     }
 
+    if (importedFunction.functionType.isVariadic) {
+      // variadic args are located right after (below) the named params in the stack frame
+      // the imported function reads them going downwards from this address
+      const sizeOfParams = externalCFunction.parameters.reduce(
+        (sum, param) => sum + getSizeOfScalarDataType(param.dataType),
+        0,
+      );
+      importedFunctionCall.args.push(
+        getRegisterPointerArithmeticNode(BASE_POINTER, "-", sizeOfParams),
+      );
+    }
+
     functionWrapper.body.push(importedFunctionCall);
 
     // now all the return values of the imported function call are on the virtual wasm stack - need to load them into the real stack
@@ -139,5 +171,9 @@ export default function processImportedFunctions(
     wrappedFunctions.push(functionWrapper);
   }
 
-  return { functionImports, wrappedFunctions };
+  return {
+    functionImports,
+    wrappedFunctions,
+    globalImports: [...globalImports.values()],
+  };
 }
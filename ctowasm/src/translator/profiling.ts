@@ -0,0 +1,69 @@
+/**
+ * Instrumentation of a translated wasm module for function-level profiling.
+ *
+ * Each function is given an index (its position in the list of profiled function names), and calls the imported
+ * "profile_enter" function with its index in its prologue, and "profile_exit" in its epilogue. The runtime side
+ * (see src/profiler.ts) times the calls and builds the profile.
+ */
+
+import { WasmModule, WasmStatement } from "~src/translator/wasm-ast/core";
+
+export const PROFILE_ENTER_FUNCTION = "profile_enter";
+export const PROFILE_EXIT_FUNCTION = "profile_exit";
+const PROFILE_BLOCK_LABEL = "profile_block"; // block holding the original function body, returns branch out of it
+
+/**
+ * Replaces all return statements within the given node by branches to the end of the block with given label,
+ * which holds the function body, so that the epilogue added after the block is always run.
+ */
+export function replaceReturns(node: unknown, blockLabel: string) {
+  if (typeof node !== "object" || node === null) {
+    return;
+  }
+  if (Array.isArray(node)) {
+    for (let i = 0; i < node.length; ++i) {
+      if (node[i]?.type === "ReturnStatement") {
+        node[i] = { type: "Branch", label: blockLabel };
+      } else {
+        replaceReturns(node[i], blockLabel);
+      }
+    }
+    return;
+  }
+  for (const value of Object.values(node)) {
+    replaceReturns(value, blockLabel);
+  }
+}
+
+function createProfileCall(name: string, index: number): WasmStatement {
+  return {
+    type: "RegularFunctionCall",
+    name,
+    args: [{ type: "IntegerConst", wasmDataType: "i32", value: BigInt(index) }],
+  };
+}
+
+/**
+ * Instruments all the functions of the module, returning the names of the profiled functions by index.
+ */
+export default function instrumentProfiling(wasmRoot: WasmModule): string[] {
+  for (const name of [PROFILE_ENTER_FUNCTION, PROFILE_EXIT_FUNCTION]) {
+    wasmRoot.importedFunctions.push({
+      name,
+      importPath: ["js", name],
+      wasmParamTypes: ["i32"],
+      returnWasmTypes: [],
+    });
+  }
+  const functionNames = Object.keys(wasmRoot.functions);
+  functionNames.forEach((functionName, index) => {
+    const func = wasmRoot.functions[functionName];
+    replaceReturns(func.body, PROFILE_BLOCK_LABEL);
+    func.body = [
+      createProfileCall(PROFILE_ENTER_FUNCTION, index),
+      { type: "Block", label: PROFILE_BLOCK_LABEL, body: func.body },
+      createProfileCall(PROFILE_EXIT_FUNCTION, index),
+    ];
+  });
+  return functionNames;
+}
@@ -0,0 +1,86 @@
+/**
+ * Preparation of a translated wasm module to run as POSIX threads (see src/modules/pthread) on a shared memory.
+ *
+ * Each thread is a separate instance of the module in its own worker, all importing the same shared memory, with their
+ * own sp, bp and hp globals. The stack of a thread is a fixed region allocated from the heap, and the hp global of the
+ * thread holds the lowest address of its stack region, so the check for stack space at the start of every function
+ * stays the same. Stacks cannot be moved when they run out of space, as the stacks of the other threads and the heap
+ * are in the way, so the growing of memory and moving of the stack in that check is replaced by a call to the imported
+ * "stack_overflow" function, which throws. Only the heap grows memory.
+ *
+ * As every instance would otherwise initialise the data segment and run main, the data segment is made passive and
+ * initialised by the exported "init_data_segment" function, and main is exported instead of being the start function
+ * (see the WAT generator). The runtime calls both in the instance of the main thread only (see src/threadsRun.ts).
+ */
+
+import { WasmModule, WasmStatement } from "~src/translator/wasm-ast/core";
+
+export const STACK_OVERFLOW_FUNCTION = "stack_overflow";
+export const INIT_DATA_SEGMENT_FUNCTION = "init_data_segment";
+export const MAIN_FUNCTION = "main";
+// the maximum size of a shared memory must be declared. 1 GiB.
+export const THREADS_MAXIMUM_MEMORY_PAGES = 16384;
+
+/**
+ * Returns whether the given node contains a memory.grow, which only the stack space checks at the start of functions do.
+ */
+export function containsMemoryGrow(node: unknown): boolean {
+  if (typeof node !== "object" || node === null) {
+    return false;
+  }
+  if (Array.isArray(node)) {
+    return node.some(containsMemoryGrow);
+  }
+  const astNode = node as Record<string, unknown>;
+  if (astNode.type === "MemoryGrow") {
+    return true;
+  }
+  for (const key in astNode) {
+    if (containsMemoryGrow(astNode[key])) {
+      return true;
+    }
+  }
+  return false;
+}
+
+/**
+ * Replaces the actions of the stack space checks (the only statements that grow memory) within the given node.
+ */
+function replaceStackGrowth(node: unknown) {
+  if (typeof node !== "object" || node === null) {
+    return;
+  }
+  if (Array.isArray(node)) {
+    node.forEach(replaceStackGrowth);
+    return;
+  }
+  const astNode = node as Record<string, unknown>;
+  if (
+    astNode.type === "SelectionStatement" &&
+    containsMemoryGrow(astNode.actions)
+  ) {
+    const stackOverflowCall: WasmStatement = {
+      type: "RegularFunctionCall",
+      name: STACK_OVERFLOW_FUNCTION,
+      args: [],
+    };
+    astNode.actions = [stackOverflowCall];
+    return;
+  }
+  for (const key in astNode) {
+    replaceStackGrowth(astNode[key]);
+  }
+}
+
+export default function prepareForThreads(wasmRoot: WasmModule) {
+  wasmRoot.threads = true;
+  wasmRoot.importedFunctions.push({
+    name: STACK_OVERFLOW_FUNCTION,
+    importPath: ["js", STACK_OVERFLOW_FUNCTION],
+    wasmParamTypes: [],
+    returnWasmTypes: [],
+  });
+  for (const func of Object.values(wasmRoot.functions)) {
+    replaceStackGrowth(func.body);
+  }
+}
@@ -0,0 +1,281 @@
+/**
+ * Instrumentation of a translated wasm module for recording execution traces, from which the state of a run at every
+ * step can be reconstructed (see src/traceRecorder.ts).
+ *
+ * The module calls the following imported functions:
+ * - "trace_statement", with the index of the statement (its position in the list of traced statement positions), before
+ *   each C statement runs.
+ * - "trace_enter" and "trace_exit", with the index of the function, in the prologue and epilogue of each function.
+ * - "trace_write", with the address and size of each store to memory, just after the store, once its value has been
+ *   evaluated (the value may call functions, whose events would otherwise see memory before the store). The address is
+ *   evaluated once, into a "trace_addr_<depth>" local of the function, so that the side effects of the address
+ *   expression are not repeated. Stores nested in the address or value of another store use a local of a greater
+ *   depth.
+ * - "trace_external_call", after each call of a function imported from JS that may write to memory without stores in
+ *   the module (e.g. scanf). Other imported functions only write through the stores of their wrappers, which are logged.
+ * The registers (sp, bp and hp) are imported globals, which the runtime reads on each event.
+ *
+ * The stack space checks at the start of functions, which grow memory and move the stack, are not instrumented.
+ * The runtime notices that memory has grown at the next event instead.
+ */
+
+import {
+  WasmExpression,
+  WasmModule,
+  WasmStatement,
+} from "~src/translator/wasm-ast/core";
+import { Position } from "~src/parser/c-ast/misc";
+import { replaceReturns } from "~src/translator/profiling";
+import { containsMemoryGrow } from "~src/translator/threads";
+
+export const TRACE_STATEMENT_FUNCTION = "trace_statement";
+export const TRACE_ENTER_FUNCTION = "trace_enter";
+export const TRACE_EXIT_FUNCTION = "trace_exit";
+export const TRACE_WRITE_FUNCTION = "trace_write";
+export const TRACE_EXTERNAL_CALL_FUNCTION = "trace_external_call";
+const TRACE_ADDRESS_LOCAL_PREFIX = "trace_addr_";
+const TRACE_BLOCK_LABEL = "trace_block"; // block holding the original function body, returns branch out of it
+const ATOMIC_WRITE_SIZE = 4; // atomic operations are only on ints
+
+/**
+ * What the indexes passed to the trace functions by a traced program refer to.
+ */
+export interface TraceSymbols {
+  functionNames: string[]; // by function index, of trace_enter and trace_exit
+  statementPositions: Position[]; // by statement index, of trace_statement
+}
+
+interface TracingState {
+  symbols: TraceSymbols;
+  memoryWritingFunctionNames: Set<string>;
+  // of the function being instrumented: the number of stores enclosing the node being instrumented, and the number of
+  // trace address locals the function needs
+  storeDepth: number;
+  numberOfAddressLocals: number;
+}
+
+function createTraceCall(name: string, index: number): WasmStatement {
+  return {
+    type: "RegularFunctionCall",
+    name,
+    args: [{ type: "IntegerConst", wasmDataType: "i32", value: BigInt(index) }],
+  };
+}
+
+function createWriteLogCall(
+  addr: WasmExpression,
+  numOfBytes: number,
+): WasmStatement {
+  return {
+    type: "RegularFunctionCall",
+    name: TRACE_WRITE_FUNCTION,
+    args: [
+      addr,
+      { type: "IntegerConst", wasmDataType: "i32", value: BigInt(numOfBytes) },
+    ],
+  };
+}
+
+/**
+ * Instruments the children of a store, whose address is then evaluated into the returned trace address local. Stores
+ * nested in the children get locals of their own, so the address is kept until the store has been logged.
+ */
+function instrumentStoreChildren(node: object, state: TracingState): string {
+  const local = `${TRACE_ADDRESS_LOCAL_PREFIX}${state.storeDepth}`;
+  ++state.storeDepth;
+  state.numberOfAddressLocals = Math.max(
+    state.numberOfAddressLocals,
+    state.storeDepth,
+  );
+  try {
+    instrumentChildren(node, state);
+  } finally {
+    --state.storeDepth;
+  }
+  return local;
+}
+
+/**
+ * Instruments the statements and expressions nested in the given node.
+ */
+function instrumentChildren(node: object, state: TracingState) {
+  const astNode = node as Record<string, unknown>;
+  for (const key in astNode) {
+    const child = astNode[key];
+    if (Array.isArray(child)) {
+      if (key === "args") {
+        for (let i = 0; i < child.length; ++i) {
+          child[i] = instrumentExpression(child[i], state);
+        }
+      } else {
+        astNode[key] = instrumentStatements(child, state);
+      }
+    } else if (
+      typeof child === "object" &&
+      child !== null &&
+      typeof (child as Record<string, unknown>).type === "string"
+    ) {
+      astNode[key] = instrumentExpression(child as WasmExpression, state);
+    }
+  }
+}
+
+function instrumentExpression(
+  expr: WasmExpression,
+  state: TracingState,
+): WasmExpression {
+  if (expr.type === "AtomicRmw" || expr.type === "AtomicCmpxchg") {
+    // logged before the operation, as its result is its value. Its operands are the locals of the helper functions of
+    // the pthread module (see atomics.ts), so nothing runs between the log and the write.
+    const local = instrumentStoreChildren(expr, state);
+    return {
+      type: "PreStatementExpression",
+      statements: [
+        { type: "LocalSet", name: local, value: expr.addr },
+        createWriteLogCall(
+          { type: "LocalGet", name: local },
+          ATOMIC_WRITE_SIZE,
+        ),
+      ],
+      expr: { ...expr, addr: { type: "LocalGet", name: local } },
+    };
+  }
+  instrumentChildren(expr, state);
+  return expr;
+}
+
+/**
+ * Returns the given statements with the statement events, write logs and external call events added.
+ */
+function instrumentStatements(
+  statements: WasmStatement[],
+  state: TracingState,
+): WasmStatement[] {
+  const instrumented: WasmStatement[] = [];
+  for (const statement of statements) {
+    if (typeof statement.position !== "undefined") {
+      const statementIndex =
+        state.symbols.statementPositions.push(statement.position) - 1;
+      instrumented.push(
+        createTraceCall(TRACE_STATEMENT_FUNCTION, statementIndex),
+      );
+    }
+    if (
+      statement.type === "SelectionStatement" &&
+      containsMemoryGrow(statement.actions)
+    ) {
+      instrumented.push(statement);
+      continue;
+    }
+    if (statement.type === "MemoryStore" || statement.type === "AtomicStore") {
+      const local = instrumentStoreChildren(statement, state);
+      const addressGetNode: WasmExpression = { type: "LocalGet", name: local };
+      instrumented.push(
+        { type: "LocalSet", name: local, value: statement.addr },
+        { ...statement, addr: addressGetNode },
+        createWriteLogCall(
+          addressGetNode,
+          statement.type === "MemoryStore"
+            ? statement.numOfBytes
+            : ATOMIC_WRITE_SIZE,
+        ),
+      );
+      continue;
+    }
+    instrumentChildren(statement, state);
+    if (statement.type === "MemoryStoreFromWasmStack") {
+      // the value is already on the wasm stack, so the write is logged after the store.
+      // these stores are only to the return objects of the stack frame, at addresses without side effects.
+      instrumented.push(
+        statement,
+        createWriteLogCall(statement.addr, statement.numOfBytes),
+      );
+    } else if (
+      statement.type === "RegularFunctionCall" &&
+      state.memoryWritingFunctionNames.has(statement.name)
+    ) {
+      instrumented.push(statement, {
+        type: "RegularFunctionCall",
+        name: TRACE_EXTERNAL_CALL_FUNCTION,
+        args: [],
+      });
+    } else {
+      instrumented.push(statement);
+    }
+  }
+  return instrumented;
+}
+
+/**
+ * Instruments all the functions of the module, returning what the indexes of the trace events refer to.
+ */
+export default function instrumentTracing(wasmRoot: WasmModule): TraceSymbols {
+  const state: TracingState = {
+    symbols: { functionNames: [], statementPositions: [] },
+    storeDepth: 0,
+    numberOfAddressLocals: 0,
+    // the functions of the included modules, not those of the runtime itself (e.g. for profiling)
+    memoryWritingFunctionNames: new Set(
+      wasmRoot.importedFunctions
+        .filter(
+          (importedFunction) =>
+            importedFunction.importPath[0] !== "js" &&
+            importedFunction.writesMemory,
+        )
+        .map((importedFunction) => importedFunction.name),
+    ),
+  };
+
+  for (const name of [
+    TRACE_STATEMENT_FUNCTION,
+    TRACE_ENTER_FUNCTION,
+    TRACE_EXIT_FUNCTION,
+  ]) {
+    wasmRoot.importedFunctions.push({
+      name,
+      importPath: ["js", name],
+      wasmParamTypes: ["i32"],
+      returnWasmTypes: [],
+    });
+  }
+  wasmRoot.importedFunctions.push(
+    {
+      name: TRACE_WRITE_FUNCTION,
+      importPath: ["js", TRACE_WRITE_FUNCTION],
+      wasmParamTypes: ["i32", "i32"],
+      returnWasmTypes: [],
+    },
+    {
+      name: TRACE_EXTERNAL_CALL_FUNCTION,
+      importPath: ["js", TRACE_EXTERNAL_CALL_FUNCTION],
+      wasmParamTypes: [],
+      returnWasmTypes: [],
+    },
+  );
+  for (const func of Object.values(wasmRoot.functions)) {
+    state.numberOfAddressLocals = 0;
+    func.body = instrumentStatements(func.body, state);
+    if (state.numberOfAddressLocals > 0) {
+      func.locals = [
+        ...(func.locals ?? []),
+        ...Array.from({ length: state.numberOfAddressLocals }, (_, depth) => ({
+          type: "LocalVariable" as const,
+          name: `${TRACE_ADDRESS_LOCAL_PREFIX}${depth}`,
+          wasmDataType: "i32" as const,
+        })),
+      ];
+    }
+    // helper functions with wasm params are implementation details of module functions, not functions of the program
+    if (typeof func.params !== "undefined") {
+      continue;
+    }
+    const functionIndex = state.symbols.functionNames.push(func.name) - 1;
+    replaceReturns(func.body, TRACE_BLOCK_LABEL);
+    func.body = [
+      createTraceCall(TRACE_ENTER_FUNCTION, functionIndex),
+      { type: "Block", label: TRACE_BLOCK_LABEL, body: func.body },
+      createTraceCall(TRACE_EXIT_FUNCTION, functionIndex),
+    ];
+  }
+  return state.symbols;
+}
@@ -17,12 +17,24 @@ import translateSwitchStatement from "~src/translator/translateSwitchStatement";
 
 /**
  * Visitor function for visting StatementP nodes and translating them to statements to add to enclosingBody.
+ * The translated statement keeps the position of the C statement, if any.
  * @param statement node being visited.
  * @returns the translated wasm statements
  */
 export default function translateStatement(
   statement: StatementP,
   enclosingLoopDetails?: EnclosingLoopDetails, // the loop labelname of the loop enclosing this statement Used to translate break statements.
+): WasmStatement {
+  const wasmStatement = translateStatementNode(statement, enclosingLoopDetails);
+  if (typeof statement.position !== "undefined") {
+    wasmStatement.position = statement.position;
+  }
+  return wasmStatement;
+}
+
+function translateStatementNode(
+  statement: StatementP,
+  enclosingLoopDetails?: EnclosingLoopDetails,
 ): WasmStatement {
   if (statement.type === "MemoryStore") {
     return {
@@ -28,6 +28,12 @@ import {
   WasmMemoryLoad,
   WasmMemorySize,
   WasmMemoryStoreFromWasmStack,
+  WasmAtomicLoad,
+  WasmAtomicStore,
+  WasmAtomicRmw,
+  WasmAtomicCmpxchg,
+  WasmAtomicWait,
+  WasmAtomicNotify,
 } from "~src/translator/wasm-ast/memory";
 import { WasmBooleanExpression } from "./expressions";
 import { WasmNumericConversionWrapper } from "./numericConversion";
@@ -40,12 +46,15 @@ import {
   WasmLocalSet,
 } from "~src/translator/wasm-ast/variables";
 import { WasmFunctionTable } from "~src/translator/wasm-ast/functionTable";
+import { Position } from "~src/parser/c-ast/misc";
+import { TraceSymbols } from "~src/translator/tracing";
 
 /**
  * Main file containing all the core wasm AST node definitions.
  */
 export interface WasmAstNode {
   type: string;
+  position?: Position; // position of the C statement that a statement was translated from (see src/translator/tracing.ts)
 }
 
 export interface WasmModule extends WasmAstNode {
@@ -57,6 +66,10 @@ export interface WasmModule extends WasmAstNode {
   dataSegmentSize: number; // number of bytes of data segment
   importedFunctions: WasmImportedFunction[];
   functionTable: WasmFunctionTable;
+  profiledFunctionNames?: string[]; // names of the functions by profiling index, if the module is instrumented for profiling
+  traceSymbols?: TraceSymbols; // what the indexes of the trace events refer to, if the module is instrumented for tracing
+  allocationSitePositions?: Position[]; // positions of the malloc and free call sites by index, if the module is instrumented for them
+  threads?: boolean; // whether the module is compiled to run as threads on a shared memory (see src/translator/threads.ts)
 }
 
 // A wasm statement is an instruction meant to be used in a situation that does not involve a value being pushed on virtual wasm stack.
@@ -73,6 +86,7 @@ export type WasmStatement =
   | WasmMemoryStore
   | WasmMemoryStoreFromWasmStack
   | WasmMemoryGrow
+  | WasmAtomicStore
   | WasmRegularFunctionCall
   | WasmFunctionCall
   | WasmIndirectFunctionCall;
@@ -86,6 +100,11 @@ export type WasmExpression =
   | WasmNegateFloatExpression
   | WasmMemoryLoad
   | WasmMemorySize
+  | WasmAtomicLoad
+  | WasmAtomicRmw
+  | WasmAtomicCmpxchg
+  | WasmAtomicWait
+  | WasmAtomicNotify
   | WasmBooleanExpression
   | WasmNumericConversionWrapper
   | WasmLocalGet
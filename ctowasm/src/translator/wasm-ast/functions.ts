@@ -2,13 +2,13 @@
  * Definitions of nodes to do with functions.
  */
 
-import { WasmMemoryLoad } from "~src/translator/wasm-ast/memory";
 import {
   WasmStatement,
   WasmAstNode,
   WasmExpression,
 } from "~src/translator/wasm-ast/core";
 import { WasmDataType } from "~src/translator/wasm-ast/dataTypes";
+import { WasmLocalVariable } from "~src/translator/wasm-ast/variables";
 
 export type WasmFunctionBodyLine = WasmStatement;
 
@@ -25,6 +25,8 @@ export interface WasmDataObjectMemoryDetails {
 export interface WasmFunction extends WasmAstNode {
   type: "Function";
   name: string;
+  params?: WasmLocalVariable[]; // wasm params, only for helper functions that do not follow the memory model
+  locals?: WasmLocalVariable[]; // wasm locals, only for helper functions
   body: WasmStatement[];
 }
 
@@ -51,7 +53,7 @@ export interface WasmIndirectFunctionCall extends WasmFunctionCallBase {
 export interface WasmRegularFunctionCall extends WasmAstNode {
   type: "RegularFunctionCall";
   name: string;
-  args: WasmMemoryLoad[];
+  args: WasmExpression[];
 }
 
 export interface WasmReturnStatement extends WasmAstNode {
@@ -66,4 +68,5 @@ export interface WasmImportedFunction {
   importPath: string[]; // import path for function e.g: ["console", "log"]
   wasmParamTypes: WasmDataType[]; // the params of the functions in wasm
   returnWasmTypes: WasmDataType[];
+  writesMemory?: boolean; // the imported JS function may write to memory directly, see ModuleFunction
 }
@@ -40,3 +40,59 @@ export interface WasmMemoryGrow extends WasmAstNode {
 export interface WasmMemorySize extends WasmAstNode {
   type: "MemorySize";
 }
+
+// the read-modify-write operations of the i32.atomic.rmw instructions
+export type WasmAtomicRmwOperation =
+  | "add"
+  | "sub"
+  | "and"
+  | "or"
+  | "xor"
+  | "xchg";
+
+/**
+ * Atomic accesses of i32 values in linear memory (used by programs compiled with the threads option).
+ * The address of an atomic access must be 4 byte aligned.
+ */
+export interface WasmAtomicLoad extends WasmAstNode {
+  type: "AtomicLoad";
+  addr: WasmExpression;
+}
+
+export interface WasmAtomicStore extends WasmAstNode {
+  type: "AtomicStore";
+  addr: WasmExpression;
+  value: WasmExpression;
+}
+
+// atomically applies the operation to the value in memory and the given value, returning the previous value in memory
+export interface WasmAtomicRmw extends WasmAstNode {
+  type: "AtomicRmw";
+  operation: WasmAtomicRmwOperation;
+  addr: WasmExpression;
+  value: WasmExpression;
+}
+
+// atomically replaces the value in memory if it equals expected, returning the previous value in memory
+export interface WasmAtomicCmpxchg extends WasmAstNode {
+  type: "AtomicCmpxchg";
+  addr: WasmExpression;
+  expected: WasmExpression;
+  replacement: WasmExpression;
+}
+
+// blocks while the value in memory equals expected, until notified or the timeout (i64 nanoseconds, negative for none)
+// has passed. Returns 0 if notified, 1 if the value was not expected, 2 on timeout.
+export interface WasmAtomicWait extends WasmAstNode {
+  type: "AtomicWait";
+  addr: WasmExpression;
+  expected: WasmExpression;
+  timeout: WasmExpression;
+}
+
+// wakes up to count waiters on the address, returning the number woken up
+export interface WasmAtomicNotify extends WasmAstNode {
+  type: "AtomicNotify";
+  addr: WasmExpression;
+  count: WasmExpression;
+}
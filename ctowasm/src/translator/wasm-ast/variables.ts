@@ -17,7 +17,15 @@ export interface WasmVariable extends WasmAstNode {
  */
 export interface WasmGlobalVariable extends WasmVariable {
   type: "GlobalVariable";
-  initializerValue?: WasmConst;
+  initializerValue?: WasmConst | WasmGlobalGet; // a global.get can only read an immutable imported global
+  isExported?: boolean; // exported under its name, for the runtime to read after the program has run
+}
+
+/**
+ * A wasm local variable or param. Only used by helper functions that are implemented directly in wasm.
+ */
+export interface WasmLocalVariable extends WasmVariable {
+  type: "LocalVariable";
 }
 
 /**
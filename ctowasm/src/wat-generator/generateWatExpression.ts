@@ -16,7 +16,7 @@ export default function generateWatExpression(node: WasmExpression): string {
     }
     return `(${node.wasmDataType}.const ${valueStr})`;
   } else if (node.type === "LocalGet") {
-    return `(local.get $${node.name}})`;
+    return `(local.get $${node.name})`;
   } else if (node.type === "GlobalGet") {
     return `(global.get $${node.name})`;
   } else if (node.type === "BinaryExpression") {
@@ -40,10 +40,32 @@ export default function generateWatExpression(node: WasmExpression): string {
       node.wasmDataType,
       node.numOfBytes,
     )} ${generateWatExpression(node.addr)})`;
+  } else if (node.type === "AtomicLoad") {
+    return `(i32.atomic.load ${generateWatExpression(node.addr)})`;
+  } else if (node.type === "AtomicRmw") {
+    return `(i32.atomic.rmw.${node.operation} ${generateWatExpression(
+      node.addr,
+    )} ${generateWatExpression(node.value)})`;
+  } else if (node.type === "AtomicCmpxchg") {
+    return `(i32.atomic.rmw.cmpxchg ${generateWatExpression(
+      node.addr,
+    )} ${generateWatExpression(node.expected)} ${generateWatExpression(
+      node.replacement,
+    )})`;
+  } else if (node.type === "AtomicWait") {
+    return `(memory.atomic.wait32 ${generateWatExpression(
+      node.addr,
+    )} ${generateWatExpression(node.expected)} ${generateWatExpression(
+      node.timeout,
+    )})`;
+  } else if (node.type === "AtomicNotify") {
+    return `(memory.atomic.notify ${generateWatExpression(
+      node.addr,
+    )} ${generateWatExpression(node.count)})`;
   } else if (node.type === "NumericWrapper") {
     return `(${node.instruction} ${generateWatExpression(node.expr)})`;
   } else if (node.type === "NegateFloatExpression") {
-    return `(${node.wasmDataType}.neg ${node.expr})`;
+    return `(${node.wasmDataType}.neg ${generateWatExpression(node.expr)})`;
   } else if (node.type === "PostStatementExpression") {
     return `${generateWatExpression(node.expr)} ${generateStatementsList(
       node.statements,
@@ -71,6 +71,10 @@ export default function generateWatStatement(node: WasmStatement): string {
     )} ${generateWatExpression(node.addr)} ${generateWatExpression(
       node.value,
     )})`;
+  } else if (node.type === "AtomicStore") {
+    return `(i32.atomic.store ${generateWatExpression(
+      node.addr,
+    )} ${generateWatExpression(node.value)})`;
   } else if (node.type === "MemoryStoreFromWasmStack") {
     // need to use psuedoregister R2 to temporarily store value from virtual stack,
     // then put store address on virtual stack followed by loading from psuedoregister R2.
@@ -3,19 +3,33 @@
  */
 import { calculateNumberOfPagesNeededForBytes } from "~src/common/utils";
 import { WasmModule } from "~src/translator/wasm-ast/core";
+import { WasmVariable } from "~src/translator/wasm-ast/variables";
 import { FUNCTION_TYPE_LABEL } from "~src/wat-generator/constants";
 import generateWatExpression from "~src/wat-generator/generateWatExpression";
 import generateWatStatement from "~src/wat-generator/generateWatStatement";
 import { generateLine } from "~src/wat-generator/util";
+import {
+  INIT_DATA_SEGMENT_FUNCTION,
+  MAIN_FUNCTION,
+  THREADS_MAXIMUM_MEMORY_PAGES,
+} from "~src/translator/threads";
+
+const DATA_SEGMENT_LABEL = "$data_segment";
+
+function generateGlobalType(global: WasmVariable) {
+  return global.isConst
+    ? global.wasmDataType
+    : `(mut ${global.wasmDataType})`;
+}
 
 export function generateWat(module: WasmModule, baseIndentation: number = 0) {
   let watStr = generateLine("(module", baseIndentation);
 
-  // add the memory import
+  // add the memory import, which is shared between the threads of programs compiled with the threads option
   watStr += generateLine(
     `(import "js" "mem" (memory ${calculateNumberOfPagesNeededForBytes(
       module.dataSegmentSize,
-    )}))`,
+    )}${module.threads ? ` ${THREADS_MAXIMUM_MEMORY_PAGES} shared` : ""}))`,
     baseIndentation + 1,
   );
 
@@ -47,9 +61,7 @@ export function generateWat(module: WasmModule, baseIndentation: number = 0) {
     watStr += generateLine(
       `(global $${importedGlobal.name} (import "js" "${
         importedGlobal.name
-      }") (${importedGlobal.isConst ? "" : "mut"} ${
-        importedGlobal.wasmDataType
-      }))`,
+      }") ${generateGlobalType(importedGlobal)})`,
       baseIndentation + 1,
     );
   }
@@ -63,9 +75,9 @@ export function generateWat(module: WasmModule, baseIndentation: number = 0) {
   // add all the wasm global variable declarations
   for (const global of module.globalWasmVariables) {
     watStr += generateLine(
-      `(global $${global.name} (${global.isConst ? "" : "mut"} ${
-        global.wasmDataType
-      }) ${
+      `(global $${global.name}${
+        global.isExported ? ` (export "${global.name}")` : ""
+      } ${generateGlobalType(global)} ${
         global.initializerValue
           ? generateWatExpression(global.initializerValue)
           : ""
@@ -75,10 +87,23 @@ export function generateWat(module: WasmModule, baseIndentation: number = 0) {
   }
 
   // add all the global variables (in linear memory) intiializations
-  watStr += generateLine(
-    `(data (i32.const 0) "${module.dataSegmentByteStr}")`,
-    baseIndentation + 1,
-  );
+  if (module.threads) {
+    // initialised only once, by the main thread (see src/translator/threads.ts)
+    watStr += generateLine(
+      `(data ${DATA_SEGMENT_LABEL} "${module.dataSegmentByteStr}")`,
+      baseIndentation + 1,
+    );
+    const dataSegmentLength = module.dataSegmentByteStr.length / 3; // each byte is in the form "\\XX"
+    watStr += generateLine(
+      `(func (export "${INIT_DATA_SEGMENT_FUNCTION}") (memory.init ${DATA_SEGMENT_LABEL} (i32.const 0) (i32.const 0) (i32.const ${dataSegmentLength})) (data.drop ${DATA_SEGMENT_LABEL}))`,
+      baseIndentation + 1,
+    );
+  } else {
+    watStr += generateLine(
+      `(data (i32.const 0) "${module.dataSegmentByteStr}")`,
+      baseIndentation + 1,
+    );
+  }
 
   // add the type of all user defined functions (to wasm the functions simply take no params, no return (memory model handles these))
   watStr += generateLine(
@@ -97,7 +122,14 @@ export function generateWat(module: WasmModule, baseIndentation: number = 0) {
   // add all the function definitions
   for (const functionName of Object.keys(module.functions)) {
     const func = module.functions[functionName];
-    watStr += generateLine(`(func $${func.name}`, baseIndentation + 1);
+    watStr += generateLine(
+      `(func $${func.name}${(func.params ?? [])
+        .map((param) => ` (param $${param.name} ${param.wasmDataType})`)
+        .join("")}${(func.locals ?? [])
+        .map((local) => ` (local $${local.name} ${local.wasmDataType})`)
+        .join("")}`,
+      baseIndentation + 1,
+    );
     for (const statement of func.body) {
       watStr += generateLine(
         generateWatStatement(statement),
@@ -107,7 +139,14 @@ export function generateWat(module: WasmModule, baseIndentation: number = 0) {
     watStr += generateLine(")", baseIndentation + 1);
   }
 
-  watStr += generateLine("(start $main)", 1);
+  if (module.threads) {
+    watStr += generateLine(
+      `(export "${MAIN_FUNCTION}" (func $${MAIN_FUNCTION}))`,
+      1,
+    );
+  } else {
+    watStr += generateLine("(start $main)", 1);
+  }
   watStr += generateLine(")", 0);
   return watStr;
 }
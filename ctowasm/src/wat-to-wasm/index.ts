@@ -1,6 +1,24 @@
 import wabt from "wabt";
 
+// the wabt module is loaded once, on first use, and reused for all compilations
+let wabtModule: ReturnType<typeof wabt> | null = null;
+
+// atomics and shared memory, and passive data segments, are used by programs compiled with the threads option
+const WASM_FEATURES = { threads: true, bulk_memory: true };
+
 export async function compileWatToWasm(wat: string): Promise<Uint8Array> {
-  const w = await wabt();
-  return w.parseWat("a", wat).toBinary({}).buffer;
+  if (wabtModule === null) {
+    wabtModule = wabt();
+    // a failed load is retried on the next compilation
+    wabtModule.catch(() => {
+      wabtModule = null;
+    });
+  }
+  const w = await wabtModule;
+  const wasmModule = w.parseWat("a", wat, WASM_FEATURES);
+  try {
+    return wasmModule.toBinary({}).buffer;
+  } finally {
+    wasmModule.destroy();
+  }
 }
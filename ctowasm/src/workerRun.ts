@@ -0,0 +1,257 @@
+/**
+ * Running of compiled programs off the calling thread.
+ *
+ * The program runs in a worker (see programWorker.ts), so that a long running program neither freezes a browser page
+ * nor blocks the Node.js event loop. Its output is streamed back through a ring buffer in shared memory (see
+ * src/modules/outputRingBuffer.ts), which the host polls, instead of through a message per print. The run can be
+ * cancelled, and stopped after a wall clock time limit, by terminating the worker.
+ *
+ * Each run uses its own worker, which is terminated when the run ends, along with the workers of the threads of programs
+ * compiled with the threads option (see src/threadsRun.ts).
+ */
+
+import { ModuleName, ModulesGlobalConfig } from "~src/modules";
+import { HostWorker } from "~src/common/hostWorker";
+import { ThreadRegion } from "~src/modules/pthread/threadControl";
+import { ThreadWorkerSpawner, startThreadWorker } from "~src/threadsRun";
+import {
+  OutputRingBufferReader,
+  createOutputRingBuffer,
+} from "~src/modules/outputRingBuffer";
+
+export const DEFAULT_OUTPUT_POLL_INTERVAL_MS = 10;
+
+/**
+ * The parts of a successful compilation result that are needed to run the program in the worker.
+ */
+export interface CompiledProgram {
+  wasm: Uint8Array;
+  dataSegmentSize: number;
+  functionTableSize: number;
+  importedModules: ModuleName[];
+  threads?: boolean; // compiled with the threads option (see src/threadsRun.ts)
+}
+
+/**
+ * The parts of the modules config that can be passed to the worker (functions and profilers cannot).
+ */
+export type WorkerModulesConfig = Pick<
+  ModulesGlobalConfig,
+  "stdoutBufferMode" | "stdoutBufferSize" | "fuelLimit" | "stdin"
+>;
+
+// messages sent from the host to the worker
+export type ProgramWorkerRequest =
+  | {
+      type: "run";
+      program: CompiledProgram;
+      outputBuffer: SharedArrayBuffer; // see outputRingBuffer.ts
+      modulesConfig: WorkerModulesConfig;
+    }
+  | ThreadWorkerRequest;
+
+// sent to a worker started for a running program compiled with the threads option, to run one of its threads
+export type ThreadWorkerRequest = {
+  type: "thread";
+  program: CompiledProgram;
+  outputBuffer: SharedArrayBuffer;
+  modulesConfig: WorkerModulesConfig;
+  memory: WebAssembly.Memory; // the shared memory of the program
+  heapAddress: number; // address of the control block of the shared heap
+  thread: ThreadRegion;
+  startRoutine: number; // function pointer of the start routine of the thread
+  arg: number;
+};
+
+// messages sent from the worker to the host, once the program (or thread) has finished, or to start a thread
+export type ProgramWorkerResponse =
+  | { type: "exit"; fuelUsed?: number } // fuelUsed is only given if there is a fuel limit
+  | { type: "error"; message: string }
+  | { type: "thread"; request: ThreadWorkerRequest }; // asks the host to start a worker running the request
+
+/**
+ * The interface the host uses to talk to the worker running programWorker.ts (see src/common/hostWorker.ts for the
+ * adapters of browser Workers and Node.js worker_threads).
+ */
+export type ProgramWorker = HostWorker<
+  ProgramWorkerRequest,
+  ProgramWorkerResponse
+>;
+
+export interface WorkerRunOptions extends WorkerModulesConfig {
+  printFunction?: (str: string) => void; // called on the host with each string the program printed
+  timeLimitMs?: number; // wall clock time after which the program is stopped, unlimited by default
+  outputBufferSize?: number; // size in bytes of the output ring buffer
+  outputPollIntervalMs?: number;
+  spawnThreadWorker?: ThreadWorkerSpawner; // starts the workers of the threads of programs compiled with the threads option
+}
+
+/**
+ * "success" - the program ran to completion.
+ * "error" - the program failed at runtime (including running out of fuel).
+ * "timeout" - the program was stopped at the time limit.
+ * "cancelled" - the run was cancelled.
+ */
+export type WorkerRunStatus = "success" | "error" | "timeout" | "cancelled";
+
+export interface WorkerRunResult {
+  status: WorkerRunStatus;
+  runTimeMs: number; // wall clock time from the start of the run, including the instantiation of the program
+  errorMessage?: string;
+  fuelUsed?: number; // only for successful runs with a fuel limit
+}
+
+export default class WorkerRun {
+  readonly result: Promise<WorkerRunResult>;
+  private worker: ProgramWorker;
+  private outputReader: OutputRingBufferReader;
+  private printFunction: (str: string) => void;
+  private startTime: number;
+  private pollTimer: ReturnType<typeof setInterval>;
+  private timeLimitTimer: ReturnType<typeof setTimeout> | null = null;
+  private spawnThreadWorker?: ThreadWorkerSpawner;
+  private threadWorkerTerminators: (() => void)[] = [];
+  private resolveResult: (result: WorkerRunResult) => void = () => {};
+  private isFinished = false;
+
+  private constructor(
+    worker: ProgramWorker,
+    program: CompiledProgram,
+    options: WorkerRunOptions,
+  ) {
+    const {
+      printFunction = (str: string) => console.log(str),
+      timeLimitMs,
+      outputBufferSize,
+      outputPollIntervalMs = DEFAULT_OUTPUT_POLL_INTERVAL_MS,
+      spawnThreadWorker,
+      ...modulesConfig
+    } = options;
+    this.worker = worker;
+    this.spawnThreadWorker = spawnThreadWorker;
+    this.printFunction = printFunction;
+    this.result = new Promise((resolve) => {
+      this.resolveResult = resolve;
+    });
+    const outputBuffer = createOutputRingBuffer(outputBufferSize);
+    this.outputReader = new OutputRingBufferReader(outputBuffer);
+    this.startTime = performance.now();
+
+    worker.setMessageHandler((message) => {
+      if (message.type === "thread") {
+        this.startThreadWorker(message.request);
+      } else if (message.type === "exit") {
+        this.finish({
+          status: "success",
+          ...(typeof message.fuelUsed !== "undefined"
+            ? { fuelUsed: message.fuelUsed }
+            : {}),
+        });
+      } else {
+        this.finish({ status: "error", errorMessage: message.message });
+      }
+    });
+    // e.g. the worker script failed to load, or the program exited the worker before it could respond
+    worker.setFailureHandler((errorMessage) =>
+      this.finish({ status: "error", errorMessage }),
+    );
+    this.pollTimer = setInterval(
+      () => this.printOutput(false),
+      outputPollIntervalMs,
+    );
+    if (typeof timeLimitMs !== "undefined") {
+      this.timeLimitTimer = setTimeout(
+        () =>
+          this.finish({
+            status: "timeout",
+            errorMessage: `Program was stopped after the time limit of ${timeLimitMs} ms`,
+          }),
+        timeLimitMs,
+      );
+    }
+    const {
+      wasm,
+      dataSegmentSize,
+      functionTableSize,
+      importedModules,
+      threads,
+    } = program; // the program may be a whole compilation result, only what is needed is sent
+    worker.postMessage({
+      type: "run",
+      program: {
+        wasm,
+        dataSegmentSize,
+        functionTableSize,
+        importedModules,
+        ...(threads ? { threads } : {}),
+      },
+      outputBuffer,
+      modulesConfig,
+    });
+  }
+
+  /**
+   * Starts running the given compiled program in the given worker.
+   */
+  static start(
+    worker: ProgramWorker,
+    program: CompiledProgram,
+    options: WorkerRunOptions = {},
+  ): WorkerRun {
+    return new WorkerRun(worker, program, options);
+  }
+
+  /**
+   * Stops the program, if it is still running. The output it printed so far is still delivered.
+   */
+  cancel() {
+    this.finish({ status: "cancelled" });
+  }
+
+  private startThreadWorker(request: ThreadWorkerRequest) {
+    if (this.isFinished) {
+      return;
+    }
+    if (typeof this.spawnThreadWorker === "undefined") {
+      this.finish({
+        status: "error",
+        errorMessage:
+          "pthread_create(): the run was not given a way to start workers for threads (see spawnThreadWorker)",
+      });
+      return;
+    }
+    this.threadWorkerTerminators.push(
+      startThreadWorker(this.spawnThreadWorker, request, (threadRequest) =>
+        this.startThreadWorker(threadRequest),
+      ),
+    );
+  }
+
+  private printOutput(includePartial: boolean) {
+    for (const str of this.outputReader.read(includePartial)) {
+      this.printFunction(str);
+    }
+  }
+
+  private finish(result: Omit<WorkerRunResult, "runTimeMs">) {
+    if (this.isFinished) {
+      return;
+    }
+    this.isFinished = true;
+    clearInterval(this.pollTimer);
+    if (this.timeLimitTimer !== null) {
+      clearTimeout(this.timeLimitTimer);
+    }
+    this.worker.terminate();
+    // threads still running when main returned are stopped
+    for (const terminateThreadWorker of this.threadWorkerTerminators) {
+      terminateThreadWorker();
+    }
+    // the worker has finished writing, or was stopped, so everything left in the buffer is delivered
+    this.printOutput(true);
+    this.resolveResult({
+      ...result,
+      runTimeMs: performance.now() - this.startTime,
+    });
+  }
+}
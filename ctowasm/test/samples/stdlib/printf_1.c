@@ -0,0 +1,17 @@
+// Test formatted printing with printf, and its interaction with line buffered stdout
+#include <source_stdlib>
+
+int main() {
+  int x = 42;
+  float f = 3.14159;
+  char c = 'a';
+  long l = -1234567890123;
+  printf("x = %d hex = %#x\n", x, x);
+  printf("%5.2f|%-4c|%s\n", f, c, "str");
+  printf("%ld %+05d %u\n", l, 7, 4294967295u);
+  printf("%e %g %g\n", 1234.5, 0.0001, 1000000.0);
+  printf("no newline ");
+  print_int(7);
+  int n = printf("%%%s%%", "");
+  print_int(n);
+}
@@ -0,0 +1,46 @@
+// Test qsort on a larger array of structs, with many duplicate keys
+#include <source_stdlib>
+#include <utility>
+
+struct Pair {
+  int key;
+  char tag;
+  long value;
+};
+
+int compare_pairs(const void *a, const void *b) {
+  const struct Pair *pa = a; // need to do this as typecasting not yet supported
+  const struct Pair *pb = b;
+  return pa->key - pb->key;
+}
+
+struct Pair pairs[500];
+
+int main() {
+  int seed = 12345;
+  for (int i = 0; i < 500; i++) {
+    seed = (seed * 1103 + 12345) % 65536;
+    pairs[i].key = seed % 100;
+    pairs[i].tag = 'a' + i % 26;
+    pairs[i].value = pairs[i].key * 1000L + i;
+  }
+
+  qsort(pairs, 500, sizeof(struct Pair), compare_pairs);
+
+  int sorted = 1;
+  int intact = 1;
+  for (int i = 0; i < 500; i++) {
+    if (i > 0 && pairs[i - 1].key > pairs[i].key) {
+      sorted = 0;
+    }
+    // each element must have been moved as a whole
+    if (pairs[i].value / 1000 != pairs[i].key ||
+        pairs[i].tag != 'a' + (pairs[i].value % 1000) % 26) {
+      intact = 0;
+    }
+  }
+  print_int(sorted);
+  print_int(intact);
+  print_int(pairs[0].key);
+  print_int(pairs[499].key);
+}
@@ -0,0 +1,13 @@
+#include <source_stdlib>
+
+/**
+ * Reads the whole input with getchar, which keeps returning EOF (-1) once the input has run out.
+ */
+int main() {
+  int c = getchar();
+  while (c != -1) {
+    print_int(c);
+    c = getchar();
+  }
+  print_int(getchar());
+}
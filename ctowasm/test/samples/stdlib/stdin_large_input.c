@@ -0,0 +1,18 @@
+#include <source_stdlib>
+
+/**
+ * Recurses with a large frame after a long preloaded input, which must not take room from the stack.
+ */
+int sum(int depth) {
+  int a[64];
+  a[depth % 64] = depth;
+  if (depth == 0) {
+    return 0;
+  }
+  return a[depth % 64] + sum(depth - 1);
+}
+
+int main() {
+  print_int(sum(50));
+  print_long(read_long());
+}
@@ -0,0 +1,15 @@
+#include <source_stdlib>
+
+/**
+ * Reads integers with read_int, which skips leading whitespace and reads an optional sign.
+ * It stops without consuming the first character that is not part of an integer, and returns 0 at the end of input.
+ */
+int main() {
+  for (int i = 0; i < 6; ++i) {
+    print_int(read_int());
+  }
+  print_int(read_int()); // no integer before 'x'
+  print_int(getchar());
+  print_int(read_int()); // end of input
+  print_int(getchar());
+}
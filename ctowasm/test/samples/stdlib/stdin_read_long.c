@@ -0,0 +1,13 @@
+#include <source_stdlib>
+
+/**
+ * Reads 64 bit integers with read_long, which wrap around on overflow as read_int does at 32 bits.
+ */
+int main() {
+  print_long(read_long());
+  print_long(read_long());
+  print_long(read_long());
+  print_long(read_long()); // wraps around
+  print_int(read_int()); // wraps around at 32 bits
+  print_long(read_long()); // end of input
+}
@@ -664,6 +664,62 @@ const testLog = {
       expectedValues: [1, 1],
     },
   },
+  stdlib: {
+    qsort_1: {
+      title: "Test qsort on array of ints",
+      expectedCode: false,
+      expectedValues: [-743, -2, 0, 2, 4, 99],
+    },
+    qsort_2: {
+      title: "Test qsort on larger array of structs with duplicate keys",
+      expectedCode: false,
+      expectedValues: [1, 1, 0, 97],
+    },
+    printf_1: {
+      title: "Test printf formatting and line buffered stdout",
+      expectedCode: false,
+      expectedValues: [
+        "x = 42 hex = 0x2a",
+        " 3.14|a   |str",
+        "-1234567890123 +0007 4294967295",
+        "1.234500e+03 0.0001 1e+06",
+        "no newline 7",
+        "%%2",
+      ],
+    },
+    stdin_getchar: {
+      title: "Test getchar on preloaded stdin, including bytes over 127 and EOF",
+      expectedCode: false,
+      stdin: "ab\n\u00e9",
+      expectedValues: [97, 98, 10, 195, 169, -1],
+    },
+    stdin_read_int: {
+      title: "Test read_int on preloaded stdin with leading whitespace and signs",
+      expectedCode: false,
+      stdin: "  42\n\t-7 +3 -0\r\n007  2147483647 x",
+      expectedValues: [42, -7, 3, 0, 7, 2147483647, 0, 120, 0, -1],
+    },
+    stdin_read_long: {
+      title: "Test read_long on preloaded stdin with 64 bit values and overflow",
+      expectedCode: false,
+      stdin:
+        "9000000000 -9223372036854775808 9223372036854775807 18446744073709551617 4294967298",
+      expectedValues: [
+        "9000000000",
+        "-9223372036854775808",
+        "9223372036854775807",
+        1,
+        2,
+        0,
+      ],
+    },
+    stdin_large_input: {
+      title: "Test recursion with large frames after a long preloaded stdin",
+      expectedCode: false,
+      stdin: "42" + " ".repeat(65000),
+      expectedValues: [1275, "42"],
+    },
+  },
   error: {
     enum_redeclaration: {
       title: "Redeclaration of enum type",
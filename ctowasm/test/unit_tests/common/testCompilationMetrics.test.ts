@@ -0,0 +1,21 @@
+import { describe, expect, test } from "@jest/globals";
+import { countAstNodes } from "../../../src/common/compilationMetrics";
+
+describe("Test countAstNodes", () => {
+  test("Counts nested nodes, ignoring objects without a type", () => {
+    const ast = {
+      type: "Root",
+      position: { start: 0, end: 10 },
+      children: [
+        { type: "A", value: 1n },
+        { type: "B", expr: { type: "C" }, list: [] },
+      ],
+    };
+    expect(countAstNodes(ast)).toBe(4);
+  });
+
+  test("Nodes referenced more than once are counted each time", () => {
+    const shared = { type: "Shared" };
+    expect(countAstNodes([shared, { type: "Parent", child: shared }])).toBe(3);
+  });
+});
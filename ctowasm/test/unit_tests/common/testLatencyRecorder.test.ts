@@ -0,0 +1,44 @@
+import { describe, expect, test } from "@jest/globals";
+import LatencyRecorder from "../../../src/common/latencyRecorder";
+
+describe("Test LatencyRecorder", () => {
+  test("No samples", () => {
+    expect(new LatencyRecorder().getPercentiles()).toEqual({
+      count: 0,
+      p50: 0,
+      p90: 0,
+      p99: 0,
+      max: 0,
+    });
+  });
+
+  test("Nearest-rank percentiles", () => {
+    const recorder = new LatencyRecorder();
+    // recorded out of order
+    for (let i = 100; i >= 1; --i) {
+      recorder.record(i);
+    }
+    expect(recorder.getPercentiles()).toEqual({
+      count: 100,
+      p50: 50,
+      p90: 90,
+      p99: 99,
+      max: 100,
+    });
+  });
+
+  test("Only the latest samples are kept", () => {
+    const recorder = new LatencyRecorder();
+    for (let i = 0; i < 10000; ++i) {
+      recorder.record(1000);
+    }
+    for (let i = 0; i < 10000; ++i) {
+      recorder.record(1);
+    }
+    expect(recorder.getPercentiles()).toMatchObject({
+      count: 20000,
+      p99: 1,
+      max: 1,
+    });
+  });
+});
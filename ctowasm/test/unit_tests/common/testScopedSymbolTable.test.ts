@@ -0,0 +1,56 @@
+import { describe, expect, test } from "@jest/globals";
+import ScopedSymbolTable, {
+  IdentifierTable,
+} from "../../../src/common/scopedSymbolTable";
+
+describe("Test ScopedSymbolTable", () => {
+  test("Interns identifiers", () => {
+    const identifiers = new IdentifierTable();
+    expect(identifiers.intern("x")).toBe(0);
+    expect(identifiers.intern("y")).toBe(1);
+    expect(identifiers.intern("x")).toBe(0);
+    expect(identifiers.getName(1)).toBe("y");
+    expect(identifiers.getId("z")).toBe(-1);
+  });
+
+  test("Shadows and uncovers symbols of enclosing scopes", () => {
+    const symbols = new ScopedSymbolTable<string>();
+    symbols.declare("x", "global x");
+    symbols.enterScope();
+    expect(symbols.lookup("x")).toBe("global x");
+    expect(symbols.lookupInCurrentScope("x")).toBeUndefined();
+    symbols.declare("x", "local x");
+    symbols.declare("y", "local y");
+    expect(symbols.lookup("x")).toBe("local x");
+    expect(symbols.lookupInCurrentScope("x")).toBe("local x");
+    expect(symbols.scopeDepth).toBe(1);
+    symbols.exitScope();
+    expect(symbols.lookup("x")).toBe("global x");
+    expect(symbols.lookup("y")).toBeUndefined();
+    expect(symbols.scopeDepth).toBe(0);
+    expect(() => symbols.exitScope()).toThrow();
+  });
+
+  test("Replaces a redeclaration in the same scope", () => {
+    const symbols = new ScopedSymbolTable<number>();
+    symbols.enterScope();
+    symbols.declare("x", 1);
+    symbols.declare("x", 2);
+    expect(symbols.lookup("x")).toBe(2);
+    symbols.exitScope();
+    expect(symbols.lookup("x")).toBeUndefined();
+  });
+
+  test("Pushes and pops entries without scopes", () => {
+    const identifiers = new IdentifierTable();
+    const symbols = new ScopedSymbolTable<number>(identifiers);
+    symbols.push("x", 1);
+    symbols.push("x", 2);
+    expect(symbols.lookupById(identifiers.getId("x"))).toBe(2);
+    expect(symbols.pop("x")).toBe(2);
+    expect(symbols.lookup("x")).toBe(1);
+    expect(symbols.pop("x")).toBe(1);
+    expect(symbols.pop("x")).toBeUndefined();
+    expect(symbols.pop("never declared")).toBeUndefined();
+  });
+});
@@ -0,0 +1,183 @@
+import { beforeAll, describe, expect, test } from "@jest/globals";
+import { webcrypto } from "crypto";
+import {
+  BatchJob,
+  isOutputMatching,
+  runBatchJob,
+  runCompiledBatchJob,
+} from "../../../src/batch";
+import CompilationCache, {
+  CompilationCacheStore,
+} from "../../../src/compilationCache";
+import {
+  CompilationResult,
+  SuccessfulCompilationResult,
+} from "../../../src/compiler";
+import { compileWatToWasm } from "../../../src/wat-to-wasm";
+
+/**
+ * Returns the compilation result of a program that prints each of the given ints, then traps if trap is set.
+ */
+async function compileProgram(
+  ints: number[],
+  trap = false,
+): Promise<CompilationResult> {
+  const wasm = await compileWatToWasm(`
+(module
+  (import "js" "mem" (memory 1))
+  (import "source_stdlib" "print_int" (func $print_int (param i32)))
+  (import "js" "function_table" (table 0 funcref))
+  (func $main
+    ${ints.map((int) => `(call $print_int (i32.const ${int}))`).join("\n    ")}
+    ${trap ? "(unreachable)" : ""})
+  (start $main))
+`);
+  return {
+    status: "success",
+    wasm,
+    dataSegmentSize: 0,
+    functionTableSize: 0,
+    importedModules: ["source_stdlib"],
+    warnings: [],
+  };
+}
+
+function createJob(testCases: BatchJob["testCases"]): BatchJob {
+  return { file: "program.c", source: "", testCases };
+}
+
+/**
+ * A store kept in memory, standing in for a cache directory shared by the workers of a batch.
+ */
+function createStore(): CompilationCacheStore {
+  const results: Map<string, SuccessfulCompilationResult> = new Map();
+  return {
+    get: async (key) => results.get(key),
+    set: async (key, result) => {
+      results.set(key, result);
+    },
+  };
+}
+
+beforeAll(() => {
+  if (typeof globalThis.crypto === "undefined") {
+    // eslint-disable-next-line
+    (globalThis as any).crypto = webcrypto;
+  }
+});
+
+describe("Test batch jobs", () => {
+  test("Test cases pass or fail on the output of the program", async () => {
+    const result = await runCompiledBatchJob(
+      createJob([
+        { expectedOutput: "1\n23\n" },
+        { expectedOutput: "1\n23" }, // trailing whitespace is ignored
+        { expectedOutput: "1\n24\n" },
+        {},
+      ]),
+      await compileProgram([1, 23]),
+      5,
+    );
+    expect(result).toMatchObject({
+      file: "program.c",
+      status: "success",
+      compileTimeMs: 5,
+      warnings: [],
+    });
+    expect(result.testCases.map((testCase) => testCase.status)).toEqual([
+      "passed",
+      "passed",
+      "failed",
+      "ran",
+    ]);
+    for (const testCase of result.testCases) {
+      expect(testCase.output).toBe("1\n23");
+      expect(testCase.heapStats).toBeDefined();
+    }
+  });
+
+  test("Programs are run once if there are no test cases", async () => {
+    const result = await runCompiledBatchJob(
+      createJob([]),
+      await compileProgram([7]),
+      0,
+    );
+    expect(result.testCases).toMatchObject([{ status: "ran", output: "7" }]);
+  });
+
+  test("Runtime errors are reported with the output up to the error", async () => {
+    const result = await runCompiledBatchJob(
+      createJob([{ expectedOutput: "1" }]),
+      await compileProgram([1], true),
+      0,
+    );
+    expect(result.status).toBe("success"); // the program compiled
+    expect(result.testCases).toMatchObject([
+      { status: "error", output: "1", errorMessage: "unreachable" },
+    ]);
+    expect(result.testCases[0].heapStats).toBeUndefined();
+  });
+
+  test("Programs that failed to compile are not run", async () => {
+    const result = await runCompiledBatchJob(
+      createJob([{ expectedOutput: "1" }]),
+      { status: "failure", errorMessage: "undeclared identifier" },
+      3,
+    );
+    expect(result).toEqual({
+      file: "program.c",
+      status: "failure",
+      compileTimeMs: 3,
+      errorMessage: "undeclared identifier",
+      testCases: [],
+    });
+  });
+
+  test("Programs are not compiled again by a later run sharing the cache store", async () => {
+    const store = createStore();
+    const job: BatchJob = {
+      file: "program.c",
+      source: "#include <source_stdlib>\nint main() { print_int(read_int() * 2); }",
+      testCases: [{ stdin: "21", expectedOutput: "42" }],
+    };
+    // each run of the batch has caches of its own, e.g. in the workers of another process
+    const firstRunCache = new CompilationCache({ store });
+    const firstResult = await runBatchJob(job, firstRunCache);
+    expect(firstResult).toMatchObject({
+      status: "success",
+      compilationCached: false,
+    });
+    expect(firstRunCache.getMetrics()).toMatchObject({ misses: 1 });
+
+    const secondRunCache = new CompilationCache({ store });
+    const secondResult = await runBatchJob(job, secondRunCache);
+    expect(secondResult).toMatchObject({
+      status: "success",
+      compilationCached: true,
+    });
+    expect(secondRunCache.getMetrics()).toMatchObject({
+      storeHits: 1,
+      misses: 0,
+    });
+    expect(secondResult.testCases).toMatchObject([
+      { status: "passed", output: "42" },
+    ]);
+  });
+
+  test("Jobs run without a cache do not report whether they were cached", async () => {
+    const result = await runBatchJob({
+      file: "program.c",
+      source: "int main() {}",
+      testCases: [],
+    });
+    expect(result.status).toBe("success");
+    expect(result.compilationCached).toBeUndefined();
+  });
+
+  test("Outputs are compared ignoring trailing whitespace", () => {
+    expect(isOutputMatching("a\nb", "a\nb\n")).toBe(true);
+    expect(isOutputMatching("a \n", "a")).toBe(true);
+    expect(isOutputMatching(" a", "a")).toBe(false);
+    expect(isOutputMatching("a\nb", "a\n\nb")).toBe(false);
+  });
+});
@@ -0,0 +1,176 @@
+import { beforeAll, describe, expect, test } from "@jest/globals";
+import { webcrypto } from "crypto";
+import CompilationCache, {
+  CacheFileSystem,
+  DirectoryCompilationCacheStore,
+} from "../../../src/compilationCache";
+import {
+  CompilationResult,
+  SuccessfulCompilationResult,
+} from "../../../src/compiler";
+import ModuleRepository from "../../../src/modules";
+
+// the module signatures are part of the cache key, no modules are needed to test the cache itself
+const moduleRepository = { modules: {} } as unknown as ModuleRepository;
+
+function createResult(wasmSize: number): SuccessfulCompilationResult {
+  return {
+    status: "success",
+    wasm: new Uint8Array(wasmSize),
+    dataSegmentSize: 4,
+    functionTableSize: 1,
+    importedModules: ["source_stdlib"],
+    warnings: ["a warning"],
+  };
+}
+
+/**
+ * Returns a compile function that counts how many times it was called.
+ */
+function createCountingCompile(result: CompilationResult) {
+  const compile = async () => {
+    ++compile.calls;
+    return result;
+  };
+  compile.calls = 0;
+  return compile;
+}
+
+/**
+ * An in-memory stand-in for the fs/promises API.
+ */
+function createFileSystem() {
+  const files: Map<string, Uint8Array | string> = new Map();
+  const fs = {
+    readFile: async (path: string, encoding?: "utf-8") => {
+      const data = files.get(path);
+      if (typeof data === "undefined") {
+        throw new Error(`ENOENT: ${path}`);
+      }
+      return encoding === "utf-8" ? data : (data as Uint8Array).slice();
+    },
+    writeFile: async (path: string, data: Uint8Array | string) => {
+      files.set(path, data);
+    },
+    rename: async (oldPath: string, newPath: string) => {
+      files.set(newPath, files.get(oldPath) as string);
+      files.delete(oldPath);
+    },
+    mkdir: async () => undefined,
+  } as unknown as CacheFileSystem;
+  return { fs, files };
+}
+
+beforeAll(() => {
+  if (typeof globalThis.crypto === "undefined") {
+    // eslint-disable-next-line
+    (globalThis as any).crypto = webcrypto;
+  }
+});
+
+describe("Test compilation cache", () => {
+  test("Successful compilations are only compiled once", async () => {
+    const cache = new CompilationCache();
+    const compile = createCountingCompile(createResult(8));
+    const first = await cache.getOrCompile(
+      "int main() {}",
+      moduleRepository,
+      compile,
+    );
+    const second = await cache.getOrCompile(
+      "int main() {}",
+      moduleRepository,
+      compile,
+    );
+    expect(compile.calls).toBe(1);
+    expect(second).toEqual(first);
+    expect(cache.getMetrics()).toMatchObject({ memoryHits: 1, misses: 1 });
+  });
+
+  test("Key depends on the source and the options", async () => {
+    const cache = new CompilationCache();
+    const key = await cache.getKey("int main() {}", moduleRepository);
+    expect(key).toMatch(/^[0-9a-f]{64}$/);
+    expect(await cache.getKey("int main() {}", moduleRepository)).toBe(key);
+    expect(await cache.getKey("int main( ) {}", moduleRepository)).not.toBe(
+      key,
+    );
+    expect(
+      await cache.getKey("int main() {}", moduleRepository, { fuel: 100 }),
+    ).not.toBe(key);
+  });
+
+  test("Key depends on the build of the compiler", async () => {
+    const key = await new CompilationCache({
+      compilerFingerprint: "a",
+    }).getKey("int main() {}", moduleRepository);
+    expect(
+      await new CompilationCache({ compilerFingerprint: "a" }).getKey(
+        "int main() {}",
+        moduleRepository,
+      ),
+    ).toBe(key);
+    expect(
+      await new CompilationCache({ compilerFingerprint: "b" }).getKey(
+        "int main() {}",
+        moduleRepository,
+      ),
+    ).not.toBe(key);
+  });
+
+  test("Failed compilations are not cached", async () => {
+    const cache = new CompilationCache();
+    const compile = createCountingCompile({
+      status: "failure",
+      errorMessage: "error",
+    });
+    await cache.getOrCompile("int main() {", moduleRepository, compile);
+    await cache.getOrCompile("int main() {", moduleRepository, compile);
+    expect(compile.calls).toBe(2);
+  });
+
+  test("Least recently used entries are evicted", async () => {
+    const cache = new CompilationCache({ maxEntries: 2 });
+    await cache.set("a", createResult(1));
+    await cache.set("b", createResult(1));
+    await cache.get("a"); // b is now the least recently used
+    await cache.set("c", createResult(1));
+    expect(await cache.get("b")).toBeUndefined();
+    expect(await cache.get("a")).toBeDefined();
+    expect(await cache.get("c")).toBeDefined();
+    expect(cache.getMetrics()).toMatchObject({ evictions: 1, entries: 2 });
+  });
+
+  test("Entries are evicted to stay within the byte limit", async () => {
+    const cache = new CompilationCache({ maxBytes: 100 });
+    await cache.set("a", createResult(60));
+    await cache.set("b", createResult(60));
+    expect(cache.getMetrics()).toMatchObject({ entries: 1, bytes: 60 });
+    expect(await cache.get("a")).toBeUndefined();
+  });
+
+  test("Results persist in a directory store across caches", async () => {
+    const { fs, files } = createFileSystem();
+    const compile = createCountingCompile(createResult(8));
+    const firstCache = new CompilationCache({
+      store: new DirectoryCompilationCacheStore(fs, "cache/"),
+    });
+    await firstCache.getOrCompile("int main() {}", moduleRepository, compile);
+    expect(files.size).toBe(2);
+
+    const secondCache = new CompilationCache({
+      store: new DirectoryCompilationCacheStore(fs, "cache"),
+    });
+    const result = await secondCache.getOrCompile(
+      "int main() {}",
+      moduleRepository,
+      compile,
+    );
+    expect(compile.calls).toBe(1);
+    expect(result).toEqual(createResult(8));
+    expect(secondCache.getMetrics()).toMatchObject({
+      storeHits: 1,
+      misses: 0,
+    });
+  });
+});
@@ -0,0 +1,183 @@
+import { describe, expect, test } from "@jest/globals";
+import CompileServer, {
+  CompileServerCompiler,
+} from "../../../src/compileServer";
+import { CompilationResult } from "../../../src/compiler";
+
+const WASM = new Uint8Array([0, 97, 115, 109]); // "\0asm"
+
+function createSuccessfulResult(): CompilationResult {
+  return {
+    status: "success",
+    wasm: WASM,
+    dataSegmentSize: 0,
+    functionTableSize: 0,
+    importedModules: [],
+    warnings: [],
+  };
+}
+
+/**
+ * Compiles every program successfully, or fails for programs containing "error".
+ * Programs containing "print" print their source when run, and programs containing "trap" then throw.
+ */
+function createCompiler(): CompileServerCompiler & { sources: string[] } {
+  const sources: string[] = [];
+  const compile = async (source: string): Promise<CompilationResult> => {
+    sources.push(source);
+    return source.includes("error")
+      ? { status: "failure", errorMessage: `error in "${source}"` }
+      : createSuccessfulResult();
+  };
+  return {
+    sources,
+    compile,
+    compileAndRun: async (source, modulesConfig) => {
+      const result = await compile(source);
+      if (source.includes("print")) {
+        modulesConfig?.printFunction?.(source);
+      }
+      if (source.includes("trap")) {
+        throw new Error("unreachable");
+      }
+      return result;
+    },
+  };
+}
+
+/**
+ * Returns a promise, and the function that resolves it.
+ */
+function createDeferred() {
+  let resolve: () => void = () => {};
+  const promise = new Promise<void>((r) => {
+    resolve = r;
+  });
+  return { promise, resolve };
+}
+
+async function handle(server: CompileServer, request: object) {
+  return JSON.parse(await server.handleLine(JSON.stringify(request)));
+}
+
+describe("Test compile server", () => {
+  test("Compile requests respond with the compiled program", async () => {
+    const server = new CompileServer(undefined, createCompiler());
+    const response = await handle(server, {
+      id: 1,
+      type: "compile",
+      source: "int main() {}",
+    });
+    expect(response).toMatchObject({
+      id: 1,
+      status: "success",
+      wasm: "AGFzbQ==",
+      dataSegmentSize: 0,
+      functionTableSize: 0,
+      importedModules: [],
+      warnings: [],
+    });
+    expect(typeof response.timeMs).toBe("number");
+  });
+
+  test("Compile and run requests respond with the output of the program", async () => {
+    const server = new CompileServer(undefined, createCompiler());
+    expect(
+      await handle(server, { type: "compileAndRun", source: "print" }),
+    ).toMatchObject({ status: "success", output: "print", warnings: [] });
+    // the output printed before the program failed is kept
+    expect(
+      await handle(server, { type: "compileAndRun", source: "print trap" }),
+    ).toMatchObject({
+      status: "error",
+      errorMessage: "unreachable",
+      output: "print trap",
+    });
+  });
+
+  test("Compilation errors and invalid requests respond with their error", async () => {
+    const server = new CompileServer(undefined, createCompiler());
+    expect(
+      await handle(server, { id: "a", type: "compile", source: "error" }),
+    ).toMatchObject({
+      id: "a",
+      status: "failure",
+      errorMessage: 'error in "error"',
+    });
+    expect(
+      await handle(server, { type: "compileAndRun", source: "error" }),
+    ).toMatchObject({ status: "failure", errorMessage: 'error in "error"' });
+    expect(await handle(server, { type: "compile" })).toMatchObject({
+      status: "error",
+      errorMessage: '"compile" request has no "source"',
+    });
+    expect(await handle(server, { type: "link" })).toMatchObject({
+      status: "error",
+      errorMessage: "unknown request type: link",
+    });
+    expect(JSON.parse(await server.handleLine("{"))).toMatchObject({
+      status: "error",
+    });
+    // only the requests that were handled without an error are in the latency stats
+    expect(await handle(server, { type: "stats" })).toMatchObject({
+      status: "success",
+      latency: { compile: { count: 1 }, compileAndRun: { count: 1 } },
+    });
+  });
+
+  test("Concurrent requests are handled one at a time, in order of arrival", async () => {
+    const compiler = createCompiler();
+    const blocked = createDeferred();
+    let active = 0;
+    let maxActive = 0;
+    const compile = compiler.compile;
+    compiler.compile = async (source, ...args) => {
+      maxActive = Math.max(maxActive, ++active);
+      if (source === "first") {
+        await blocked.promise;
+      }
+      const result = await compile(source, ...args);
+      --active;
+      return result;
+    };
+    const server = new CompileServer(undefined, compiler);
+    const responses = ["first", "error", "third"].map((source, id) =>
+      server
+        .handleLine(JSON.stringify({ id, type: "compile", source }))
+        .then(JSON.parse),
+    );
+    blocked.resolve();
+    const [first, second, third] = await Promise.all(responses);
+    expect(maxActive).toBe(1);
+    expect(compiler.sources).toEqual(["first", "error", "third"]);
+    expect(first).toMatchObject({ id: 0, status: "success" });
+    expect(second).toMatchObject({ id: 1, status: "failure" });
+    expect(third).toMatchObject({ id: 2, status: "success" });
+  });
+
+  test("Closing waits for the requests in progress and refuses new ones", async () => {
+    const compiler = createCompiler();
+    const blocked = createDeferred();
+    const compile = compiler.compile;
+    compiler.compile = async (...args) => {
+      await blocked.promise;
+      return compile(...args);
+    };
+    const server = new CompileServer(undefined, compiler);
+    const inProgress = handle(server, { type: "compile", source: "a" });
+    let closed = false;
+    const closing = server.close().then(() => {
+      closed = true;
+    });
+    expect(await handle(server, { type: "compile", source: "b" })).toEqual({
+      status: "error",
+      errorMessage: "server is shutting down",
+      timeMs: 0,
+    });
+    expect(closed).toBe(false);
+    blocked.resolve();
+    expect(await inProgress).toMatchObject({ status: "success" });
+    await closing;
+    expect(compiler.sources).toEqual(["a"]);
+  });
+});
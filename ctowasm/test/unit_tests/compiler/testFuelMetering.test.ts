@@ -0,0 +1,95 @@
+import { describe, expect, test } from "@jest/globals";
+import instrumentFuelMetering, {
+  FUEL_EXHAUSTED_FUNCTION,
+  FUEL_GLOBAL,
+  FUEL_LIMIT_GLOBAL,
+} from "../../../src/translator/fuelMetering";
+import { WasmStatement } from "../../../src/translator/wasm-ast/core";
+import { generateWat } from "../../../src/wat-generator";
+import { createModule } from "../fixtures";
+
+// returns the amount of fuel charged by the fuel charge at the start of the given body
+function getChargedFuel(body: WasmStatement[]) {
+  const charge = body[0];
+  if (
+    charge.type !== "GlobalSet" ||
+    charge.name !== FUEL_GLOBAL ||
+    charge.value.type !== "BinaryExpression" ||
+    charge.value.rightExpr.type !== "IntegerConst"
+  ) {
+    throw new Error("body does not start with a fuel charge");
+  }
+  return charge.value.rightExpr.value;
+}
+
+const NUMBER_OF_CHARGE_STATEMENTS = 2;
+
+describe("Test fuel metering instrumentation", () => {
+  test("Function bodies and loop iterations are charged once per block", () => {
+    const loopBody: WasmStatement[] = [
+      {
+        type: "GlobalSet",
+        name: "r1",
+        value: { type: "GlobalGet", name: "sp" },
+      },
+      { type: "Branch", label: "loop1" },
+    ];
+    const wasmModule = createModule([
+      { type: "Loop", label: "loop1", body: loopBody },
+      { type: "Branch", label: "func_block" },
+    ]);
+    instrumentFuelMetering(wasmModule);
+
+    const functionBody = wasmModule.functions.main.body;
+    // the loop and the branch, the loop body is charged separately
+    expect(getChargedFuel(functionBody)).toBe(2n);
+    const loop = functionBody[NUMBER_OF_CHARGE_STATEMENTS];
+    expect(loop.type).toBe("Loop");
+    if (loop.type === "Loop") {
+      // global.set, global.get and branch
+      expect(getChargedFuel(loop.body)).toBe(3n);
+      expect(loop.body.length).toBe(
+        NUMBER_OF_CHARGE_STATEMENTS + loopBody.length,
+      );
+    }
+  });
+
+  test("If and else arms are charged with the enclosing block", () => {
+    const wasmModule = createModule([
+      {
+        type: "SelectionStatement",
+        condition: {
+          type: "BooleanExpression",
+          wasmDataType: "i32",
+          expr: { type: "GlobalGet", name: "r1" },
+        },
+        actions: [{ type: "Branch", label: "func_block" }],
+        elseStatements: [],
+      },
+    ]);
+    instrumentFuelMetering(wasmModule);
+    const selectionStatement =
+      wasmModule.functions.main.body[NUMBER_OF_CHARGE_STATEMENTS];
+    // selection statement, boolean expression, global.get and branch
+    expect(getChargedFuel(wasmModule.functions.main.body)).toBe(4n);
+    expect(selectionStatement).toMatchObject({
+      type: "SelectionStatement",
+      actions: [{ type: "Branch", label: "func_block" }],
+    });
+  });
+
+  test("The fuel global is defined from the imported fuel limit and exported", () => {
+    const wasmModule = createModule([]);
+    instrumentFuelMetering(wasmModule);
+    const wat = generateWat(wasmModule);
+    expect(wat).toContain(
+      `(import "js" "${FUEL_EXHAUSTED_FUNCTION}" (func $${FUEL_EXHAUSTED_FUNCTION}))`,
+    );
+    expect(wat).toContain(
+      `(global $${FUEL_LIMIT_GLOBAL} (import "js" "${FUEL_LIMIT_GLOBAL}") i64)`,
+    );
+    expect(wat).toContain(
+      `(global $${FUEL_GLOBAL} (export "${FUEL_GLOBAL}") (mut i64) (global.get $${FUEL_LIMIT_GLOBAL}))`,
+    );
+  });
+});
@@ -0,0 +1,121 @@
+import { describe, expect, test } from "@jest/globals";
+import Profiler from "../../../src/profiler";
+import instrumentProfiling, {
+  PROFILE_ENTER_FUNCTION,
+  PROFILE_EXIT_FUNCTION,
+} from "../../../src/translator/profiling";
+import { createModule } from "../fixtures";
+
+const MAIN = 0;
+const FIB = 1;
+const PRINT = 2;
+
+// a profiler with a clock that is advanced manually
+function createProfiler() {
+  const clock = { time: 0 };
+  const profiler = new Profiler(["main", "fib", "print"], () => clock.time);
+  return { profiler, clock };
+}
+
+describe("Test Profiler", () => {
+  test("Inclusive and exclusive times", () => {
+    const { profiler, clock } = createProfiler();
+    profiler.enter(MAIN);
+    clock.time = 1;
+    profiler.enter(PRINT);
+    clock.time = 4;
+    profiler.exit(PRINT);
+    profiler.enter(PRINT);
+    clock.time = 6;
+    profiler.exit(PRINT);
+    clock.time = 10;
+    profiler.exit(MAIN);
+
+    expect(profiler.getFlatProfile()).toEqual([
+      {
+        name: "main",
+        calls: 1,
+        inclusiveTime: 10,
+        exclusiveTime: 5,
+        exclusivePercentage: 50,
+      },
+      {
+        name: "print",
+        calls: 2,
+        inclusiveTime: 5,
+        exclusiveTime: 5,
+        exclusivePercentage: 50,
+      },
+    ]);
+    expect(profiler.getCallGraphProfile()).toEqual([
+      { caller: null, callee: "main", calls: 1, inclusiveTime: 10 },
+      { caller: "main", callee: "print", calls: 2, inclusiveTime: 5 },
+    ]);
+  });
+
+  test("Recursive calls are not counted twice in inclusive time", () => {
+    const { profiler, clock } = createProfiler();
+    profiler.enter(MAIN);
+    profiler.enter(FIB);
+    clock.time = 1;
+    profiler.enter(FIB);
+    clock.time = 3;
+    profiler.exit(FIB);
+    clock.time = 4;
+    profiler.exit(FIB);
+    profiler.exit(MAIN);
+
+    const fib = profiler
+      .getFlatProfile()
+      .find((entry) => entry.name === "fib");
+    expect(fib).toMatchObject({ calls: 2, inclusiveTime: 4, exclusiveTime: 4 });
+  });
+
+  test("Calls still running when the profile is taken are ended", () => {
+    const { profiler, clock } = createProfiler();
+    profiler.enter(MAIN);
+    profiler.enter(FIB);
+    clock.time = 2;
+    // e.g. the program trapped in fib
+    expect(profiler.getFlatProfile()).toEqual([
+      expect.objectContaining({ name: "fib", exclusiveTime: 2 }),
+      expect.objectContaining({ name: "main", inclusiveTime: 2 }),
+    ]);
+  });
+});
+
+describe("Test profiling instrumentation", () => {
+  test("Returns branch to the epilogue", () => {
+    const wasmModule = createModule([], {
+      functions: {
+        helper: {
+          type: "Function",
+          name: "helper",
+          body: [
+            {
+              type: "Loop",
+              label: "loop",
+              body: [{ type: "ReturnStatement" }],
+            },
+          ],
+        },
+      },
+    });
+    expect(instrumentProfiling(wasmModule)).toEqual(["main", "helper"]);
+    const body = wasmModule.functions.helper.body;
+    expect(body[0]).toMatchObject({
+      type: "RegularFunctionCall",
+      name: PROFILE_ENTER_FUNCTION,
+      args: [{ value: 1n }],
+    });
+    expect(body[1]).toMatchObject({
+      type: "Block",
+      body: [{ type: "Loop", body: [{ type: "Branch" }] }],
+    });
+    expect(body[2]).toMatchObject({
+      type: "RegularFunctionCall",
+      name: PROFILE_EXIT_FUNCTION,
+      args: [{ value: 1n }],
+    });
+  });
+});
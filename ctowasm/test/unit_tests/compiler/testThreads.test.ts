@@ -0,0 +1,88 @@
+import { describe, expect, test } from "@jest/globals";
+import { createMutexLockWasmImplementation } from "../../../src/modules/pthread/atomics";
+import prepareForThreads, {
+  INIT_DATA_SEGMENT_FUNCTION,
+  STACK_OVERFLOW_FUNCTION,
+  THREADS_MAXIMUM_MEMORY_PAGES,
+} from "../../../src/translator/threads";
+import { getStackSpaceAllocationCheckStatement } from "../../../src/translator/memoryUtil";
+import { WasmStatement } from "../../../src/translator/wasm-ast/core";
+import { generateWat } from "../../../src/wat-generator";
+import generateWatStatement from "../../../src/wat-generator/generateWatStatement";
+import { createModule } from "../fixtures";
+
+// a module with a data segment, which threads initialise separately
+function createModuleWithData(body: WasmStatement[]) {
+  return createModule(body, {
+    dataSegmentByteStr: "\\d0\\e0\\b0\\f0",
+    dataSegmentSize: 4,
+  });
+}
+
+describe("Test preparation of modules for threads", () => {
+  test("Stack space checks call stack_overflow instead of growing memory", () => {
+    const wasmModule = createModuleWithData([
+      getStackSpaceAllocationCheckStatement(16),
+      {
+        type: "Block",
+        label: "func_block",
+        body: [getStackSpaceAllocationCheckStatement(32)],
+      },
+    ]);
+    prepareForThreads(wasmModule);
+
+    const wat = generateWat(wasmModule);
+    expect(wat).not.toContain("memory.grow");
+    expect(wat.split(`(call $${STACK_OVERFLOW_FUNCTION})`).length).toBe(3);
+    expect(wasmModule.importedFunctions).toEqual([
+      {
+        name: STACK_OVERFLOW_FUNCTION,
+        importPath: ["js", STACK_OVERFLOW_FUNCTION],
+        wasmParamTypes: [],
+        returnWasmTypes: [],
+      },
+    ]);
+  });
+
+  test("Memory is shared, the data segment is passive and main is exported", () => {
+    const wasmModule = createModuleWithData([]);
+    prepareForThreads(wasmModule);
+
+    const wat = generateWat(wasmModule);
+    expect(wat).toContain(
+      `(memory 1 ${THREADS_MAXIMUM_MEMORY_PAGES} shared)`,
+    );
+    expect(wat).toContain('(data $data_segment "\\d0\\e0\\b0\\f0")');
+    expect(wat).toContain(
+      `(func (export "${INIT_DATA_SEGMENT_FUNCTION}") (memory.init $data_segment (i32.const 0) (i32.const 0) (i32.const 4)) (data.drop $data_segment))`,
+    );
+    expect(wat).toContain('(export "main" (func $main))');
+    expect(wat).not.toContain("(start $main)");
+  });
+
+  test("Modules compiled without threads are unchanged", () => {
+    const wat = generateWat(createModuleWithData([]));
+    expect(wat).toContain('(import "js" "mem" (memory 1))');
+    expect(wat).toContain('(data (i32.const 0) "\\d0\\e0\\b0\\f0")');
+    expect(wat).toContain("(start $main)");
+  });
+
+  test("Mutexes are locked with atomic instructions", () => {
+    const [lockFunction] = createMutexLockWasmImplementation({
+      moduleName: "pthread",
+      name: "pthread_mutex_lock",
+      parameters: [{ dataType: "pointer", offset: -4 }],
+      returnObjects: [{ dataType: "signed int", offset: 0 }],
+    });
+    const wat = lockFunction.body.map(generateWatStatement).join(" ");
+    expect(wat).toContain(
+      "(i32.atomic.rmw.cmpxchg (local.get $mutex) (i32.const 0) (i32.const 1))",
+    );
+    expect(wat).toContain(
+      "(i32.atomic.rmw.xchg (local.get $mutex) (i32.const 2))",
+    );
+    expect(wat).toContain(
+      "(memory.atomic.wait32 (local.get $mutex) (i32.const 2) (i64.const -1))",
+    );
+  });
+});
@@ -0,0 +1,112 @@
+import { describe, expect, test } from "@jest/globals";
+import TokenTable, { TokenKind } from "../../../src/parser/tokenTable";
+
+// adds the tokens of "int x = x + 1 ;" as the lexer would, separated by single spaces
+function createTokenTable() {
+  const tokenTable = new TokenTable("int x = x + 1 ;");
+  let offset = 0;
+  for (const [kind, text, value] of [
+    [TokenKind.Keyword, "int"],
+    [TokenKind.Identifier, "x", "x"],
+    [TokenKind.Punctuator, "="],
+    [TokenKind.Identifier, "x", "x"],
+    [TokenKind.Punctuator, "+"],
+    [TokenKind.IntegerConstant, "1", { value: "1", suffix: "" }],
+    [TokenKind.Punctuator, ";"],
+  ] as [TokenKind, string, unknown][]) {
+    tokenTable.addToken(
+      kind,
+      offset,
+      offset + text.length,
+      offset,
+      offset + text.length,
+      value,
+    );
+    offset += text.length + 1;
+  }
+  return tokenTable;
+}
+
+describe("Test TokenTable", () => {
+  test("Looks up tokens by their start offset", () => {
+    const tokenTable = createTokenTable();
+    expect(tokenTable.numberOfTokens).toBe(7);
+    expect(tokenTable.getTokenIndexAt(0)).toBe(0);
+    expect(tokenTable.getTokenIndexAt(4)).toBe(1);
+    expect(tokenTable.getTokenKindAt(12)).toBe(TokenKind.IntegerConstant);
+    expect(tokenTable.getTokenLength(0)).toBe(3);
+    // within a token and on a separator
+    expect(tokenTable.getTokenIndexAt(1)).toBe(-1);
+    expect(tokenTable.getTokenKindAt(3)).toBe(-1);
+  });
+
+  test("Interns identifiers", () => {
+    const tokenTable = createTokenTable();
+    expect(tokenTable.identifiers.names).toEqual(["x"]);
+    expect(tokenTable.identifierIds[1]).toBe(tokenTable.identifierIds[3]);
+    expect(tokenTable.getIdentifierName(3)).toBe("x");
+    expect(tokenTable.identifierIds[0]).toBe(-1);
+  });
+
+  test("Keeps literal values", () => {
+    const tokenTable = createTokenTable();
+    expect(tokenTable.values[5]).toEqual({ value: "1", suffix: "" });
+    expect(tokenTable.values[1]).toBeUndefined();
+  });
+
+  test("Grows beyond its initial capacity", () => {
+    const tokenTable = new TokenTable("");
+    for (let i = 0; i < 5000; ++i) {
+      tokenTable.addToken(
+        TokenKind.Identifier,
+        i * 3,
+        i * 3 + 2,
+        i * 3,
+        i * 3 + 2,
+        `v${i % 10}`,
+      );
+    }
+    expect(tokenTable.getTokenIndexAt(4999 * 3)).toBe(4999);
+    expect(tokenTable.getIdentifierName(4999)).toBe("v9");
+    expect(tokenTable.identifiers.names.length).toBe(10);
+  });
+
+  test("Computes positions in the source code", () => {
+    // lexer output "int x ;"
+    const tokenTable = new TokenTable("int\n  x\n;");
+    tokenTable.addToken(TokenKind.Keyword, 0, 3, 0, 3);
+    tokenTable.addToken(TokenKind.Identifier, 4, 5, 6, 7, "x");
+    tokenTable.addToken(TokenKind.Punctuator, 6, 7, 8, 9);
+    expect(tokenTable.getPosition(4, 4)).toEqual({
+      start: { offset: 6, line: 2, column: 3 },
+      end: { offset: 7, line: 2, column: 4 },
+    });
+    expect(tokenTable.getPosition(0, 6)).toEqual({
+      start: { offset: 0, line: 1, column: 1 },
+      end: { offset: 9, line: 3, column: 2 },
+    });
+    expect(tokenTable.getTokenIndexContaining(2)).toBe(0);
+    // on a separator
+    expect(tokenTable.getPosition(3, 3)).toBeNull();
+  });
+
+  test("Adjusts positions for removed backslash-newlines", () => {
+    // the preprocessor removed the "\\\n" at offsets 3 and 8, giving "int xy;"
+    const tokenTable = new TokenTable("int\\\n xy\\\n;", [3, 8]);
+    tokenTable.addToken(TokenKind.Keyword, 0, 3, 0, 3);
+    tokenTable.addToken(TokenKind.Identifier, 4, 6, 4, 6, "xy");
+    tokenTable.addToken(TokenKind.Punctuator, 7, 8, 6, 7);
+    expect(tokenTable.getPosition(0, 0)).toEqual({
+      start: { offset: 0, line: 1, column: 1 },
+      end: { offset: 3, line: 1, column: 4 },
+    });
+    expect(tokenTable.getPosition(4, 5)).toEqual({
+      start: { offset: 6, line: 2, column: 2 },
+      end: { offset: 8, line: 2, column: 4 },
+    });
+    expect(tokenTable.getPosition(7, 7)).toEqual({
+      start: { offset: 10, line: 3, column: 1 },
+      end: { offset: 11, line: 3, column: 2 },
+    });
+  });
+});
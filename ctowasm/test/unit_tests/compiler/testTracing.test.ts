@@ -0,0 +1,409 @@
+import { describe, expect, test } from "@jest/globals";
+import ModuleRepository, {
+  SharedWasmGlobalVariables,
+} from "../../../src/modules";
+import TraceRecorder, { TraceEventKind } from "../../../src/traceRecorder";
+import { compile } from "../../../src/index";
+import { runWasm } from "../../../src/runWasm";
+import instrumentTracing, {
+  TRACE_ENTER_FUNCTION,
+  TRACE_EXIT_FUNCTION,
+  TRACE_EXTERNAL_CALL_FUNCTION,
+  TRACE_STATEMENT_FUNCTION,
+  TRACE_WRITE_FUNCTION,
+} from "../../../src/translator/tracing";
+import {
+  WASM_PAGE_SIZE,
+  getStackSpaceAllocationCheckStatement,
+} from "../../../src/translator/memoryUtil";
+import { WasmModule } from "../../../src/translator/wasm-ast/core";
+import { generateWat } from "../../../src/wat-generator";
+import { createModule, createPosition } from "../fixtures";
+
+describe("Test tracing instrumentation", () => {
+  // main, and the wrappers of the functions it calls that are imported from JS
+  function createTracedModule(): WasmModule {
+    return createModule(
+      [
+        getStackSpaceAllocationCheckStatement(8),
+        {
+          type: "MemoryStore",
+          addr: { type: "GlobalGet", name: "sp" },
+          value: { type: "IntegerConst", wasmDataType: "i32", value: 1n },
+          wasmDataType: "i32",
+          numOfBytes: 4,
+          position: createPosition(2),
+        },
+        {
+          type: "RegularFunctionCall",
+          name: "print_int",
+          args: [],
+          position: createPosition(3),
+        },
+      ],
+      {
+        functions: {
+          print_int: {
+            type: "Function",
+            name: "print_int",
+            body: [
+              {
+                type: "RegularFunctionCall",
+                name: "print_int_imported",
+                args: [],
+              },
+              {
+                type: "MemoryStoreFromWasmStack",
+                addr: { type: "GlobalGet", name: "bp" },
+                wasmDataType: "i32",
+                numOfBytes: 4,
+              },
+            ],
+          },
+          scanf: {
+            type: "Function",
+            name: "scanf",
+            body: [
+              { type: "RegularFunctionCall", name: "scanf_imported", args: [] },
+            ],
+          },
+        },
+        importedFunctions: [
+          {
+            name: "print_int_imported",
+            importPath: ["source_stdlib", "print_int"],
+            wasmParamTypes: [],
+            returnWasmTypes: ["i32"],
+          },
+          {
+            name: "scanf_imported",
+            importPath: ["source_stdlib", "scanf"],
+            wasmParamTypes: [],
+            returnWasmTypes: [],
+            writesMemory: true,
+          },
+        ],
+      },
+    );
+  }
+
+  test("Statements, calls and writes are reported", () => {
+    const wasmModule = createTracedModule();
+    const symbols = instrumentTracing(wasmModule);
+    expect(symbols).toEqual({
+      functionNames: ["main", "print_int", "scanf"],
+      statementPositions: [createPosition(2), createPosition(3)],
+    });
+
+    const mainBody = wasmModule.functions.main.body;
+    expect(mainBody[0]).toMatchObject({
+      type: "RegularFunctionCall",
+      name: TRACE_ENTER_FUNCTION,
+      args: [{ value: 0n }],
+    });
+    expect(mainBody[2]).toMatchObject({
+      type: "RegularFunctionCall",
+      name: TRACE_EXIT_FUNCTION,
+      args: [{ value: 0n }],
+    });
+    const block = mainBody[1];
+    if (block.type !== "Block") {
+      throw new Error("function body is not in a block");
+    }
+    expect(block.body.map((statement) => statement.type)).toEqual([
+      "SelectionStatement", // the stack space check is left as it is
+      "RegularFunctionCall",
+      "LocalSet",
+      "MemoryStore",
+      "RegularFunctionCall",
+      "RegularFunctionCall",
+      "RegularFunctionCall",
+    ]);
+    expect(block.body[1]).toMatchObject({
+      name: TRACE_STATEMENT_FUNCTION,
+      args: [{ value: 0n }],
+    });
+    // the address is evaluated once, and the write is logged after the store
+    expect(block.body[2]).toMatchObject({
+      name: "trace_addr_0",
+      value: { type: "GlobalGet", name: "sp" },
+    });
+    expect(block.body[3]).toMatchObject({
+      addr: { type: "LocalGet", name: "trace_addr_0" },
+    });
+    expect(block.body[4]).toMatchObject({
+      name: TRACE_WRITE_FUNCTION,
+      args: [{ type: "LocalGet", name: "trace_addr_0" }, { value: 4n }],
+    });
+    expect(block.body[5]).toMatchObject({
+      name: TRACE_STATEMENT_FUNCTION,
+      args: [{ value: 1n }],
+    });
+
+    const wrapperBody = wasmModule.functions.print_int.body[1];
+    if (wrapperBody.type !== "Block") {
+      throw new Error("function body is not in a block");
+    }
+    // the imported function only writes to memory through the logged store of its wrapper
+    expect(wrapperBody.body).toMatchObject([
+      { name: "print_int_imported" },
+      { type: "MemoryStoreFromWasmStack" },
+      {
+        name: TRACE_WRITE_FUNCTION,
+        args: [{ type: "GlobalGet", name: "bp" }, { value: 4n }],
+      },
+    ]);
+    const writingWrapperBody = wasmModule.functions.scanf.body[1];
+    if (writingWrapperBody.type !== "Block") {
+      throw new Error("function body is not in a block");
+    }
+    expect(writingWrapperBody.body).toMatchObject([
+      { name: "scanf_imported" },
+      { name: TRACE_EXTERNAL_CALL_FUNCTION },
+    ]);
+
+    const wat = generateWat(wasmModule);
+    expect(wat).toContain("(func $main (local $trace_addr_0 i32)");
+    expect(wat).toContain(
+      `(import "js" "${TRACE_WRITE_FUNCTION}" (func $${TRACE_WRITE_FUNCTION} (param i32) (param i32)))`,
+    );
+  });
+});
+
+describe("Test TraceRecorder", () => {
+  function createRecorder(memory: WebAssembly.Memory, keyframeInterval = 16) {
+    const moduleRepository = new ModuleRepository(memory);
+    const recorder = new TraceRecorder(
+      {
+        functionNames: ["main"],
+        statementPositions: [createPosition(2), createPosition(3)],
+      },
+      { keyframeInterval },
+    );
+    recorder.attach(memory, moduleRepository.sharedWasmGlobalVariables);
+    return { recorder, moduleRepository };
+  }
+
+  test("Frames are reconstructed from the logged writes", () => {
+    const memory = new WebAssembly.Memory({ initial: 1 });
+    const bytes = new Uint8Array(memory.buffer);
+    const { recorder, moduleRepository } = createRecorder(memory);
+    moduleRepository.setStackPointerValue(WASM_PAGE_SIZE);
+    recorder.recordEvent("enter", 0);
+
+    moduleRepository.setStackPointerValue(WASM_PAGE_SIZE - 8);
+    bytes.set([1, 2], 100);
+    recorder.recordWrite(100, 2);
+    bytes.set([3, 4], 102);
+    recorder.recordWrite(102, 2);
+    bytes.set([5], 50);
+    recorder.recordWrite(50, 1);
+    recorder.recordEvent("statement", 0);
+
+    bytes[100] = 9;
+    recorder.recordWrite(100, 1);
+    bytes[300] = 7; // written by a function imported from JS
+    recorder.recordExternalCall();
+    recorder.recordEvent("statement", 1);
+
+    expect(recorder.numberOfSteps).toBe(3);
+    expect(recorder.getNumberOfKeyframes()).toBe(1);
+    const first = recorder.getFrame(0);
+    expect(first).toMatchObject({
+      step: 0,
+      event: "enter",
+      functionName: "main",
+      stackPointer: WASM_PAGE_SIZE,
+    });
+    expect(Array.from(first.memory.subarray(100, 104))).toEqual([0, 0, 0, 0]);
+    const second = recorder.getFrame(1);
+    expect(second).toMatchObject({
+      event: "statement",
+      position: createPosition(2),
+      stackPointer: WASM_PAGE_SIZE - 8,
+    });
+    expect(Array.from(second.memory.subarray(100, 104))).toEqual([1, 2, 3, 4]);
+    expect(second.memory[50]).toBe(5);
+    expect(second.memory[300]).toBe(0);
+    const third = recorder.getFrame(2);
+    expect(Array.from(third.memory.subarray(100, 104))).toEqual([9, 2, 3, 4]);
+    expect(third.memory[300]).toBe(7);
+    // only the written bytes are stored, besides the keyframe and the copy of memory as of the last step
+    expect(recorder.getByteLength()).toBeLessThan(3 * WASM_PAGE_SIZE);
+  });
+
+  test("Frames are the same whether reconstructed from the nearest keyframe or the previous frame", () => {
+    const memory = new WebAssembly.Memory({ initial: 1 });
+    const bytes = new Uint8Array(memory.buffer);
+    const { recorder } = createRecorder(memory, 3);
+    for (let step = 0; step < 10; ++step) {
+      bytes[step * 4] = step + 1;
+      recorder.recordWrite(step * 4, 1);
+      recorder.recordEvent("statement", step % 2);
+    }
+    expect(recorder.getNumberOfKeyframes()).toBe(3);
+
+    let step = 2;
+    for (const frame of recorder.frames(2, 9)) {
+      expect(frame.step).toBe(step);
+      expect(frame.memory).toEqual(recorder.getFrame(step).memory);
+      expect(frame.memory[step * 4]).toBe(step + 1);
+      expect(frame.memory[(step + 1) * 4]).toBe(0);
+      ++step;
+    }
+    expect(step).toBe(9);
+    expect(() => recorder.getFrame(10)).toThrow();
+  });
+
+  test("A keyframe is taken when memory grows", () => {
+    const memory = new WebAssembly.Memory({ initial: 1 });
+    const { recorder } = createRecorder(memory);
+    recorder.recordEvent("enter", 0);
+    recorder.recordWrite(WASM_PAGE_SIZE - 4, 4);
+    memory.grow(1);
+    new Uint8Array(memory.buffer)[2 * WASM_PAGE_SIZE - 1] = 1;
+    recorder.recordExternalCall();
+    recorder.recordEvent("statement", 0);
+
+    expect(recorder.getNumberOfKeyframes()).toBe(2);
+    expect(recorder.getFrame(0).memory.length).toBe(WASM_PAGE_SIZE);
+    const frame = recorder.getFrame(1);
+    expect(frame.memory.length).toBe(2 * WASM_PAGE_SIZE);
+    expect(frame.memory[2 * WASM_PAGE_SIZE - 1]).toBe(1);
+  });
+
+  test("The byte length of the trace includes the copy of memory and the spare capacity of its arrays", () => {
+    const memory = new WebAssembly.Memory({ initial: 1 });
+    const { recorder } = createRecorder(memory);
+    const emptyByteLength = recorder.getByteLength();
+    expect(emptyByteLength).toBeGreaterThan(0); // the arrays are allocated up front
+    recorder.recordEvent("enter", 0);
+    // the keyframe and the copy of memory as of the last step
+    expect(recorder.getByteLength()).toBe(
+      emptyByteLength + 2 * WASM_PAGE_SIZE,
+    );
+    // writes within the capacity of the arrays take no more bytes, until they grow
+    new Uint8Array(memory.buffer).fill(1, 0, 100000);
+    recorder.recordWrite(0, 4);
+    recorder.recordEvent("statement", 0);
+    expect(recorder.getByteLength()).toBe(
+      emptyByteLength + 2 * WASM_PAGE_SIZE,
+    );
+    recorder.recordWrite(4, 60000);
+    recorder.recordEvent("statement", 0);
+    // the array of written bytes grew to hold the 60004 bytes written
+    expect(recorder.getByteLength()).toBeGreaterThanOrEqual(
+      2 * WASM_PAGE_SIZE + 60004,
+    );
+  });
+
+  test("Recording stops once the trace takes the most bytes it may", () => {
+    const memory = new WebAssembly.Memory({ initial: 1 });
+    const moduleRepository = new ModuleRepository(memory);
+    const recorder = new TraceRecorder(undefined, { maxBytes: WASM_PAGE_SIZE });
+    recorder.attach(memory, moduleRepository.sharedWasmGlobalVariables);
+    recorder.recordEvent("enter", 0);
+    recorder.recordEvent("statement", 0);
+    recorder.recordEvent("statement", 0);
+    expect(recorder.numberOfSteps).toBe(1);
+    expect(recorder.truncated).toBe(true);
+    expect(recorder.getFrame(0).memory.length).toBe(WASM_PAGE_SIZE);
+  });
+});
+
+/**
+ * A trace recorder that also keeps a copy of the whole memory at each recorded step, to check the frames against.
+ */
+class SnapshottingTraceRecorder extends TraceRecorder {
+  snapshots: Uint8Array[] = [];
+  private snapshotMemory: WebAssembly.Memory | null = null;
+
+  attach(memory: WebAssembly.Memory, registers: SharedWasmGlobalVariables) {
+    this.snapshotMemory = memory;
+    super.attach(memory, registers);
+  }
+
+  recordEvent(event: TraceEventKind, index: number) {
+    const numberOfSteps = this.numberOfSteps;
+    super.recordEvent(event, index);
+    if (this.numberOfSteps > numberOfSteps) {
+      this.snapshots.push(
+        new Uint8Array(
+          (this.snapshotMemory as WebAssembly.Memory).buffer,
+        ).slice(),
+      );
+    }
+  }
+}
+
+// writes to the heap, to memory through scanf, stores whose value is the result of a (recursive) call, and a store
+// nested in the value of another
+const TRACED_PROGRAM = `
+#include <source_stdlib>
+
+int f(int n) {
+  if (n == 0) {
+    return 0;
+  }
+  return n + f(n - 1);
+}
+
+int main() {
+  int *h = malloc(40);
+  int w;
+  scanf("%d", &w);
+  for (int i = 0; i < 10; ++i) {
+    h[i] = f(i) + w;
+  }
+  int total = f(w);
+  int a;
+  int b;
+  a = (b = w) + 1;
+  print_int(total + h[9] + a + b);
+  free(h);
+}
+`;
+
+describe("Test tracing of compiled programs", () => {
+  for (const keyframeInterval of [1, 7, 4096]) {
+    test(`Every frame matches the memory of the run, with keyframes every ${keyframeInterval} steps`, async () => {
+      const result = await compile(TRACED_PROGRAM, undefined, { trace: true });
+      if (result.status !== "success") {
+        throw new Error(result.errorMessage);
+      }
+      const recorder = new SnapshottingTraceRecorder(result.traceSymbols, {
+        keyframeInterval,
+      });
+      const output: string[] = [];
+      await runWasm(
+        result.wasm,
+        result.dataSegmentSize,
+        result.functionTableSize,
+        result.importedModules,
+        {
+          printFunction: (str) => output.push(str),
+          tracer: recorder,
+          stdin: "4",
+        },
+      );
+      expect(output).toEqual(["68"]);
+      expect(recorder.truncated).toBe(false);
+      expect(recorder.snapshots.length).toBe(recorder.numberOfSteps);
+      let numberOfWrongFrames = 0;
+      for (const frame of recorder.frames()) {
+        const snapshot = recorder.snapshots[frame.step];
+        if (
+          frame.memory.length !== snapshot.length ||
+          frame.memory.some((byte, i) => byte !== snapshot[i])
+        ) {
+          ++numberOfWrongFrames;
+        }
+      }
+      expect(numberOfWrongFrames).toBe(0);
+      const lastStep = recorder.numberOfSteps - 1;
+      expect(recorder.getFrame(lastStep).memory).toEqual(
+        recorder.snapshots[lastStep],
+      );
+    });
+  }
+});
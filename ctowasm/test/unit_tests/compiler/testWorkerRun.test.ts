@@ -0,0 +1,207 @@
+import { describe, expect, test } from "@jest/globals";
+import WorkerRun, {
+  ProgramWorker,
+  ProgramWorkerRequest,
+  ProgramWorkerResponse,
+  ThreadWorkerRequest,
+} from "../../../src/workerRun";
+import { OutputRingBufferWriter } from "../../../src/modules/outputRingBuffer";
+import SharedHeap from "../../../src/modules/pthread/sharedHeap";
+import {
+  ThreadRegion,
+  allocateThread,
+  finishThread,
+  joinThread,
+} from "../../../src/modules/pthread/threadControl";
+
+/**
+ * A stand-in for the program worker, which lets the test write output to the shared ring buffer and send responses.
+ */
+class FakeWorker implements ProgramWorker {
+  request: ProgramWorkerRequest | null = null;
+  handler: (message: ProgramWorkerResponse) => void = () => {};
+  failureHandler: (message: string) => void = () => {};
+  terminated = false;
+
+  postMessage(message: ProgramWorkerRequest) {
+    this.request = message;
+  }
+
+  setMessageHandler(handler: (message: ProgramWorkerResponse) => void) {
+    this.handler = handler;
+  }
+
+  setFailureHandler(handler: (message: string) => void) {
+    this.failureHandler = handler;
+  }
+
+  terminate() {
+    this.terminated = true;
+  }
+
+  print(str: string) {
+    new OutputRingBufferWriter(this.request!.outputBuffer).write(str);
+  }
+}
+
+const program = {
+  wasm: new Uint8Array(0),
+  dataSegmentSize: 0,
+  functionTableSize: 0,
+  importedModules: [],
+};
+
+function sleep(ms: number) {
+  return new Promise((resolve) => setTimeout(resolve, ms));
+}
+
+describe("Test running programs in a worker", () => {
+  test("Output is streamed while the program runs", async () => {
+    const worker = new FakeWorker();
+    const output: string[] = [];
+    const run = WorkerRun.start(worker, program, {
+      printFunction: (str) => output.push(str),
+      outputPollIntervalMs: 1,
+      fuelLimit: 100,
+    });
+    expect(worker.request?.modulesConfig).toEqual({ fuelLimit: 100 });
+    worker.print("first");
+    await sleep(20);
+    expect(output).toEqual(["first"]);
+    worker.print("second");
+    worker.handler({ type: "exit", fuelUsed: 42 });
+    const result = await run.result;
+    expect(output).toEqual(["first", "second"]);
+    expect(result.status).toBe("success");
+    expect(result.fuelUsed).toBe(42);
+    expect(worker.terminated).toBe(true);
+  });
+
+  test("Runtime errors are reported", async () => {
+    const worker = new FakeWorker();
+    const run = WorkerRun.start(worker, program, { printFunction: () => {} });
+    worker.handler({ type: "error", message: "out of bounds" });
+    const result = await run.result;
+    expect(result.status).toBe("error");
+    expect(result.errorMessage).toBe("out of bounds");
+  });
+
+  test("Workers that fail without responding end the run with an error", async () => {
+    const worker = new FakeWorker();
+    const output: string[] = [];
+    const run = WorkerRun.start(worker, program, {
+      printFunction: (str) => output.push(str),
+    });
+    worker.print("before the exit");
+    worker.failureHandler("worker exited with code 1");
+    const result = await run.result;
+    expect(result).toMatchObject({
+      status: "error",
+      errorMessage: "worker exited with code 1",
+    });
+    expect(output).toEqual(["before the exit"]);
+    expect(worker.terminated).toBe(true);
+  });
+
+  test("Programs are stopped at the time limit", async () => {
+    const worker = new FakeWorker();
+    const output: string[] = [];
+    const run = WorkerRun.start(worker, program, {
+      printFunction: (str) => output.push(str),
+      timeLimitMs: 10,
+    });
+    worker.print("before the limit");
+    const result = await run.result;
+    expect(result.status).toBe("timeout");
+    expect(worker.terminated).toBe(true);
+    expect(output).toEqual(["before the limit"]);
+    // responses after the run has ended are ignored
+    worker.handler({ type: "exit" });
+    expect((await run.result).status).toBe("timeout");
+  });
+
+  test("The host starts the workers of threads, failing the threads whose worker fails", async () => {
+    const memory = new WebAssembly.Memory({
+      initial: 64,
+      maximum: 64,
+      shared: true,
+    });
+    const heap = SharedHeap.create(memory, 0);
+    const worker = new FakeWorker();
+    const threadWorkers: FakeWorker[] = [];
+    const run = WorkerRun.start(worker, program, {
+      printFunction: () => {},
+      spawnThreadWorker: () => {
+        const threadWorker = new FakeWorker();
+        threadWorkers.push(threadWorker);
+        return threadWorker;
+      },
+    });
+    const createThreadRequest = (
+      thread: ThreadRegion,
+    ): ThreadWorkerRequest => ({
+      type: "thread",
+      program,
+      outputBuffer: worker.request!.outputBuffer,
+      modulesConfig: {},
+      memory,
+      heapAddress: 0,
+      thread,
+      startRoutine: 0,
+      arg: 0,
+    });
+    const [finished, failed, running] = [0, 1, 2].map(
+      () => allocateThread(heap)!,
+    );
+    worker.handler({ type: "thread", request: createThreadRequest(finished) });
+    worker.handler({ type: "thread", request: createThreadRequest(failed) });
+    // threads may create threads too
+    threadWorkers[1].handler({
+      type: "thread",
+      request: createThreadRequest(running),
+    });
+    expect(threadWorkers.map((threadWorker) => threadWorker.request)).toEqual(
+      [finished, failed, running].map(createThreadRequest),
+    );
+
+    // runThread ends the thread before its worker responds
+    finishThread(memory, finished.id, 7);
+    threadWorkers[0].handler({ type: "exit" });
+    expect(threadWorkers[0].terminated).toBe(true);
+    expect(joinThread(heap, finished.id)).toBe(7);
+
+    threadWorkers[1].failureHandler("worker exited with code 1");
+    expect(threadWorkers[1].terminated).toBe(true);
+    expect(() => joinThread(heap, failed.id)).toThrow("ended with an error");
+
+    // threads still running when main returns are stopped
+    expect(threadWorkers[2].terminated).toBe(false);
+    worker.handler({ type: "exit" });
+    expect((await run.result).status).toBe("success");
+    expect(threadWorkers[2].terminated).toBe(true);
+  });
+
+  test("Runs of threaded programs fail if the host cannot start workers for threads", async () => {
+    const worker = new FakeWorker();
+    const run = WorkerRun.start(worker, program, { printFunction: () => {} });
+    worker.handler({
+      type: "thread",
+      request: { type: "thread" } as ThreadWorkerRequest,
+    });
+    expect(await run.result).toMatchObject({
+      status: "error",
+      errorMessage:
+        "pthread_create(): the run was not given a way to start workers for threads (see spawnThreadWorker)",
+    });
+    expect(worker.terminated).toBe(true);
+  });
+
+  test("Runs can be cancelled", async () => {
+    const worker = new FakeWorker();
+    const run = WorkerRun.start(worker, program, { printFunction: () => {} });
+    run.cancel();
+    const result = await run.result;
+    expect(result.status).toBe("cancelled");
+    expect(worker.terminated).toBe(true);
+  });
+});
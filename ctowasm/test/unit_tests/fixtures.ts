@@ -0,0 +1,94 @@
+/**
+ * Fixtures shared by the unit tests.
+ */
+import ModuleRepository, {
+  ModulesGlobalConfig,
+} from "../../src/modules";
+import SharedHeap from "../../src/modules/pthread/sharedHeap";
+import { Position } from "../../src/parser/c-ast/misc";
+import { WASM_PAGE_SIZE } from "../../src/translator/memoryUtil";
+import {
+  WasmModule,
+  WasmStatement,
+} from "../../src/translator/wasm-ast/core";
+import { WasmFunction } from "../../src/translator/wasm-ast/functions";
+
+export const HEAP_ADDRESS = 64; // where the heaps created below start
+
+/**
+ * Returns the position of a statement on the given line of a program.
+ */
+export function createPosition(line: number): Position {
+  return {
+    start: { line, column: 1, offset: 0 },
+    end: { line, column: 10, offset: 0 },
+  };
+}
+
+/**
+ * Returns a module whose main function has the given body. Any other fields of the module are taken from the given
+ * fields, whose functions are added to main.
+ */
+export function createModule(
+  body: WasmStatement[],
+  fields: Partial<Omit<WasmModule, "functions">> & {
+    functions?: Record<string, WasmFunction>;
+  } = {},
+): WasmModule {
+  return {
+    type: "Module",
+    dataSegmentByteStr: "",
+    globalWasmVariables: [],
+    importedGlobalWasmVariables: [],
+    dataSegmentSize: 0,
+    importedFunctions: [],
+    functionTable: { size: 0, elements: [] },
+    ...fields,
+    functions: {
+      main: { type: "Function", name: "main", body },
+      ...fields.functions,
+    },
+  };
+}
+
+/**
+ * Returns a heap shared between threads, starting at HEAP_ADDRESS of a shared memory of one page.
+ */
+export function createSharedHeap(maximumPages = 64) {
+  const memory = new WebAssembly.Memory({
+    initial: 1,
+    maximum: maximumPages,
+    shared: true,
+  });
+  return SharedHeap.create(memory, HEAP_ADDRESS);
+}
+
+/**
+ * Returns the malloc and free of the standard library of a module repository whose heap starts at HEAP_ADDRESS.
+ */
+export async function createStdlibHeap(config?: Partial<ModulesGlobalConfig>) {
+  const moduleRepository = new ModuleRepository(
+    new WebAssembly.Memory({ initial: 1 }),
+    undefined,
+    { printFunction: () => {}, ...config },
+  );
+  moduleRepository.setStackPointerValue(WASM_PAGE_SIZE);
+  moduleRepository.setHeapPointerValue(HEAP_ADDRESS);
+  const imports = await moduleRepository.createWasmImportsObject([
+    "source_stdlib",
+  ]);
+  const stdlib = imports.source_stdlib;
+  const allocationSite = moduleRepository.sharedWasmGlobalVariables
+    .allocationSite as WebAssembly.Global;
+  return {
+    moduleRepository,
+    malloc: (size: number, site = -1) => {
+      allocationSite.value = site;
+      return (stdlib.malloc as (size: number) => number)(size);
+    },
+    free: (address: number, site = -1) => {
+      allocationSite.value = site;
+      (stdlib.free as (address: number) => void)(address);
+    },
+  };
+}
@@ -0,0 +1,2151 @@
+// generated by generateFloatFormattingCases.c - do not edit
+// [conversion, precision, bits of double in hex, expected glibc output]
+const floatFormattingCases: [string, number, string, string][] = [
+  ["f", 0, "0000000000000000", "0"],
+  ["f", 1, "0000000000000000", "0.0"],
+  ["f", 3, "0000000000000000", "0.000"],
+  ["f", 6, "0000000000000000", "0.000000"],
+  ["f", 17, "0000000000000000", "0.00000000000000000"],
+  ["e", 0, "0000000000000000", "0e+00"],
+  ["e", 1, "0000000000000000", "0.0e+00"],
+  ["e", 3, "0000000000000000", "0.000e+00"],
+  ["e", 6, "0000000000000000", "0.000000e+00"],
+  ["e", 17, "0000000000000000", "0.00000000000000000e+00"],
+  ["g", 0, "0000000000000000", "0"],
+  ["g", 1, "0000000000000000", "0"],
+  ["g", 3, "0000000000000000", "0"],
+  ["g", 6, "0000000000000000", "0"],
+  ["g", 17, "0000000000000000", "0"],
+  ["f", 0, "3fe0000000000000", "0"],
+  ["f", 1, "3fe0000000000000", "0.5"],
+  ["f", 3, "3fe0000000000000", "0.500"],
+  ["f", 6, "3fe0000000000000", "0.500000"],
+  ["f", 17, "3fe0000000000000", "0.50000000000000000"],
+  ["e", 0, "3fe0000000000000", "5e-01"],
+  ["e", 1, "3fe0000000000000", "5.0e-01"],
+  ["e", 3, "3fe0000000000000", "5.000e-01"],
+  ["e", 6, "3fe0000000000000", "5.000000e-01"],
+  ["e", 17, "3fe0000000000000", "5.00000000000000000e-01"],
+  ["g", 0, "3fe0000000000000", "0.5"],
+  ["g", 1, "3fe0000000000000", "0.5"],
+  ["g", 3, "3fe0000000000000", "0.5"],
+  ["g", 6, "3fe0000000000000", "0.5"],
+  ["g", 17, "3fe0000000000000", "0.5"],
+  ["f", 0, "3ff8000000000000", "2"],
+  ["f", 1, "3ff8000000000000", "1.5"],
+  ["f", 3, "3ff8000000000000", "1.500"],
+  ["f", 6, "3ff8000000000000", "1.500000"],
+  ["f", 17, "3ff8000000000000", "1.50000000000000000"],
+  ["e", 0, "3ff8000000000000", "2e+00"],
+  ["e", 1, "3ff8000000000000", "1.5e+00"],
+  ["e", 3, "3ff8000000000000", "1.500e+00"],
+  ["e", 6, "3ff8000000000000", "1.500000e+00"],
+  ["e", 17, "3ff8000000000000", "1.50000000000000000e+00"],
+  ["g", 0, "3ff8000000000000", "2"],
+  ["g", 1, "3ff8000000000000", "2"],
+  ["g", 3, "3ff8000000000000", "1.5"],
+  ["g", 6, "3ff8000000000000", "1.5"],
+  ["g", 17, "3ff8000000000000", "1.5"],
+  ["f", 0, "4004000000000000", "2"],
+  ["f", 1, "4004000000000000", "2.5"],
+  ["f", 3, "4004000000000000", "2.500"],
+  ["f", 6, "4004000000000000", "2.500000"],
+  ["f", 17, "4004000000000000", "2.50000000000000000"],
+  ["e", 0, "4004000000000000", "2e+00"],
+  ["e", 1, "4004000000000000", "2.5e+00"],
+  ["e", 3, "4004000000000000", "2.500e+00"],
+  ["e", 6, "4004000000000000", "2.500000e+00"],
+  ["e", 17, "4004000000000000", "2.50000000000000000e+00"],
+  ["g", 0, "4004000000000000", "2"],
+  ["g", 1, "4004000000000000", "2"],
+  ["g", 3, "4004000000000000", "2.5"],
+  ["g", 6, "4004000000000000", "2.5"],
+  ["g", 17, "4004000000000000", "2.5"],
+  ["f", 0, "3fc0000000000000", "0"],
+  ["f", 1, "3fc0000000000000", "0.1"],
+  ["f", 3, "3fc0000000000000", "0.125"],
+  ["f", 6, "3fc0000000000000", "0.125000"],
+  ["f", 17, "3fc0000000000000", "0.12500000000000000"],
+  ["e", 0, "3fc0000000000000", "1e-01"],
+  ["e", 1, "3fc0000000000000", "1.2e-01"],
+  ["e", 3, "3fc0000000000000", "1.250e-01"],
+  ["e", 6, "3fc0000000000000", "1.250000e-01"],
+  ["e", 17, "3fc0000000000000", "1.25000000000000000e-01"],
+  ["g", 0, "3fc0000000000000", "0.1"],
+  ["g", 1, "3fc0000000000000", "0.1"],
+  ["g", 3, "3fc0000000000000", "0.125"],
+  ["g", 6, "3fc0000000000000", "0.125"],
+  ["g", 17, "3fc0000000000000", "0.125"],
+  ["f", 0, "3fd8000000000000", "0"],
+  ["f", 1, "3fd8000000000000", "0.4"],
+  ["f", 3, "3fd8000000000000", "0.375"],
+  ["f", 6, "3fd8000000000000", "0.375000"],
+  ["f", 17, "3fd8000000000000", "0.37500000000000000"],
+  ["e", 0, "3fd8000000000000", "4e-01"],
+  ["e", 1, "3fd8000000000000", "3.8e-01"],
+  ["e", 3, "3fd8000000000000", "3.750e-01"],
+  ["e", 6, "3fd8000000000000", "3.750000e-01"],
+  ["e", 17, "3fd8000000000000", "3.75000000000000000e-01"],
+  ["g", 0, "3fd8000000000000", "0.4"],
+  ["g", 1, "3fd8000000000000", "0.4"],
+  ["g", 3, "3fd8000000000000", "0.375"],
+  ["g", 6, "3fd8000000000000", "0.375"],
+  ["g", 17, "3fd8000000000000", "0.375"],
+  ["f", 0, "4023000000000000", "10"],
+  ["f", 1, "4023000000000000", "9.5"],
+  ["f", 3, "4023000000000000", "9.500"],
+  ["f", 6, "4023000000000000", "9.500000"],
+  ["f", 17, "4023000000000000", "9.50000000000000000"],
+  ["e", 0, "4023000000000000", "1e+01"],
+  ["e", 1, "4023000000000000", "9.5e+00"],
+  ["e", 3, "4023000000000000", "9.500e+00"],
+  ["e", 6, "4023000000000000", "9.500000e+00"],
+  ["e", 17, "4023000000000000", "9.50000000000000000e+00"],
+  ["g", 0, "4023000000000000", "1e+01"],
+  ["g", 1, "4023000000000000", "1e+01"],
+  ["g", 3, "4023000000000000", "9.5"],
+  ["g", 6, "4023000000000000", "9.5"],
+  ["g", 17, "4023000000000000", "9.5"],
+  ["f", 0, "3fa999999999999a", "0"],
+  ["f", 1, "3fa999999999999a", "0.1"],
+  ["f", 3, "3fa999999999999a", "0.050"],
+  ["f", 6, "3fa999999999999a", "0.050000"],
+  ["f", 17, "3fa999999999999a", "0.05000000000000000"],
+  ["e", 0, "3fa999999999999a", "5e-02"],
+  ["e", 1, "3fa999999999999a", "5.0e-02"],
+  ["e", 3, "3fa999999999999a", "5.000e-02"],
+  ["e", 6, "3fa999999999999a", "5.000000e-02"],
+  ["e", 17, "3fa999999999999a", "5.00000000000000028e-02"],
+  ["g", 0, "3fa999999999999a", "0.05"],
+  ["g", 1, "3fa999999999999a", "0.05"],
+  ["g", 3, "3fa999999999999a", "0.05"],
+  ["g", 6, "3fa999999999999a", "0.05"],
+  ["g", 17, "3fa999999999999a", "0.050000000000000003"],
+  ["f", 0, "3fd0000000000000", "0"],
+  ["f", 1, "3fd0000000000000", "0.2"],
+  ["f", 3, "3fd0000000000000", "0.250"],
+  ["f", 6, "3fd0000000000000", "0.250000"],
+  ["f", 17, "3fd0000000000000", "0.25000000000000000"],
+  ["e", 0, "3fd0000000000000", "2e-01"],
+  ["e", 1, "3fd0000000000000", "2.5e-01"],
+  ["e", 3, "3fd0000000000000", "2.500e-01"],
+  ["e", 6, "3fd0000000000000", "2.500000e-01"],
+  ["e", 17, "3fd0000000000000", "2.50000000000000000e-01"],
+  ["g", 0, "3fd0000000000000", "0.2"],
+  ["g", 1, "3fd0000000000000", "0.2"],
+  ["g", 3, "3fd0000000000000", "0.25"],
+  ["g", 6, "3fd0000000000000", "0.25"],
+  ["g", 17, "3fd0000000000000", "0.25"],
+  ["f", 0, "4005666666666666", "3"],
+  ["f", 1, "4005666666666666", "2.7"],
+  ["f", 3, "4005666666666666", "2.675"],
+  ["f", 6, "4005666666666666", "2.675000"],
+  ["f", 17, "4005666666666666", "2.67499999999999982"],
+  ["e", 0, "4005666666666666", "3e+00"],
+  ["e", 1, "4005666666666666", "2.7e+00"],
+  ["e", 3, "4005666666666666", "2.675e+00"],
+  ["e", 6, "4005666666666666", "2.675000e+00"],
+  ["e", 17, "4005666666666666", "2.67499999999999982e+00"],
+  ["g", 0, "4005666666666666", "3"],
+  ["g", 1, "4005666666666666", "3"],
+  ["g", 3, "4005666666666666", "2.67"],
+  ["g", 6, "4005666666666666", "2.675"],
+  ["g", 17, "4005666666666666", "2.6749999999999998"],
+  ["f", 0, "3ff0147ae147ae14", "1"],
+  ["f", 1, "3ff0147ae147ae14", "1.0"],
+  ["f", 3, "3ff0147ae147ae14", "1.005"],
+  ["f", 6, "3ff0147ae147ae14", "1.005000"],
+  ["f", 17, "3ff0147ae147ae14", "1.00499999999999989"],
+  ["e", 0, "3ff0147ae147ae14", "1e+00"],
+  ["e", 1, "3ff0147ae147ae14", "1.0e+00"],
+  ["e", 3, "3ff0147ae147ae14", "1.005e+00"],
+  ["e", 6, "3ff0147ae147ae14", "1.005000e+00"],
+  ["e", 17, "3ff0147ae147ae14", "1.00499999999999989e+00"],
+  ["g", 0, "3ff0147ae147ae14", "1"],
+  ["g", 1, "3ff0147ae147ae14", "1"],
+  ["g", 3, "3ff0147ae147ae14", "1"],
+  ["g", 6, "3ff0147ae147ae14", "1.005"],
+  ["g", 17, "3ff0147ae147ae14", "1.0049999999999999"],
+  ["f", 0, "3fb999999999999a", "0"],
+  ["f", 1, "3fb999999999999a", "0.1"],
+  ["f", 3, "3fb999999999999a", "0.100"],
+  ["f", 6, "3fb999999999999a", "0.100000"],
+  ["f", 17, "3fb999999999999a", "0.10000000000000001"],
+  ["e", 0, "3fb999999999999a", "1e-01"],
+  ["e", 1, "3fb999999999999a", "1.0e-01"],
+  ["e", 3, "3fb999999999999a", "1.000e-01"],
+  ["e", 6, "3fb999999999999a", "1.000000e-01"],
+  ["e", 17, "3fb999999999999a", "1.00000000000000006e-01"],
+  ["g", 0, "3fb999999999999a", "0.1"],
+  ["g", 1, "3fb999999999999a", "0.1"],
+  ["g", 3, "3fb999999999999a", "0.1"],
+  ["g", 6, "3fb999999999999a", "0.1"],
+  ["g", 17, "3fb999999999999a", "0.10000000000000001"],
+  ["f", 0, "3fd3333333333333", "0"],
+  ["f", 1, "3fd3333333333333", "0.3"],
+  ["f", 3, "3fd3333333333333", "0.300"],
+  ["f", 6, "3fd3333333333333", "0.300000"],
+  ["f", 17, "3fd3333333333333", "0.29999999999999999"],
+  ["e", 0, "3fd3333333333333", "3e-01"],
+  ["e", 1, "3fd3333333333333", "3.0e-01"],
+  ["e", 3, "3fd3333333333333", "3.000e-01"],
+  ["e", 6, "3fd3333333333333", "3.000000e-01"],
+  ["e", 17, "3fd3333333333333", "2.99999999999999989e-01"],
+  ["g", 0, "3fd3333333333333", "0.3"],
+  ["g", 1, "3fd3333333333333", "0.3"],
+  ["g", 3, "3fd3333333333333", "0.3"],
+  ["g", 6, "3fd3333333333333", "0.3"],
+  ["g", 17, "3fd3333333333333", "0.29999999999999999"],
+  ["f", 0, "400921f9f01b866e", "3"],
+  ["f", 1, "400921f9f01b866e", "3.1"],
+  ["f", 3, "400921f9f01b866e", "3.142"],
+  ["f", 6, "400921f9f01b866e", "3.141590"],
+  ["f", 17, "400921f9f01b866e", "3.14158999999999988"],
+  ["e", 0, "400921f9f01b866e", "3e+00"],
+  ["e", 1, "400921f9f01b866e", "3.1e+00"],
+  ["e", 3, "400921f9f01b866e", "3.142e+00"],
+  ["e", 6, "400921f9f01b866e", "3.141590e+00"],
+  ["e", 17, "400921f9f01b866e", "3.14158999999999988e+00"],
+  ["g", 0, "400921f9f01b866e", "3"],
+  ["g", 1, "400921f9f01b866e", "3"],
+  ["g", 3, "400921f9f01b866e", "3.14"],
+  ["g", 6, "400921f9f01b866e", "3.14159"],
+  ["g", 17, "400921f9f01b866e", "3.1415899999999999"],
+  ["f", 0, "4023ffbe76c8b439", "10"],
+  ["f", 1, "4023ffbe76c8b439", "10.0"],
+  ["f", 3, "4023ffbe76c8b439", "9.999"],
+  ["f", 6, "4023ffbe76c8b439", "9.999500"],
+  ["f", 17, "4023ffbe76c8b439", "9.99949999999999939"],
+  ["e", 0, "4023ffbe76c8b439", "1e+01"],
+  ["e", 1, "4023ffbe76c8b439", "1.0e+01"],
+  ["e", 3, "4023ffbe76c8b439", "9.999e+00"],
+  ["e", 6, "4023ffbe76c8b439", "9.999500e+00"],
+  ["e", 17, "4023ffbe76c8b439", "9.99949999999999939e+00"],
+  ["g", 0, "4023ffbe76c8b439", "1e+01"],
+  ["g", 1, "4023ffbe76c8b439", "1e+01"],
+  ["g", 3, "4023ffbe76c8b439", "10"],
+  ["g", 6, "4023ffbe76c8b439", "9.9995"],
+  ["g", 17, "4023ffbe76c8b439", "9.9994999999999994"],
+  ["f", 0, "412e847f00000000", "1000000"],
+  ["f", 1, "412e847f00000000", "999999.5"],
+  ["f", 3, "412e847f00000000", "999999.500"],
+  ["f", 6, "412e847f00000000", "999999.500000"],
+  ["f", 17, "412e847f00000000", "999999.50000000000000000"],
+  ["e", 0, "412e847f00000000", "1e+06"],
+  ["e", 1, "412e847f00000000", "1.0e+06"],
+  ["e", 3, "412e847f00000000", "1.000e+06"],
+  ["e", 6, "412e847f00000000", "9.999995e+05"],
+  ["e", 17, "412e847f00000000", "9.99999500000000000e+05"],
+  ["g", 0, "412e847f00000000", "1e+06"],
+  ["g", 1, "412e847f00000000", "1e+06"],
+  ["g", 3, "412e847f00000000", "1e+06"],
+  ["g", 6, "412e847f00000000", "1e+06"],
+  ["g", 17, "412e847f00000000", "999999.5"],
+  ["f", 0, "3f80000000000000", "0"],
+  ["f", 1, "3f80000000000000", "0.0"],
+  ["f", 3, "3f80000000000000", "0.008"],
+  ["f", 6, "3f80000000000000", "0.007812"],
+  ["f", 17, "3f80000000000000", "0.00781250000000000"],
+  ["e", 0, "3f80000000000000", "8e-03"],
+  ["e", 1, "3f80000000000000", "7.8e-03"],
+  ["e", 3, "3f80000000000000", "7.812e-03"],
+  ["e", 6, "3f80000000000000", "7.812500e-03"],
+  ["e", 17, "3f80000000000000", "7.81250000000000000e-03"],
+  ["g", 0, "3f80000000000000", "0.008"],
+  ["g", 1, "3f80000000000000", "0.008"],
+  ["g", 3, "3f80000000000000", "0.00781"],
+  ["g", 6, "3f80000000000000", "0.0078125"],
+  ["g", 17, "3f80000000000000", "0.0078125"],
+  ["f", 0, "405f400000000000", "125"],
+  ["f", 1, "405f400000000000", "125.0"],
+  ["f", 3, "405f400000000000", "125.000"],
+  ["f", 6, "405f400000000000", "125.000000"],
+  ["f", 17, "405f400000000000", "125.00000000000000000"],
+  ["e", 0, "405f400000000000", "1e+02"],
+  ["e", 1, "405f400000000000", "1.2e+02"],
+  ["e", 3, "405f400000000000", "1.250e+02"],
+  ["e", 6, "405f400000000000", "1.250000e+02"],
+  ["e", 17, "405f400000000000", "1.25000000000000000e+02"],
+  ["g", 0, "405f400000000000", "1e+02"],
+  ["g", 1, "405f400000000000", "1e+02"],
+  ["g", 3, "405f400000000000", "125"],
+  ["g", 6, "405f400000000000", "125"],
+  ["g", 17, "405f400000000000", "125"],
+  ["f", 0, "4093880000000000", "1250"],
+  ["f", 1, "4093880000000000", "1250.0"],
+  ["f", 3, "4093880000000000", "1250.000"],
+  ["f", 6, "4093880000000000", "1250.000000"],
+  ["f", 17, "4093880000000000", "1250.00000000000000000"],
+  ["e", 0, "4093880000000000", "1e+03"],
+  ["e", 1, "4093880000000000", "1.2e+03"],
+  ["e", 3, "4093880000000000", "1.250e+03"],
+  ["e", 6, "4093880000000000", "1.250000e+03"],
+  ["e", 17, "4093880000000000", "1.25000000000000000e+03"],
+  ["g", 0, "4093880000000000", "1e+03"],
+  ["g", 1, "4093880000000000", "1e+03"],
+  ["g", 3, "4093880000000000", "1.25e+03"],
+  ["g", 6, "4093880000000000", "1250"],
+  ["g", 17, "4093880000000000", "1250"],
+  ["f", 0, "4167d78400000000", "12500000"],
+  ["f", 1, "4167d78400000000", "12500000.0"],
+  ["f", 3, "4167d78400000000", "12500000.000"],
+  ["f", 6, "4167d78400000000", "12500000.000000"],
+  ["f", 17, "4167d78400000000", "12500000.00000000000000000"],
+  ["e", 0, "4167d78400000000", "1e+07"],
+  ["e", 1, "4167d78400000000", "1.2e+07"],
+  ["e", 3, "4167d78400000000", "1.250e+07"],
+  ["e", 6, "4167d78400000000", "1.250000e+07"],
+  ["e", 17, "4167d78400000000", "1.25000000000000000e+07"],
+  ["g", 0, "4167d78400000000", "1e+07"],
+  ["g", 1, "4167d78400000000", "1e+07"],
+  ["g", 3, "4167d78400000000", "1.25e+07"],
+  ["g", 6, "4167d78400000000", "1.25e+07"],
+  ["g", 17, "4167d78400000000", "12500000"],
+  ["f", 0, "3ee4f8b588e368f1", "0"],
+  ["f", 1, "3ee4f8b588e368f1", "0.0"],
+  ["f", 3, "3ee4f8b588e368f1", "0.000"],
+  ["f", 6, "3ee4f8b588e368f1", "0.000010"],
+  ["f", 17, "3ee4f8b588e368f1", "0.00001000000000000"],
+  ["e", 0, "3ee4f8b588e368f1", "1e-05"],
+  ["e", 1, "3ee4f8b588e368f1", "1.0e-05"],
+  ["e", 3, "3ee4f8b588e368f1", "1.000e-05"],
+  ["e", 6, "3ee4f8b588e368f1", "1.000000e-05"],
+  ["e", 17, "3ee4f8b588e368f1", "1.00000000000000008e-05"],
+  ["g", 0, "3ee4f8b588e368f1", "1e-05"],
+  ["g", 1, "3ee4f8b588e368f1", "1e-05"],
+  ["g", 3, "3ee4f8b588e368f1", "1e-05"],
+  ["g", 6, "3ee4f8b588e368f1", "1e-05"],
+  ["g", 17, "3ee4f8b588e368f1", "1.0000000000000001e-05"],
+  ["f", 0, "3f1a36e2eb1c432d", "0"],
+  ["f", 1, "3f1a36e2eb1c432d", "0.0"],
+  ["f", 3, "3f1a36e2eb1c432d", "0.000"],
+  ["f", 6, "3f1a36e2eb1c432d", "0.000100"],
+  ["f", 17, "3f1a36e2eb1c432d", "0.00010000000000000"],
+  ["e", 0, "3f1a36e2eb1c432d", "1e-04"],
+  ["e", 1, "3f1a36e2eb1c432d", "1.0e-04"],
+  ["e", 3, "3f1a36e2eb1c432d", "1.000e-04"],
+  ["e", 6, "3f1a36e2eb1c432d", "1.000000e-04"],
+  ["e", 17, "3f1a36e2eb1c432d", "1.00000000000000005e-04"],
+  ["g", 0, "3f1a36e2eb1c432d", "0.0001"],
+  ["g", 1, "3f1a36e2eb1c432d", "0.0001"],
+  ["g", 3, "3f1a36e2eb1c432d", "0.0001"],
+  ["g", 6, "3f1a36e2eb1c432d", "0.0001"],
+  ["g", 17, "3f1a36e2eb1c432d", "0.0001"],
+  ["f", 0, "40f86a0000000000", "100000"],
+  ["f", 1, "40f86a0000000000", "100000.0"],
+  ["f", 3, "40f86a0000000000", "100000.000"],
+  ["f", 6, "40f86a0000000000", "100000.000000"],
+  ["f", 17, "40f86a0000000000", "100000.00000000000000000"],
+  ["e", 0, "40f86a0000000000", "1e+05"],
+  ["e", 1, "40f86a0000000000", "1.0e+05"],
+  ["e", 3, "40f86a0000000000", "1.000e+05"],
+  ["e", 6, "40f86a0000000000", "1.000000e+05"],
+  ["e", 17, "40f86a0000000000", "1.00000000000000000e+05"],
+  ["g", 0, "40f86a0000000000", "1e+05"],
+  ["g", 1, "40f86a0000000000", "1e+05"],
+  ["g", 3, "40f86a0000000000", "1e+05"],
+  ["g", 6, "40f86a0000000000", "100000"],
+  ["g", 17, "40f86a0000000000", "100000"],
+  ["f", 0, "412e848000000000", "1000000"],
+  ["f", 1, "412e848000000000", "1000000.0"],
+  ["f", 3, "412e848000000000", "1000000.000"],
+  ["f", 6, "412e848000000000", "1000000.000000"],
+  ["f", 17, "412e848000000000", "1000000.00000000000000000"],
+  ["e", 0, "412e848000000000", "1e+06"],
+  ["e", 1, "412e848000000000", "1.0e+06"],
+  ["e", 3, "412e848000000000", "1.000e+06"],
+  ["e", 6, "412e848000000000", "1.000000e+06"],
+  ["e", 17, "412e848000000000", "1.00000000000000000e+06"],
+  ["g", 0, "412e848000000000", "1e+06"],
+  ["g", 1, "412e848000000000", "1e+06"],
+  ["g", 3, "412e848000000000", "1e+06"],
+  ["g", 6, "412e848000000000", "1e+06"],
+  ["g", 17, "412e848000000000", "1000000"],
+  ["f", 0, "444b1ae4d6e2ef50", "1000000000000000000000"],
+  ["f", 1, "444b1ae4d6e2ef50", "1000000000000000000000.0"],
+  ["f", 3, "444b1ae4d6e2ef50", "1000000000000000000000.000"],
+  ["f", 6, "444b1ae4d6e2ef50", "1000000000000000000000.000000"],
+  ["f", 17, "444b1ae4d6e2ef50", "1000000000000000000000.00000000000000000"],
+  ["e", 0, "444b1ae4d6e2ef50", "1e+21"],
+  ["e", 1, "444b1ae4d6e2ef50", "1.0e+21"],
+  ["e", 3, "444b1ae4d6e2ef50", "1.000e+21"],
+  ["e", 6, "444b1ae4d6e2ef50", "1.000000e+21"],
+  ["e", 17, "444b1ae4d6e2ef50", "1.00000000000000000e+21"],
+  ["g", 0, "444b1ae4d6e2ef50", "1e+21"],
+  ["g", 1, "444b1ae4d6e2ef50", "1e+21"],
+  ["g", 3, "444b1ae4d6e2ef50", "1e+21"],
+  ["g", 6, "444b1ae4d6e2ef50", "1e+21"],
+  ["g", 17, "444b1ae4d6e2ef50", "1e+21"],
+  ["f", 0, "4480f0cf064dd592", "10000000000000000000000"],
+  ["f", 1, "4480f0cf064dd592", "10000000000000000000000.0"],
+  ["f", 3, "4480f0cf064dd592", "10000000000000000000000.000"],
+  ["f", 6, "4480f0cf064dd592", "10000000000000000000000.000000"],
+  ["f", 17, "4480f0cf064dd592", "10000000000000000000000.00000000000000000"],
+  ["e", 0, "4480f0cf064dd592", "1e+22"],
+  ["e", 1, "4480f0cf064dd592", "1.0e+22"],
+  ["e", 3, "4480f0cf064dd592", "1.000e+22"],
+  ["e", 6, "4480f0cf064dd592", "1.000000e+22"],
+  ["e", 17, "4480f0cf064dd592", "1.00000000000000000e+22"],
+  ["g", 0, "4480f0cf064dd592", "1e+22"],
+  ["g", 1, "4480f0cf064dd592", "1e+22"],
+  ["g", 3, "4480f0cf064dd592", "1e+22"],
+  ["g", 6, "4480f0cf064dd592", "1e+22"],
+  ["g", 17, "4480f0cf064dd592", "1e+22"],
+  ["f", 0, "0000000000000001", "0"],
+  ["f", 1, "0000000000000001", "0.0"],
+  ["f", 3, "0000000000000001", "0.000"],
+  ["f", 6, "0000000000000001", "0.000000"],
+  ["f", 17, "0000000000000001", "0.00000000000000000"],
+  ["e", 0, "0000000000000001", "5e-324"],
+  ["e", 1, "0000000000000001", "4.9e-324"],
+  ["e", 3, "0000000000000001", "4.941e-324"],
+  ["e", 6, "0000000000000001", "4.940656e-324"],
+  ["e", 17, "0000000000000001", "4.94065645841246544e-324"],
+  ["g", 0, "0000000000000001", "5e-324"],
+  ["g", 1, "0000000000000001", "5e-324"],
+  ["g", 3, "0000000000000001", "4.94e-324"],
+  ["g", 6, "0000000000000001", "4.94066e-324"],
+  ["g", 17, "0000000000000001", "4.9406564584124654e-324"],
+  ["f", 0, "0010000000000000", "0"],
+  ["f", 1, "0010000000000000", "0.0"],
+  ["f", 3, "0010000000000000", "0.000"],
+  ["f", 6, "0010000000000000", "0.000000"],
+  ["f", 17, "0010000000000000", "0.00000000000000000"],
+  ["e", 0, "0010000000000000", "2e-308"],
+  ["e", 1, "0010000000000000", "2.2e-308"],
+  ["e", 3, "0010000000000000", "2.225e-308"],
+  ["e", 6, "0010000000000000", "2.225074e-308"],
+  ["e", 17, "0010000000000000", "2.22507385850720138e-308"],
+  ["g", 0, "0010000000000000", "2e-308"],
+  ["g", 1, "0010000000000000", "2e-308"],
+  ["g", 3, "0010000000000000", "2.23e-308"],
+  ["g", 6, "0010000000000000", "2.22507e-308"],
+  ["g", 17, "0010000000000000", "2.2250738585072014e-308"],
+  ["e", 0, "7fefffffffffffff", "2e+308"],
+  ["e", 1, "7fefffffffffffff", "1.8e+308"],
+  ["e", 3, "7fefffffffffffff", "1.798e+308"],
+  ["e", 6, "7fefffffffffffff", "1.797693e+308"],
+  ["e", 17, "7fefffffffffffff", "1.79769313486231571e+308"],
+  ["g", 0, "7fefffffffffffff", "2e+308"],
+  ["g", 1, "7fefffffffffffff", "2e+308"],
+  ["g", 3, "7fefffffffffffff", "1.8e+308"],
+  ["g", 6, "7fefffffffffffff", "1.79769e+308"],
+  ["g", 17, "7fefffffffffffff", "1.7976931348623157e+308"],
+  ["e", 0, "79690975fbde15b0", "7e+276"],
+  ["e", 1, "79690975fbde15b0", "6.9e+276"],
+  ["e", 3, "79690975fbde15b0", "6.935e+276"],
+  ["e", 6, "79690975fbde15b0", "6.934698e+276"],
+  ["e", 17, "79690975fbde15b0", "6.93469824511269441e+276"],
+  ["g", 0, "79690975fbde15b0", "7e+276"],
+  ["g", 1, "79690975fbde15b0", "7e+276"],
+  ["g", 3, "79690975fbde15b0", "6.93e+276"],
+  ["g", 6, "79690975fbde15b0", "6.9347e+276"],
+  ["g", 17, "79690975fbde15b0", "6.9346982451126944e+276"],
+  ["f", 0, "2a337357ae2cc59b", "0"],
+  ["f", 1, "2a337357ae2cc59b", "0.0"],
+  ["f", 3, "2a337357ae2cc59b", "0.000"],
+  ["f", 6, "2a337357ae2cc59b", "0.000000"],
+  ["f", 17, "2a337357ae2cc59b", "0.00000000000000000"],
+  ["e", 0, "2a337357ae2cc59b", "2e-105"],
+  ["e", 1, "2a337357ae2cc59b", "2.1e-105"],
+  ["e", 3, "2a337357ae2cc59b", "2.120e-105"],
+  ["e", 6, "2a337357ae2cc59b", "2.120184e-105"],
+  ["e", 17, "2a337357ae2cc59b", "2.12018404008109272e-105"],
+  ["g", 0, "2a337357ae2cc59b", "2e-105"],
+  ["g", 1, "2a337357ae2cc59b", "2e-105"],
+  ["g", 3, "2a337357ae2cc59b", "2.12e-105"],
+  ["g", 6, "2a337357ae2cc59b", "2.12018e-105"],
+  ["g", 17, "2a337357ae2cc59b", "2.1201840400810927e-105"],
+  ["f", 0, "2fef107a27529ad0", "0"],
+  ["f", 1, "2fef107a27529ad0", "0.0"],
+  ["f", 3, "2fef107a27529ad0", "0.000"],
+  ["f", 6, "2fef107a27529ad0", "0.000000"],
+  ["f", 17, "2fef107a27529ad0", "0.00000000000000000"],
+  ["e", 0, "2fef107a27529ad0", "8e-78"],
+  ["e", 1, "2fef107a27529ad0", "8.4e-78"],
+  ["e", 3, "2fef107a27529ad0", "8.384e-78"],
+  ["e", 6, "2fef107a27529ad0", "8.383659e-78"],
+  ["e", 17, "2fef107a27529ad0", "8.38365883862680932e-78"],
+  ["g", 0, "2fef107a27529ad0", "8e-78"],
+  ["g", 1, "2fef107a27529ad0", "8e-78"],
+  ["g", 3, "2fef107a27529ad0", "8.38e-78"],
+  ["g", 6, "2fef107a27529ad0", "8.38366e-78"],
+  ["g", 17, "2fef107a27529ad0", "8.3836588386268093e-78"],
+  ["e", 0, "64093df8432a8be5", "8e+173"],
+  ["e", 1, "64093df8432a8be5", "7.8e+173"],
+  ["e", 3, "64093df8432a8be5", "7.804e+173"],
+  ["e", 6, "64093df8432a8be5", "7.803914e+173"],
+  ["e", 17, "64093df8432a8be5", "7.80391395862724423e+173"],
+  ["g", 0, "64093df8432a8be5", "8e+173"],
+  ["g", 1, "64093df8432a8be5", "8e+173"],
+  ["g", 3, "64093df8432a8be5", "7.8e+173"],
+  ["g", 6, "64093df8432a8be5", "7.80391e+173"],
+  ["g", 17, "64093df8432a8be5", "7.8039139586272442e+173"],
+  ["e", 0, "71dd0913271687b2", "3e+240"],
+  ["e", 1, "71dd0913271687b2", "3.0e+240"],
+  ["e", 3, "71dd0913271687b2", "3.025e+240"],
+  ["e", 6, "71dd0913271687b2", "3.025137e+240"],
+  ["e", 17, "71dd0913271687b2", "3.02513733815513920e+240"],
+  ["g", 0, "71dd0913271687b2", "3e+240"],
+  ["g", 1, "71dd0913271687b2", "3e+240"],
+  ["g", 3, "71dd0913271687b2", "3.03e+240"],
+  ["g", 6, "71dd0913271687b2", "3.02514e+240"],
+  ["g", 17, "71dd0913271687b2", "3.0251373381551392e+240"],
+  ["e", 0, "770abb341875063d", "3e+265"],
+  ["e", 1, "770abb341875063d", "2.7e+265"],
+  ["e", 3, "770abb341875063d", "2.694e+265"],
+  ["e", 6, "770abb341875063d", "2.693554e+265"],
+  ["e", 17, "770abb341875063d", "2.69355400170399814e+265"],
+  ["g", 0, "770abb341875063d", "3e+265"],
+  ["g", 1, "770abb341875063d", "3e+265"],
+  ["g", 3, "770abb341875063d", "2.69e+265"],
+  ["g", 6, "770abb341875063d", "2.69355e+265"],
+  ["g", 17, "770abb341875063d", "2.6935540017039981e+265"],
+  ["e", 0, "61b97bcd4b21c371", "6e+162"],
+  ["e", 1, "61b97bcd4b21c371", "5.7e+162"],
+  ["e", 3, "61b97bcd4b21c371", "5.732e+162"],
+  ["e", 6, "61b97bcd4b21c371", "5.732426e+162"],
+  ["e", 17, "61b97bcd4b21c371", "5.73242626665418493e+162"],
+  ["g", 0, "61b97bcd4b21c371", "6e+162"],
+  ["g", 1, "61b97bcd4b21c371", "6e+162"],
+  ["g", 3, "61b97bcd4b21c371", "5.73e+162"],
+  ["g", 6, "61b97bcd4b21c371", "5.73243e+162"],
+  ["g", 17, "61b97bcd4b21c371", "5.7324262666541849e+162"],
+  ["e", 0, "6845105ed8c77cb7", "2e+194"],
+  ["e", 1, "6845105ed8c77cb7", "1.9e+194"],
+  ["e", 3, "6845105ed8c77cb7", "1.922e+194"],
+  ["e", 6, "6845105ed8c77cb7", "1.922060e+194"],
+  ["e", 17, "6845105ed8c77cb7", "1.92206016976352594e+194"],
+  ["g", 0, "6845105ed8c77cb7", "2e+194"],
+  ["g", 1, "6845105ed8c77cb7", "2e+194"],
+  ["g", 3, "6845105ed8c77cb7", "1.92e+194"],
+  ["g", 6, "6845105ed8c77cb7", "1.92206e+194"],
+  ["g", 17, "6845105ed8c77cb7", "1.9220601697635259e+194"],
+  ["e", 0, "677b20aec4233f8e", "3e+190"],
+  ["e", 1, "677b20aec4233f8e", "3.0e+190"],
+  ["e", 3, "677b20aec4233f8e", "3.022e+190"],
+  ["e", 6, "677b20aec4233f8e", "3.021689e+190"],
+  ["e", 17, "677b20aec4233f8e", "3.02168868419702931e+190"],
+  ["g", 0, "677b20aec4233f8e", "3e+190"],
+  ["g", 1, "677b20aec4233f8e", "3e+190"],
+  ["g", 3, "677b20aec4233f8e", "3.02e+190"],
+  ["g", 6, "677b20aec4233f8e", "3.02169e+190"],
+  ["g", 17, "677b20aec4233f8e", "3.0216886841970293e+190"],
+  ["e", 0, "49ddc8f042775a71", "7e+47"],
+  ["e", 1, "49ddc8f042775a71", "6.8e+47"],
+  ["e", 3, "49ddc8f042775a71", "6.802e+47"],
+  ["e", 6, "49ddc8f042775a71", "6.801672e+47"],
+  ["e", 17, "49ddc8f042775a71", "6.80167243838020161e+47"],
+  ["g", 0, "49ddc8f042775a71", "7e+47"],
+  ["g", 1, "49ddc8f042775a71", "7e+47"],
+  ["g", 3, "49ddc8f042775a71", "6.8e+47"],
+  ["g", 6, "49ddc8f042775a71", "6.80167e+47"],
+  ["g", 17, "49ddc8f042775a71", "6.8016724383802016e+47"],
+  ["e", 0, "7e5defe9c5610885", "5e+300"],
+  ["e", 1, "7e5defe9c5610885", "5.0e+300"],
+  ["e", 3, "7e5defe9c5610885", "5.012e+300"],
+  ["e", 6, "7e5defe9c5610885", "5.012176e+300"],
+  ["e", 17, "7e5defe9c5610885", "5.01217585709004597e+300"],
+  ["g", 0, "7e5defe9c5610885", "5e+300"],
+  ["g", 1, "7e5defe9c5610885", "5e+300"],
+  ["g", 3, "7e5defe9c5610885", "5.01e+300"],
+  ["g", 6, "7e5defe9c5610885", "5.01218e+300"],
+  ["g", 17, "7e5defe9c5610885", "5.012175857090046e+300"],
+  ["e", 0, "6ef14999f8114bd4", "3e+226"],
+  ["e", 1, "6ef14999f8114bd4", "2.6e+226"],
+  ["e", 3, "6ef14999f8114bd4", "2.560e+226"],
+  ["e", 6, "6ef14999f8114bd4", "2.559582e+226"],
+  ["e", 17, "6ef14999f8114bd4", "2.55958225845534794e+226"],
+  ["g", 0, "6ef14999f8114bd4", "3e+226"],
+  ["g", 1, "6ef14999f8114bd4", "3e+226"],
+  ["g", 3, "6ef14999f8114bd4", "2.56e+226"],
+  ["g", 6, "6ef14999f8114bd4", "2.55958e+226"],
+  ["g", 17, "6ef14999f8114bd4", "2.5595822584553479e+226"],
+  ["f", 0, "23a03fe4de4f1c43", "0"],
+  ["f", 1, "23a03fe4de4f1c43", "0.0"],
+  ["f", 3, "23a03fe4de4f1c43", "0.000"],
+  ["f", 6, "23a03fe4de4f1c43", "0.000000"],
+  ["f", 17, "23a03fe4de4f1c43", "0.00000000000000000"],
+  ["e", 0, "23a03fe4de4f1c43", "4e-137"],
+  ["e", 1, "23a03fe4de4f1c43", "4.4e-137"],
+  ["e", 3, "23a03fe4de4f1c43", "4.367e-137"],
+  ["e", 6, "23a03fe4de4f1c43", "4.366508e-137"],
+  ["e", 17, "23a03fe4de4f1c43", "4.36650822311472422e-137"],
+  ["g", 0, "23a03fe4de4f1c43", "4e-137"],
+  ["g", 1, "23a03fe4de4f1c43", "4e-137"],
+  ["g", 3, "23a03fe4de4f1c43", "4.37e-137"],
+  ["g", 6, "23a03fe4de4f1c43", "4.36651e-137"],
+  ["g", 17, "23a03fe4de4f1c43", "4.3665082231147242e-137"],
+  ["f", 0, "1fded21c82caf2bb", "0"],
+  ["f", 1, "1fded21c82caf2bb", "0.0"],
+  ["f", 3, "1fded21c82caf2bb", "0.000"],
+  ["f", 6, "1fded21c82caf2bb", "0.000000"],
+  ["f", 17, "1fded21c82caf2bb", "0.00000000000000000"],
+  ["e", 0, "1fded21c82caf2bb", "4e-155"],
+  ["e", 1, "1fded21c82caf2bb", "3.6e-155"],
+  ["e", 3, "1fded21c82caf2bb", "3.592e-155"],
+  ["e", 6, "1fded21c82caf2bb", "3.591744e-155"],
+  ["e", 17, "1fded21c82caf2bb", "3.59174432434633210e-155"],
+  ["g", 0, "1fded21c82caf2bb", "4e-155"],
+  ["g", 1, "1fded21c82caf2bb", "4e-155"],
+  ["g", 3, "1fded21c82caf2bb", "3.59e-155"],
+  ["g", 6, "1fded21c82caf2bb", "3.59174e-155"],
+  ["g", 17, "1fded21c82caf2bb", "3.5917443243463321e-155"],
+  ["f", 0, "3494d6880418a99e", "0"],
+  ["f", 1, "3494d6880418a99e", "0.0"],
+  ["f", 3, "3494d6880418a99e", "0.000"],
+  ["f", 6, "3494d6880418a99e", "0.000000"],
+  ["f", 17, "3494d6880418a99e", "0.00000000000000000"],
+  ["e", 0, "3494d6880418a99e", "2e-55"],
+  ["e", 1, "3494d6880418a99e", "2.1e-55"],
+  ["e", 3, "3494d6880418a99e", "2.125e-55"],
+  ["e", 6, "3494d6880418a99e", "2.124600e-55"],
+  ["e", 17, "3494d6880418a99e", "2.12459967090868851e-55"],
+  ["g", 0, "3494d6880418a99e", "2e-55"],
+  ["g", 1, "3494d6880418a99e", "2e-55"],
+  ["g", 3, "3494d6880418a99e", "2.12e-55"],
+  ["g", 6, "3494d6880418a99e", "2.1246e-55"],
+  ["g", 17, "3494d6880418a99e", "2.1245996709086885e-55"],
+  ["f", 0, "155753b579933f4d", "0"],
+  ["f", 1, "155753b579933f4d", "0.0"],
+  ["f", 3, "155753b579933f4d", "0.000"],
+  ["f", 6, "155753b579933f4d", "0.000000"],
+  ["f", 17, "155753b579933f4d", "0.00000000000000000"],
+  ["e", 0, "155753b579933f4d", "7e-206"],
+  ["e", 1, "155753b579933f4d", "7.3e-206"],
+  ["e", 3, "155753b579933f4d", "7.266e-206"],
+  ["e", 6, "155753b579933f4d", "7.265770e-206"],
+  ["e", 17, "155753b579933f4d", "7.26576985612225337e-206"],
+  ["g", 0, "155753b579933f4d", "7e-206"],
+  ["g", 1, "155753b579933f4d", "7e-206"],
+  ["g", 3, "155753b579933f4d", "7.27e-206"],
+  ["g", 6, "155753b579933f4d", "7.26577e-206"],
+  ["g", 17, "155753b579933f4d", "7.2657698561222534e-206"],
+  ["f", 0, "01239ff2c4a06a73", "0"],
+  ["f", 1, "01239ff2c4a06a73", "0.0"],
+  ["f", 3, "01239ff2c4a06a73", "0.000"],
+  ["f", 6, "01239ff2c4a06a73", "0.000000"],
+  ["f", 17, "01239ff2c4a06a73", "0.00000000000000000"],
+  ["e", 0, "01239ff2c4a06a73", "4e-303"],
+  ["e", 1, "01239ff2c4a06a73", "3.6e-303"],
+  ["e", 3, "01239ff2c4a06a73", "3.577e-303"],
+  ["e", 6, "01239ff2c4a06a73", "3.577170e-303"],
+  ["e", 17, "01239ff2c4a06a73", "3.57716993832558357e-303"],
+  ["g", 0, "01239ff2c4a06a73", "4e-303"],
+  ["g", 1, "01239ff2c4a06a73", "4e-303"],
+  ["g", 3, "01239ff2c4a06a73", "3.58e-303"],
+  ["g", 6, "01239ff2c4a06a73", "3.57717e-303"],
+  ["g", 17, "01239ff2c4a06a73", "3.5771699383255836e-303"],
+  ["f", 0, "0be87413a8b3d667", "0"],
+  ["f", 1, "0be87413a8b3d667", "0.0"],
+  ["f", 3, "0be87413a8b3d667", "0.000"],
+  ["f", 6, "0be87413a8b3d667", "0.000000"],
+  ["f", 17, "0be87413a8b3d667", "0.00000000000000000"],
+  ["e", 0, "0be87413a8b3d667", "3e-251"],
+  ["e", 1, "0be87413a8b3d667", "2.7e-251"],
+  ["e", 3, "0be87413a8b3d667", "2.668e-251"],
+  ["e", 6, "0be87413a8b3d667", "2.668292e-251"],
+  ["e", 17, "0be87413a8b3d667", "2.66829181928263374e-251"],
+  ["g", 0, "0be87413a8b3d667", "3e-251"],
+  ["g", 1, "0be87413a8b3d667", "3e-251"],
+  ["g", 3, "0be87413a8b3d667", "2.67e-251"],
+  ["g", 6, "0be87413a8b3d667", "2.66829e-251"],
+  ["g", 17, "0be87413a8b3d667", "2.6682918192826337e-251"],
+  ["f", 0, "2e6f66b049cdc80b", "0"],
+  ["f", 1, "2e6f66b049cdc80b", "0.0"],
+  ["f", 3, "2e6f66b049cdc80b", "0.000"],
+  ["f", 6, "2e6f66b049cdc80b", "0.000000"],
+  ["f", 17, "2e6f66b049cdc80b", "0.00000000000000000"],
+  ["e", 0, "2e6f66b049cdc80b", "5e-85"],
+  ["e", 1, "2e6f66b049cdc80b", "5.1e-85"],
+  ["e", 3, "2e6f66b049cdc80b", "5.051e-85"],
+  ["e", 6, "2e6f66b049cdc80b", "5.051222e-85"],
+  ["e", 17, "2e6f66b049cdc80b", "5.05122224694158405e-85"],
+  ["g", 0, "2e6f66b049cdc80b", "5e-85"],
+  ["g", 1, "2e6f66b049cdc80b", "5e-85"],
+  ["g", 3, "2e6f66b049cdc80b", "5.05e-85"],
+  ["g", 6, "2e6f66b049cdc80b", "5.05122e-85"],
+  ["g", 17, "2e6f66b049cdc80b", "5.051222246941584e-85"],
+  ["e", 0, "7991db0c819b315b", "4e+277"],
+  ["e", 1, "7991db0c819b315b", "4.0e+277"],
+  ["e", 3, "7991db0c819b315b", "3.957e+277"],
+  ["e", 6, "7991db0c819b315b", "3.956507e+277"],
+  ["e", 17, "7991db0c819b315b", "3.95650680488017897e+277"],
+  ["g", 0, "7991db0c819b315b", "4e+277"],
+  ["g", 1, "7991db0c819b315b", "4e+277"],
+  ["g", 3, "7991db0c819b315b", "3.96e+277"],
+  ["g", 6, "7991db0c819b315b", "3.95651e+277"],
+  ["g", 17, "7991db0c819b315b", "3.956506804880179e+277"],
+  ["f", 0, "14269b57fb8d31f9", "0"],
+  ["f", 1, "14269b57fb8d31f9", "0.0"],
+  ["f", 3, "14269b57fb8d31f9", "0.000"],
+  ["f", 6, "14269b57fb8d31f9", "0.000000"],
+  ["f", 17, "14269b57fb8d31f9", "0.00000000000000000"],
+  ["e", 0, "14269b57fb8d31f9", "1e-211"],
+  ["e", 1, "14269b57fb8d31f9", "1.3e-211"],
+  ["e", 3, "14269b57fb8d31f9", "1.343e-211"],
+  ["e", 6, "14269b57fb8d31f9", "1.343051e-211"],
+  ["e", 17, "14269b57fb8d31f9", "1.34305056949873114e-211"],
+  ["g", 0, "14269b57fb8d31f9", "1e-211"],
+  ["g", 1, "14269b57fb8d31f9", "1e-211"],
+  ["g", 3, "14269b57fb8d31f9", "1.34e-211"],
+  ["g", 6, "14269b57fb8d31f9", "1.34305e-211"],
+  ["g", 17, "14269b57fb8d31f9", "1.3430505694987311e-211"],
+  ["f", 0, "3e1edefcfabd75da", "0"],
+  ["f", 1, "3e1edefcfabd75da", "0.0"],
+  ["f", 3, "3e1edefcfabd75da", "0.000"],
+  ["f", 6, "3e1edefcfabd75da", "0.000000"],
+  ["f", 17, "3e1edefcfabd75da", "0.00000000179693147"],
+  ["e", 0, "3e1edefcfabd75da", "2e-09"],
+  ["e", 1, "3e1edefcfabd75da", "1.8e-09"],
+  ["e", 3, "3e1edefcfabd75da", "1.797e-09"],
+  ["e", 6, "3e1edefcfabd75da", "1.796931e-09"],
+  ["e", 17, "3e1edefcfabd75da", "1.79693147424358880e-09"],
+  ["g", 0, "3e1edefcfabd75da", "2e-09"],
+  ["g", 1, "3e1edefcfabd75da", "2e-09"],
+  ["g", 3, "3e1edefcfabd75da", "1.8e-09"],
+  ["g", 6, "3e1edefcfabd75da", "1.79693e-09"],
+  ["g", 17, "3e1edefcfabd75da", "1.7969314742435888e-09"],
+  ["e", 0, "635ac67471cc39b1", "4e+170"],
+  ["e", 1, "635ac67471cc39b1", "4.0e+170"],
+  ["e", 3, "635ac67471cc39b1", "4.042e+170"],
+  ["e", 6, "635ac67471cc39b1", "4.041946e+170"],
+  ["e", 17, "635ac67471cc39b1", "4.04194610775298717e+170"],
+  ["g", 0, "635ac67471cc39b1", "4e+170"],
+  ["g", 1, "635ac67471cc39b1", "4e+170"],
+  ["g", 3, "635ac67471cc39b1", "4.04e+170"],
+  ["g", 6, "635ac67471cc39b1", "4.04195e+170"],
+  ["g", 17, "635ac67471cc39b1", "4.0419461077529872e+170"],
+  ["e", 0, "7b59baf2b613ed82", "2e+286"],
+  ["e", 1, "7b59baf2b613ed82", "1.5e+286"],
+  ["e", 3, "7b59baf2b613ed82", "1.530e+286"],
+  ["e", 6, "7b59baf2b613ed82", "1.530454e+286"],
+  ["e", 17, "7b59baf2b613ed82", "1.53045362285411097e+286"],
+  ["g", 0, "7b59baf2b613ed82", "2e+286"],
+  ["g", 1, "7b59baf2b613ed82", "2e+286"],
+  ["g", 3, "7b59baf2b613ed82", "1.53e+286"],
+  ["g", 6, "7b59baf2b613ed82", "1.53045e+286"],
+  ["g", 17, "7b59baf2b613ed82", "1.530453622854111e+286"],
+  ["f", 0, "0b4eb7817f86ead9", "0"],
+  ["f", 1, "0b4eb7817f86ead9", "0.0"],
+  ["f", 3, "0b4eb7817f86ead9", "0.000"],
+  ["f", 6, "0b4eb7817f86ead9", "0.000000"],
+  ["f", 17, "0b4eb7817f86ead9", "0.00000000000000000"],
+  ["e", 0, "0b4eb7817f86ead9", "3e-254"],
+  ["e", 1, "0b4eb7817f86ead9", "3.3e-254"],
+  ["e", 3, "0b4eb7817f86ead9", "3.273e-254"],
+  ["e", 6, "0b4eb7817f86ead9", "3.273180e-254"],
+  ["e", 17, "0b4eb7817f86ead9", "3.27318024699065642e-254"],
+  ["g", 0, "0b4eb7817f86ead9", "3e-254"],
+  ["g", 1, "0b4eb7817f86ead9", "3e-254"],
+  ["g", 3, "0b4eb7817f86ead9", "3.27e-254"],
+  ["g", 6, "0b4eb7817f86ead9", "3.27318e-254"],
+  ["g", 17, "0b4eb7817f86ead9", "3.2731802469906564e-254"],
+  ["f", 0, "17876671a300714c", "0"],
+  ["f", 1, "17876671a300714c", "0.0"],
+  ["f", 3, "17876671a300714c", "0.000"],
+  ["f", 6, "17876671a300714c", "0.000000"],
+  ["f", 17, "17876671a300714c", "0.00000000000000000"],
+  ["e", 0, "17876671a300714c", "3e-195"],
+  ["e", 1, "17876671a300714c", "2.5e-195"],
+  ["e", 3, "17876671a300714c", "2.504e-195"],
+  ["e", 6, "17876671a300714c", "2.504332e-195"],
+  ["e", 17, "17876671a300714c", "2.50433176620363726e-195"],
+  ["g", 0, "17876671a300714c", "3e-195"],
+  ["g", 1, "17876671a300714c", "3e-195"],
+  ["g", 3, "17876671a300714c", "2.5e-195"],
+  ["g", 6, "17876671a300714c", "2.50433e-195"],
+  ["g", 17, "17876671a300714c", "2.5043317662036373e-195"],
+  ["e", 0, "7ad4dc52cb2fa2ae", "5e+283"],
+  ["e", 1, "7ad4dc52cb2fa2ae", "4.8e+283"],
+  ["e", 3, "7ad4dc52cb2fa2ae", "4.847e+283"],
+  ["e", 6, "7ad4dc52cb2fa2ae", "4.846894e+283"],
+  ["e", 17, "7ad4dc52cb2fa2ae", "4.84689405009926635e+283"],
+  ["g", 0, "7ad4dc52cb2fa2ae", "5e+283"],
+  ["g", 1, "7ad4dc52cb2fa2ae", "5e+283"],
+  ["g", 3, "7ad4dc52cb2fa2ae", "4.85e+283"],
+  ["g", 6, "7ad4dc52cb2fa2ae", "4.84689e+283"],
+  ["g", 17, "7ad4dc52cb2fa2ae", "4.8468940500992663e+283"],
+  ["f", 0, "11e69a347dd2966b", "0"],
+  ["f", 1, "11e69a347dd2966b", "0.0"],
+  ["f", 3, "11e69a347dd2966b", "0.000"],
+  ["f", 6, "11e69a347dd2966b", "0.000000"],
+  ["f", 17, "11e69a347dd2966b", "0.00000000000000000"],
+  ["e", 0, "11e69a347dd2966b", "2e-222"],
+  ["e", 1, "11e69a347dd2966b", "2.0e-222"],
+  ["e", 3, "11e69a347dd2966b", "1.954e-222"],
+  ["e", 6, "11e69a347dd2966b", "1.954011e-222"],
+  ["e", 17, "11e69a347dd2966b", "1.95401128374951840e-222"],
+  ["g", 0, "11e69a347dd2966b", "2e-222"],
+  ["g", 1, "11e69a347dd2966b", "2e-222"],
+  ["g", 3, "11e69a347dd2966b", "1.95e-222"],
+  ["g", 6, "11e69a347dd2966b", "1.95401e-222"],
+  ["g", 17, "11e69a347dd2966b", "1.9540112837495184e-222"],
+  ["e", 0, "686f3326a04fc987", "1e+195"],
+  ["e", 1, "686f3326a04fc987", "1.1e+195"],
+  ["e", 3, "686f3326a04fc987", "1.139e+195"],
+  ["e", 6, "686f3326a04fc987", "1.138778e+195"],
+  ["e", 17, "686f3326a04fc987", "1.13877817533425743e+195"],
+  ["g", 0, "686f3326a04fc987", "1e+195"],
+  ["g", 1, "686f3326a04fc987", "1e+195"],
+  ["g", 3, "686f3326a04fc987", "1.14e+195"],
+  ["g", 6, "686f3326a04fc987", "1.13878e+195"],
+  ["g", 17, "686f3326a04fc987", "1.1387781753342574e+195"],
+  ["e", 0, "6ed5ff7aa865d7d4", "8e+225"],
+  ["e", 1, "6ed5ff7aa865d7d4", "8.1e+225"],
+  ["e", 3, "6ed5ff7aa865d7d4", "8.143e+225"],
+  ["e", 6, "6ed5ff7aa865d7d4", "8.142528e+225"],
+  ["e", 17, "6ed5ff7aa865d7d4", "8.14252834666211063e+225"],
+  ["g", 0, "6ed5ff7aa865d7d4", "8e+225"],
+  ["g", 1, "6ed5ff7aa865d7d4", "8e+225"],
+  ["g", 3, "6ed5ff7aa865d7d4", "8.14e+225"],
+  ["g", 6, "6ed5ff7aa865d7d4", "8.14253e+225"],
+  ["g", 17, "6ed5ff7aa865d7d4", "8.1425283466621106e+225"],
+  ["e", 0, "6edd22562c4c697b", "1e+226"],
+  ["e", 1, "6edd22562c4c697b", "1.1e+226"],
+  ["e", 3, "6edd22562c4c697b", "1.078e+226"],
+  ["e", 6, "6edd22562c4c697b", "1.078397e+226"],
+  ["e", 17, "6edd22562c4c697b", "1.07839727130125367e+226"],
+  ["g", 0, "6edd22562c4c697b", "1e+226"],
+  ["g", 1, "6edd22562c4c697b", "1e+226"],
+  ["g", 3, "6edd22562c4c697b", "1.08e+226"],
+  ["g", 6, "6edd22562c4c697b", "1.0784e+226"],
+  ["g", 17, "6edd22562c4c697b", "1.0783972713012537e+226"],
+  ["e", 0, "5b22f45380f3cf69", "1e+131"],
+  ["e", 1, "5b22f45380f3cf69", "1.1e+131"],
+  ["e", 3, "5b22f45380f3cf69", "1.051e+131"],
+  ["e", 6, "5b22f45380f3cf69", "1.051086e+131"],
+  ["e", 17, "5b22f45380f3cf69", "1.05108576273750993e+131"],
+  ["g", 0, "5b22f45380f3cf69", "1e+131"],
+  ["g", 1, "5b22f45380f3cf69", "1e+131"],
+  ["g", 3, "5b22f45380f3cf69", "1.05e+131"],
+  ["g", 6, "5b22f45380f3cf69", "1.05109e+131"],
+  ["g", 17, "5b22f45380f3cf69", "1.0510857627375099e+131"],
+  ["f", 0, "2f29109cc782d2b7", "0"],
+  ["f", 1, "2f29109cc782d2b7", "0.0"],
+  ["f", 3, "2f29109cc782d2b7", "0.000"],
+  ["f", 6, "2f29109cc782d2b7", "0.000000"],
+  ["f", 17, "2f29109cc782d2b7", "0.00000000000000000"],
+  ["e", 0, "2f29109cc782d2b7", "2e-81"],
+  ["e", 1, "2f29109cc782d2b7", "1.7e-81"],
+  ["e", 3, "2f29109cc782d2b7", "1.651e-81"],
+  ["e", 6, "2f29109cc782d2b7", "1.651494e-81"],
+  ["e", 17, "2f29109cc782d2b7", "1.65149409788127386e-81"],
+  ["g", 0, "2f29109cc782d2b7", "2e-81"],
+  ["g", 1, "2f29109cc782d2b7", "2e-81"],
+  ["g", 3, "2f29109cc782d2b7", "1.65e-81"],
+  ["g", 6, "2f29109cc782d2b7", "1.65149e-81"],
+  ["g", 17, "2f29109cc782d2b7", "1.6514940978812739e-81"],
+  ["e", 0, "76d874a3714b9ad2", "3e+264"],
+  ["e", 1, "76d874a3714b9ad2", "3.1e+264"],
+  ["e", 3, "76d874a3714b9ad2", "3.080e+264"],
+  ["e", 6, "76d874a3714b9ad2", "3.080313e+264"],
+  ["e", 17, "76d874a3714b9ad2", "3.08031314353616804e+264"],
+  ["g", 0, "76d874a3714b9ad2", "3e+264"],
+  ["g", 1, "76d874a3714b9ad2", "3e+264"],
+  ["g", 3, "76d874a3714b9ad2", "3.08e+264"],
+  ["g", 6, "76d874a3714b9ad2", "3.08031e+264"],
+  ["g", 17, "76d874a3714b9ad2", "3.080313143536168e+264"],
+  ["e", 0, "7dc2ae94e4dbf967", "6e+297"],
+  ["e", 1, "7dc2ae94e4dbf967", "6.1e+297"],
+  ["e", 3, "7dc2ae94e4dbf967", "6.109e+297"],
+  ["e", 6, "7dc2ae94e4dbf967", "6.108972e+297"],
+  ["e", 17, "7dc2ae94e4dbf967", "6.10897227205033263e+297"],
+  ["g", 0, "7dc2ae94e4dbf967", "6e+297"],
+  ["g", 1, "7dc2ae94e4dbf967", "6e+297"],
+  ["g", 3, "7dc2ae94e4dbf967", "6.11e+297"],
+  ["g", 6, "7dc2ae94e4dbf967", "6.10897e+297"],
+  ["g", 17, "7dc2ae94e4dbf967", "6.1089722720503326e+297"],
+  ["f", 0, "0c971bea6a6af755", "0"],
+  ["f", 1, "0c971bea6a6af755", "0.0"],
+  ["f", 3, "0c971bea6a6af755", "0.000"],
+  ["f", 6, "0c971bea6a6af755", "0.000000"],
+  ["f", 17, "0c971bea6a6af755", "0.00000000000000000"],
+  ["e", 0, "0c971bea6a6af755", "5e-248"],
+  ["e", 1, "0c971bea6a6af755", "5.2e-248"],
+  ["e", 3, "0c971bea6a6af755", "5.164e-248"],
+  ["e", 6, "0c971bea6a6af755", "5.164230e-248"],
+  ["e", 17, "0c971bea6a6af755", "5.16423018767397847e-248"],
+  ["g", 0, "0c971bea6a6af755", "5e-248"],
+  ["g", 1, "0c971bea6a6af755", "5e-248"],
+  ["g", 3, "0c971bea6a6af755", "5.16e-248"],
+  ["g", 6, "0c971bea6a6af755", "5.16423e-248"],
+  ["g", 17, "0c971bea6a6af755", "5.1642301876739785e-248"],
+  ["e", 0, "6a2177d8d51f57fb", "2e+203"],
+  ["e", 1, "6a2177d8d51f57fb", "1.7e+203"],
+  ["e", 3, "6a2177d8d51f57fb", "1.711e+203"],
+  ["e", 6, "6a2177d8d51f57fb", "1.711489e+203"],
+  ["e", 17, "6a2177d8d51f57fb", "1.71148880045807395e+203"],
+  ["g", 0, "6a2177d8d51f57fb", "2e+203"],
+  ["g", 1, "6a2177d8d51f57fb", "2e+203"],
+  ["g", 3, "6a2177d8d51f57fb", "1.71e+203"],
+  ["g", 6, "6a2177d8d51f57fb", "1.71149e+203"],
+  ["g", 17, "6a2177d8d51f57fb", "1.711488800458074e+203"],
+  ["e", 0, "76104a9e26b7f794", "5e+260"],
+  ["e", 1, "76104a9e26b7f794", "5.0e+260"],
+  ["e", 3, "76104a9e26b7f794", "5.010e+260"],
+  ["e", 6, "76104a9e26b7f794", "5.009757e+260"],
+  ["e", 17, "76104a9e26b7f794", "5.00975730513502415e+260"],
+  ["g", 0, "76104a9e26b7f794", "5e+260"],
+  ["g", 1, "76104a9e26b7f794", "5e+260"],
+  ["g", 3, "76104a9e26b7f794", "5.01e+260"],
+  ["g", 6, "76104a9e26b7f794", "5.00976e+260"],
+  ["g", 17, "76104a9e26b7f794", "5.0097573051350242e+260"],
+  ["e", 0, "6d159abfb303fd7b", "3e+217"],
+  ["e", 1, "6d159abfb303fd7b", "3.0e+217"],
+  ["e", 3, "6d159abfb303fd7b", "2.979e+217"],
+  ["e", 6, "6d159abfb303fd7b", "2.979071e+217"],
+  ["e", 17, "6d159abfb303fd7b", "2.97907102294684413e+217"],
+  ["g", 0, "6d159abfb303fd7b", "3e+217"],
+  ["g", 1, "6d159abfb303fd7b", "3e+217"],
+  ["g", 3, "6d159abfb303fd7b", "2.98e+217"],
+  ["g", 6, "6d159abfb303fd7b", "2.97907e+217"],
+  ["g", 17, "6d159abfb303fd7b", "2.9790710229468441e+217"],
+  ["f", 0, "0ff20e6dfbb7c441", "0"],
+  ["f", 1, "0ff20e6dfbb7c441", "0.0"],
+  ["f", 3, "0ff20e6dfbb7c441", "0.000"],
+  ["f", 6, "0ff20e6dfbb7c441", "0.000000"],
+  ["f", 17, "0ff20e6dfbb7c441", "0.00000000000000000"],
+  ["e", 0, "0ff20e6dfbb7c441", "7e-232"],
+  ["e", 1, "0ff20e6dfbb7c441", "7.3e-232"],
+  ["e", 3, "0ff20e6dfbb7c441", "7.269e-232"],
+  ["e", 6, "0ff20e6dfbb7c441", "7.268984e-232"],
+  ["e", 17, "0ff20e6dfbb7c441", "7.26898361165072074e-232"],
+  ["g", 0, "0ff20e6dfbb7c441", "7e-232"],
+  ["g", 1, "0ff20e6dfbb7c441", "7e-232"],
+  ["g", 3, "0ff20e6dfbb7c441", "7.27e-232"],
+  ["g", 6, "0ff20e6dfbb7c441", "7.26898e-232"],
+  ["g", 17, "0ff20e6dfbb7c441", "7.2689836116507207e-232"],
+  ["f", 0, "409e039700000000", "1921"],
+  ["f", 1, "409e039700000000", "1920.9"],
+  ["f", 3, "409e039700000000", "1920.897"],
+  ["f", 6, "409e039700000000", "1920.897461"],
+  ["f", 17, "409e039700000000", "1920.89746093750000000"],
+  ["e", 0, "409e039700000000", "2e+03"],
+  ["e", 1, "409e039700000000", "1.9e+03"],
+  ["e", 3, "409e039700000000", "1.921e+03"],
+  ["e", 6, "409e039700000000", "1.920897e+03"],
+  ["e", 17, "409e039700000000", "1.92089746093750000e+03"],
+  ["g", 0, "409e039700000000", "2e+03"],
+  ["g", 1, "409e039700000000", "2e+03"],
+  ["g", 3, "409e039700000000", "1.92e+03"],
+  ["g", 6, "409e039700000000", "1920.9"],
+  ["g", 17, "409e039700000000", "1920.8974609375"],
+  ["f", 0, "40e0c37300000000", "34332"],
+  ["f", 1, "40e0c37300000000", "34331.6"],
+  ["f", 3, "40e0c37300000000", "34331.594"],
+  ["f", 6, "40e0c37300000000", "34331.593750"],
+  ["f", 17, "40e0c37300000000", "34331.59375000000000000"],
+  ["e", 0, "40e0c37300000000", "3e+04"],
+  ["e", 1, "40e0c37300000000", "3.4e+04"],
+  ["e", 3, "40e0c37300000000", "3.433e+04"],
+  ["e", 6, "40e0c37300000000", "3.433159e+04"],
+  ["e", 17, "40e0c37300000000", "3.43315937500000000e+04"],
+  ["g", 0, "40e0c37300000000", "3e+04"],
+  ["g", 1, "40e0c37300000000", "3e+04"],
+  ["g", 3, "40e0c37300000000", "3.43e+04"],
+  ["g", 6, "40e0c37300000000", "34331.6"],
+  ["g", 17, "40e0c37300000000", "34331.59375"],
+  ["f", 0, "40b2053800000000", "4613"],
+  ["f", 1, "40b2053800000000", "4613.2"],
+  ["f", 3, "40b2053800000000", "4613.219"],
+  ["f", 6, "40b2053800000000", "4613.218750"],
+  ["f", 17, "40b2053800000000", "4613.21875000000000000"],
+  ["e", 0, "40b2053800000000", "5e+03"],
+  ["e", 1, "40b2053800000000", "4.6e+03"],
+  ["e", 3, "40b2053800000000", "4.613e+03"],
+  ["e", 6, "40b2053800000000", "4.613219e+03"],
+  ["e", 17, "40b2053800000000", "4.61321875000000000e+03"],
+  ["g", 0, "40b2053800000000", "5e+03"],
+  ["g", 1, "40b2053800000000", "5e+03"],
+  ["g", 3, "40b2053800000000", "4.61e+03"],
+  ["g", 6, "40b2053800000000", "4613.22"],
+  ["g", 17, "40b2053800000000", "4613.21875"],
+  ["f", 0, "40923f8f00000000", "1168"],
+  ["f", 1, "40923f8f00000000", "1167.9"],
+  ["f", 3, "40923f8f00000000", "1167.890"],
+  ["f", 6, "40923f8f00000000", "1167.889648"],
+  ["f", 17, "40923f8f00000000", "1167.88964843750000000"],
+  ["e", 0, "40923f8f00000000", "1e+03"],
+  ["e", 1, "40923f8f00000000", "1.2e+03"],
+  ["e", 3, "40923f8f00000000", "1.168e+03"],
+  ["e", 6, "40923f8f00000000", "1.167890e+03"],
+  ["e", 17, "40923f8f00000000", "1.16788964843750000e+03"],
+  ["g", 0, "40923f8f00000000", "1e+03"],
+  ["g", 1, "40923f8f00000000", "1e+03"],
+  ["g", 3, "40923f8f00000000", "1.17e+03"],
+  ["g", 6, "40923f8f00000000", "1167.89"],
+  ["g", 17, "40923f8f00000000", "1167.8896484375"],
+  ["f", 0, "40b92df200000000", "6446"],
+  ["f", 1, "40b92df200000000", "6445.9"],
+  ["f", 3, "40b92df200000000", "6445.945"],
+  ["f", 6, "40b92df200000000", "6445.945312"],
+  ["f", 17, "40b92df200000000", "6445.94531250000000000"],
+  ["e", 0, "40b92df200000000", "6e+03"],
+  ["e", 1, "40b92df200000000", "6.4e+03"],
+  ["e", 3, "40b92df200000000", "6.446e+03"],
+  ["e", 6, "40b92df200000000", "6.445945e+03"],
+  ["e", 17, "40b92df200000000", "6.44594531250000000e+03"],
+  ["g", 0, "40b92df200000000", "6e+03"],
+  ["g", 1, "40b92df200000000", "6e+03"],
+  ["g", 3, "40b92df200000000", "6.45e+03"],
+  ["g", 6, "40b92df200000000", "6445.95"],
+  ["g", 17, "40b92df200000000", "6445.9453125"],
+  ["f", 0, "40dd11c200000000", "29767"],
+  ["f", 1, "40dd11c200000000", "29767.0"],
+  ["f", 3, "40dd11c200000000", "29767.031"],
+  ["f", 6, "40dd11c200000000", "29767.031250"],
+  ["f", 17, "40dd11c200000000", "29767.03125000000000000"],
+  ["e", 0, "40dd11c200000000", "3e+04"],
+  ["e", 1, "40dd11c200000000", "3.0e+04"],
+  ["e", 3, "40dd11c200000000", "2.977e+04"],
+  ["e", 6, "40dd11c200000000", "2.976703e+04"],
+  ["e", 17, "40dd11c200000000", "2.97670312500000000e+04"],
+  ["g", 0, "40dd11c200000000", "3e+04"],
+  ["g", 1, "40dd11c200000000", "3e+04"],
+  ["g", 3, "40dd11c200000000", "2.98e+04"],
+  ["g", 6, "40dd11c200000000", "29767"],
+  ["g", 17, "40dd11c200000000", "29767.03125"],
+  ["f", 0, "40d4fa1500000000", "21480"],
+  ["f", 1, "40d4fa1500000000", "21480.3"],
+  ["f", 3, "40d4fa1500000000", "21480.328"],
+  ["f", 6, "40d4fa1500000000", "21480.328125"],
+  ["f", 17, "40d4fa1500000000", "21480.32812500000000000"],
+  ["e", 0, "40d4fa1500000000", "2e+04"],
+  ["e", 1, "40d4fa1500000000", "2.1e+04"],
+  ["e", 3, "40d4fa1500000000", "2.148e+04"],
+  ["e", 6, "40d4fa1500000000", "2.148033e+04"],
+  ["e", 17, "40d4fa1500000000", "2.14803281250000000e+04"],
+  ["g", 0, "40d4fa1500000000", "2e+04"],
+  ["g", 1, "40d4fa1500000000", "2e+04"],
+  ["g", 3, "40d4fa1500000000", "2.15e+04"],
+  ["g", 6, "40d4fa1500000000", "21480.3"],
+  ["g", 17, "40d4fa1500000000", "21480.328125"],
+  ["f", 0, "40f81fea00000000", "98815"],
+  ["f", 1, "40f81fea00000000", "98814.6"],
+  ["f", 3, "40f81fea00000000", "98814.625"],
+  ["f", 6, "40f81fea00000000", "98814.625000"],
+  ["f", 17, "40f81fea00000000", "98814.62500000000000000"],
+  ["e", 0, "40f81fea00000000", "1e+05"],
+  ["e", 1, "40f81fea00000000", "9.9e+04"],
+  ["e", 3, "40f81fea00000000", "9.881e+04"],
+  ["e", 6, "40f81fea00000000", "9.881462e+04"],
+  ["e", 17, "40f81fea00000000", "9.88146250000000000e+04"],
+  ["g", 0, "40f81fea00000000", "1e+05"],
+  ["g", 1, "40f81fea00000000", "1e+05"],
+  ["g", 3, "40f81fea00000000", "9.88e+04"],
+  ["g", 6, "40f81fea00000000", "98814.6"],
+  ["g", 17, "40f81fea00000000", "98814.625"],
+  ["f", 0, "411334e600000000", "314682"],
+  ["f", 1, "411334e600000000", "314681.5"],
+  ["f", 3, "411334e600000000", "314681.500"],
+  ["f", 6, "411334e600000000", "314681.500000"],
+  ["f", 17, "411334e600000000", "314681.50000000000000000"],
+  ["e", 0, "411334e600000000", "3e+05"],
+  ["e", 1, "411334e600000000", "3.1e+05"],
+  ["e", 3, "411334e600000000", "3.147e+05"],
+  ["e", 6, "411334e600000000", "3.146815e+05"],
+  ["e", 17, "411334e600000000", "3.14681500000000000e+05"],
+  ["g", 0, "411334e600000000", "3e+05"],
+  ["g", 1, "411334e600000000", "3e+05"],
+  ["g", 3, "411334e600000000", "3.15e+05"],
+  ["g", 6, "411334e600000000", "314682"],
+  ["g", 17, "411334e600000000", "314681.5"],
+  ["f", 0, "40fc1e8200000000", "115176"],
+  ["f", 1, "40fc1e8200000000", "115176.1"],
+  ["f", 3, "40fc1e8200000000", "115176.125"],
+  ["f", 6, "40fc1e8200000000", "115176.125000"],
+  ["f", 17, "40fc1e8200000000", "115176.12500000000000000"],
+  ["e", 0, "40fc1e8200000000", "1e+05"],
+  ["e", 1, "40fc1e8200000000", "1.2e+05"],
+  ["e", 3, "40fc1e8200000000", "1.152e+05"],
+  ["e", 6, "40fc1e8200000000", "1.151761e+05"],
+  ["e", 17, "40fc1e8200000000", "1.15176125000000000e+05"],
+  ["g", 0, "40fc1e8200000000", "1e+05"],
+  ["g", 1, "40fc1e8200000000", "1e+05"],
+  ["g", 3, "40fc1e8200000000", "1.15e+05"],
+  ["g", 6, "40fc1e8200000000", "115176"],
+  ["g", 17, "40fc1e8200000000", "115176.125"],
+  ["f", 0, "4100156600000000", "131757"],
+  ["f", 1, "4100156600000000", "131756.8"],
+  ["f", 3, "4100156600000000", "131756.750"],
+  ["f", 6, "4100156600000000", "131756.750000"],
+  ["f", 17, "4100156600000000", "131756.75000000000000000"],
+  ["e", 0, "4100156600000000", "1e+05"],
+  ["e", 1, "4100156600000000", "1.3e+05"],
+  ["e", 3, "4100156600000000", "1.318e+05"],
+  ["e", 6, "4100156600000000", "1.317568e+05"],
+  ["e", 17, "4100156600000000", "1.31756750000000000e+05"],
+  ["g", 0, "4100156600000000", "1e+05"],
+  ["g", 1, "4100156600000000", "1e+05"],
+  ["g", 3, "4100156600000000", "1.32e+05"],
+  ["g", 6, "4100156600000000", "131757"],
+  ["g", 17, "4100156600000000", "131756.75"],
+  ["f", 0, "40b8e09200000000", "6369"],
+  ["f", 1, "40b8e09200000000", "6368.6"],
+  ["f", 3, "40b8e09200000000", "6368.570"],
+  ["f", 6, "40b8e09200000000", "6368.570312"],
+  ["f", 17, "40b8e09200000000", "6368.57031250000000000"],
+  ["e", 0, "40b8e09200000000", "6e+03"],
+  ["e", 1, "40b8e09200000000", "6.4e+03"],
+  ["e", 3, "40b8e09200000000", "6.369e+03"],
+  ["e", 6, "40b8e09200000000", "6.368570e+03"],
+  ["e", 17, "40b8e09200000000", "6.36857031250000000e+03"],
+  ["g", 0, "40b8e09200000000", "6e+03"],
+  ["g", 1, "40b8e09200000000", "6e+03"],
+  ["g", 3, "40b8e09200000000", "6.37e+03"],
+  ["g", 6, "40b8e09200000000", "6368.57"],
+  ["g", 17, "40b8e09200000000", "6368.5703125"],
+  ["f", 0, "4060363000000000", "130"],
+  ["f", 1, "4060363000000000", "129.7"],
+  ["f", 3, "4060363000000000", "129.693"],
+  ["f", 6, "4060363000000000", "129.693359"],
+  ["f", 17, "4060363000000000", "129.69335937500000000"],
+  ["e", 0, "4060363000000000", "1e+02"],
+  ["e", 1, "4060363000000000", "1.3e+02"],
+  ["e", 3, "4060363000000000", "1.297e+02"],
+  ["e", 6, "4060363000000000", "1.296934e+02"],
+  ["e", 17, "4060363000000000", "1.29693359375000000e+02"],
+  ["g", 0, "4060363000000000", "1e+02"],
+  ["g", 1, "4060363000000000", "1e+02"],
+  ["g", 3, "4060363000000000", "130"],
+  ["g", 6, "4060363000000000", "129.693"],
+  ["g", 17, "4060363000000000", "129.693359375"],
+  ["f", 0, "41378c9b00000000", "1543323"],
+  ["f", 1, "41378c9b00000000", "1543323.0"],
+  ["f", 3, "41378c9b00000000", "1543323.000"],
+  ["f", 6, "41378c9b00000000", "1543323.000000"],
+  ["f", 17, "41378c9b00000000", "1543323.00000000000000000"],
+  ["e", 0, "41378c9b00000000", "2e+06"],
+  ["e", 1, "41378c9b00000000", "1.5e+06"],
+  ["e", 3, "41378c9b00000000", "1.543e+06"],
+  ["e", 6, "41378c9b00000000", "1.543323e+06"],
+  ["e", 17, "41378c9b00000000", "1.54332300000000000e+06"],
+  ["g", 0, "41378c9b00000000", "2e+06"],
+  ["g", 1, "41378c9b00000000", "2e+06"],
+  ["g", 3, "41378c9b00000000", "1.54e+06"],
+  ["g", 6, "41378c9b00000000", "1.54332e+06"],
+  ["g", 17, "41378c9b00000000", "1543323"],
+  ["f", 0, "40c7f66c00000000", "12269"],
+  ["f", 1, "40c7f66c00000000", "12268.8"],
+  ["f", 3, "40c7f66c00000000", "12268.844"],
+  ["f", 6, "40c7f66c00000000", "12268.843750"],
+  ["f", 17, "40c7f66c00000000", "12268.84375000000000000"],
+  ["e", 0, "40c7f66c00000000", "1e+04"],
+  ["e", 1, "40c7f66c00000000", "1.2e+04"],
+  ["e", 3, "40c7f66c00000000", "1.227e+04"],
+  ["e", 6, "40c7f66c00000000", "1.226884e+04"],
+  ["e", 17, "40c7f66c00000000", "1.22688437500000000e+04"],
+  ["g", 0, "40c7f66c00000000", "1e+04"],
+  ["g", 1, "40c7f66c00000000", "1e+04"],
+  ["g", 3, "40c7f66c00000000", "1.23e+04"],
+  ["g", 6, "40c7f66c00000000", "12268.8"],
+  ["g", 17, "40c7f66c00000000", "12268.84375"],
+  ["f", 0, "40c5ca0000000000", "11156"],
+  ["f", 1, "40c5ca0000000000", "11156.0"],
+  ["f", 3, "40c5ca0000000000", "11156.000"],
+  ["f", 6, "40c5ca0000000000", "11156.000000"],
+  ["f", 17, "40c5ca0000000000", "11156.00000000000000000"],
+  ["e", 0, "40c5ca0000000000", "1e+04"],
+  ["e", 1, "40c5ca0000000000", "1.1e+04"],
+  ["e", 3, "40c5ca0000000000", "1.116e+04"],
+  ["e", 6, "40c5ca0000000000", "1.115600e+04"],
+  ["e", 17, "40c5ca0000000000", "1.11560000000000000e+04"],
+  ["g", 0, "40c5ca0000000000", "1e+04"],
+  ["g", 1, "40c5ca0000000000", "1e+04"],
+  ["g", 3, "40c5ca0000000000", "1.12e+04"],
+  ["g", 6, "40c5ca0000000000", "11156"],
+  ["g", 17, "40c5ca0000000000", "11156"],
+  ["f", 0, "4116dc8000000000", "374560"],
+  ["f", 1, "4116dc8000000000", "374560.0"],
+  ["f", 3, "4116dc8000000000", "374560.000"],
+  ["f", 6, "4116dc8000000000", "374560.000000"],
+  ["f", 17, "4116dc8000000000", "374560.00000000000000000"],
+  ["e", 0, "4116dc8000000000", "4e+05"],
+  ["e", 1, "4116dc8000000000", "3.7e+05"],
+  ["e", 3, "4116dc8000000000", "3.746e+05"],
+  ["e", 6, "4116dc8000000000", "3.745600e+05"],
+  ["e", 17, "4116dc8000000000", "3.74560000000000000e+05"],
+  ["g", 0, "4116dc8000000000", "4e+05"],
+  ["g", 1, "4116dc8000000000", "4e+05"],
+  ["g", 3, "4116dc8000000000", "3.75e+05"],
+  ["g", 6, "4116dc8000000000", "374560"],
+  ["g", 17, "4116dc8000000000", "374560"],
+  ["f", 0, "409f1c3400000000", "1991"],
+  ["f", 1, "409f1c3400000000", "1991.1"],
+  ["f", 3, "409f1c3400000000", "1991.051"],
+  ["f", 6, "409f1c3400000000", "1991.050781"],
+  ["f", 17, "409f1c3400000000", "1991.05078125000000000"],
+  ["e", 0, "409f1c3400000000", "2e+03"],
+  ["e", 1, "409f1c3400000000", "2.0e+03"],
+  ["e", 3, "409f1c3400000000", "1.991e+03"],
+  ["e", 6, "409f1c3400000000", "1.991051e+03"],
+  ["e", 17, "409f1c3400000000", "1.99105078125000000e+03"],
+  ["g", 0, "409f1c3400000000", "2e+03"],
+  ["g", 1, "409f1c3400000000", "2e+03"],
+  ["g", 3, "409f1c3400000000", "1.99e+03"],
+  ["g", 6, "409f1c3400000000", "1991.05"],
+  ["g", 17, "409f1c3400000000", "1991.05078125"],
+  ["f", 0, "411a7ec300000000", "434097"],
+  ["f", 1, "411a7ec300000000", "434096.8"],
+  ["f", 3, "411a7ec300000000", "434096.750"],
+  ["f", 6, "411a7ec300000000", "434096.750000"],
+  ["f", 17, "411a7ec300000000", "434096.75000000000000000"],
+  ["e", 0, "411a7ec300000000", "4e+05"],
+  ["e", 1, "411a7ec300000000", "4.3e+05"],
+  ["e", 3, "411a7ec300000000", "4.341e+05"],
+  ["e", 6, "411a7ec300000000", "4.340968e+05"],
+  ["e", 17, "411a7ec300000000", "4.34096750000000000e+05"],
+  ["g", 0, "411a7ec300000000", "4e+05"],
+  ["g", 1, "411a7ec300000000", "4e+05"],
+  ["g", 3, "411a7ec300000000", "4.34e+05"],
+  ["g", 6, "411a7ec300000000", "434097"],
+  ["g", 17, "411a7ec300000000", "434096.75"],
+  ["f", 0, "411120b000000000", "280620"],
+  ["f", 1, "411120b000000000", "280620.0"],
+  ["f", 3, "411120b000000000", "280620.000"],
+  ["f", 6, "411120b000000000", "280620.000000"],
+  ["f", 17, "411120b000000000", "280620.00000000000000000"],
+  ["e", 0, "411120b000000000", "3e+05"],
+  ["e", 1, "411120b000000000", "2.8e+05"],
+  ["e", 3, "411120b000000000", "2.806e+05"],
+  ["e", 6, "411120b000000000", "2.806200e+05"],
+  ["e", 17, "411120b000000000", "2.80620000000000000e+05"],
+  ["g", 0, "411120b000000000", "3e+05"],
+  ["g", 1, "411120b000000000", "3e+05"],
+  ["g", 3, "411120b000000000", "2.81e+05"],
+  ["g", 6, "411120b000000000", "280620"],
+  ["g", 17, "411120b000000000", "280620"],
+  ["f", 0, "40fb14f200000000", "110927"],
+  ["f", 1, "40fb14f200000000", "110927.1"],
+  ["f", 3, "40fb14f200000000", "110927.125"],
+  ["f", 6, "40fb14f200000000", "110927.125000"],
+  ["f", 17, "40fb14f200000000", "110927.12500000000000000"],
+  ["e", 0, "40fb14f200000000", "1e+05"],
+  ["e", 1, "40fb14f200000000", "1.1e+05"],
+  ["e", 3, "40fb14f200000000", "1.109e+05"],
+  ["e", 6, "40fb14f200000000", "1.109271e+05"],
+  ["e", 17, "40fb14f200000000", "1.10927125000000000e+05"],
+  ["g", 0, "40fb14f200000000", "1e+05"],
+  ["g", 1, "40fb14f200000000", "1e+05"],
+  ["g", 3, "40fb14f200000000", "1.11e+05"],
+  ["g", 6, "40fb14f200000000", "110927"],
+  ["g", 17, "40fb14f200000000", "110927.125"],
+  ["f", 0, "4117d4c900000000", "390450"],
+  ["f", 1, "4117d4c900000000", "390450.2"],
+  ["f", 3, "4117d4c900000000", "390450.250"],
+  ["f", 6, "4117d4c900000000", "390450.250000"],
+  ["f", 17, "4117d4c900000000", "390450.25000000000000000"],
+  ["e", 0, "4117d4c900000000", "4e+05"],
+  ["e", 1, "4117d4c900000000", "3.9e+05"],
+  ["e", 3, "4117d4c900000000", "3.905e+05"],
+  ["e", 6, "4117d4c900000000", "3.904502e+05"],
+  ["e", 17, "4117d4c900000000", "3.90450250000000000e+05"],
+  ["g", 0, "4117d4c900000000", "4e+05"],
+  ["g", 1, "4117d4c900000000", "4e+05"],
+  ["g", 3, "4117d4c900000000", "3.9e+05"],
+  ["g", 6, "4117d4c900000000", "390450"],
+  ["g", 17, "4117d4c900000000", "390450.25"],
+  ["f", 0, "40ca58d800000000", "13490"],
+  ["f", 1, "40ca58d800000000", "13489.7"],
+  ["f", 3, "40ca58d800000000", "13489.688"],
+  ["f", 6, "40ca58d800000000", "13489.687500"],
+  ["f", 17, "40ca58d800000000", "13489.68750000000000000"],
+  ["e", 0, "40ca58d800000000", "1e+04"],
+  ["e", 1, "40ca58d800000000", "1.3e+04"],
+  ["e", 3, "40ca58d800000000", "1.349e+04"],
+  ["e", 6, "40ca58d800000000", "1.348969e+04"],
+  ["e", 17, "40ca58d800000000", "1.34896875000000000e+04"],
+  ["g", 0, "40ca58d800000000", "1e+04"],
+  ["g", 1, "40ca58d800000000", "1e+04"],
+  ["g", 3, "40ca58d800000000", "1.35e+04"],
+  ["g", 6, "40ca58d800000000", "13489.7"],
+  ["g", 17, "40ca58d800000000", "13489.6875"],
+  ["f", 0, "40b40a2000000000", "5130"],
+  ["f", 1, "40b40a2000000000", "5130.1"],
+  ["f", 3, "40b40a2000000000", "5130.125"],
+  ["f", 6, "40b40a2000000000", "5130.125000"],
+  ["f", 17, "40b40a2000000000", "5130.12500000000000000"],
+  ["e", 0, "40b40a2000000000", "5e+03"],
+  ["e", 1, "40b40a2000000000", "5.1e+03"],
+  ["e", 3, "40b40a2000000000", "5.130e+03"],
+  ["e", 6, "40b40a2000000000", "5.130125e+03"],
+  ["e", 17, "40b40a2000000000", "5.13012500000000000e+03"],
+  ["g", 0, "40b40a2000000000", "5e+03"],
+  ["g", 1, "40b40a2000000000", "5e+03"],
+  ["g", 3, "40b40a2000000000", "5.13e+03"],
+  ["g", 6, "40b40a2000000000", "5130.12"],
+  ["g", 17, "40b40a2000000000", "5130.125"],
+  ["f", 0, "40d6fc4900000000", "23537"],
+  ["f", 1, "40d6fc4900000000", "23537.1"],
+  ["f", 3, "40d6fc4900000000", "23537.141"],
+  ["f", 6, "40d6fc4900000000", "23537.140625"],
+  ["f", 17, "40d6fc4900000000", "23537.14062500000000000"],
+  ["e", 0, "40d6fc4900000000", "2e+04"],
+  ["e", 1, "40d6fc4900000000", "2.4e+04"],
+  ["e", 3, "40d6fc4900000000", "2.354e+04"],
+  ["e", 6, "40d6fc4900000000", "2.353714e+04"],
+  ["e", 17, "40d6fc4900000000", "2.35371406250000000e+04"],
+  ["g", 0, "40d6fc4900000000", "2e+04"],
+  ["g", 1, "40d6fc4900000000", "2e+04"],
+  ["g", 3, "40d6fc4900000000", "2.35e+04"],
+  ["g", 6, "40d6fc4900000000", "23537.1"],
+  ["g", 17, "40d6fc4900000000", "23537.140625"],
+  ["f", 0, "40d6a74c00000000", "23197"],
+  ["f", 1, "40d6a74c00000000", "23197.2"],
+  ["f", 3, "40d6a74c00000000", "23197.188"],
+  ["f", 6, "40d6a74c00000000", "23197.187500"],
+  ["f", 17, "40d6a74c00000000", "23197.18750000000000000"],
+  ["e", 0, "40d6a74c00000000", "2e+04"],
+  ["e", 1, "40d6a74c00000000", "2.3e+04"],
+  ["e", 3, "40d6a74c00000000", "2.320e+04"],
+  ["e", 6, "40d6a74c00000000", "2.319719e+04"],
+  ["e", 17, "40d6a74c00000000", "2.31971875000000000e+04"],
+  ["g", 0, "40d6a74c00000000", "2e+04"],
+  ["g", 1, "40d6a74c00000000", "2e+04"],
+  ["g", 3, "40d6a74c00000000", "2.32e+04"],
+  ["g", 6, "40d6a74c00000000", "23197.2"],
+  ["g", 17, "40d6a74c00000000", "23197.1875"],
+  ["f", 0, "4139cfd600000000", "1691606"],
+  ["f", 1, "4139cfd600000000", "1691606.0"],
+  ["f", 3, "4139cfd600000000", "1691606.000"],
+  ["f", 6, "4139cfd600000000", "1691606.000000"],
+  ["f", 17, "4139cfd600000000", "1691606.00000000000000000"],
+  ["e", 0, "4139cfd600000000", "2e+06"],
+  ["e", 1, "4139cfd600000000", "1.7e+06"],
+  ["e", 3, "4139cfd600000000", "1.692e+06"],
+  ["e", 6, "4139cfd600000000", "1.691606e+06"],
+  ["e", 17, "4139cfd600000000", "1.69160600000000000e+06"],
+  ["g", 0, "4139cfd600000000", "2e+06"],
+  ["g", 1, "4139cfd600000000", "2e+06"],
+  ["g", 3, "4139cfd600000000", "1.69e+06"],
+  ["g", 6, "4139cfd600000000", "1.69161e+06"],
+  ["g", 17, "4139cfd600000000", "1691606"],
+  ["f", 0, "409adef400000000", "1720"],
+  ["f", 1, "409adef400000000", "1719.7"],
+  ["f", 3, "409adef400000000", "1719.738"],
+  ["f", 6, "409adef400000000", "1719.738281"],
+  ["f", 17, "409adef400000000", "1719.73828125000000000"],
+  ["e", 0, "409adef400000000", "2e+03"],
+  ["e", 1, "409adef400000000", "1.7e+03"],
+  ["e", 3, "409adef400000000", "1.720e+03"],
+  ["e", 6, "409adef400000000", "1.719738e+03"],
+  ["e", 17, "409adef400000000", "1.71973828125000000e+03"],
+  ["g", 0, "409adef400000000", "2e+03"],
+  ["g", 1, "409adef400000000", "2e+03"],
+  ["g", 3, "409adef400000000", "1.72e+03"],
+  ["g", 6, "409adef400000000", "1719.74"],
+  ["g", 17, "409adef400000000", "1719.73828125"],
+  ["f", 0, "412674dd00000000", "735854"],
+  ["f", 1, "412674dd00000000", "735854.5"],
+  ["f", 3, "412674dd00000000", "735854.500"],
+  ["f", 6, "412674dd00000000", "735854.500000"],
+  ["f", 17, "412674dd00000000", "735854.50000000000000000"],
+  ["e", 0, "412674dd00000000", "7e+05"],
+  ["e", 1, "412674dd00000000", "7.4e+05"],
+  ["e", 3, "412674dd00000000", "7.359e+05"],
+  ["e", 6, "412674dd00000000", "7.358545e+05"],
+  ["e", 17, "412674dd00000000", "7.35854500000000000e+05"],
+  ["g", 0, "412674dd00000000", "7e+05"],
+  ["g", 1, "412674dd00000000", "7e+05"],
+  ["g", 3, "412674dd00000000", "7.36e+05"],
+  ["g", 6, "412674dd00000000", "735854"],
+  ["g", 17, "412674dd00000000", "735854.5"],
+  ["f", 0, "40ba272000000000", "6695"],
+  ["f", 1, "40ba272000000000", "6695.1"],
+  ["f", 3, "40ba272000000000", "6695.125"],
+  ["f", 6, "40ba272000000000", "6695.125000"],
+  ["f", 17, "40ba272000000000", "6695.12500000000000000"],
+  ["e", 0, "40ba272000000000", "7e+03"],
+  ["e", 1, "40ba272000000000", "6.7e+03"],
+  ["e", 3, "40ba272000000000", "6.695e+03"],
+  ["e", 6, "40ba272000000000", "6.695125e+03"],
+  ["e", 17, "40ba272000000000", "6.69512500000000000e+03"],
+  ["g", 0, "40ba272000000000", "7e+03"],
+  ["g", 1, "40ba272000000000", "7e+03"],
+  ["g", 3, "40ba272000000000", "6.7e+03"],
+  ["g", 6, "40ba272000000000", "6695.12"],
+  ["g", 17, "40ba272000000000", "6695.125"],
+  ["f", 0, "40c62f2000000000", "11358"],
+  ["f", 1, "40c62f2000000000", "11358.2"],
+  ["f", 3, "40c62f2000000000", "11358.250"],
+  ["f", 6, "40c62f2000000000", "11358.250000"],
+  ["f", 17, "40c62f2000000000", "11358.25000000000000000"],
+  ["e", 0, "40c62f2000000000", "1e+04"],
+  ["e", 1, "40c62f2000000000", "1.1e+04"],
+  ["e", 3, "40c62f2000000000", "1.136e+04"],
+  ["e", 6, "40c62f2000000000", "1.135825e+04"],
+  ["e", 17, "40c62f2000000000", "1.13582500000000000e+04"],
+  ["g", 0, "40c62f2000000000", "1e+04"],
+  ["g", 1, "40c62f2000000000", "1e+04"],
+  ["g", 3, "40c62f2000000000", "1.14e+04"],
+  ["g", 6, "40c62f2000000000", "11358.2"],
+  ["g", 17, "40c62f2000000000", "11358.25"],
+  ["f", 0, "40fbf95b00000000", "114582"],
+  ["f", 1, "40fbf95b00000000", "114581.7"],
+  ["f", 3, "40fbf95b00000000", "114581.688"],
+  ["f", 6, "40fbf95b00000000", "114581.687500"],
+  ["f", 17, "40fbf95b00000000", "114581.68750000000000000"],
+  ["e", 0, "40fbf95b00000000", "1e+05"],
+  ["e", 1, "40fbf95b00000000", "1.1e+05"],
+  ["e", 3, "40fbf95b00000000", "1.146e+05"],
+  ["e", 6, "40fbf95b00000000", "1.145817e+05"],
+  ["e", 17, "40fbf95b00000000", "1.14581687500000000e+05"],
+  ["g", 0, "40fbf95b00000000", "1e+05"],
+  ["g", 1, "40fbf95b00000000", "1e+05"],
+  ["g", 3, "40fbf95b00000000", "1.15e+05"],
+  ["g", 6, "40fbf95b00000000", "114582"],
+  ["g", 17, "40fbf95b00000000", "114581.6875"],
+  ["f", 0, "40da80c800000000", "27139"],
+  ["f", 1, "40da80c800000000", "27139.1"],
+  ["f", 3, "40da80c800000000", "27139.125"],
+  ["f", 6, "40da80c800000000", "27139.125000"],
+  ["f", 17, "40da80c800000000", "27139.12500000000000000"],
+  ["e", 0, "40da80c800000000", "3e+04"],
+  ["e", 1, "40da80c800000000", "2.7e+04"],
+  ["e", 3, "40da80c800000000", "2.714e+04"],
+  ["e", 6, "40da80c800000000", "2.713912e+04"],
+  ["e", 17, "40da80c800000000", "2.71391250000000000e+04"],
+  ["g", 0, "40da80c800000000", "3e+04"],
+  ["g", 1, "40da80c800000000", "3e+04"],
+  ["g", 3, "40da80c800000000", "2.71e+04"],
+  ["g", 6, "40da80c800000000", "27139.1"],
+  ["g", 17, "40da80c800000000", "27139.125"],
+  ["f", 0, "40e513dc00000000", "43167"],
+  ["f", 1, "40e513dc00000000", "43166.9"],
+  ["f", 3, "40e513dc00000000", "43166.875"],
+  ["f", 6, "40e513dc00000000", "43166.875000"],
+  ["f", 17, "40e513dc00000000", "43166.87500000000000000"],
+  ["e", 0, "40e513dc00000000", "4e+04"],
+  ["e", 1, "40e513dc00000000", "4.3e+04"],
+  ["e", 3, "40e513dc00000000", "4.317e+04"],
+  ["e", 6, "40e513dc00000000", "4.316688e+04"],
+  ["e", 17, "40e513dc00000000", "4.31668750000000000e+04"],
+  ["g", 0, "40e513dc00000000", "4e+04"],
+  ["g", 1, "40e513dc00000000", "4e+04"],
+  ["g", 3, "40e513dc00000000", "4.32e+04"],
+  ["g", 6, "40e513dc00000000", "43166.9"],
+  ["g", 17, "40e513dc00000000", "43166.875"],
+  ["f", 0, "4109d09000000000", "211474"],
+  ["f", 1, "4109d09000000000", "211474.0"],
+  ["f", 3, "4109d09000000000", "211474.000"],
+  ["f", 6, "4109d09000000000", "211474.000000"],
+  ["f", 17, "4109d09000000000", "211474.00000000000000000"],
+  ["e", 0, "4109d09000000000", "2e+05"],
+  ["e", 1, "4109d09000000000", "2.1e+05"],
+  ["e", 3, "4109d09000000000", "2.115e+05"],
+  ["e", 6, "4109d09000000000", "2.114740e+05"],
+  ["e", 17, "4109d09000000000", "2.11474000000000000e+05"],
+  ["g", 0, "4109d09000000000", "2e+05"],
+  ["g", 1, "4109d09000000000", "2e+05"],
+  ["g", 3, "4109d09000000000", "2.11e+05"],
+  ["g", 6, "4109d09000000000", "211474"],
+  ["g", 17, "4109d09000000000", "211474"],
+  ["f", 0, "4113c20400000000", "323713"],
+  ["f", 1, "4113c20400000000", "323713.0"],
+  ["f", 3, "4113c20400000000", "323713.000"],
+  ["f", 6, "4113c20400000000", "323713.000000"],
+  ["f", 17, "4113c20400000000", "323713.00000000000000000"],
+  ["e", 0, "4113c20400000000", "3e+05"],
+  ["e", 1, "4113c20400000000", "3.2e+05"],
+  ["e", 3, "4113c20400000000", "3.237e+05"],
+  ["e", 6, "4113c20400000000", "3.237130e+05"],
+  ["e", 17, "4113c20400000000", "3.23713000000000000e+05"],
+  ["g", 0, "4113c20400000000", "3e+05"],
+  ["g", 1, "4113c20400000000", "3e+05"],
+  ["g", 3, "4113c20400000000", "3.24e+05"],
+  ["g", 6, "4113c20400000000", "323713"],
+  ["g", 17, "4113c20400000000", "323713"],
+  ["f", 0, "410ac94800000000", "219433"],
+  ["f", 1, "410ac94800000000", "219433.0"],
+  ["f", 3, "410ac94800000000", "219433.000"],
+  ["f", 6, "410ac94800000000", "219433.000000"],
+  ["f", 17, "410ac94800000000", "219433.00000000000000000"],
+  ["e", 0, "410ac94800000000", "2e+05"],
+  ["e", 1, "410ac94800000000", "2.2e+05"],
+  ["e", 3, "410ac94800000000", "2.194e+05"],
+  ["e", 6, "410ac94800000000", "2.194330e+05"],
+  ["e", 17, "410ac94800000000", "2.19433000000000000e+05"],
+  ["g", 0, "410ac94800000000", "2e+05"],
+  ["g", 1, "410ac94800000000", "2e+05"],
+  ["g", 3, "410ac94800000000", "2.19e+05"],
+  ["g", 6, "410ac94800000000", "219433"],
+  ["g", 17, "410ac94800000000", "219433"],
+  ["f", 0, "4131527200000000", "1135218"],
+  ["f", 1, "4131527200000000", "1135218.0"],
+  ["f", 3, "4131527200000000", "1135218.000"],
+  ["f", 6, "4131527200000000", "1135218.000000"],
+  ["f", 17, "4131527200000000", "1135218.00000000000000000"],
+  ["e", 0, "4131527200000000", "1e+06"],
+  ["e", 1, "4131527200000000", "1.1e+06"],
+  ["e", 3, "4131527200000000", "1.135e+06"],
+  ["e", 6, "4131527200000000", "1.135218e+06"],
+  ["e", 17, "4131527200000000", "1.13521800000000000e+06"],
+  ["g", 0, "4131527200000000", "1e+06"],
+  ["g", 1, "4131527200000000", "1e+06"],
+  ["g", 3, "4131527200000000", "1.14e+06"],
+  ["g", 6, "4131527200000000", "1.13522e+06"],
+  ["g", 17, "4131527200000000", "1135218"],
+  ["f", 0, "405e3b7000000000", "121"],
+  ["f", 1, "405e3b7000000000", "120.9"],
+  ["f", 3, "405e3b7000000000", "120.929"],
+  ["f", 6, "405e3b7000000000", "120.928711"],
+  ["f", 17, "405e3b7000000000", "120.92871093750000000"],
+  ["e", 0, "405e3b7000000000", "1e+02"],
+  ["e", 1, "405e3b7000000000", "1.2e+02"],
+  ["e", 3, "405e3b7000000000", "1.209e+02"],
+  ["e", 6, "405e3b7000000000", "1.209287e+02"],
+  ["e", 17, "405e3b7000000000", "1.20928710937500000e+02"],
+  ["g", 0, "405e3b7000000000", "1e+02"],
+  ["g", 1, "405e3b7000000000", "1e+02"],
+  ["g", 3, "405e3b7000000000", "121"],
+  ["g", 6, "405e3b7000000000", "120.929"],
+  ["g", 17, "405e3b7000000000", "120.9287109375"],
+  ["f", 0, "4137da8000000000", "1563264"],
+  ["f", 1, "4137da8000000000", "1563264.0"],
+  ["f", 3, "4137da8000000000", "1563264.000"],
+  ["f", 6, "4137da8000000000", "1563264.000000"],
+  ["f", 17, "4137da8000000000", "1563264.00000000000000000"],
+  ["e", 0, "4137da8000000000", "2e+06"],
+  ["e", 1, "4137da8000000000", "1.6e+06"],
+  ["e", 3, "4137da8000000000", "1.563e+06"],
+  ["e", 6, "4137da8000000000", "1.563264e+06"],
+  ["e", 17, "4137da8000000000", "1.56326400000000000e+06"],
+  ["g", 0, "4137da8000000000", "2e+06"],
+  ["g", 1, "4137da8000000000", "2e+06"],
+  ["g", 3, "4137da8000000000", "1.56e+06"],
+  ["g", 6, "4137da8000000000", "1.56326e+06"],
+  ["g", 17, "4137da8000000000", "1563264"],
+  ["f", 0, "3e71204d7839eab6", "0"],
+  ["f", 1, "3e71204d7839eab6", "0.0"],
+  ["f", 3, "3e71204d7839eab6", "0.000"],
+  ["f", 6, "3e71204d7839eab6", "0.000000"],
+  ["f", 17, "3e71204d7839eab6", "0.00000006380000000"],
+  ["e", 0, "3e71204d7839eab6", "6e-08"],
+  ["e", 1, "3e71204d7839eab6", "6.4e-08"],
+  ["e", 3, "3e71204d7839eab6", "6.380e-08"],
+  ["e", 6, "3e71204d7839eab6", "6.380000e-08"],
+  ["e", 17, "3e71204d7839eab6", "6.38000000000000022e-08"],
+  ["g", 0, "3e71204d7839eab6", "6e-08"],
+  ["g", 1, "3e71204d7839eab6", "6e-08"],
+  ["g", 3, "3e71204d7839eab6", "6.38e-08"],
+  ["g", 6, "3e71204d7839eab6", "6.38e-08"],
+  ["g", 17, "3e71204d7839eab6", "6.3800000000000002e-08"],
+  ["f", 0, "429e0bb333f40000", "8258900000000"],
+  ["f", 1, "429e0bb333f40000", "8258900000000.0"],
+  ["f", 3, "429e0bb333f40000", "8258900000000.000"],
+  ["f", 6, "429e0bb333f40000", "8258900000000.000000"],
+  ["f", 17, "429e0bb333f40000", "8258900000000.00000000000000000"],
+  ["e", 0, "429e0bb333f40000", "8e+12"],
+  ["e", 1, "429e0bb333f40000", "8.3e+12"],
+  ["e", 3, "429e0bb333f40000", "8.259e+12"],
+  ["e", 6, "429e0bb333f40000", "8.258900e+12"],
+  ["e", 17, "429e0bb333f40000", "8.25890000000000000e+12"],
+  ["g", 0, "429e0bb333f40000", "8e+12"],
+  ["g", 1, "429e0bb333f40000", "8e+12"],
+  ["g", 3, "429e0bb333f40000", "8.26e+12"],
+  ["g", 6, "429e0bb333f40000", "8.2589e+12"],
+  ["g", 17, "429e0bb333f40000", "8258900000000"],
+  ["f", 0, "42a0101d79260000", "8830700000000"],
+  ["f", 1, "42a0101d79260000", "8830700000000.0"],
+  ["f", 3, "42a0101d79260000", "8830700000000.000"],
+  ["f", 6, "42a0101d79260000", "8830700000000.000000"],
+  ["f", 17, "42a0101d79260000", "8830700000000.00000000000000000"],
+  ["e", 0, "42a0101d79260000", "9e+12"],
+  ["e", 1, "42a0101d79260000", "8.8e+12"],
+  ["e", 3, "42a0101d79260000", "8.831e+12"],
+  ["e", 6, "42a0101d79260000", "8.830700e+12"],
+  ["e", 17, "42a0101d79260000", "8.83070000000000000e+12"],
+  ["g", 0, "42a0101d79260000", "9e+12"],
+  ["g", 1, "42a0101d79260000", "9e+12"],
+  ["g", 3, "42a0101d79260000", "8.83e+12"],
+  ["g", 6, "42a0101d79260000", "8.8307e+12"],
+  ["g", 17, "42a0101d79260000", "8830700000000"],
+  ["f", 0, "426c96edc8500000", "982330000000"],
+  ["f", 1, "426c96edc8500000", "982330000000.0"],
+  ["f", 3, "426c96edc8500000", "982330000000.000"],
+  ["f", 6, "426c96edc8500000", "982330000000.000000"],
+  ["f", 17, "426c96edc8500000", "982330000000.00000000000000000"],
+  ["e", 0, "426c96edc8500000", "1e+12"],
+  ["e", 1, "426c96edc8500000", "9.8e+11"],
+  ["e", 3, "426c96edc8500000", "9.823e+11"],
+  ["e", 6, "426c96edc8500000", "9.823300e+11"],
+  ["e", 17, "426c96edc8500000", "9.82330000000000000e+11"],
+  ["g", 0, "426c96edc8500000", "1e+12"],
+  ["g", 1, "426c96edc8500000", "1e+12"],
+  ["g", 3, "426c96edc8500000", "9.82e+11"],
+  ["g", 6, "426c96edc8500000", "9.8233e+11"],
+  ["g", 17, "426c96edc8500000", "982330000000"],
+  ["f", 0, "3fb8a71de69ad42d", "0"],
+  ["f", 1, "3fb8a71de69ad42d", "0.1"],
+  ["f", 3, "3fb8a71de69ad42d", "0.096"],
+  ["f", 6, "3fb8a71de69ad42d", "0.096300"],
+  ["f", 17, "3fb8a71de69ad42d", "0.09630000000000001"],
+  ["e", 0, "3fb8a71de69ad42d", "1e-01"],
+  ["e", 1, "3fb8a71de69ad42d", "9.6e-02"],
+  ["e", 3, "3fb8a71de69ad42d", "9.630e-02"],
+  ["e", 6, "3fb8a71de69ad42d", "9.630000e-02"],
+  ["e", 17, "3fb8a71de69ad42d", "9.63000000000000106e-02"],
+  ["g", 0, "3fb8a71de69ad42d", "0.1"],
+  ["g", 1, "3fb8a71de69ad42d", "0.1"],
+  ["g", 3, "3fb8a71de69ad42d", "0.0963"],
+  ["g", 6, "3fb8a71de69ad42d", "0.0963"],
+  ["g", 17, "3fb8a71de69ad42d", "0.096300000000000011"],
+  ["f", 0, "3f152e87ca30b29d", "0"],
+  ["f", 1, "3f152e87ca30b29d", "0.0"],
+  ["f", 3, "3f152e87ca30b29d", "0.000"],
+  ["f", 6, "3f152e87ca30b29d", "0.000081"],
+  ["f", 17, "3f152e87ca30b29d", "0.00008080200000000"],
+  ["e", 0, "3f152e87ca30b29d", "8e-05"],
+  ["e", 1, "3f152e87ca30b29d", "8.1e-05"],
+  ["e", 3, "3f152e87ca30b29d", "8.080e-05"],
+  ["e", 6, "3f152e87ca30b29d", "8.080200e-05"],
+  ["e", 17, "3f152e87ca30b29d", "8.08020000000000033e-05"],
+  ["g", 0, "3f152e87ca30b29d", "8e-05"],
+  ["g", 1, "3f152e87ca30b29d", "8e-05"],
+  ["g", 3, "3f152e87ca30b29d", "8.08e-05"],
+  ["g", 6, "3f152e87ca30b29d", "8.0802e-05"],
+  ["g", 17, "3f152e87ca30b29d", "8.0802000000000003e-05"],
+  ["f", 0, "3fdd13e81450efdd", "0"],
+  ["f", 1, "3fdd13e81450efdd", "0.5"],
+  ["f", 3, "3fdd13e81450efdd", "0.454"],
+  ["f", 6, "3fdd13e81450efdd", "0.454340"],
+  ["f", 17, "3fdd13e81450efdd", "0.45434000000000002"],
+  ["e", 0, "3fdd13e81450efdd", "5e-01"],
+  ["e", 1, "3fdd13e81450efdd", "4.5e-01"],
+  ["e", 3, "3fdd13e81450efdd", "4.543e-01"],
+  ["e", 6, "3fdd13e81450efdd", "4.543400e-01"],
+  ["e", 17, "3fdd13e81450efdd", "4.54340000000000022e-01"],
+  ["g", 0, "3fdd13e81450efdd", "0.5"],
+  ["g", 1, "3fdd13e81450efdd", "0.5"],
+  ["g", 3, "3fdd13e81450efdd", "0.454"],
+  ["g", 6, "3fdd13e81450efdd", "0.45434"],
+  ["g", 17, "3fdd13e81450efdd", "0.45434000000000002"],
+  ["f", 0, "429fa5dabec40000", "8699300000000"],
+  ["f", 1, "429fa5dabec40000", "8699300000000.0"],
+  ["f", 3, "429fa5dabec40000", "8699300000000.000"],
+  ["f", 6, "429fa5dabec40000", "8699300000000.000000"],
+  ["f", 17, "429fa5dabec40000", "8699300000000.00000000000000000"],
+  ["e", 0, "429fa5dabec40000", "9e+12"],
+  ["e", 1, "429fa5dabec40000", "8.7e+12"],
+  ["e", 3, "429fa5dabec40000", "8.699e+12"],
+  ["e", 6, "429fa5dabec40000", "8.699300e+12"],
+  ["e", 17, "429fa5dabec40000", "8.69930000000000000e+12"],
+  ["g", 0, "429fa5dabec40000", "9e+12"],
+  ["g", 1, "429fa5dabec40000", "9e+12"],
+  ["g", 3, "429fa5dabec40000", "8.7e+12"],
+  ["g", 6, "429fa5dabec40000", "8.6993e+12"],
+  ["g", 17, "429fa5dabec40000", "8699300000000"],
+  ["f", 0, "4289ea8e46180000", "3561900000000"],
+  ["f", 1, "4289ea8e46180000", "3561900000000.0"],
+  ["f", 3, "4289ea8e46180000", "3561900000000.000"],
+  ["f", 6, "4289ea8e46180000", "3561900000000.000000"],
+  ["f", 17, "4289ea8e46180000", "3561900000000.00000000000000000"],
+  ["e", 0, "4289ea8e46180000", "4e+12"],
+  ["e", 1, "4289ea8e46180000", "3.6e+12"],
+  ["e", 3, "4289ea8e46180000", "3.562e+12"],
+  ["e", 6, "4289ea8e46180000", "3.561900e+12"],
+  ["e", 17, "4289ea8e46180000", "3.56190000000000000e+12"],
+  ["g", 0, "4289ea8e46180000", "4e+12"],
+  ["g", 1, "4289ea8e46180000", "4e+12"],
+  ["g", 3, "4289ea8e46180000", "3.56e+12"],
+  ["g", 6, "4289ea8e46180000", "3.5619e+12"],
+  ["g", 17, "4289ea8e46180000", "3561900000000"],
+  ["f", 0, "423375c197000000", "83580000000"],
+  ["f", 1, "423375c197000000", "83580000000.0"],
+  ["f", 3, "423375c197000000", "83580000000.000"],
+  ["f", 6, "423375c197000000", "83580000000.000000"],
+  ["f", 17, "423375c197000000", "83580000000.00000000000000000"],
+  ["e", 0, "423375c197000000", "8e+10"],
+  ["e", 1, "423375c197000000", "8.4e+10"],
+  ["e", 3, "423375c197000000", "8.358e+10"],
+  ["e", 6, "423375c197000000", "8.358000e+10"],
+  ["e", 17, "423375c197000000", "8.35800000000000000e+10"],
+  ["g", 0, "423375c197000000", "8e+10"],
+  ["g", 1, "423375c197000000", "8e+10"],
+  ["g", 3, "423375c197000000", "8.36e+10"],
+  ["g", 6, "423375c197000000", "8.358e+10"],
+  ["g", 17, "423375c197000000", "83580000000"],
+  ["f", 0, "3f709777806a1dab", "0"],
+  ["f", 1, "3f709777806a1dab", "0.0"],
+  ["f", 3, "3f709777806a1dab", "0.004"],
+  ["f", 6, "3f709777806a1dab", "0.004051"],
+  ["f", 17, "3f709777806a1dab", "0.00405070000000000"],
+  ["e", 0, "3f709777806a1dab", "4e-03"],
+  ["e", 1, "3f709777806a1dab", "4.1e-03"],
+  ["e", 3, "3f709777806a1dab", "4.051e-03"],
+  ["e", 6, "3f709777806a1dab", "4.050700e-03"],
+  ["e", 17, "3f709777806a1dab", "4.05069999999999996e-03"],
+  ["g", 0, "3f709777806a1dab", "0.004"],
+  ["g", 1, "3f709777806a1dab", "0.004"],
+  ["g", 3, "3f709777806a1dab", "0.00405"],
+  ["g", 6, "3f709777806a1dab", "0.0040507"],
+  ["g", 17, "3f709777806a1dab", "0.0040507"],
+  ["f", 0, "3edc84ccd7295f2f", "0"],
+  ["f", 1, "3edc84ccd7295f2f", "0.0"],
+  ["f", 3, "3edc84ccd7295f2f", "0.000"],
+  ["f", 6, "3edc84ccd7295f2f", "0.000007"],
+  ["f", 17, "3edc84ccd7295f2f", "0.00000679940000000"],
+  ["e", 0, "3edc84ccd7295f2f", "7e-06"],
+  ["e", 1, "3edc84ccd7295f2f", "6.8e-06"],
+  ["e", 3, "3edc84ccd7295f2f", "6.799e-06"],
+  ["e", 6, "3edc84ccd7295f2f", "6.799400e-06"],
+  ["e", 17, "3edc84ccd7295f2f", "6.79940000000000049e-06"],
+  ["g", 0, "3edc84ccd7295f2f", "7e-06"],
+  ["g", 1, "3edc84ccd7295f2f", "7e-06"],
+  ["g", 3, "3edc84ccd7295f2f", "6.8e-06"],
+  ["g", 6, "3edc84ccd7295f2f", "6.7994e-06"],
+  ["g", 17, "3edc84ccd7295f2f", "6.7994000000000005e-06"],
+  ["f", 0, "40d0658000000000", "16790"],
+  ["f", 1, "40d0658000000000", "16790.0"],
+  ["f", 3, "40d0658000000000", "16790.000"],
+  ["f", 6, "40d0658000000000", "16790.000000"],
+  ["f", 17, "40d0658000000000", "16790.00000000000000000"],
+  ["e", 0, "40d0658000000000", "2e+04"],
+  ["e", 1, "40d0658000000000", "1.7e+04"],
+  ["e", 3, "40d0658000000000", "1.679e+04"],
+  ["e", 6, "40d0658000000000", "1.679000e+04"],
+  ["e", 17, "40d0658000000000", "1.67900000000000000e+04"],
+  ["g", 0, "40d0658000000000", "2e+04"],
+  ["g", 1, "40d0658000000000", "2e+04"],
+  ["g", 3, "40d0658000000000", "1.68e+04"],
+  ["g", 6, "40d0658000000000", "16790"],
+  ["g", 17, "40d0658000000000", "16790"],
+  ["f", 0, "4195b44640000000", "91034000"],
+  ["f", 1, "4195b44640000000", "91034000.0"],
+  ["f", 3, "4195b44640000000", "91034000.000"],
+  ["f", 6, "4195b44640000000", "91034000.000000"],
+  ["f", 17, "4195b44640000000", "91034000.00000000000000000"],
+  ["e", 0, "4195b44640000000", "9e+07"],
+  ["e", 1, "4195b44640000000", "9.1e+07"],
+  ["e", 3, "4195b44640000000", "9.103e+07"],
+  ["e", 6, "4195b44640000000", "9.103400e+07"],
+  ["e", 17, "4195b44640000000", "9.10340000000000000e+07"],
+  ["g", 0, "4195b44640000000", "9e+07"],
+  ["g", 1, "4195b44640000000", "9e+07"],
+  ["g", 3, "4195b44640000000", "9.1e+07"],
+  ["g", 6, "4195b44640000000", "9.1034e+07"],
+  ["g", 17, "4195b44640000000", "91034000"],
+  ["f", 0, "40becd8000000000", "7886"],
+  ["f", 1, "40becd8000000000", "7885.5"],
+  ["f", 3, "40becd8000000000", "7885.500"],
+  ["f", 6, "40becd8000000000", "7885.500000"],
+  ["f", 17, "40becd8000000000", "7885.50000000000000000"],
+  ["e", 0, "40becd8000000000", "8e+03"],
+  ["e", 1, "40becd8000000000", "7.9e+03"],
+  ["e", 3, "40becd8000000000", "7.886e+03"],
+  ["e", 6, "40becd8000000000", "7.885500e+03"],
+  ["e", 17, "40becd8000000000", "7.88550000000000000e+03"],
+  ["g", 0, "40becd8000000000", "8e+03"],
+  ["g", 1, "40becd8000000000", "8e+03"],
+  ["g", 3, "40becd8000000000", "7.89e+03"],
+  ["g", 6, "40becd8000000000", "7885.5"],
+  ["g", 17, "40becd8000000000", "7885.5"],
+  ["f", 0, "42a55b5444c40000", "11741000000000"],
+  ["f", 1, "42a55b5444c40000", "11741000000000.0"],
+  ["f", 3, "42a55b5444c40000", "11741000000000.000"],
+  ["f", 6, "42a55b5444c40000", "11741000000000.000000"],
+  ["f", 17, "42a55b5444c40000", "11741000000000.00000000000000000"],
+  ["e", 0, "42a55b5444c40000", "1e+13"],
+  ["e", 1, "42a55b5444c40000", "1.2e+13"],
+  ["e", 3, "42a55b5444c40000", "1.174e+13"],
+  ["e", 6, "42a55b5444c40000", "1.174100e+13"],
+  ["e", 17, "42a55b5444c40000", "1.17410000000000000e+13"],
+  ["g", 0, "42a55b5444c40000", "1e+13"],
+  ["g", 1, "42a55b5444c40000", "1e+13"],
+  ["g", 3, "42a55b5444c40000", "1.17e+13"],
+  ["g", 6, "42a55b5444c40000", "1.1741e+13"],
+  ["g", 17, "42a55b5444c40000", "11741000000000"],
+  ["f", 0, "420f21db34000000", "16714000000"],
+  ["f", 1, "420f21db34000000", "16714000000.0"],
+  ["f", 3, "420f21db34000000", "16714000000.000"],
+  ["f", 6, "420f21db34000000", "16714000000.000000"],
+  ["f", 17, "420f21db34000000", "16714000000.00000000000000000"],
+  ["e", 0, "420f21db34000000", "2e+10"],
+  ["e", 1, "420f21db34000000", "1.7e+10"],
+  ["e", 3, "420f21db34000000", "1.671e+10"],
+  ["e", 6, "420f21db34000000", "1.671400e+10"],
+  ["e", 17, "420f21db34000000", "1.67140000000000000e+10"],
+  ["g", 0, "420f21db34000000", "2e+10"],
+  ["g", 1, "420f21db34000000", "2e+10"],
+  ["g", 3, "420f21db34000000", "1.67e+10"],
+  ["g", 6, "420f21db34000000", "1.6714e+10"],
+  ["g", 17, "420f21db34000000", "16714000000"],
+  ["f", 0, "3f71f75e70ce9f35", "0"],
+  ["f", 1, "3f71f75e70ce9f35", "0.0"],
+  ["f", 3, "3f71f75e70ce9f35", "0.004"],
+  ["f", 6, "3f71f75e70ce9f35", "0.004386"],
+  ["f", 17, "3f71f75e70ce9f35", "0.00438630000000000"],
+  ["e", 0, "3f71f75e70ce9f35", "4e-03"],
+  ["e", 1, "3f71f75e70ce9f35", "4.4e-03"],
+  ["e", 3, "3f71f75e70ce9f35", "4.386e-03"],
+  ["e", 6, "3f71f75e70ce9f35", "4.386300e-03"],
+  ["e", 17, "3f71f75e70ce9f35", "4.38630000000000009e-03"],
+  ["g", 0, "3f71f75e70ce9f35", "0.004"],
+  ["g", 1, "3f71f75e70ce9f35", "0.004"],
+  ["g", 3, "3f71f75e70ce9f35", "0.00439"],
+  ["g", 6, "3f71f75e70ce9f35", "0.0043863"],
+  ["g", 17, "3f71f75e70ce9f35", "0.0043863000000000001"],
+  ["f", 0, "4073775c28f5c28f", "311"],
+  ["f", 1, "4073775c28f5c28f", "311.5"],
+  ["f", 3, "4073775c28f5c28f", "311.460"],
+  ["f", 6, "4073775c28f5c28f", "311.460000"],
+  ["f", 17, "4073775c28f5c28f", "311.45999999999997954"],
+  ["e", 0, "4073775c28f5c28f", "3e+02"],
+  ["e", 1, "4073775c28f5c28f", "3.1e+02"],
+  ["e", 3, "4073775c28f5c28f", "3.115e+02"],
+  ["e", 6, "4073775c28f5c28f", "3.114600e+02"],
+  ["e", 17, "4073775c28f5c28f", "3.11459999999999980e+02"],
+  ["g", 0, "4073775c28f5c28f", "3e+02"],
+  ["g", 1, "4073775c28f5c28f", "3e+02"],
+  ["g", 3, "4073775c28f5c28f", "311"],
+  ["g", 6, "4073775c28f5c28f", "311.46"],
+  ["g", 17, "4073775c28f5c28f", "311.45999999999998"],
+  ["f", 0, "41e19432c8000000", "2359400000"],
+  ["f", 1, "41e19432c8000000", "2359400000.0"],
+  ["f", 3, "41e19432c8000000", "2359400000.000"],
+  ["f", 6, "41e19432c8000000", "2359400000.000000"],
+  ["f", 17, "41e19432c8000000", "2359400000.00000000000000000"],
+  ["e", 0, "41e19432c8000000", "2e+09"],
+  ["e", 1, "41e19432c8000000", "2.4e+09"],
+  ["e", 3, "41e19432c8000000", "2.359e+09"],
+  ["e", 6, "41e19432c8000000", "2.359400e+09"],
+  ["e", 17, "41e19432c8000000", "2.35940000000000000e+09"],
+  ["g", 0, "41e19432c8000000", "2e+09"],
+  ["g", 1, "41e19432c8000000", "2e+09"],
+  ["g", 3, "41e19432c8000000", "2.36e+09"],
+  ["g", 6, "41e19432c8000000", "2.3594e+09"],
+  ["g", 17, "41e19432c8000000", "2359400000"],
+  ["f", 0, "3fab328b6d86ec18", "0"],
+  ["f", 1, "3fab328b6d86ec18", "0.1"],
+  ["f", 3, "3fab328b6d86ec18", "0.053"],
+  ["f", 6, "3fab328b6d86ec18", "0.053120"],
+  ["f", 17, "3fab328b6d86ec18", "0.05312000000000000"],
+  ["e", 0, "3fab328b6d86ec18", "5e-02"],
+  ["e", 1, "3fab328b6d86ec18", "5.3e-02"],
+  ["e", 3, "3fab328b6d86ec18", "5.312e-02"],
+  ["e", 6, "3fab328b6d86ec18", "5.312000e-02"],
+  ["e", 17, "3fab328b6d86ec18", "5.31200000000000006e-02"],
+  ["g", 0, "3fab328b6d86ec18", "0.05"],
+  ["g", 1, "3fab328b6d86ec18", "0.05"],
+  ["g", 3, "3fab328b6d86ec18", "0.0531"],
+  ["g", 6, "3fab328b6d86ec18", "0.05312"],
+  ["g", 17, "3fab328b6d86ec18", "0.053120000000000001"],
+  ["f", 0, "3ed0298e86d07019", "0"],
+  ["f", 1, "3ed0298e86d07019", "0.0"],
+  ["f", 3, "3ed0298e86d07019", "0.000"],
+  ["f", 6, "3ed0298e86d07019", "0.000004"],
+  ["f", 17, "3ed0298e86d07019", "0.00000385340000000"],
+  ["e", 0, "3ed0298e86d07019", "4e-06"],
+  ["e", 1, "3ed0298e86d07019", "3.9e-06"],
+  ["e", 3, "3ed0298e86d07019", "3.853e-06"],
+  ["e", 6, "3ed0298e86d07019", "3.853400e-06"],
+  ["e", 17, "3ed0298e86d07019", "3.85340000000000024e-06"],
+  ["g", 0, "3ed0298e86d07019", "4e-06"],
+  ["g", 1, "3ed0298e86d07019", "4e-06"],
+  ["g", 3, "3ed0298e86d07019", "3.85e-06"],
+  ["g", 6, "3ed0298e86d07019", "3.8534e-06"],
+  ["g", 17, "3ed0298e86d07019", "3.8534000000000002e-06"],
+  ["f", 0, "404de83126e978d5", "60"],
+  ["f", 1, "404de83126e978d5", "59.8"],
+  ["f", 3, "404de83126e978d5", "59.814"],
+  ["f", 6, "404de83126e978d5", "59.814000"],
+  ["f", 17, "404de83126e978d5", "59.81400000000000006"],
+  ["e", 0, "404de83126e978d5", "6e+01"],
+  ["e", 1, "404de83126e978d5", "6.0e+01"],
+  ["e", 3, "404de83126e978d5", "5.981e+01"],
+  ["e", 6, "404de83126e978d5", "5.981400e+01"],
+  ["e", 17, "404de83126e978d5", "5.98140000000000001e+01"],
+  ["g", 0, "404de83126e978d5", "6e+01"],
+  ["g", 1, "404de83126e978d5", "6e+01"],
+  ["g", 3, "404de83126e978d5", "59.8"],
+  ["g", 6, "404de83126e978d5", "59.814"],
+  ["g", 17, "404de83126e978d5", "59.814"],
+  ["f", 0, "422dc2aa6b000000", "63910000000"],
+  ["f", 1, "422dc2aa6b000000", "63910000000.0"],
+  ["f", 3, "422dc2aa6b000000", "63910000000.000"],
+  ["f", 6, "422dc2aa6b000000", "63910000000.000000"],
+  ["f", 17, "422dc2aa6b000000", "63910000000.00000000000000000"],
+  ["e", 0, "422dc2aa6b000000", "6e+10"],
+  ["e", 1, "422dc2aa6b000000", "6.4e+10"],
+  ["e", 3, "422dc2aa6b000000", "6.391e+10"],
+  ["e", 6, "422dc2aa6b000000", "6.391000e+10"],
+  ["e", 17, "422dc2aa6b000000", "6.39100000000000000e+10"],
+  ["g", 0, "422dc2aa6b000000", "6e+10"],
+  ["g", 1, "422dc2aa6b000000", "6e+10"],
+  ["g", 3, "422dc2aa6b000000", "6.39e+10"],
+  ["g", 6, "422dc2aa6b000000", "6.391e+10"],
+  ["g", 17, "422dc2aa6b000000", "63910000000"],
+  ["f", 0, "41bb9f8880000000", "463440000"],
+  ["f", 1, "41bb9f8880000000", "463440000.0"],
+  ["f", 3, "41bb9f8880000000", "463440000.000"],
+  ["f", 6, "41bb9f8880000000", "463440000.000000"],
+  ["f", 17, "41bb9f8880000000", "463440000.00000000000000000"],
+  ["e", 0, "41bb9f8880000000", "5e+08"],
+  ["e", 1, "41bb9f8880000000", "4.6e+08"],
+  ["e", 3, "41bb9f8880000000", "4.634e+08"],
+  ["e", 6, "41bb9f8880000000", "4.634400e+08"],
+  ["e", 17, "41bb9f8880000000", "4.63440000000000000e+08"],
+  ["g", 0, "41bb9f8880000000", "5e+08"],
+  ["g", 1, "41bb9f8880000000", "5e+08"],
+  ["g", 3, "41bb9f8880000000", "4.63e+08"],
+  ["g", 6, "41bb9f8880000000", "4.6344e+08"],
+  ["g", 17, "41bb9f8880000000", "463440000"],
+  ["f", 0, "42d3ecda8ec80000", "87632000000000"],
+  ["f", 1, "42d3ecda8ec80000", "87632000000000.0"],
+  ["f", 3, "42d3ecda8ec80000", "87632000000000.000"],
+  ["f", 6, "42d3ecda8ec80000", "87632000000000.000000"],
+  ["f", 17, "42d3ecda8ec80000", "87632000000000.00000000000000000"],
+  ["e", 0, "42d3ecda8ec80000", "9e+13"],
+  ["e", 1, "42d3ecda8ec80000", "8.8e+13"],
+  ["e", 3, "42d3ecda8ec80000", "8.763e+13"],
+  ["e", 6, "42d3ecda8ec80000", "8.763200e+13"],
+  ["e", 17, "42d3ecda8ec80000", "8.76320000000000000e+13"],
+  ["g", 0, "42d3ecda8ec80000", "9e+13"],
+  ["g", 1, "42d3ecda8ec80000", "9e+13"],
+  ["g", 3, "42d3ecda8ec80000", "8.76e+13"],
+  ["g", 6, "42d3ecda8ec80000", "8.7632e+13"],
+  ["g", 17, "42d3ecda8ec80000", "87632000000000"],
+  ["f", 0, "4265b9563d700000", "746430000000"],
+  ["f", 1, "4265b9563d700000", "746430000000.0"],
+  ["f", 3, "4265b9563d700000", "746430000000.000"],
+  ["f", 6, "4265b9563d700000", "746430000000.000000"],
+  ["f", 17, "4265b9563d700000", "746430000000.00000000000000000"],
+  ["e", 0, "4265b9563d700000", "7e+11"],
+  ["e", 1, "4265b9563d700000", "7.5e+11"],
+  ["e", 3, "4265b9563d700000", "7.464e+11"],
+  ["e", 6, "4265b9563d700000", "7.464300e+11"],
+  ["e", 17, "4265b9563d700000", "7.46430000000000000e+11"],
+  ["g", 0, "4265b9563d700000", "7e+11"],
+  ["g", 1, "4265b9563d700000", "7e+11"],
+  ["g", 3, "4265b9563d700000", "7.46e+11"],
+  ["g", 6, "4265b9563d700000", "7.4643e+11"],
+  ["g", 17, "4265b9563d700000", "746430000000"],
+  ["f", 0, "41a47bd5e0000000", "171830000"],
+  ["f", 1, "41a47bd5e0000000", "171830000.0"],
+  ["f", 3, "41a47bd5e0000000", "171830000.000"],
+  ["f", 6, "41a47bd5e0000000", "171830000.000000"],
+  ["f", 17, "41a47bd5e0000000", "171830000.00000000000000000"],
+  ["e", 0, "41a47bd5e0000000", "2e+08"],
+  ["e", 1, "41a47bd5e0000000", "1.7e+08"],
+  ["e", 3, "41a47bd5e0000000", "1.718e+08"],
+  ["e", 6, "41a47bd5e0000000", "1.718300e+08"],
+  ["e", 17, "41a47bd5e0000000", "1.71830000000000000e+08"],
+  ["g", 0, "41a47bd5e0000000", "2e+08"],
+  ["g", 1, "41a47bd5e0000000", "2e+08"],
+  ["g", 3, "41a47bd5e0000000", "1.72e+08"],
+  ["g", 6, "41a47bd5e0000000", "1.7183e+08"],
+  ["g", 17, "41a47bd5e0000000", "171830000"],
+  ["f", 0, "40b4a9cccccccccd", "5290"],
+  ["f", 1, "40b4a9cccccccccd", "5289.8"],
+  ["f", 3, "40b4a9cccccccccd", "5289.800"],
+  ["f", 6, "40b4a9cccccccccd", "5289.800000"],
+  ["f", 17, "40b4a9cccccccccd", "5289.80000000000018190"],
+  ["e", 0, "40b4a9cccccccccd", "5e+03"],
+  ["e", 1, "40b4a9cccccccccd", "5.3e+03"],
+  ["e", 3, "40b4a9cccccccccd", "5.290e+03"],
+  ["e", 6, "40b4a9cccccccccd", "5.289800e+03"],
+  ["e", 17, "40b4a9cccccccccd", "5.28980000000000018e+03"],
+  ["g", 0, "40b4a9cccccccccd", "5e+03"],
+  ["g", 1, "40b4a9cccccccccd", "5e+03"],
+  ["g", 3, "40b4a9cccccccccd", "5.29e+03"],
+  ["g", 6, "40b4a9cccccccccd", "5289.8"],
+  ["g", 17, "40b4a9cccccccccd", "5289.8000000000002"],
+  ["f", 0, "425eafbe40600000", "527190000000"],
+  ["f", 1, "425eafbe40600000", "527190000000.0"],
+  ["f", 3, "425eafbe40600000", "527190000000.000"],
+  ["f", 6, "425eafbe40600000", "527190000000.000000"],
+  ["f", 17, "425eafbe40600000", "527190000000.00000000000000000"],
+  ["e", 0, "425eafbe40600000", "5e+11"],
+  ["e", 1, "425eafbe40600000", "5.3e+11"],
+  ["e", 3, "425eafbe40600000", "5.272e+11"],
+  ["e", 6, "425eafbe40600000", "5.271900e+11"],
+  ["e", 17, "425eafbe40600000", "5.27190000000000000e+11"],
+  ["g", 0, "425eafbe40600000", "5e+11"],
+  ["g", 1, "425eafbe40600000", "5e+11"],
+  ["g", 3, "425eafbe40600000", "5.27e+11"],
+  ["g", 6, "425eafbe40600000", "5.2719e+11"],
+  ["g", 17, "425eafbe40600000", "527190000000"],
+  ["f", 0, "415b56ed00000000", "7166900"],
+  ["f", 1, "415b56ed00000000", "7166900.0"],
+  ["f", 3, "415b56ed00000000", "7166900.000"],
+  ["f", 6, "415b56ed00000000", "7166900.000000"],
+  ["f", 17, "415b56ed00000000", "7166900.00000000000000000"],
+  ["e", 0, "415b56ed00000000", "7e+06"],
+  ["e", 1, "415b56ed00000000", "7.2e+06"],
+  ["e", 3, "415b56ed00000000", "7.167e+06"],
+  ["e", 6, "415b56ed00000000", "7.166900e+06"],
+  ["e", 17, "415b56ed00000000", "7.16690000000000000e+06"],
+  ["g", 0, "415b56ed00000000", "7e+06"],
+  ["g", 1, "415b56ed00000000", "7e+06"],
+  ["g", 3, "415b56ed00000000", "7.17e+06"],
+  ["g", 6, "415b56ed00000000", "7.1669e+06"],
+  ["g", 17, "415b56ed00000000", "7166900"],
+  ["f", 0, "42b96731554e0000", "27931000000000"],
+  ["f", 1, "42b96731554e0000", "27931000000000.0"],
+  ["f", 3, "42b96731554e0000", "27931000000000.000"],
+  ["f", 6, "42b96731554e0000", "27931000000000.000000"],
+  ["f", 17, "42b96731554e0000", "27931000000000.00000000000000000"],
+  ["e", 0, "42b96731554e0000", "3e+13"],
+  ["e", 1, "42b96731554e0000", "2.8e+13"],
+  ["e", 3, "42b96731554e0000", "2.793e+13"],
+  ["e", 6, "42b96731554e0000", "2.793100e+13"],
+  ["e", 17, "42b96731554e0000", "2.79310000000000000e+13"],
+  ["g", 0, "42b96731554e0000", "3e+13"],
+  ["g", 1, "42b96731554e0000", "3e+13"],
+  ["g", 3, "42b96731554e0000", "2.79e+13"],
+  ["g", 6, "42b96731554e0000", "2.7931e+13"],
+  ["g", 17, "42b96731554e0000", "27931000000000"],
+  ["f", 0, "41745a3480000000", "21341000"],
+  ["f", 1, "41745a3480000000", "21341000.0"],
+  ["f", 3, "41745a3480000000", "21341000.000"],
+  ["f", 6, "41745a3480000000", "21341000.000000"],
+  ["f", 17, "41745a3480000000", "21341000.00000000000000000"],
+  ["e", 0, "41745a3480000000", "2e+07"],
+  ["e", 1, "41745a3480000000", "2.1e+07"],
+  ["e", 3, "41745a3480000000", "2.134e+07"],
+  ["e", 6, "41745a3480000000", "2.134100e+07"],
+  ["e", 17, "41745a3480000000", "2.13410000000000000e+07"],
+  ["g", 0, "41745a3480000000", "2e+07"],
+  ["g", 1, "41745a3480000000", "2e+07"],
+  ["g", 3, "41745a3480000000", "2.13e+07"],
+  ["g", 6, "41745a3480000000", "2.1341e+07"],
+  ["g", 17, "41745a3480000000", "21341000"],
+  ["f", 0, "40582cfdf3b645a2", "97"],
+  ["f", 1, "40582cfdf3b645a2", "96.7"],
+  ["f", 3, "40582cfdf3b645a2", "96.703"],
+  ["f", 6, "40582cfdf3b645a2", "96.703000"],
+  ["f", 17, "40582cfdf3b645a2", "96.70300000000000296"],
+  ["e", 0, "40582cfdf3b645a2", "1e+02"],
+  ["e", 1, "40582cfdf3b645a2", "9.7e+01"],
+  ["e", 3, "40582cfdf3b645a2", "9.670e+01"],
+  ["e", 6, "40582cfdf3b645a2", "9.670300e+01"],
+  ["e", 17, "40582cfdf3b645a2", "9.67030000000000030e+01"],
+  ["g", 0, "40582cfdf3b645a2", "1e+02"],
+  ["g", 1, "40582cfdf3b645a2", "1e+02"],
+  ["g", 3, "40582cfdf3b645a2", "96.7"],
+  ["g", 6, "40582cfdf3b645a2", "96.703"],
+  ["g", 17, "40582cfdf3b645a2", "96.703000000000003"],
+  ["f", 0, "41fbd949a8000000", "7475600000"],
+  ["f", 1, "41fbd949a8000000", "7475600000.0"],
+  ["f", 3, "41fbd949a8000000", "7475600000.000"],
+  ["f", 6, "41fbd949a8000000", "7475600000.000000"],
+  ["f", 17, "41fbd949a8000000", "7475600000.00000000000000000"],
+  ["e", 0, "41fbd949a8000000", "7e+09"],
+  ["e", 1, "41fbd949a8000000", "7.5e+09"],
+  ["e", 3, "41fbd949a8000000", "7.476e+09"],
+  ["e", 6, "41fbd949a8000000", "7.475600e+09"],
+  ["e", 17, "41fbd949a8000000", "7.47560000000000000e+09"],
+  ["g", 0, "41fbd949a8000000", "7e+09"],
+  ["g", 1, "41fbd949a8000000", "7e+09"],
+  ["g", 3, "41fbd949a8000000", "7.48e+09"],
+  ["g", 6, "41fbd949a8000000", "7.4756e+09"],
+  ["g", 17, "41fbd949a8000000", "7475600000"],
+  ["f", 0, "3f4d6be1249d992e", "0"],
+  ["f", 1, "3f4d6be1249d992e", "0.0"],
+  ["f", 3, "3f4d6be1249d992e", "0.001"],
+  ["f", 6, "3f4d6be1249d992e", "0.000898"],
+  ["f", 17, "3f4d6be1249d992e", "0.00089787000000000"],
+  ["e", 0, "3f4d6be1249d992e", "9e-04"],
+  ["e", 1, "3f4d6be1249d992e", "9.0e-04"],
+  ["e", 3, "3f4d6be1249d992e", "8.979e-04"],
+  ["e", 6, "3f4d6be1249d992e", "8.978700e-04"],
+  ["e", 17, "3f4d6be1249d992e", "8.97870000000000048e-04"],
+  ["g", 0, "3f4d6be1249d992e", "0.0009"],
+  ["g", 1, "3f4d6be1249d992e", "0.0009"],
+  ["g", 3, "3f4d6be1249d992e", "0.000898"],
+  ["g", 6, "3f4d6be1249d992e", "0.00089787"],
+  ["g", 17, "3f4d6be1249d992e", "0.00089787000000000005"],
+  ["f", 0, "41192b9800000000", "412390"],
+  ["f", 1, "41192b9800000000", "412390.0"],
+  ["f", 3, "41192b9800000000", "412390.000"],
+  ["f", 6, "41192b9800000000", "412390.000000"],
+  ["f", 17, "41192b9800000000", "412390.00000000000000000"],
+  ["e", 0, "41192b9800000000", "4e+05"],
+  ["e", 1, "41192b9800000000", "4.1e+05"],
+  ["e", 3, "41192b9800000000", "4.124e+05"],
+  ["e", 6, "41192b9800000000", "4.123900e+05"],
+  ["e", 17, "41192b9800000000", "4.12390000000000000e+05"],
+  ["g", 0, "41192b9800000000", "4e+05"],
+  ["g", 1, "41192b9800000000", "4e+05"],
+  ["g", 3, "41192b9800000000", "4.12e+05"],
+  ["g", 6, "41192b9800000000", "412390"],
+  ["g", 17, "41192b9800000000", "412390"],
+  ["f", 0, "4207e1877a000000", "12821000000"],
+  ["f", 1, "4207e1877a000000", "12821000000.0"],
+  ["f", 3, "4207e1877a000000", "12821000000.000"],
+  ["f", 6, "4207e1877a000000", "12821000000.000000"],
+  ["f", 17, "4207e1877a000000", "12821000000.00000000000000000"],
+  ["e", 0, "4207e1877a000000", "1e+10"],
+  ["e", 1, "4207e1877a000000", "1.3e+10"],
+  ["e", 3, "4207e1877a000000", "1.282e+10"],
+  ["e", 6, "4207e1877a000000", "1.282100e+10"],
+  ["e", 17, "4207e1877a000000", "1.28210000000000000e+10"],
+  ["g", 0, "4207e1877a000000", "1e+10"],
+  ["g", 1, "4207e1877a000000", "1e+10"],
+  ["g", 3, "4207e1877a000000", "1.28e+10"],
+  ["g", 6, "4207e1877a000000", "1.2821e+10"],
+  ["g", 17, "4207e1877a000000", "12821000000"],
+  ["f", 0, "3effe838f52541c0", "0"],
+  ["f", 1, "3effe838f52541c0", "0.0"],
+  ["f", 3, "3effe838f52541c0", "0.000"],
+  ["f", 6, "3effe838f52541c0", "0.000030"],
+  ["f", 17, "3effe838f52541c0", "0.00003042900000000"],
+  ["e", 0, "3effe838f52541c0", "3e-05"],
+  ["e", 1, "3effe838f52541c0", "3.0e-05"],
+  ["e", 3, "3effe838f52541c0", "3.043e-05"],
+  ["e", 6, "3effe838f52541c0", "3.042900e-05"],
+  ["e", 17, "3effe838f52541c0", "3.04290000000000029e-05"],
+  ["g", 0, "3effe838f52541c0", "3e-05"],
+  ["g", 1, "3effe838f52541c0", "3e-05"],
+  ["g", 3, "3effe838f52541c0", "3.04e-05"],
+  ["g", 6, "3effe838f52541c0", "3.0429e-05"],
+  ["g", 17, "3effe838f52541c0", "3.0429000000000003e-05"],
+  ["f", 0, "405628f5c28f5c29", "89"],
+  ["f", 1, "405628f5c28f5c29", "88.6"],
+  ["f", 3, "405628f5c28f5c29", "88.640"],
+  ["f", 6, "405628f5c28f5c29", "88.640000"],
+  ["f", 17, "405628f5c28f5c29", "88.64000000000000057"],
+  ["e", 0, "405628f5c28f5c29", "9e+01"],
+  ["e", 1, "405628f5c28f5c29", "8.9e+01"],
+  ["e", 3, "405628f5c28f5c29", "8.864e+01"],
+  ["e", 6, "405628f5c28f5c29", "8.864000e+01"],
+  ["e", 17, "405628f5c28f5c29", "8.86400000000000006e+01"],
+  ["g", 0, "405628f5c28f5c29", "9e+01"],
+  ["g", 1, "405628f5c28f5c29", "9e+01"],
+  ["g", 3, "405628f5c28f5c29", "88.6"],
+  ["g", 6, "405628f5c28f5c29", "88.64"],
+  ["g", 17, "405628f5c28f5c29", "88.640000000000001"],
+  ["f", 130, "3cce2f1a9a812d92", "0.0000000000000008377742857142855658981272718651731789698497996146664412719928805017843842506408691406250000000000000000000000000000"],
+  ["e", 110, "3cce2f1a9a812d92", "8.37774285714285565898127271865173178969849799614666441271992880501784384250640869140625000000000000000000000000e-16"],
+  ["g", 120, "3cce2f1a9a812d92", "8.37774285714285565898127271865173178969849799614666441271992880501784384250640869140625e-16"],
+  ["f", 130, "3cd4ee5ee586bd8b", "0.0000000000000011619114285714284362465205091581656357090627683034678163664921157760545611381530761718750000000000000000000000000000"],
+  ["e", 110, "3cd4ee5ee586bd8b", "1.16191142857142843624652050915816563570906276830346781636649211577605456113815307617187500000000000000000000000e-15"],
+  ["g", 120, "3cd4ee5ee586bd8b", "1.161911428571428436246520509158165635709062768303467816366492115776054561138153076171875e-15"],
+  ["f", 130, "3ccf76128ca842e8", "0.0000000000000008732242857142855798743300742617013699496783703246638452810657327063381671905517578125000000000000000000000000000000"],
+  ["e", 110, "3ccf76128ca842e8", "8.73224285714285579874330074261701369949678370324663845281065732706338167190551757812500000000000000000000000000e-16"],
+  ["g", 120, "3ccf76128ca842e8", "8.732242857142855798743300742617013699496783703246638452810657327063381671905517578125e-16"],
+  ["f", 130, "3cccf37e493fdb2b", "0.0000000000000008035557142857143247984228286644766094505573455174241015441793933860026299953460693359375000000000000000000000000000"],
+  ["e", 110, "3cccf37e493fdb2b", "8.03555714285714324798422828664476609450557345517424101544179393386002629995346069335937500000000000000000000000e-16"],
+  ["g", 120, "3cccf37e493fdb2b", "8.035557142857143247984228286644766094505573455174241015441793933860026299953460693359375e-16"],
+  ["f", 130, "3cd7135d95321b08", "0.0000000000000012809557142857142527955175377165431493763471729185887681978783803060650825500488281250000000000000000000000000000000"],
+  ["e", 110, "3cd7135d95321b08", "1.28095571428571425279551753771654314937634717291858876819787838030606508255004882812500000000000000000000000000e-15"],
+  ["g", 120, "3cd7135d95321b08", "1.280955714285714252795517537716543149376347172918588768197878380306065082550048828125e-15"],
+  ["f", 130, "3cd278dcc469dd9f", "0.0000000000000010254085714285713787799790539180944768718597775655765325097945606103166937828063964843750000000000000000000000000000"],
+  ["e", 110, "3cd278dcc469dd9f", "1.02540857142857137877997905391809447687185977756557653250979456061031669378280639648437500000000000000000000000e-15"],
+  ["g", 120, "3cd278dcc469dd9f", "1.025408571428571378779979053918094476871859777565576532509794560610316693782806396484375e-15"],
+  ["f", 130, "3cbfc6ef6156e2a7", "0.0000000000000004409957142857142571982850064360656863317104411145036513275385914312209933996200561523437500000000000000000000000000"],
+  ["e", 110, "3cbfc6ef6156e2a7", "4.40995714285714257198285006436065686331710441114503651327538591431220993399620056152343750000000000000000000000e-16"],
+  ["g", 120, "3cbfc6ef6156e2a7", "4.4099571428571425719828500643606568633171044111450365132753859143122099339962005615234375e-16"],
+  ["f", 130, "3cc91928b9316e1b", "0.0000000000000006966171428571428605116984826867708973832971921201495657527402727282606065273284912109375000000000000000000000000000"],
+  ["e", 110, "3cc91928b9316e1b", "6.96617142857142860511698482686770897383297192120149565752740272728260606527328491210937500000000000000000000000e-16"],
+  ["g", 120, "3cc91928b9316e1b", "6.966171428571428605116984826867708973832971921201495657527402727282606065273284912109375e-16"],
+  ["f", 130, "3cc52d1db059935a", "0.0000000000000005877585714285714557452186398632088745216359203585310133632901852251961827278137207031250000000000000000000000000000"],
+  ["e", 110, "3cc52d1db059935a", "5.87758571428571455745218639863208874521635920358531013363290185225196182727813720703125000000000000000000000000e-16"],
+  ["g", 120, "3cc52d1db059935a", "5.87758571428571455745218639863208874521635920358531013363290185225196182727813720703125e-16"],
+  ["f", 130, "3cd28ed062238d99", "0.0000000000000010301685714285714797927310454276873484745323398051319863100161455804482102394104003906250000000000000000000000000000"],
+  ["e", 110, "3cd28ed062238d99", "1.03016857142857147979273104542768734847453233980513198631001614558044821023941040039062500000000000000000000000e-15"],
+  ["g", 120, "3cd28ed062238d99", "1.030168571428571479792731045427687348474532339805131986310016145580448210239410400390625e-15"],
+];
+
+export default floatFormattingCases;
@@ -0,0 +1,88 @@
+/**
+ * Generates floatFormattingCases.ts - the expected output of glibc printf for the float formatting differential tests.
+ * Usage: gcc generateFloatFormattingCases.c -lm -o gen && ./gen > floatFormattingCases.ts
+ */
+#include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+static uint64_t state = 88172645463325252ull;
+
+// deterministic xorshift generator, so that the generated cases are reproducible
+static uint64_t next_random(void) {
+  state ^= state << 13;
+  state ^= state >> 7;
+  state ^= state << 17;
+  return state;
+}
+
+static void emit_case(char conversion, int precision, double value) {
+  char format[16];
+  char output[512];
+  uint64_t bits;
+  memcpy(&bits, &value, sizeof bits);
+  sprintf(format, "%%.%d%c", precision, conversion);
+  snprintf(output, sizeof output, format, value);
+  printf("  [\"%c\", %d, \"%016llx\", \"%s\"],\n", conversion, precision,
+         (unsigned long long)bits, output);
+}
+
+static void emit_cases(double value) {
+  static const int precisions[] = {0, 1, 3, 6, 17};
+  static const char conversions[] = {'f', 'e', 'g'};
+  for (int c = 0; c < 3; ++c) {
+    for (int i = 0; i < 5; ++i) {
+      // skip fixed notation of huge values, which is just very long
+      if (conversions[c] == 'f' && value > 1e40) {
+        continue;
+      }
+      emit_case(conversions[c], precisions[i], value);
+    }
+  }
+}
+
+int main(void) {
+  static const double special_values[] = {
+      0,      0.5,       1.5,       2.5,     0.125,     0.375,
+      9.5,    0.05,      0.25,      2.675,   1.005,     0.1,
+      0.3,    3.14159,   9.9995,    999999.5, 0.0078125, 125,
+      1250,   12500000,  1e-5,      0.0001,  100000,    1000000,
+      1e21,   1e22,      5e-324,    2.2250738585072014e-308,
+      1.7976931348623157e308,
+  };
+  printf("// generated by generateFloatFormattingCases.c - do not edit\n");
+  printf("// [conversion, precision, bits of double in hex, expected glibc "
+         "output]\n");
+  printf("const floatFormattingCases: [string, number, string, string][] = [\n");
+  for (size_t i = 0; i < sizeof special_values / sizeof *special_values; ++i) {
+    emit_cases(special_values[i]);
+  }
+  for (int i = 0; i < 40; ++i) {
+    // arbitrary bit patterns
+    uint64_t bits = next_random() & 0x7fffffffffffffffull;
+    double value;
+    memcpy(&value, &bits, sizeof value);
+    if (isfinite(value)) {
+      emit_cases(value);
+    }
+  }
+  for (int i = 0; i < 40; ++i) {
+    // dyadic fractions, which include many exact rounding ties
+    emit_cases((double)(next_random() % 2000001) / (1u << (next_random() % 12)));
+  }
+  for (int i = 0; i < 40; ++i) {
+    // short decimals of varying magnitude
+    emit_cases((double)(next_random() % 100000) *
+               pow(10, (int)(next_random() % 20) - 10));
+  }
+  for (int i = 0; i < 10; ++i) {
+    // precisions beyond what Number.prototype.toFixed supports
+    double value = (double)(next_random() % 1000000) / 7 * pow(10, -20);
+    emit_case('f', 130, value);
+    emit_case('e', 110, value);
+    emit_case('g', 120, value);
+  }
+  printf("];\n\nexport default floatFormattingCases;\n");
+  return 0;
+}
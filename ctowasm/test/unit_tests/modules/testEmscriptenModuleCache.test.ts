@@ -0,0 +1,54 @@
+import { describe, expect, test } from "@jest/globals";
+import {
+  getEmbeddedWasmBinary,
+  instantiateEmscriptenModule,
+} from "../../../src/modules/emscriptenModuleCache";
+import mathModuleFactoryFn from "../../../src/modules/math/emscripten/math";
+import utilityModuleFactoryFn from "../../../src/modules/utility/emscripten/utility";
+
+describe("Test Emscripten module cache", () => {
+  // the cache is bypassed without error if the binary is not found, so a change to the build of the modules must fail here
+  test("The wasm binary embedded in each library module is found", () => {
+    for (const factory of [mathModuleFactoryFn, utilityModuleFactoryFn]) {
+      const binary = getEmbeddedWasmBinary(factory);
+      expect(binary).not.toBeNull();
+      expect(WebAssembly.validate(binary as Uint8Array)).toBe(true);
+    }
+  });
+
+  test("The embedded binary is compiled once and instantiated for each instance", async () => {
+    // stands in for an Emscripten factory, which embeds the binary of an empty wasm module
+    const factory = async (moduleArg: {
+      instantiateWasm: (
+        imports: WebAssembly.Imports,
+        receiveInstance: (
+          instance: WebAssembly.Instance,
+          module: WebAssembly.Module,
+        ) => void,
+      ) => void;
+    }) => {
+      const wasmBinaryFile =
+        "data:application/octet-stream;base64,AGFzbQEAAAA=";
+      const { instance, module } = await new Promise<{
+        instance: WebAssembly.Instance;
+        module: WebAssembly.Module;
+      }>((resolve) =>
+        moduleArg.instantiateWasm({}, (instance, module) =>
+          resolve({ instance, module }),
+        ),
+      );
+      return { instance, module, wasmBinaryFile };
+    };
+    const first = await instantiateEmscriptenModule(factory);
+    const second = await instantiateEmscriptenModule(factory);
+    expect(first.instance).not.toBe(second.instance);
+    expect(first.module).toBe(second.module);
+  });
+
+  test("Factories without an embedded binary are called as is", async () => {
+    const instance = { _answer: () => 42 };
+    const factory = async () => instance;
+    expect(getEmbeddedWasmBinary(factory)).toBeNull();
+    expect(await instantiateEmscriptenModule(factory)).toBe(instance);
+  });
+});
@@ -0,0 +1,161 @@
+import { describe, expect, test } from "@jest/globals";
+import FilterPipeline, {
+  FilterWorkerRequest,
+  FilterWorkerResponse,
+  PipelineWorker,
+} from "../../../src/modules/pix_and_flix/filterPipeline";
+
+/**
+ * A stand-in for the filter worker, which records the requests it receives and lets the test send the responses.
+ */
+class FakeWorker implements PipelineWorker {
+  requests: FilterWorkerRequest[] = [];
+  handler: (message: FilterWorkerResponse) => void = () => {};
+  failureHandler: (message: string) => void = () => {};
+  terminated = false;
+
+  postMessage(message: FilterWorkerRequest) {
+    this.requests.push(message);
+    if (message.type === "init") {
+      // respond once the pipeline is waiting for the worker to be ready
+      Promise.resolve().then(() => this.handler({ type: "ready" }));
+    }
+  }
+
+  setMessageHandler(handler: (message: FilterWorkerResponse) => void) {
+    this.handler = handler;
+  }
+
+  setFailureHandler(handler: (message: string) => void) {
+    this.failureHandler = handler;
+  }
+
+  terminate() {
+    this.terminated = true;
+  }
+
+  frameRequests() {
+    return this.requests.filter(
+      (request) => request.type === "frame",
+    ) as Extract<FilterWorkerRequest, { type: "frame" }>[];
+  }
+}
+
+const program = {
+  wasm: new Uint8Array(0),
+  dataSegmentSize: 0,
+  functionTableSize: 0,
+  importedModules: [],
+};
+
+describe("Test pix_n_flix filter pipeline", () => {
+  test("Frames are dropped when all slots are in use", async () => {
+    const worker = new FakeWorker();
+    const dropped: number[] = [];
+    const pipeline = await FilterPipeline.start(worker, program, {
+      height: 1,
+      width: 2,
+      onFrameDropped: (sequence) => dropped.push(sequence),
+    });
+    const frame = new Uint8ClampedArray(8);
+    expect(pipeline.submitFrame(frame)).toBe(true);
+    expect(pipeline.submitFrame(frame)).toBe(true);
+    expect(pipeline.submitFrame(frame)).toBe(false);
+    expect(dropped).toEqual([2]);
+    expect(pipeline.getTelemetry().queueDepth).toBe(2);
+    expect(worker.frameRequests().length).toBe(2);
+  });
+
+  test("Filtered frames update telemetry and free their slot", async () => {
+    const worker = new FakeWorker();
+    const filteredFrames: number[][] = [];
+    const pipeline = await FilterPipeline.start(worker, program, {
+      height: 1,
+      width: 1,
+      fps: 50,
+      onFrame: (frame) => filteredFrames.push(Array.from(frame)),
+    });
+    pipeline.submitFrame([1, 2, 3, 4]);
+    pipeline.submitFrame([5, 6, 7, 8]);
+    const [first, second] = worker.frameRequests();
+    expect(first.budgetMs).toBe(20);
+
+    // the worker filters the first frame, and drops the second
+    const init = worker.requests[0] as Extract<
+      FilterWorkerRequest,
+      { type: "init" }
+    >;
+    new Uint8ClampedArray(init.slots[first.slot], 4, 4).set([9, 9, 9, 9]);
+    worker.handler({
+      type: "frameDone",
+      slot: first.slot,
+      sequence: first.sequence,
+      filterTimeMs: 4,
+    });
+    worker.handler({
+      type: "frameDropped",
+      slot: second.slot,
+      sequence: second.sequence,
+    });
+    await pipeline.whenIdle();
+
+    expect(filteredFrames).toEqual([[9, 9, 9, 9]]);
+    const telemetry = pipeline.getTelemetry();
+    expect(telemetry.framesSubmitted).toBe(2);
+    expect(telemetry.framesFiltered).toBe(1);
+    expect(telemetry.framesDropped).toBe(1);
+    expect(telemetry.queueDepth).toBe(0);
+    expect(telemetry.averageFilterTimeMs).toBe(4);
+
+    // both slots can be used again
+    expect(pipeline.submitFrame([0, 0, 0, 0])).toBe(true);
+    expect(pipeline.submitFrame([0, 0, 0, 0])).toBe(true);
+  });
+
+  test("set_fps in the program changes the frame budget", async () => {
+    const worker = new FakeWorker();
+    const pipeline = await FilterPipeline.start(worker, program, {
+      height: 1,
+      width: 1,
+    });
+    worker.handler({ type: "setFps", fps: 10 });
+    expect(pipeline.getTelemetry().frameBudgetMs).toBe(100);
+  });
+
+  test("Worker errors are reported to the host", async () => {
+    const worker = new FakeWorker();
+    const pipeline = await FilterPipeline.start(worker, program, {
+      height: 1,
+      width: 1,
+    });
+    pipeline.submitFrame([0, 0, 0, 0]);
+    const idle = pipeline.whenIdle();
+    worker.handler({ type: "error", message: "trap" });
+    await expect(idle).rejects.toThrow("trap");
+    expect(() => pipeline.submitFrame([0, 0, 0, 0])).toThrow("trap");
+    pipeline.stop();
+    expect(worker.terminated).toBe(true);
+  });
+
+  test("Workers that fail without responding fail the pipeline, unless it was stopped", async () => {
+    const worker = new FakeWorker();
+    const pipeline = await FilterPipeline.start(worker, program, {
+      height: 1,
+      width: 1,
+    });
+    pipeline.submitFrame([0, 0, 0, 0]);
+    const idle = pipeline.whenIdle();
+    worker.failureHandler("worker exited with code 1");
+    await expect(idle).rejects.toThrow("worker exited with code 1");
+
+    const stoppedWorker = new FakeWorker();
+    const stoppedPipeline = await FilterPipeline.start(stoppedWorker, program, {
+      height: 1,
+      width: 1,
+    });
+    stoppedPipeline.stop();
+    // terminating a Node.js worker makes it exit
+    stoppedWorker.failureHandler("worker exited with code 1");
+    await stoppedPipeline.whenIdle(); // does not reject
+  });
+});
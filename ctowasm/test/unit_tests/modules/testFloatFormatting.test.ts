@@ -0,0 +1,47 @@
+import { describe, expect, test } from "@jest/globals";
+import {
+  formatFloatExponential,
+  formatFloatFixed,
+  formatFloatGeneral,
+} from "../../../src/modules/floatFormatting";
+import { convertFloatToCStyleString } from "../../../src/modules/util";
+import floatFormattingCases from "./floatFormattingCases";
+
+const formatters: Record<string, (value: number, precision: number) => string> =
+  {
+    f: formatFloatFixed,
+    e: formatFloatExponential,
+    g: formatFloatGeneral,
+  };
+
+function doubleFromHexBits(hexBits: string) {
+  const view = new DataView(new ArrayBuffer(8));
+  view.setBigUint64(0, BigInt("0x" + hexBits));
+  return view.getFloat64(0);
+}
+
+describe("Test float formatting against glibc printf output", () => {
+  test.each(floatFormattingCases)(
+    "%%.%i%s of double with bits 0x%s",
+    (conversion, precision, hexBits, expected) => {
+      expect(
+        formatters[conversion](doubleFromHexBits(hexBits), precision),
+      ).toBe(expected);
+    },
+  );
+});
+
+describe("Test convertFloatToCStyleString() function", () => {
+  test("Test 1 - rounds ties to even", () => {
+    expect(convertFloatToCStyleString(0.0078125)).toBe("0.007812");
+  });
+  test("Test 2 - negative values and negative zero", () => {
+    expect(convertFloatToCStyleString(-2.5)).toBe("-2.500000");
+    expect(convertFloatToCStyleString(-0)).toBe("-0.000000");
+  });
+  test("Test 3 - non finite values", () => {
+    expect(convertFloatToCStyleString(Infinity)).toBe("inf");
+    expect(convertFloatToCStyleString(-Infinity)).toBe("-inf");
+    expect(convertFloatToCStyleString(NaN)).toBe("nan");
+  });
+});
@@ -0,0 +1,70 @@
+import { describe, expect, test } from "@jest/globals";
+import FrameBuffers from "../../../src/modules/pix_and_flix/frameBuffers";
+
+/**
+ * Creates frame buffers backed by a simple bump allocator, recording all allocations and frees.
+ */
+function createFrameBuffers(memory: WebAssembly.Memory) {
+  const allocations: number[] = [];
+  const frees: number[] = [];
+  let nextAddress = 16;
+  const frameBuffers = new FrameBuffers(
+    memory,
+    (numBytes) => {
+      const address = nextAddress;
+      nextAddress += numBytes;
+      allocations.push(address);
+      return address;
+    },
+    (address) => frees.push(address),
+  );
+  return { frameBuffers, allocations, frees };
+}
+
+describe("Test pix_n_flix frame buffers", () => {
+  test("Buffers are only allocated once per resolution", () => {
+    const memory = new WebAssembly.Memory({ initial: 1 });
+    const { frameBuffers, allocations, frees } = createFrameBuffers(memory);
+    expect(frameBuffers.ensureResolution(2, 3)).toBe(true);
+    expect(frameBuffers.ensureResolution(2, 3)).toBe(false);
+    expect(allocations).toEqual([16]);
+    expect(frameBuffers.destAddress).toBe(16 + 2 * 3 * 4);
+
+    expect(frameBuffers.ensureResolution(4, 3)).toBe(true);
+    expect(frees).toEqual([16]);
+    expect(allocations.length).toBe(2);
+  });
+
+  test("Views alias the frames in memory", () => {
+    const memory = new WebAssembly.Memory({ initial: 1 });
+    const { frameBuffers } = createFrameBuffers(memory);
+    frameBuffers.ensureResolution(1, 2);
+    const { src, dest } = frameBuffers.getViews();
+    expect(src.length).toBe(8);
+    src.set([1, 2, 3, 4, 5, 6, 7, 300]);
+    const bytes = new Uint8Array(memory.buffer);
+    expect(bytes[frameBuffers.srcAddress + 7]).toBe(255); // clamped
+    bytes[frameBuffers.destAddress] = 42;
+    expect(dest[0]).toBe(42);
+    expect(frameBuffers.getViews().src).toBe(src); // views are reused
+  });
+
+  test("Views are recreated after memory grows", () => {
+    const memory = new WebAssembly.Memory({ initial: 1 });
+    const { frameBuffers } = createFrameBuffers(memory);
+    frameBuffers.ensureResolution(1, 1);
+    const oldViews = frameBuffers.getViews();
+    oldViews.src[0] = 7;
+    memory.grow(1);
+    const newViews = frameBuffers.getViews();
+    expect(newViews.src).not.toBe(oldViews.src);
+    expect(newViews.src[0]).toBe(7);
+  });
+
+  test("Getting views before allocation throws", () => {
+    const memory = new WebAssembly.Memory({ initial: 1 });
+    const { frameBuffers } = createFrameBuffers(memory);
+    expect(() => frameBuffers.getViews()).toThrow();
+    expect(() => frameBuffers.ensureResolution(0, 10)).toThrow();
+  });
+});
@@ -0,0 +1,160 @@
+import { describe, expect, test } from "@jest/globals";
+import HeapTracker, {
+  HeapLeak,
+} from "../../../src/modules/source_stdlib/heapStats";
+import instrumentAllocationSites, {
+  ALLOCATION_SITE_GLOBAL,
+} from "../../../src/translator/allocationSites";
+import {
+  createModule,
+  createPosition,
+  createStdlibHeap,
+} from "../fixtures";
+
+describe("Test heap statistics", () => {
+  test("Live, peak and total bytes are kept", async () => {
+    const { moduleRepository, malloc, free } = await createStdlibHeap();
+    const first = malloc(16);
+    const second = malloc(100);
+    free(first);
+    malloc(8);
+    const stats = moduleRepository.getHeapStats();
+    expect(stats).toMatchObject({
+      liveBytes: 108,
+      liveBlocks: 2,
+      peakLiveBytes: 116,
+      numberOfAllocations: 3,
+      numberOfFrees: 1,
+      totalBytesAllocated: 124,
+      heapSize: 116,
+    });
+    expect(stats.sizeHistogram).toEqual([
+      { maxSize: 8, count: 1 },
+      { maxSize: 16, count: 1 },
+      { maxSize: 128, count: 1 },
+    ]);
+    expect(moduleRepository.getHeapLeaks()).toEqual([
+      { address: second, size: 100, allocationSite: -1 },
+      { address: first, size: 8, allocationSite: -1 },
+    ]);
+  });
+
+  test("Blocks of zero bytes have their own address", async () => {
+    const { moduleRepository, malloc, free } = await createStdlibHeap();
+    const first = malloc(0);
+    const second = malloc(0);
+    const third = malloc(4);
+    expect(new Set([first, second, third]).size).toBe(3);
+    expect(moduleRepository.getHeapStats()).toMatchObject({
+      liveBytes: 4,
+      liveBlocks: 3,
+    });
+    free(first);
+    expect(moduleRepository.getHeapLeaks()).toEqual([
+      { address: third, size: 4, allocationSite: -1 },
+      { address: second, size: 0, allocationSite: -1 },
+    ]);
+    free(second);
+    free(third);
+    expect(moduleRepository.getHeapStats()).toMatchObject({
+      liveBytes: 0,
+      liveBlocks: 0,
+      numberOfFrees: 3,
+    });
+  });
+
+  test("Free list length and fragmentation are computed from the free list", () => {
+    const heapTracker = new HeapTracker();
+    expect(heapTracker.getStats([], 0).fragmentation).toBe(0);
+    const stats = heapTracker.getStats(
+      [
+        { address: 0, size: 30 },
+        { address: 100, size: 10 },
+      ],
+      200,
+    );
+    expect(stats).toMatchObject({
+      freeListLength: 2,
+      freeBytes: 40,
+      largestFreeBlock: 30,
+      fragmentation: 0.25,
+    });
+  });
+
+  test("Events are logged with the allocation site of each call", async () => {
+    const { moduleRepository, malloc, free } = await createStdlibHeap({
+      heapEventLog: true,
+    });
+    const address = malloc(4, 0);
+    free(address, 1);
+    const otherAddress = malloc(12); // the site of the previous call is not reused
+    expect(moduleRepository.getHeapEvents()).toEqual([
+      { type: "malloc", address, size: 4, allocationSite: 0 },
+      { type: "free", address, size: 4, allocationSite: 1 },
+      { type: "malloc", address: otherAddress, size: 12, allocationSite: -1 },
+    ]);
+  });
+
+  test("Leaks are reported when the program exits", async () => {
+    const reports: HeapLeak[][] = [];
+    const { moduleRepository, malloc, free } = await createStdlibHeap({
+      onHeapLeaks: (leaks) => reports.push(leaks),
+    });
+    const address = malloc(4);
+    free(address);
+    moduleRepository.reportHeapLeaks();
+    expect(reports).toEqual([]); // not called if all the blocks were freed
+
+    const leaked = malloc(24, 2);
+    moduleRepository.reportHeapLeaks();
+    expect(reports).toEqual([
+      [{ address: leaked, size: 24, allocationSite: 2 }],
+    ]);
+  });
+});
+
+describe("Test allocation site instrumentation", () => {
+  test("The call site is set before each call of malloc and free", () => {
+    const call = (name: string) => ({
+      type: "FunctionCall" as const,
+      name,
+      stackFrameSetup: [],
+      stackFrameTearDown: [],
+    });
+    const wasmModule = createModule([
+      { ...call("malloc"), position: createPosition(2) },
+      { ...call("print_int"), position: createPosition(3) },
+      {
+        type: "Loop",
+        label: "loop",
+        body: [{ ...call("free"), position: createPosition(5) }],
+        position: createPosition(4),
+      },
+    ]);
+    const positions = instrumentAllocationSites(wasmModule);
+    expect(positions).toEqual([createPosition(2), createPosition(5)]);
+    expect(wasmModule.importedGlobalWasmVariables).toEqual([
+      {
+        type: "ImportedGlobalVariable",
+        name: ALLOCATION_SITE_GLOBAL,
+        wasmDataType: "i32",
+      },
+    ]);
+    expect(wasmModule.functions.main.body).toMatchObject([
+      { type: "GlobalSet", name: ALLOCATION_SITE_GLOBAL, value: { value: 0n } },
+      { name: "malloc" },
+      { name: "print_int" },
+      {
+        type: "Loop",
+        body: [
+          {
+            type: "GlobalSet",
+            name: ALLOCATION_SITE_GLOBAL,
+            value: { value: 1n },
+          },
+          { name: "free" },
+        ],
+      },
+    ]);
+  });
+});
@@ -0,0 +1,47 @@
+import { describe, expect, test } from "@jest/globals";
+import OutputBuffer from "../../../src/modules/outputBuffer";
+
+function createBuffer(mode: "line" | "full", capacity: number) {
+  const printed: string[] = [];
+  const buffer = new OutputBuffer((str) => printed.push(str), mode, capacity);
+  return { buffer, printed };
+}
+
+describe("Test output buffer", () => {
+  test("Line buffered output is printed a line at a time", () => {
+    const { buffer, printed } = createBuffer("line", 64);
+    buffer.write("1");
+    buffer.write("2\n3");
+    expect(printed).toEqual(["12"]);
+    buffer.write("\n");
+    expect(printed).toEqual(["12", "3"]);
+  });
+
+  test("Full buffers only print complete lines", () => {
+    const { buffer, printed } = createBuffer("full", 8);
+    buffer.write("ab\n");
+    buffer.write("cdef");
+    expect(printed).toEqual([]);
+    buffer.write("gh");
+    expect(printed).toEqual(["ab"]);
+    buffer.write("\nij");
+    expect(printed).toEqual(["ab", "cdefgh"]);
+    buffer.flush();
+    expect(printed).toEqual(["ab", "cdefgh", "ij"]);
+  });
+
+  test("Lines longer than the capacity are kept until completed or flushed", () => {
+    for (const mode of ["line", "full"] as const) {
+      const { buffer, printed } = createBuffer(mode, 4);
+      for (const digit of "123456789") {
+        buffer.write(digit);
+      }
+      expect(printed).toEqual([]);
+      buffer.write("\n");
+      expect(printed).toEqual(["123456789"]);
+      buffer.write("abcdef");
+      buffer.flush();
+      expect(printed).toEqual(["123456789", "abcdef"]);
+    }
+  });
+});
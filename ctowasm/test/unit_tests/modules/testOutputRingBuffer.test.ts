@@ -0,0 +1,62 @@
+import { describe, expect, test } from "@jest/globals";
+import {
+  OutputRingBufferReader,
+  OutputRingBufferWriter,
+  createOutputRingBuffer,
+} from "../../../src/modules/outputRingBuffer";
+
+describe("Test output ring buffer", () => {
+  test("Strings are read in the order they were written", () => {
+    const buffer = createOutputRingBuffer(64);
+    const writer = new OutputRingBufferWriter(buffer);
+    const reader = new OutputRingBufferReader(buffer);
+    expect(reader.read()).toEqual([]);
+    writer.write("hello");
+    writer.write("");
+    writer.write("world");
+    expect(reader.read()).toEqual(["hello", "", "world"]);
+    expect(reader.read()).toEqual([]);
+  });
+
+  test("Records wrap around the end of the buffer", () => {
+    const buffer = createOutputRingBuffer(16);
+    const writer = new OutputRingBufferWriter(buffer);
+    const reader = new OutputRingBufferReader(buffer);
+    const strings: string[] = [];
+    for (let i = 0; i < 20; ++i) {
+      writer.write(`line ${i}`);
+      strings.push(...reader.read());
+    }
+    expect(strings).toEqual(
+      Array.from({ length: 20 }, (_, i) => `line ${i}`),
+    );
+  });
+
+  test("The buffer can be filled up to one byte short of its size", () => {
+    const buffer = createOutputRingBuffer(12);
+    const writer = new OutputRingBufferWriter(buffer);
+    const reader = new OutputRingBufferReader(buffer);
+    writer.write("héllo"); // a 10 byte record, as "é" takes 2 bytes of UTF-8
+    expect(reader.read()).toEqual(["héllo"]);
+    writer.write("ab");
+    writer.write("c"); // fills the buffer
+    expect(reader.read()).toEqual(["ab", "c"]);
+  });
+
+  test("Strings whose last record has not been written are only read when asked for", () => {
+    const buffer = createOutputRingBuffer(16);
+    const reader = new OutputRingBufferReader(buffer);
+    // write the first record of a string that continues by hand, as the writer would block on the rest
+    const offsets = new Int32Array(buffer, 0, 3);
+    const data = new Uint8Array(buffer, 12);
+    data.set([3, 0, 0, 0x80], 0);
+    data.set(new TextEncoder().encode("abc"), 4);
+    Atomics.store(offsets, 0, 7);
+    expect(reader.read()).toEqual([]);
+    expect(reader.read(true)).toEqual(["abc"]);
+  });
+
+  test("Too small buffers are rejected", () => {
+    expect(() => createOutputRingBuffer(4)).toThrow();
+  });
+});
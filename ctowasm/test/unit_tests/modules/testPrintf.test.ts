@@ -0,0 +1,71 @@
+import { describe, expect, test } from "@jest/globals";
+import ModuleRepository from "../../../src/modules";
+import { getUtf8ByteLength } from "../../../src/modules/util";
+
+const FORMAT_ADDRESS = 0;
+const VAR_ARGS_ADDRESS = 512; // the args are placed below this address
+const STRINGS_ADDRESS = 1024;
+
+/**
+ * Returns the printf of the standard library, called with the given format and int args, and the output it printed.
+ */
+async function setUpPrintf() {
+  const output: string[] = [];
+  const memory = new WebAssembly.Memory({ initial: 1 });
+  const moduleRepository = new ModuleRepository(memory, undefined, {
+    printFunction: (str) => output.push(str),
+  });
+  const imports = await moduleRepository.createWasmImportsObject([
+    "source_stdlib",
+  ]);
+  const bytes = new Uint8Array(memory.buffer);
+  const view = new DataView(memory.buffer);
+  const printf = (format: string, args: number[] = []) => {
+    bytes.set(new TextEncoder().encode(format + "\0"), FORMAT_ADDRESS);
+    args.forEach((arg, i) =>
+      view.setInt32(VAR_ARGS_ADDRESS - 4 * (i + 1), arg, true),
+    );
+    const written = (
+      imports.source_stdlib.printf as (
+        formatAddress: number,
+        varArgsAddress: number,
+      ) => number
+    )(FORMAT_ADDRESS, VAR_ARGS_ADDRESS);
+    moduleRepository.flushStdout();
+    return written;
+  };
+  return { printf, output, bytes };
+}
+
+describe("Test printf", () => {
+  test("The number of bytes written is returned", async () => {
+    const { printf, output, bytes } = await setUpPrintf();
+    expect(printf("%d items\n", [12])).toBe(9);
+    bytes.set(new TextEncoder().encode("日本\0"), STRINGS_ADDRESS);
+    // 2 characters of 3 bytes each, and an emoji of 4 bytes (2 UTF-16 code units)
+    expect(printf("%s😀", [STRINGS_ADDRESS])).toBe(10);
+    expect(output).toEqual(["12 items", "日本😀"]);
+  });
+
+  test("Multi-byte characters can be printed one byte at a time with %c", async () => {
+    const { printf, output } = await setUpPrintf();
+    const [first, second, third] = new TextEncoder().encode("日");
+    // the args are read downwards from VAR_ARGS_ADDRESS
+    printf("%c%c%c!\n", [first, second, third]);
+    expect(output).toEqual(["日!"]);
+  });
+
+  test("%s widths and precisions count bytes", async () => {
+    const { printf, output, bytes } = await setUpPrintf();
+    bytes.set(new TextEncoder().encode("é日\0"), STRINGS_ADDRESS);
+    expect(printf("[%.5s]\n", [STRINGS_ADDRESS])).toBe(8);
+    expect(printf("[%6s]\n", [STRINGS_ADDRESS])).toBe(9);
+    expect(output).toEqual(["[é日]", "[ é日]"]);
+  });
+
+  test("UTF-8 byte lengths are counted without encoding", () => {
+    for (const str of ["", "abc", "é", "€", "😀", "a\u{10ffff}b", "\ud800"]) {
+      expect(getUtf8ByteLength(str)).toBe(new TextEncoder().encode(str).length);
+    }
+  });
+});
@@ -0,0 +1,98 @@
+import { describe, expect, test } from "@jest/globals";
+import SharedHeap from "../../../src/modules/pthread/sharedHeap";
+import {
+  THREAD_STACK_SIZE,
+  allocateThread,
+  failThread,
+  finishThread,
+  joinThread,
+} from "../../../src/modules/pthread/threadControl";
+import { WASM_PAGE_SIZE } from "../../../src/translator/memoryUtil";
+import { HEAP_ADDRESS, createSharedHeap } from "../fixtures";
+
+describe("Test shared heap", () => {
+  test("Blocks are 8 byte aligned and do not overlap", () => {
+    const heap = createSharedHeap();
+    const first = heap.malloc(3);
+    const second = heap.malloc(20);
+    const third = heap.malloc(8);
+    for (const address of [first, second, third]) {
+      expect(address % 8).toBe(0);
+      expect(address).toBeGreaterThan(HEAP_ADDRESS);
+    }
+    expect(second).toBeGreaterThanOrEqual(first + 8);
+    expect(third).toBeGreaterThanOrEqual(second + 24);
+    expect(heap.getHeapEnd()).toBeGreaterThanOrEqual(third + 8);
+  });
+
+  test("Freed blocks are reused and split", () => {
+    const heap = createSharedHeap();
+    const large = heap.malloc(64);
+    heap.malloc(8); // stops the large block from being at the end of the heap
+    const heapEnd = heap.getHeapEnd();
+    heap.free(large);
+    const small = heap.malloc(16);
+    expect(small).toBe(large);
+    const rest = heap.malloc(32);
+    expect(rest).toBeGreaterThan(small);
+    expect(rest).toBeLessThan(large + 64);
+    expect(heap.getHeapEnd()).toBe(heapEnd);
+  });
+
+  test("Memory grows as needed, and malloc returns 0 when it is full", () => {
+    const heap = createSharedHeap(4);
+    const address = heap.malloc(2 * WASM_PAGE_SIZE);
+    expect(address).not.toBe(0);
+    expect(heap.memory.buffer.byteLength).toBe(3 * WASM_PAGE_SIZE);
+    expect(heap.malloc(2 * WASM_PAGE_SIZE)).toBe(0);
+  });
+
+  test("Freeing an address that is not allocated throws", () => {
+    const heap = createSharedHeap();
+    const address = heap.malloc(8);
+    heap.free(0); // does nothing
+    expect(() => heap.free(address + 8)).toThrow(
+      "free(): No allocated block with given address",
+    );
+    heap.free(address);
+    expect(() => heap.free(address)).toThrow(
+      "free(): No allocated block with given address",
+    );
+  });
+
+  test("Heaps can be shared through the address of their control block", () => {
+    const heap = createSharedHeap();
+    const address = heap.malloc(8);
+    const otherHeap = new SharedHeap(heap.memory, HEAP_ADDRESS);
+    otherHeap.free(address);
+    expect(heap.malloc(8)).toBe(address);
+  });
+});
+
+describe("Test thread control blocks", () => {
+  test("Threads get their own stack", () => {
+    const heap = createSharedHeap();
+    const first = allocateThread(heap)!;
+    const second = allocateThread(heap)!;
+    expect(first.stackTop - first.stackBase).toBe(THREAD_STACK_SIZE);
+    expect(first.stackBase).toBeGreaterThan(first.id);
+    expect(second.id).toBeGreaterThanOrEqual(first.stackTop);
+  });
+
+  test("Joining a finished thread returns its return value and frees it", () => {
+    const heap = createSharedHeap();
+    const thread = allocateThread(heap)!;
+    finishThread(heap.memory, thread.id, 1234);
+    expect(joinThread(heap, thread.id)).toBe(1234);
+    expect(allocateThread(heap)!.id).toBe(thread.id);
+  });
+
+  test("Joining a thread that ended with an error throws", () => {
+    const heap = createSharedHeap();
+    const thread = allocateThread(heap)!;
+    failThread(heap.memory, thread.id);
+    expect(() => joinThread(heap, thread.id)).toThrow(
+      `pthread_join(): thread ${thread.id} ended with an error`,
+    );
+  });
+});
@@ -0,0 +1,74 @@
+import { describe, expect, test } from "@jest/globals";
+import { getFunctionPtrTrampoline } from "../../../src/modules/stackFrameUtils";
+
+const PAGE_SIZE = 65536;
+
+/**
+ * Creates the state of a program whose function table holds the given functions, which stand in for compiled
+ * C functions and access their stack frame the same way (relative to the base pointer).
+ */
+function createCallContext(
+  functions: ((view: DataView, basePointer: number) => void)[],
+) {
+  const memory = new WebAssembly.Memory({ initial: 1 });
+  const global = (value: number) =>
+    new WebAssembly.Global({ value: "i32", mutable: true }, value);
+  const sharedWasmGlobalVariables = {
+    stackPointer: global(PAGE_SIZE),
+    basePointer: global(PAGE_SIZE),
+    heapPointer: global(0),
+  };
+  const functionTable = {
+    get: (index: number) => () =>
+      functions[index](
+        new DataView(memory.buffer),
+        sharedWasmGlobalVariables.basePointer.value,
+      ),
+  } as unknown as WebAssembly.Table;
+  return { memory, functionTable, sharedWasmGlobalVariables };
+}
+
+describe("Test function pointer trampolines", () => {
+  test("Params are passed below the base pointer and returns read above it", () => {
+    // long f(int a, double b, char c)
+    const context = createCallContext([
+      (view, bp) => {
+        const a = view.getInt32(bp - 4, true);
+        const b = view.getFloat64(bp - 12, true);
+        const c = view.getInt8(bp - 13);
+        view.setBigInt64(bp + 4, BigInt(a * 100 + b * 10 + c), true);
+      },
+    ]);
+    const trampoline = getFunctionPtrTrampoline(
+      ["signed int", "double", "signed char"],
+      ["signed long"],
+    );
+    expect(trampoline(context, 0, [3, 2, -1])).toEqual([319n]);
+    // the stack frame is torn down
+    expect(context.sharedWasmGlobalVariables.stackPointer.value).toBe(
+      PAGE_SIZE,
+    );
+    expect(context.sharedWasmGlobalVariables.basePointer.value).toBe(
+      PAGE_SIZE,
+    );
+  });
+
+  test("Trampolines are cached per signature", () => {
+    expect(
+      getFunctionPtrTrampoline(["pointer", "pointer"], ["signed int"]),
+    ).toBe(getFunctionPtrTrampoline(["pointer", "pointer"], ["signed int"]));
+    expect(getFunctionPtrTrampoline(["pointer"], ["signed int"])).not.toBe(
+      getFunctionPtrTrampoline(["pointer", "pointer"], ["signed int"]),
+    );
+  });
+
+  test("Pointers and unsigned values are passed in full", () => {
+    const context = createCallContext([
+      (view, bp) => {
+        view.setUint32(bp + 4, view.getUint32(bp - 4, true) + 1, true);
+      },
+    ]);
+    const trampoline = getFunctionPtrTrampoline(["pointer"], ["pointer"]);
+    expect(trampoline(context, 0, [0x12345])).toEqual([0x12346]);
+  });
+});
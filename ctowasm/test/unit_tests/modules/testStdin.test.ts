@@ -0,0 +1,118 @@
+import { describe, expect, test } from "@jest/globals";
+import {
+  EOF,
+  getStdinBytes,
+  scanFormattedInput,
+} from "../../../src/modules/source_stdlib/stdin";
+import { SharedWasmGlobalVariables } from "../../../src/modules";
+
+const FORMAT_ADDRESS = 0;
+const VAR_ARGS_ADDRESS = 256; // the pointer args are placed below this address
+const STDIN_ADDRESS = 1024;
+const RESULTS_ADDRESS = 4096; // each pointer arg points 8 bytes further from here
+
+function createGlobal(value: number) {
+  return new WebAssembly.Global({ value: "i32", mutable: true }, value);
+}
+
+/**
+ * Sets up memory holding the given input. The returned scanf is called with the given number of pointer args, pointing
+ * to the addresses given by result().
+ */
+function setUpScanf(input: string) {
+  const memory = new WebAssembly.Memory({ initial: 1 });
+  const bytes = new Uint8Array(memory.buffer);
+  const stdinBytes = getStdinBytes(input);
+  bytes.set(stdinBytes, STDIN_ADDRESS);
+  const globals: SharedWasmGlobalVariables = {
+    stackPointer: createGlobal(0),
+    basePointer: createGlobal(0),
+    heapPointer: createGlobal(0),
+    stdinPosition: createGlobal(STDIN_ADDRESS),
+    stdinEnd: createGlobal(STDIN_ADDRESS + stdinBytes.length),
+    allocationSite: createGlobal(-1),
+  };
+  const view = new DataView(memory.buffer);
+  const scanf = (format: string, numberOfArgs: number) => {
+    bytes.set(new TextEncoder().encode(format + "\0"), FORMAT_ADDRESS);
+    for (let i = 0; i < numberOfArgs; ++i) {
+      view.setUint32(
+        VAR_ARGS_ADDRESS - 4 * (i + 1),
+        RESULTS_ADDRESS + 8 * i,
+        true,
+      );
+    }
+    return scanFormattedInput(
+      memory,
+      globals,
+      FORMAT_ADDRESS,
+      VAR_ARGS_ADDRESS,
+    );
+  };
+  const result = (i: number) => RESULTS_ADDRESS + 8 * i;
+  return { scanf, view, bytes, globals, result };
+}
+
+describe("Test reading of stdin", () => {
+  test("Integers are read skipping whitespace", () => {
+    const { scanf, view, result } = setUpScanf("  42\n-7 +3 0x1f 017");
+    expect(scanf("%d %d%d", 3)).toBe(3);
+    expect(view.getInt32(result(0), true)).toBe(42);
+    expect(view.getInt32(result(1), true)).toBe(-7);
+    expect(view.getInt32(result(2), true)).toBe(3);
+    expect(scanf("%i %i", 2)).toBe(2);
+    expect(view.getInt32(result(0), true)).toBe(31);
+    expect(view.getInt32(result(1), true)).toBe(15);
+    expect(scanf("%d", 1)).toBe(EOF);
+  });
+
+  test("Length modifiers and widths are followed", () => {
+    const { scanf, view, result } = setUpScanf("9000000000 123456 300");
+    expect(scanf("%ld %3d%d %hhd", 4)).toBe(4);
+    expect(view.getBigInt64(result(0), true)).toBe(9000000000n);
+    expect(view.getInt32(result(1), true)).toBe(123);
+    expect(view.getInt32(result(2), true)).toBe(456);
+    expect(view.getInt8(result(3))).toBe(44); // 300 wraps around
+  });
+
+  test("Floats are read", () => {
+    const { scanf, view, result } = setUpScanf("3.5 -1e3 2.5e inf");
+    expect(scanf("%f %lf %lf", 3)).toBe(3);
+    expect(view.getFloat32(result(0), true)).toBe(3.5);
+    expect(view.getFloat64(result(1), true)).toBe(-1000);
+    expect(view.getFloat64(result(2), true)).toBe(2.5);
+    expect(scanf("%lf", 1)).toBe(1);
+    expect(view.getFloat64(result(0), true)).toBe(Infinity);
+  });
+
+  test("Strings and characters are read", () => {
+    const { scanf, bytes, result } = setUpScanf("hello world! x");
+    expect(scanf("%s%c%3s", 3)).toBe(3);
+    const readString = (address: number) =>
+      new TextDecoder().decode(
+        bytes.subarray(address, bytes.indexOf(0, address)),
+      );
+    expect(readString(result(0))).toBe("hello");
+    expect(bytes[result(1)]).toBe(" ".charCodeAt(0));
+    expect(readString(result(2))).toBe("wor");
+    expect(scanf("%*s %c", 1)).toBe(1);
+    expect(bytes[result(0)]).toBe("x".charCodeAt(0));
+  });
+
+  test("Reading stops at a matching failure, leaving the input unread", () => {
+    const { scanf, view, result, globals } = setUpScanf("1,abc");
+    expect(scanf("%d,%d", 2)).toBe(1);
+    expect(view.getInt32(result(0), true)).toBe(1);
+    expect(globals.stdinPosition.value).toBe(STDIN_ADDRESS + 2);
+    expect(scanf("%d", 1)).toBe(0);
+  });
+
+  test("Literal characters and %n are matched", () => {
+    const { scanf, view, result } = setUpScanf("(1, 2) 100%");
+    expect(scanf(" (%d ,%d)%n %d%%", 4)).toBe(3);
+    expect(view.getInt32(result(0), true)).toBe(1);
+    expect(view.getInt32(result(1), true)).toBe(2);
+    expect(view.getInt32(result(2), true)).toBe(6);
+    expect(view.getInt32(result(3), true)).toBe(100);
+  });
+});
@@ -1,5 +1,32 @@
 import { describe, expect, test } from "@jest/globals";
-import { stringifyDataType } from "../../../src/processor/dataTypeUtil";
+import {
+  checkDataTypeCompatibility,
+  getDataTypeSize,
+  stringifyDataType,
+  unpackDataType,
+} from "../../../src/processor/dataTypeUtil";
+import { internDataType } from "../../../src/processor/dataTypeTable";
+import { DataType } from "../../../src/parser/c-ast/dataTypes";
+import { Expression } from "../../../src/parser/c-ast/core";
+
+function createArrayDataType(
+  elementDataType: DataType,
+  numElements: bigint,
+): DataType {
+  return {
+    type: "array",
+    elementDataType,
+    numElements: {
+      type: "IntegerConstant",
+      value: numElements,
+      suffix: null,
+      position: {
+        start: { line: 0, offset: 0, column: 0 },
+        end: { line: 0, offset: 0, column: 0 },
+      },
+    } as Expression,
+  };
+}
 
 describe("Test stringifyDataType() function", () => {
   test("Test 1 - signed int", () => {
@@ -21,3 +48,85 @@ describe("Test stringifyDataType() function", () => {
     ).toBe("const pointer to const signed int");
   });
 });
+
+describe("Test interning of data types", () => {
+  test("Structurally equal data types share a canonical node", () => {
+    const a = createArrayDataType(
+      { type: "primary", primaryDataType: "signed int" },
+      3n,
+    );
+    const b = createArrayDataType(
+      { type: "primary", primaryDataType: "signed int" },
+      3n,
+    );
+    const c = createArrayDataType(
+      { type: "primary", primaryDataType: "signed int" },
+      4n,
+    );
+    expect(internDataType(a)).toBe(internDataType(b));
+    expect(internDataType(a).id).not.toBe(internDataType(c).id);
+    expect(checkDataTypeCompatibility(a, b)).toBe(true);
+    expect(checkDataTypeCompatibility(a, c)).toBe(false);
+    expect(getDataTypeSize(b)).toBe(12);
+    expect(unpackDataType(a)).toBe(unpackDataType(b));
+  });
+
+  test("Qualifiers give distinct canonical nodes", () => {
+    const constInt: DataType = {
+      type: "primary",
+      primaryDataType: "signed int",
+      isConst: true,
+    };
+    const int: DataType = { type: "primary", primaryDataType: "signed int" };
+    expect(internDataType(constInt)).not.toBe(internDataType(int));
+    expect(checkDataTypeCompatibility(constInt, int)).toBe(false);
+    expect(checkDataTypeCompatibility(constInt, int, true)).toBe(true);
+  });
+
+  test("Pointers to incomplete arrays are interned without an array size", () => {
+    // "int (*c)[];", as in test/samples/subset4/complex_declarations.c: the declarator gives no number of elements
+    const createPointerToIncompleteArray = (): DataType => ({
+      type: "pointer",
+      pointeeType: {
+        type: "array",
+        elementDataType: { type: "primary", primaryDataType: "signed int" },
+        numElements: undefined as unknown as Expression,
+      },
+    });
+    const a = createPointerToIncompleteArray();
+    const b = createPointerToIncompleteArray();
+    const pointerToArray: DataType = {
+      type: "pointer",
+      pointeeType: createArrayDataType(
+        { type: "primary", primaryDataType: "signed int" },
+        1n,
+      ),
+    };
+    expect(internDataType(a)).toBe(internDataType(b));
+    expect(internDataType(a)).not.toBe(internDataType(pointerToArray));
+    expect(getDataTypeSize(a)).toBe(4);
+  });
+
+  test("Unpacks structs with self pointers", () => {
+    const struct: DataType = {
+      type: "struct",
+      tag: "node",
+      fields: [
+        { tag: "next", dataType: { type: "struct self pointer" } },
+        {
+          tag: "values",
+          dataType: createArrayDataType(
+            { type: "primary", primaryDataType: "signed short" },
+            2n,
+          ),
+        },
+      ],
+    };
+    expect(getDataTypeSize(struct)).toBe(8);
+    expect(unpackDataType(struct)).toEqual([
+      { dataType: "pointer", offset: 0 },
+      { dataType: "signed short", offset: 4 },
+      { dataType: "signed short", offset: 6 },
+    ]);
+  });
+});
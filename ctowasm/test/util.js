@@ -153,6 +153,7 @@ export async function testFileCompilationSuccess(testGroup, testFileName) {
         // configuration for the modules
         const modulesConfig = {
           printFunction: (str) => programOutput.push(str), // custom print function, add to the programOutput instead of print to console
+          stdin: testLog[testGroup][testFileName].stdin, // input preloaded for the program to read, if any
         };
         try {
           // if there is a expectedValues for variables in the file, check that they are equal
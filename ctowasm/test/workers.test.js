@@ -0,0 +1,305 @@
+/**
+ * Runs programs in real worker threads, through the worker scripts used by cmd.js.
+ * The worker scripts import the built package, so these tests need the package to be built first.
+ *
+ * The programs are written in WAT rather than C, so that these tests only depend on the worker side of the runtime,
+ * except for the threaded programs, which are compiled with the threads option.
+ */
+import { Worker } from "node:worker_threads";
+import wabt from "wabt";
+import {
+  FilterPipeline,
+  WorkerRun,
+  compile,
+  fromNodeWorker,
+} from "../dist/index.js";
+
+const WASM_FEATURES = { threads: true, bulk_memory: true };
+
+async function assemble(wat) {
+  const wasmModule = (await wabt()).parseWat("program.wat", wat, WASM_FEATURES);
+  try {
+    return wasmModule.toBinary({}).buffer;
+  } finally {
+    wasmModule.destroy();
+  }
+}
+
+function startWorker(script) {
+  return new Worker(new URL(`../${script}`, import.meta.url));
+}
+
+// installs a filter that inverts every channel, called as filter(src, dest, height, width) with its params below the
+// base pointer
+const INVERT_FILTER_PROGRAM = `
+(module
+  (import "js" "mem" (memory 1))
+  (import "pix_n_flix" "install_filter" (func $install_filter (param i32)))
+  (global $bp (import "js" "bp") (mut i32))
+  (import "js" "function_table" (table 1 funcref))
+  (elem (i32.const 0) $invert)
+  (func $invert (local $src i32) (local $dest i32) (local $size i32) (local $i i32)
+    (local.set $src (i32.load (i32.sub (global.get $bp) (i32.const 4))))
+    (local.set $dest (i32.load (i32.sub (global.get $bp) (i32.const 8))))
+    (local.set $size
+      (i32.mul
+        (i32.mul
+          (i32.load (i32.sub (global.get $bp) (i32.const 12)))
+          (i32.load (i32.sub (global.get $bp) (i32.const 16))))
+        (i32.const 4)))
+    (block $done
+      (loop $next
+        (br_if $done (i32.ge_u (local.get $i) (local.get $size)))
+        (i32.store8
+          (i32.add (local.get $dest) (local.get $i))
+          (i32.sub
+            (i32.const 255)
+            (i32.load8_u (i32.add (local.get $src) (local.get $i)))))
+        (local.set $i (i32.add (local.get $i) (i32.const 1)))
+        (br $next))))
+  (func $main (call $install_filter (i32.const 0)))
+  (start $main))
+`;
+
+describe("Filter pipeline in a worker thread", () => {
+  test("Frames are filtered by the program installed in the worker", async () => {
+    const program = {
+      wasm: await assemble(INVERT_FILTER_PROGRAM),
+      dataSegmentSize: 0,
+      functionTableSize: 1,
+      importedModules: ["pix_n_flix"],
+    };
+    const filteredFrames = [];
+    const pipeline = await FilterPipeline.start(
+      fromNodeWorker(startWorker("pixNFlixWorker.js")),
+      program,
+      {
+        height: 2,
+        width: 3,
+        fps: 1, // so that no frame goes over budget on a slow machine
+        onFrame: (frame) => filteredFrames.push(Array.from(frame)),
+      },
+    );
+    try {
+      const frame = Array.from({ length: 2 * 3 * 4 }, (_, i) => i * 10);
+      for (let i = 0; i < 2; ++i) {
+        expect(pipeline.submitFrame(frame)).toBe(true);
+        await pipeline.whenIdle();
+      }
+      const expectedFrame = frame.map((value) => 255 - value);
+      expect(filteredFrames).toEqual([expectedFrame, expectedFrame]);
+      expect(pipeline.getTelemetry()).toMatchObject({
+        framesSubmitted: 2,
+        framesFiltered: 2,
+        framesDropped: 0,
+        queueDepth: 0,
+      });
+    } finally {
+      pipeline.stop();
+    }
+  });
+});
+
+/**
+ * Returns a program that prints each of the given ints, then traps if trap is set.
+ */
+async function createPrintingProgram(ints, trap = false) {
+  return {
+    wasm: await assemble(`
+(module
+  (import "js" "mem" (memory 1))
+  (import "source_stdlib" "print_int" (func $print_int (param i32)))
+  (import "js" "function_table" (table 0 funcref))
+  (func $main
+    ${ints.map((int) => `(call $print_int (i32.const ${int}))`).join("\n    ")}
+    ${trap ? "(unreachable)" : ""})
+  (start $main))
+`),
+    dataSegmentSize: 0,
+    functionTableSize: 0,
+    importedModules: ["source_stdlib"],
+  };
+}
+
+describe("Programs in a worker thread", () => {
+  test("Programs run to completion in the worker, with their output streamed back", async () => {
+    const output = [];
+    const result = await WorkerRun.start(
+      fromNodeWorker(startWorker("programWorker.js")),
+      await createPrintingProgram([1, 23]),
+      { printFunction: (str) => output.push(str) },
+    ).result;
+    expect(result.status).toBe("success");
+    expect(output).toEqual(["1", "23"]);
+  });
+
+  test("Runtime errors in the worker are reported", async () => {
+    const output = [];
+    const result = await WorkerRun.start(
+      fromNodeWorker(startWorker("programWorker.js")),
+      await createPrintingProgram([1], true),
+      { printFunction: (str) => output.push(str) },
+    ).result;
+    expect(result).toMatchObject({
+      status: "error",
+      errorMessage: "unreachable",
+    });
+    expect(output).toEqual(["1"]);
+  });
+
+  test("Workers that exit or throw without responding end the run with an error", async () => {
+    const program = await createPrintingProgram([]);
+    const exited = await WorkerRun.start(
+      fromNodeWorker(new Worker("process.exit(3)", { eval: true })),
+      program,
+    ).result;
+    expect(exited).toMatchObject({
+      status: "error",
+      errorMessage: "worker exited with code 3",
+    });
+    const threw = await WorkerRun.start(
+      fromNodeWorker(new Worker("throw new Error('broken')", { eval: true })),
+      program,
+    ).result;
+    expect(threw).toMatchObject({ status: "error", errorMessage: "broken" });
+  });
+});
+
+const NUM_THREADS = 4;
+
+/**
+ * Compiles the given C program with the threads option and runs it, with a worker started by startThreadWorker for
+ * each thread. Returns the result of the run and its output.
+ */
+async function runThreadedProgram(
+  source,
+  startThreadWorker = () => startWorker("programWorker.js"),
+) {
+  const program = await compile(source, undefined, { threads: true });
+  expect(program).toMatchObject({ status: "success" });
+  const output = [];
+  const result = await WorkerRun.start(
+    fromNodeWorker(startWorker("programWorker.js")),
+    program,
+    {
+      printFunction: (str) => output.push(str),
+      spawnThreadWorker: () => fromNodeWorker(startThreadWorker()),
+    },
+  ).result;
+  return { result, output };
+}
+
+describe("Threaded programs in worker threads", () => {
+  test("Threads increment a counter under a mutex", async () => {
+    const { result, output } = await runThreadedProgram(`
+#include <source_stdlib>
+#include <pthread>
+
+int counter = 0;
+int mutex;
+
+void *increment(void *arg) {
+  for (int i = 0; i < 10000; ++i) {
+    pthread_mutex_lock(&mutex);
+    ++counter;
+    pthread_mutex_unlock(&mutex);
+  }
+  return arg;
+}
+
+int main() {
+  unsigned int threads[${NUM_THREADS}];
+  pthread_mutex_init(&mutex, 0);
+  for (int i = 0; i < ${NUM_THREADS}; ++i) {
+    pthread_create(&threads[i], 0, increment, 0);
+  }
+  for (int i = 0; i < ${NUM_THREADS}; ++i) {
+    pthread_join(threads[i], 0);
+  }
+  print_int(counter);
+}
+`);
+    expect(result.status).toBe("success");
+    expect(output).toEqual([String(NUM_THREADS * 10000)]);
+  });
+
+  test("Threads malloc from the shared heap at the same time without overlapping blocks", async () => {
+    // every thread fills its blocks with its own number, then checks them once all threads have allocated theirs
+    const { result, output } = await runThreadedProgram(`
+#include <source_stdlib>
+#include <pthread>
+
+int numAllocated = 0;
+
+void *allocate(void *arg) {
+  int *result = arg;
+  int n = *result;
+  int *blocks[200];
+  for (int i = 0; i < 200; ++i) {
+    blocks[i] = malloc(4 * (1 + i % 5));
+    for (int j = 0; j < 1 + i % 5; ++j) {
+      blocks[i][j] = n;
+    }
+  }
+  atomic_fetch_add(&numAllocated, 1);
+  while (atomic_load(&numAllocated) < ${NUM_THREADS}) {
+  }
+  int numCorrupted = 0;
+  for (int i = 0; i < 200; ++i) {
+    for (int j = 0; j < 1 + i % 5; ++j) {
+      if (blocks[i][j] != n) {
+        ++numCorrupted;
+      }
+    }
+    free(blocks[i]);
+  }
+  *result = numCorrupted;
+  return arg;
+}
+
+int main() {
+  unsigned int threads[${NUM_THREADS}];
+  int args[${NUM_THREADS}];
+  for (int i = 0; i < ${NUM_THREADS}; ++i) {
+    args[i] = i + 1;
+    pthread_create(&threads[i], 0, allocate, &args[i]);
+  }
+  int numCorrupted = 0;
+  for (int i = 0; i < ${NUM_THREADS}; ++i) {
+    pthread_join(threads[i], 0);
+    numCorrupted += args[i];
+  }
+  print_int(numCorrupted);
+}
+`);
+    expect(result.status).toBe("success");
+    expect(output).toEqual(["0"]);
+  });
+
+  test("Joiners of a thread whose worker exits are woken up with an error", async () => {
+    const { result, output } = await runThreadedProgram(
+      `
+#include <source_stdlib>
+#include <pthread>
+
+void *run(void *arg) {
+  return arg;
+}
+
+int main() {
+  unsigned int thread;
+  pthread_create(&thread, 0, run, 0);
+  print_int(1);
+  pthread_join(thread, 0);
+  print_int(2);
+}
+`,
+      () => new Worker("process.exit(3)", { eval: true }),
+    );
+    expect(result.status).toBe("error");
+    expect(result.errorMessage).toMatch(
+      /^pthread_join\(\): thread \d+ ended with an error$/,
+    );
+    expect(output).toEqual(["1"]);
+  });
+});